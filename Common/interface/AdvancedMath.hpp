@@ -30,6 +30,9 @@
 #include <float.h>
 #include <vector>
 #include <type_traits>
+#include <algorithm>
+#include <functional>
+#include <cmath>
 
 #include "../../Platforms/interface/PlatformDefinitions.h"
 #include "../../Primitives/interface/FlagEnum.h"
@@ -1251,14 +1254,24 @@ enum TRIANGULATE_POLYGON_RESULT : Uint32
     TRIANGULATE_POLYGON_RESULT_INVALID_EAR = 1u << 3u,
 
     /// No ear vertex was found at one of the steps.
-    TRIANGULATE_POLYGON_RESULT_NO_EAR_FOUND = 1u << 4u
+    TRIANGULATE_POLYGON_RESULT_NO_EAR_FOUND = 1u << 4u,
+
+    /// One or more holes could not be connected to the outer polygon,
+    /// e.g. because they are not inside it. Such holes are ignored.
+    TRIANGULATE_POLYGON_RESULT_HOLE_NOT_BRIDGED = 1u << 5u
 };
 DEFINE_FLAG_ENUM_OPERATORS(TRIANGULATE_POLYGON_RESULT);
 
 /// 2D polygon triangulator.
 ///
 /// The class implements the ear-clipping algorithm to triangulate simple (i.e.
-/// non-self-intersecting) 2D polygons.
+/// non-self-intersecting) 2D polygons, optionally with holes.
+///
+/// The ear tests only visit the vertices in the cells of a uniform grid that overlap
+/// the tested triangle, and the ears are clipped from a linked list in the order of their
+/// indices, which makes the result identical to the straightforward O(N^2) implementation
+/// while large polygons are triangulated much faster. The triangulator keeps its scratch buffers between calls,
+/// so it is recommended to reuse the same object to triangulate multiple polygons.
 ///
 /// \tparam IndexType - Index type (e.g. Uint32 or Uint16).
 template <typename IndexType>
@@ -1281,22 +1294,105 @@ public:
     ///             that it does not self-intersect.
     template <typename ComponentType>
     const std::vector<IndexType>& Triangulate(const std::vector<Vector2<ComponentType>>& Polygon)
+    {
+        TriangulateImpl<ComponentType>(Polygon.data(), static_cast<int>(Polygon.size()));
+        return m_Triangles;
+    }
+
+    /// Triangulates a simple polygon with holes.
+
+    /// \tparam [in] ComponentType - Vertex component type (e.g. float, double or int).
+    ///
+    /// \param [in]  Polygon   - A list of outer polygon vertices. The last vertex is
+    ///                          assumed to be connected to the first one.
+    /// \param [in]  Holes     - A list of holes. Every hole is a simple polygon that
+    ///                          lies strictly inside the outer polygon and does not
+    ///                          intersect other holes. The winding order of holes is
+    ///                          irrelevant.
+    ///
+    /// \return     The triangle list. The indices refer to the outer polygon vertices
+    ///             followed by the vertices of all holes in order.
+    ///
+    /// \remarks    Every hole is connected to the outer polygon with a pair of coincident
+    ///             bridge edges, after which the resulting polygon is triangulated.
+    ///             The winding order of each triangle is the same as the winding
+    ///             order of the outer polygon.
+    ///
+    ///             Holes with fewer than three vertices are ignored. If a hole can't
+    ///             be connected to the outer polygon, it is ignored as well and
+    ///             GetResult() returns TRIANGULATE_POLYGON_RESULT_HOLE_NOT_BRIDGED.
+    template <typename ComponentType>
+    const std::vector<IndexType>& Triangulate(const std::vector<Vector2<ComponentType>>&              Polygon,
+                                              const std::vector<std::vector<Vector2<ComponentType>>>& Holes)
+    {
+        if (Holes.empty())
+            return Triangulate(Polygon);
+
+        // All source vertices: the outer polygon followed by the holes.
+        // The vertices are referenced rather than copied, so that no memory is allocated
+        // once the scratch buffers are large enough.
+        m_SrcVertPtrs.clear();
+        for (const auto& Vert : Polygon)
+            m_SrcVertPtrs.push_back(&Vert);
+        for (const auto& Hole : Holes)
+        {
+            for (const auto& Vert : Hole)
+                m_SrcVertPtrs.push_back(&Vert);
+        }
+
+        const bool AllHolesBridged = BridgeHoles(IndirectVertexArray<ComponentType>{m_SrcVertPtrs.data()}, static_cast<int>(Polygon.size()), Holes);
+
+        m_MergedVertPtrs.resize(m_MergedVertIds.size());
+        for (size_t i = 0; i < m_MergedVertIds.size(); ++i)
+            m_MergedVertPtrs[i] = m_SrcVertPtrs[m_MergedVertIds[i]];
+
+        TriangulateImpl<ComponentType>(IndirectVertexArray<ComponentType>{m_MergedVertPtrs.data()}, static_cast<int>(m_MergedVertPtrs.size()));
+        for (auto& Idx : m_Triangles)
+            Idx = static_cast<IndexType>(m_MergedVertIds[Idx]);
+
+        if (!AllHolesBridged)
+            m_Result |= TRIANGULATE_POLYGON_RESULT_HOLE_NOT_BRIDGED;
+
+        return m_Triangles;
+    }
+
+    TRIANGULATE_POLYGON_RESULT GetResult() const { return m_Result; }
+
+protected:
+    TRIANGULATE_POLYGON_RESULT m_Result = TRIANGULATE_POLYGON_RESULT_OK;
+    std::vector<IndexType>     m_Triangles;
+
+private:
+    // Array of polygon vertices referenced through pointers
+    template <typename ComponentType>
+    struct IndirectVertexArray
+    {
+        const void* const* ppVerts;
+
+        const Vector2<ComponentType>& operator[](int Idx) const
+        {
+            return *static_cast<const Vector2<ComponentType>*>(ppVerts[Idx]);
+        }
+    };
+
+    // VertexArrayType is either a pointer to the vertices or IndirectVertexArray
+    template <typename ComponentType, typename VertexArrayType>
+    void TriangulateImpl(const VertexArrayType& Polygon, const int VertCount)
     {
         m_Result = TRIANGULATE_POLYGON_RESULT_OK;
         m_Triangles.clear();
 
-        const int VertCount = static_cast<int>(Polygon.size());
         if (VertCount <= 2)
         {
             m_Result = TRIANGULATE_POLYGON_RESULT_TOO_FEW_VERTS;
-            return m_Triangles;
+            return;
         }
 
         const int TriangleCount = VertCount - 2;
         if (TriangleCount == 1)
         {
             m_Triangles = {0, 1, 2};
-            return m_Triangles;
+            return;
         }
 
         // Find the leftmost vertex to determine the winding order
@@ -1341,24 +1437,30 @@ public:
         if (PolygonWinding == 0)
         {
             m_Result = TRIANGULATE_POLYGON_RESULT_VERTS_COLLINEAR;
-            return m_Triangles;
+            return;
         }
         PolygonWinding = PolygonWinding > ComponentType{0} ? ComponentType{1} : ComponentType{-1};
 
-        m_RemainingVertIds.resize(VertCount);
+        // Remaining vertices form a doubly-linked list sorted by vertex index (except for the wrap-around).
+        // Removed vertices have negative links.
+        m_PrevVert.resize(VertCount);
+        m_NextVert.resize(VertCount);
         m_VertTypes.resize(VertCount);
         for (int i = 0; i < VertCount; ++i)
         {
-            m_RemainingVertIds[i] = i;
-            m_VertTypes[i]        = VertexType::Convexx;
+            m_PrevVert[i]  = WrapIndex(i - 1, VertCount);
+            m_NextVert[i]  = WrapIndex(i + 1, VertCount);
+            m_VertTypes[i] = VertexType::Convexx;
         }
+        // The remaining vertex with the smallest index
+        int FirstVert          = 0;
+        int RemainingVertCount = VertCount;
 
-        auto CheckConvex = [&](int vert_id) {
-            const int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
+        InitVertexGrid(Polygon, VertCount);
 
-            const int Idx0 = m_RemainingVertIds[WrapIndex(vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[WrapIndex(vert_id + 0, RemainingVertCount)];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(vert_id + 1, RemainingVertCount)];
+        auto CheckConvex = [&](int Idx1) {
+            const int Idx0 = m_PrevVert[Idx1];
+            const int Idx2 = m_NextVert[Idx1];
 
             const auto& V0 = Polygon[Idx0];
             const auto& V1 = Polygon[Idx1];
@@ -1369,12 +1471,9 @@ public:
                 VertexType::Convexx;
         };
 
-        auto CheckEar = [&](int vert_id) {
-            const int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
-
-            const int Idx0 = m_RemainingVertIds[WrapIndex(vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[WrapIndex(vert_id + 0, RemainingVertCount)];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(vert_id + 1, RemainingVertCount)];
+        auto CheckEar = [&](int Idx1) {
+            const int Idx0 = m_PrevVert[Idx1];
+            const int Idx2 = m_NextVert[Idx1];
 
             VERIFY_EXPR(m_VertTypes[Idx1] == VertexType::Convexx);
 
@@ -1382,38 +1481,99 @@ public:
             const auto& V1 = Polygon[Idx1];
             const auto& V2 = Polygon[Idx2];
 
-            for (const int Idx : m_RemainingVertIds)
-            {
-                if (Idx == Idx0 || Idx == Idx1 || Idx == Idx2)
-                    continue;
+            // Only the vertices in the grid cells overlapped by the triangle may be inside the triangle
+            const Vector2<double> TriVerts[] = {
+                {static_cast<double>(V0.x), static_cast<double>(V0.y)},
+                {static_cast<double>(V1.x), static_cast<double>(V1.y)},
+                {static_cast<double>(V2.x), static_cast<double>(V2.y)},
+            };
 
-                if (m_VertTypes[Idx] == VertexType::Convexx || m_VertTypes[Idx] == VertexType::Ear)
+            const int MinCellY = GetGridCellY((std::min)((std::min)(TriVerts[0].y, TriVerts[1].y), TriVerts[2].y));
+            const int MaxCellY = GetGridCellY((std::max)((std::max)(TriVerts[0].y, TriVerts[1].y), TriVerts[2].y));
+            for (int CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+            {
+                // Find the range of cells in this row that overlap the triangle. Long thin triangles
+                // are common in large polygons, so this is much tighter than the bounding box.
+                // The row is slightly expanded to account for rounding errors.
+                const double RowMinY = CellY == MinCellY ? -DBL_MAX : m_GridMinY + (CellY - 0.01) * m_GridCellSize;
+                const double RowMaxY = CellY == MaxCellY ? +DBL_MAX : m_GridMinY + (CellY + 1.01) * m_GridCellSize;
+
+                double RowMinX = +DBL_MAX;
+                double RowMaxX = -DBL_MAX;
+                for (int e = 0; e < 3; ++e)
                 {
-#ifdef DILIGENT_DEVELOPMENT
-                    // This check may fail due to floating point imprecision if there are collinear vertices.
-                    if (IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false))
+                    const Vector2<double>& A = TriVerts[e];
+                    const Vector2<double>& B = TriVerts[(e + 1) % 3];
+
+                    const double EdgeMinY = (std::max)((std::min)(A.y, B.y), RowMinY);
+                    const double EdgeMaxY = (std::min)((std::max)(A.y, B.y), RowMaxY);
+                    if (EdgeMinY > EdgeMaxY)
+                        continue;
+
+                    double X0 = A.x;
+                    double X1 = B.x;
+                    if (A.y != B.y)
                     {
-                        // Convex and ear vertices must always be outside the triangle
-                        m_Result |= (m_VertTypes[Idx] == VertexType::Convexx) ?
-                            TRIANGULATE_POLYGON_RESULT_INVALID_CONVEX :
-                            TRIANGULATE_POLYGON_RESULT_INVALID_EAR;
+                        X0 = A.x + (B.x - A.x) * (EdgeMinY - A.y) / (B.y - A.y);
+                        X1 = A.x + (B.x - A.x) * (EdgeMaxY - A.y) / (B.y - A.y);
                     }
-#endif
-                    continue;
+                    RowMinX = (std::min)(RowMinX, (std::min)(X0, X1));
+                    RowMaxX = (std::max)(RowMaxX, (std::max)(X0, X1));
                 }
+                if (RowMinX > RowMaxX)
+                    continue;
 
-                // Do not treat vertices exactly on the edge as inside the triangle,
-                // so that we can clip out degenerate triangles.
-                if (IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false))
+                const int MinCellX = GetGridCellX(RowMinX - 0.01 * m_GridCellSize);
+                const int MaxCellX = GetGridCellX(RowMaxX + 0.01 * m_GridCellSize);
+                for (int CellX = MinCellX; CellX <= MaxCellX; ++CellX)
                 {
-                    // The vertex is inside the triangle
-                    return VertexType::Convexx;
+                    const int Cell = CellX + CellY * m_GridWidth;
+                    for (int i = m_GridCellStart[Cell]; i < m_GridCellStart[Cell + 1]; ++i)
+                    {
+                        const int Idx = m_GridCellVerts[i];
+                        if (m_PrevVert[Idx] < 0)
+                            continue; // The vertex has been clipped
+
+                        if (Idx == Idx0 || Idx == Idx1 || Idx == Idx2)
+                            continue;
+
+                        if (m_VertTypes[Idx] == VertexType::Convexx || m_VertTypes[Idx] == VertexType::Ear)
+                        {
+#ifdef DILIGENT_DEVELOPMENT
+                            // This check may fail due to floating point imprecision if there are collinear vertices.
+                            if (IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false))
+                            {
+                                // Convex and ear vertices must always be outside the triangle
+                                m_Result |= (m_VertTypes[Idx] == VertexType::Convexx) ?
+                                    TRIANGULATE_POLYGON_RESULT_INVALID_CONVEX :
+                                    TRIANGULATE_POLYGON_RESULT_INVALID_EAR;
+                            }
+#endif
+                            continue;
+                        }
+
+                        // Do not treat vertices exactly on the edge as inside the triangle,
+                        // so that we can clip out degenerate triangles.
+                        if (IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false))
+                        {
+                            // The vertex is inside the triangle
+                            return VertexType::Convexx;
+                        }
+                    }
                 }
             }
 
             return VertexType::Ear;
         };
 
+        // Ears are kept in a min-heap to always clip the ear with the smallest index.
+        // Vertices that are no longer ears are removed from the heap lazily.
+        m_EarHeap.clear();
+        auto PushEar = [this](int Idx) {
+            m_EarHeap.push_back(Idx);
+            std::push_heap(m_EarHeap.begin(), m_EarHeap.end(), std::greater<int>{});
+        };
+
         // First label vertices as reflex or convex
         for (int vert_id = 0; vert_id < VertCount; ++vert_id)
         {
@@ -1425,74 +1585,323 @@ public:
         {
             VertexType& VertType = m_VertTypes[vert_id];
             if (VertType == VertexType::Convexx)
+            {
                 VertType = CheckEar(vert_id);
+                if (VertType == VertexType::Ear)
+                    PushEar(vert_id);
+            }
         }
 
-        m_Triangles.clear();
         m_Triangles.reserve(TriangleCount * 3);
 
         // Clip ears one by one until only three vertices are left
-        while (m_RemainingVertIds.size() > 3)
+        while (RemainingVertCount > 3)
         {
-            int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
-
             // Find the first ear
-            int ear_vert_id = 0;
-            for (; ear_vert_id < RemainingVertCount; ++ear_vert_id)
+            while (!m_EarHeap.empty() && (m_PrevVert[m_EarHeap.front()] < 0 || m_VertTypes[m_EarHeap.front()] != VertexType::Ear))
             {
-                const int Idx = m_RemainingVertIds[ear_vert_id];
-                if (m_VertTypes[Idx] == VertexType::Ear)
-                    break;
-            };
+                std::pop_heap(m_EarHeap.begin(), m_EarHeap.end(), std::greater<int>{});
+                m_EarHeap.pop_back();
+            }
 
-            if (ear_vert_id == RemainingVertCount)
+            int EarIdx = FirstVert;
+            if (!m_EarHeap.empty())
+            {
+                EarIdx = m_EarHeap.front();
+            }
+            else
             {
                 // No ears found
                 m_Result |= TRIANGULATE_POLYGON_RESULT_NO_EAR_FOUND;
-                ear_vert_id = 0;
             }
 
-            const int Idx0 = m_RemainingVertIds[WrapIndex(ear_vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[ear_vert_id];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(ear_vert_id + 1, RemainingVertCount)];
+            const int Idx0 = m_PrevVert[EarIdx];
+            const int Idx2 = m_NextVert[EarIdx];
+
+            m_Triangles.emplace_back(static_cast<IndexType>(Idx0));
+            m_Triangles.emplace_back(static_cast<IndexType>(EarIdx));
+            m_Triangles.emplace_back(static_cast<IndexType>(Idx2));
 
-            m_Triangles.emplace_back(Idx0);
-            m_Triangles.emplace_back(Idx1);
-            m_Triangles.emplace_back(Idx2);
-            m_RemainingVertIds.erase(m_RemainingVertIds.begin() + ear_vert_id);
+            m_NextVert[Idx0]   = Idx2;
+            m_PrevVert[Idx2]   = Idx0;
+            m_PrevVert[EarIdx] = -1;
+            m_NextVert[EarIdx] = -1;
+            if (EarIdx == FirstVert)
+                FirstVert = Idx2;
 
             --RemainingVertCount;
             // Update adjacent vertices
             if (RemainingVertCount > 3)
             {
-                const int IdxL = m_RemainingVertIds[WrapIndex(ear_vert_id - 1, RemainingVertCount)];
-                const int IdxR = m_RemainingVertIds[WrapIndex(ear_vert_id, RemainingVertCount)];
                 // First check for convex vs reflex
-                m_VertTypes[IdxL] = CheckConvex(ear_vert_id - 1);
-                m_VertTypes[IdxR] = CheckConvex(ear_vert_id);
+                m_VertTypes[Idx0] = CheckConvex(Idx0);
+                m_VertTypes[Idx2] = CheckConvex(Idx2);
 
                 // Next, check for ears
-                if (m_VertTypes[IdxL] == VertexType::Convexx)
-                    m_VertTypes[IdxL] = CheckEar(ear_vert_id - 1);
-                if (m_VertTypes[IdxR] == VertexType::Convexx)
-                    m_VertTypes[IdxR] = CheckEar(ear_vert_id);
+                if (m_VertTypes[Idx0] == VertexType::Convexx)
+                {
+                    m_VertTypes[Idx0] = CheckEar(Idx0);
+                    if (m_VertTypes[Idx0] == VertexType::Ear)
+                        PushEar(Idx0);
+                }
+                if (m_VertTypes[Idx2] == VertexType::Convexx)
+                {
+                    m_VertTypes[Idx2] = CheckEar(Idx2);
+                    if (m_VertTypes[Idx2] == VertexType::Ear)
+                        PushEar(Idx2);
+                }
             }
         }
 
-        m_Triangles.emplace_back(m_RemainingVertIds[0]);
-        m_Triangles.emplace_back(m_RemainingVertIds[1]);
-        m_Triangles.emplace_back(m_RemainingVertIds[2]);
+        m_Triangles.emplace_back(static_cast<IndexType>(FirstVert));
+        m_Triangles.emplace_back(static_cast<IndexType>(m_NextVert[FirstVert]));
+        m_Triangles.emplace_back(static_cast<IndexType>(m_NextVert[m_NextVert[FirstVert]]));
+    }
 
-        return m_Triangles;
+    // Sorts polygon vertices into a uniform grid with roughly two vertices per cell.
+    template <typename VertexArrayType>
+    void InitVertexGrid(const VertexArrayType& Polygon, const int VertCount)
+    {
+        double MinX = static_cast<double>(Polygon[0].x);
+        double MinY = static_cast<double>(Polygon[0].y);
+        double MaxX = MinX;
+        double MaxY = MinY;
+        for (int i = 1; i < VertCount; ++i)
+        {
+            MinX = (std::min)(MinX, static_cast<double>(Polygon[i].x));
+            MinY = (std::min)(MinY, static_cast<double>(Polygon[i].y));
+            MaxX = (std::max)(MaxX, static_cast<double>(Polygon[i].x));
+            MaxY = (std::max)(MaxY, static_cast<double>(Polygon[i].y));
+        }
+
+        const double ExtentX     = MaxX - MinX;
+        const double ExtentY     = MaxY - MinY;
+        const double TargetCells = (std::max)(VertCount / 2, 1);
+        // The polygon may be degenerate in one of the dimensions
+        const double CellSize = (ExtentX > 0 && ExtentY > 0) ?
+            std::sqrt(ExtentX * ExtentY / TargetCells) :
+            (std::max)(ExtentX, ExtentY) / TargetCells;
+
+        m_GridMinX      = MinX;
+        m_GridMinY      = MinY;
+        m_GridWidth     = CellSize > 0 ? static_cast<int>((std::min)(ExtentX / CellSize, TargetCells)) + 1 : 1;
+        m_GridHeight    = CellSize > 0 ? static_cast<int>((std::min)(ExtentY / CellSize, TargetCells)) + 1 : 1;
+        m_GridCellSize  = CellSize;
+        m_GridInvCellSz = CellSize > 0 ? 1.0 / CellSize : 0.0;
+
+        // Counting sort of the vertices by cell
+        const int NumCells = m_GridWidth * m_GridHeight;
+        m_GridCellStart.assign(NumCells + 1, 0);
+        m_GridCellVerts.resize(VertCount);
+        m_VertCells.resize(VertCount);
+        for (int i = 0; i < VertCount; ++i)
+        {
+            const int Cell =
+                GetGridCellX(static_cast<double>(Polygon[i].x)) +
+                GetGridCellY(static_cast<double>(Polygon[i].y)) * m_GridWidth;
+            m_VertCells[i] = Cell;
+            ++m_GridCellStart[Cell + 1];
+        }
+        for (int Cell = 0; Cell < NumCells; ++Cell)
+            m_GridCellStart[Cell + 1] += m_GridCellStart[Cell];
+        for (int i = 0; i < VertCount; ++i)
+            m_GridCellVerts[m_GridCellStart[m_VertCells[i]]++] = i;
+        // Restore the cell start offsets shifted by the loop above
+        for (int Cell = NumCells; Cell > 0; --Cell)
+            m_GridCellStart[Cell] = m_GridCellStart[Cell - 1];
+        m_GridCellStart[0] = 0;
     }
 
-    TRIANGULATE_POLYGON_RESULT GetResult() const { return m_Result; }
+    // Cell coordinates are monotonic in the point coordinates, so a point inside
+    // a bounding box is always in one of the cells covered by the box.
+    int GetGridCellX(double x) const
+    {
+        return clamp(static_cast<int>((x - m_GridMinX) * m_GridInvCellSz), 0, m_GridWidth - 1);
+    }
+    int GetGridCellY(double y) const
+    {
+        return clamp(static_cast<int>((y - m_GridMinY) * m_GridInvCellSz), 0, m_GridHeight - 1);
+    }
 
-protected:
-    TRIANGULATE_POLYGON_RESULT m_Result = TRIANGULATE_POLYGON_RESULT_OK;
-    std::vector<IndexType>     m_Triangles;
+    // Connects the holes to the outer polygon with bridge edges using the algorithm by David Eberly
+    // (Triangulation by Ear Clipping, 2002) and writes the source vertex indices of the resulting
+    // polygon to m_MergedVertIds. Returns false if some of the holes could not be connected.
+    template <typename ComponentType>
+    bool BridgeHoles(const IndirectVertexArray<ComponentType>&               SrcVerts,
+                     const int                                               OuterVertCount,
+                     const std::vector<std::vector<Vector2<ComponentType>>>& Holes)
+    {
+        auto GetSignedArea = [&](int Start, int Count) {
+            double Area = 0;
+            for (int i = 0; i < Count; ++i)
+            {
+                const auto& V0 = SrcVerts[Start + i];
+                const auto& V1 = SrcVerts[Start + (i + 1) % Count];
+                Area += static_cast<double>(V0.x) * static_cast<double>(V1.y) - static_cast<double>(V1.x) * static_cast<double>(V0.y);
+            }
+            return Area;
+        };
+
+        m_MergedVertIds.resize(OuterVertCount);
+        for (int i = 0; i < OuterVertCount; ++i)
+            m_MergedVertIds[i] = i;
+        const bool OuterIsCCW = GetSignedArea(0, OuterVertCount) > 0;
+
+        m_HoleInfos.clear();
+        int Start = OuterVertCount;
+        for (const auto& Hole : Holes)
+        {
+            const int Count = static_cast<int>(Hole.size());
+            if (Count >= 3)
+            {
+                int RightmostVert = Start;
+                for (int i = Start + 1; i < Start + Count; ++i)
+                {
+                    if (SrcVerts[i].x > SrcVerts[RightmostVert].x)
+                        RightmostVert = i;
+                }
+                m_HoleInfos.push_back({Start, Count, RightmostVert});
+            }
+            Start += Count;
+        }
+        // Process holes from right to left so that every bridge only crosses the outer polygon
+        // and the holes that have already been merged into it
+        std::sort(m_HoleInfos.begin(), m_HoleInfos.end(), [&](const HoleInfo& H0, const HoleInfo& H1) {
+            return SrcVerts[H0.RightmostVert].x > SrcVerts[H1.RightmostVert].x;
+        });
+
+        bool AllHolesBridged = true;
+        for (const auto& Hole : m_HoleInfos)
+        {
+            const double Mx = static_cast<double>(SrcVerts[Hole.RightmostVert].x);
+            const double My = static_cast<double>(SrcVerts[Hole.RightmostVert].y);
+
+            // Cast a ray from the rightmost hole vertex M in the +X direction and find the closest edge it hits
+            const int MergedCount  = static_cast<int>(m_MergedVertIds.size());
+            int       BridgePos    = -1;
+            double    ClosestHitX  = DBL_MAX;
+            int       EdgeStartPos = -1;
+            for (int i = 0; i < MergedCount; ++i)
+            {
+                const auto&  A  = SrcVerts[m_MergedVertIds[i]];
+                const auto&  B  = SrcVerts[m_MergedVertIds[(i + 1) % MergedCount]];
+                const double Ax = static_cast<double>(A.x);
+                const double Ay = static_cast<double>(A.y);
+                const double Bx = static_cast<double>(B.x);
+                const double By = static_cast<double>(B.y);
+                if ((Ay > My && By > My) || (Ay < My && By < My) || Ay == By)
+                    continue;
+
+                const double HitX = Ax + (My - Ay) * (Bx - Ax) / (By - Ay);
+                if (HitX < Mx || HitX >= ClosestHitX)
+                    continue;
+
+                ClosestHitX  = HitX;
+                EdgeStartPos = i;
+                if (Ay == My && Ax == HitX)
+                    BridgePos = i;
+                else if (By == My && Bx == HitX)
+                    BridgePos = (i + 1) % MergedCount;
+                else
+                    BridgePos = -1;
+            }
+            if (EdgeStartPos < 0)
+            {
+                // The hole is not inside the outer polygon
+                AllHolesBridged = false;
+                continue;
+            }
+
+            if (BridgePos < 0)
+            {
+                // Select the edge endpoint P with the maximum X. If there are no other polygon vertices
+                // inside the triangle formed by M, the hit point I and P, then P is visible from M.
+                // Otherwise, select the vertex inside the triangle that has the minimum angle with the ray.
+                const int   PosA = EdgeStartPos;
+                const int   PosB = (EdgeStartPos + 1) % MergedCount;
+                const auto& A    = SrcVerts[m_MergedVertIds[PosA]];
+                const auto& B    = SrcVerts[m_MergedVertIds[PosB]];
+                BridgePos        = A.x > B.x ? PosA : PosB;
+
+                const Vector2<double> M{Mx, My};
+                const Vector2<double> I{ClosestHitX, My};
+                const Vector2<double> P{static_cast<double>(SrcVerts[m_MergedVertIds[BridgePos]].x), static_cast<double>(SrcVerts[m_MergedVertIds[BridgePos]].y)};
+
+                double BestTan  = DBL_MAX;
+                double BestDist = DBL_MAX;
+                for (int i = 0; i < MergedCount; ++i)
+                {
+                    if (i == BridgePos)
+                        continue;
+                    const auto&           V = SrcVerts[m_MergedVertIds[i]];
+                    const Vector2<double> R{static_cast<double>(V.x), static_cast<double>(V.y)};
+                    if (R == P || !IsPointInsideTriangle(M, I, P, R, /*AllowEdges = */ true))
+                        continue;
+
+                    const double Dx   = R.x - M.x;
+                    const double Tan  = Dx > 0 ? std::abs(R.y - M.y) / Dx : DBL_MAX;
+                    const double Dist = Dx * Dx + (R.y - M.y) * (R.y - M.y);
+                    if (Tan < BestTan || (Tan == BestTan && Dist < BestDist))
+                    {
+                        BestTan   = Tan;
+                        BestDist  = Dist;
+                        BridgePos = i;
+                    }
+                }
+            }
+
+            // The bridge vertex may occur in the polygon multiple times if other holes have already been
+            // connected to it. Select the occurrence whose interior angle contains the bridge direction.
+            {
+                const int    BridgeVertId = m_MergedVertIds[BridgePos];
+                const auto&  P            = SrcVerts[BridgeVertId];
+                const double Sign         = OuterIsCCW ? 1.0 : -1.0;
+                const double Dx           = Mx - static_cast<double>(P.x);
+                const double Dy           = My - static_cast<double>(P.y);
+                for (int i = 0; i < MergedCount; ++i)
+                {
+                    if (m_MergedVertIds[i] != BridgeVertId)
+                        continue;
+
+                    const auto&  Prev = SrcVerts[m_MergedVertIds[(i + MergedCount - 1) % MergedCount]];
+                    const auto&  Next = SrcVerts[m_MergedVertIds[(i + 1) % MergedCount]];
+                    const double Ax   = static_cast<double>(Prev.x) - static_cast<double>(P.x);
+                    const double Ay   = static_cast<double>(Prev.y) - static_cast<double>(P.y);
+                    const double Bx   = static_cast<double>(Next.x) - static_cast<double>(P.x);
+                    const double By   = static_cast<double>(Next.y) - static_cast<double>(P.y);
+
+                    // The interior angle goes from the next edge to the previous edge in the polygon winding direction
+                    const bool IsConvex = (Bx * Ay - By * Ax) * Sign >= 0;
+                    const bool IsInside = IsConvex ?
+                        (Bx * Dy - By * Dx) * Sign >= 0 && (Dx * Ay - Dy * Ax) * Sign >= 0 :
+                        (Bx * Dy - By * Dx) * Sign >= 0 || (Dx * Ay - Dy * Ax) * Sign >= 0;
+                    if (IsInside)
+                    {
+                        BridgePos = i;
+                        break;
+                    }
+                }
+            }
+
+            // Splice the hole into the polygon after the bridge vertex:
+            //   ..., Bridge, M, <hole vertices>, M, Bridge, ...
+            // The hole must be traversed in the direction opposite to the outer polygon.
+            const bool HoleIsCCW = GetSignedArea(Hole.Start, Hole.Count) > 0;
+            const int  Step      = HoleIsCCW == OuterIsCCW ? Hole.Count - 1 : 1;
+
+            const int BridgeVertId = m_MergedVertIds[BridgePos];
+            m_MergedVertIds.insert(m_MergedVertIds.begin() + BridgePos + 1, Hole.Count + 2, 0);
+
+            int*      pSplice = &m_MergedVertIds[BridgePos + 1];
+            const int M       = Hole.RightmostVert - Hole.Start;
+            for (int i = 0; i <= Hole.Count; ++i)
+                pSplice[i] = Hole.Start + (M + i * Step) % Hole.Count;
+            pSplice[Hole.Count + 1] = BridgeVertId;
+        }
+
+        return AllHolesBridged;
+    }
 
-private:
     //        Reflex
     //   Ear.   |   .Ear
     //      \'. V .'/
@@ -1510,8 +1919,37 @@ private:
     };
     std::vector<VertexType> m_VertTypes;
 
-    // Remaining vertices to process
-    std::vector<int> m_RemainingVertIds;
+    // Links of the remaining vertices
+    std::vector<int> m_PrevVert;
+    std::vector<int> m_NextVert;
+
+    // Min-heap of ear vertices
+    std::vector<int> m_EarHeap;
+
+    // Uniform grid of polygon vertices
+    std::vector<int> m_GridCellStart;
+    std::vector<int> m_GridCellVerts;
+    std::vector<int> m_VertCells;
+    double           m_GridMinX      = 0;
+    double           m_GridMinY      = 0;
+    double           m_GridCellSize  = 0;
+    double           m_GridInvCellSz = 0;
+    int              m_GridWidth     = 1;
+    int              m_GridHeight    = 1;
+
+    // Source vertex indices of the polygon with bridged holes
+    std::vector<int> m_MergedVertIds;
+
+    // Scratch buffers used to bridge the holes
+    struct HoleInfo
+    {
+        int Start;
+        int Count;
+        int RightmostVert;
+    };
+    std::vector<HoleInfo>    m_HoleInfos;
+    std::vector<const void*> m_SrcVertPtrs;
+    std::vector<const void*> m_MergedVertPtrs;
 };
 
 
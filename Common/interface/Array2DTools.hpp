@@ -29,7 +29,11 @@
 /// \file
 /// 2D array processing utilities.
 
+#include <vector>
+
 #include "../../Primitives/interface/BasicTypes.h"
+#include "../../Graphics/GraphicsEngine/interface/GraphicsTypes.h"
+#include "ThreadPool.h"
 
 namespace Diligent
 {
@@ -49,4 +53,116 @@ void GetArray2DMinMaxValue(const float* pData,
                            float&       MinValue,
                            float&       MaxValue);
 
+
+/// Describes a strided 2D array
+struct Array2DDesc
+{
+    /// A pointer to the array data.
+    const void* pData = nullptr;
+
+    /// Array element type.
+
+    /// \remarks   Supported types are VT_FLOAT32, VT_FLOAT16 and VT_UINT16.
+    VALUE_TYPE ValueType = VT_FLOAT32;
+
+    /// Row stride in bytes.
+    size_t Stride = 0;
+
+    /// Array width.
+    Uint32 Width = 0;
+
+    /// Array height.
+    Uint32 Height = 0;
+};
+
+/// Checks if the value type is supported by the 2D array min/max utilities.
+bool IsArray2DMinMaxTypeSupported(VALUE_TYPE ValueType);
+
+/// Computes the minimum and the maximum value in a 2D array of any supported type
+
+/// \param[in]  Array    - 2D array description.
+/// \param[out] MinValue - Minimum value.
+/// \param[out] MaxValue - Maximum value.
+///
+/// \remarks   VT_FLOAT16 values are compared without converting them to float.
+///            NaN values are not supported.
+void GetArray2DMinMaxValue(const Array2DDesc& Array,
+                           float&             MinValue,
+                           float&             MaxValue);
+
+
+/// Hierarchical min/max pyramid over a 2D array.
+
+/// Every texel of level 0 contains the minimum and the maximum value of a
+/// TileSize x TileSize tile of the source array. Every texel of level N+1 contains
+/// the minimum and the maximum of the 2x2 block of texels of level N. When the
+/// level size is odd, the last texel covers one column or row only.
+/// The last level is 1x1 and contains the global min/max of the array.
+class Array2DMinMaxPyramid
+{
+public:
+    /// Builds the pyramid for the given source array.
+
+    /// \param[in] Array       - Source array description.
+    /// \param[in] TileSize    - The size of the source tile covered by one texel of level 0.
+    /// \param[in] pThreadPool - Optional thread pool to process rows in parallel.
+    void Build(const Array2DDesc& Array,
+               Uint32             TileSize    = 1,
+               IThreadPool*       pThreadPool = nullptr);
+
+    /// Updates the pyramid after the rectangle [Left, Right) x [Top, Bottom) of
+    /// the source array has been modified.
+
+    /// \param[in] Array       - Source array description. The array must have
+    ///                          the same type and size as the one used to build the pyramid.
+    /// \param[in] Left        - Left boundary of the modified region, inclusive.
+    /// \param[in] Top         - Top boundary of the modified region, inclusive.
+    /// \param[in] Right       - Right boundary of the modified region, exclusive.
+    /// \param[in] Bottom      - Bottom boundary of the modified region, exclusive.
+    /// \param[in] pThreadPool - Optional thread pool to process rows in parallel.
+    void Update(const Array2DDesc& Array,
+                Uint32             Left,
+                Uint32             Top,
+                Uint32             Right,
+                Uint32             Bottom,
+                IThreadPool*       pThreadPool = nullptr);
+
+    /// Releases all memory and resets the pyramid to the empty state.
+    void Clear();
+
+    Uint32 GetTileSize() const { return m_TileSize; }
+    Uint32 GetLevelCount() const { return static_cast<Uint32>(m_Levels.size()); }
+    Uint32 GetLevelWidth(Uint32 Level) const { return m_Levels[Level].Width; }
+    Uint32 GetLevelHeight(Uint32 Level) const { return m_Levels[Level].Height; }
+
+    /// Returns the minimum values of the given level. The row stride is equal to the level width.
+    const float* GetMinData(Uint32 Level) const { return &m_Min[m_Levels[Level].Offset]; }
+
+    /// Returns the maximum values of the given level. The row stride is equal to the level width.
+    const float* GetMaxData(Uint32 Level) const { return &m_Max[m_Levels[Level].Offset]; }
+
+    float GetMin(Uint32 Level, Uint32 x, Uint32 y) const { return GetMinData(Level)[x + size_t{y} * m_Levels[Level].Width]; }
+    float GetMax(Uint32 Level, Uint32 x, Uint32 y) const { return GetMaxData(Level)[x + size_t{y} * m_Levels[Level].Width]; }
+
+private:
+    void UpdateLevel0(const Array2DDesc& Array, Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1, IThreadPool* pThreadPool);
+    void UpdateLevel(Uint32 Level, Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1, IThreadPool* pThreadPool);
+
+    struct LevelInfo
+    {
+        size_t Offset = 0;
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+    };
+    std::vector<LevelInfo> m_Levels;
+
+    std::vector<float> m_Min;
+    std::vector<float> m_Max;
+
+    VALUE_TYPE m_ValueType = VT_UNDEFINED;
+    Uint32     m_Width     = 0;
+    Uint32     m_Height    = 0;
+    Uint32     m_TileSize  = 1;
+};
+
 } // namespace Diligent
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batch transformations and bounds of points, directions, boxes and matrices.
+///
+/// The functions use SSE2, AVX2 or NEON instructions when available and produce the same
+/// results as the corresponding scalar operations up to floating-point contraction.
+/// NaN values are not supported.
+
+#include "AdvancedMath.hpp"
+
+namespace Diligent
+{
+
+/// Transforms an array of points by a matrix.
+
+/// \param[in]  pSrc   - Source points.
+/// \param[in]  Count  - Number of points.
+/// \param[in]  Matrix - Transformation matrix.
+/// \param[out] pDst   - Destination points. May be equal to pSrc.
+///
+/// \remarks    Every point is transformed as pSrc[i] * Matrix, including
+///             the division by the w component.
+void TransformPoints(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst);
+
+/// Transforms an array of directions by a matrix.
+
+/// \param[in]  pSrc   - Source directions.
+/// \param[in]  Count  - Number of directions.
+/// \param[in]  Matrix - Transformation matrix.
+/// \param[out] pDst   - Destination directions. May be equal to pSrc.
+///
+/// \remarks    Every direction is transformed as float4{pSrc[i], 0} * Matrix,
+///             i.e. the translation is ignored.
+void TransformDirections(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst);
+
+/// Transforms an array of 4-component vectors by a matrix as pSrc[i] * Matrix.
+
+/// \param[in]  pSrc   - Source vectors.
+/// \param[in]  Count  - Number of vectors.
+/// \param[in]  Matrix - Transformation matrix.
+/// \param[out] pDst   - Destination vectors. May be equal to pSrc.
+void TransformVectors(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst);
+
+/// Transforms an array of bounding boxes by a matrix, see BoundBox::Transform().
+
+/// \param[in]  pSrc   - Source boxes.
+/// \param[in]  Count  - Number of boxes.
+/// \param[in]  Matrix - Transformation matrix.
+/// \param[out] pDst   - Destination boxes. May be equal to pSrc.
+void TransformBoundBoxes(const BoundBox* pSrc, size_t Count, const float4x4& Matrix, BoundBox* pDst);
+
+/// Multiplies an array of matrices by a matrix as pSrc[i] * Matrix.
+
+/// \param[in]  pSrc   - Source matrices, for example a matrix palette.
+/// \param[in]  Count  - Number of matrices.
+/// \param[in]  Matrix - Matrix to multiply by.
+/// \param[out] pDst   - Destination matrices. May be equal to pSrc.
+void MultiplyMatrices(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst);
+
+/// Computes the bounding box of a set of points.
+
+/// \param[in]  pPoints - Points.
+/// \param[in]  Count   - Number of points.
+///
+/// \return     The bounding box of the points, or BoundBox::Invalid() if Count is zero.
+BoundBox GetPointsBoundBox(const float3* pPoints, size_t Count);
+
+/// Computes the bounding box that encloses all boxes in the array, see BoundBox::Combine().
+
+/// \param[in]  pBoxes - Boxes.
+/// \param[in]  Count  - Number of boxes.
+///
+/// \return     The combined bounding box, or BoundBox::Invalid() if Count is zero.
+BoundBox CombineBoundBoxes(const BoundBox* pBoxes, size_t Count);
+
+} // namespace Diligent
@@ -104,6 +104,7 @@ public:
         while (BlockSize < size + align - 1)
             BlockSize *= 2;
         m_Blocks.emplace_back(m_pAllocator->Allocate(BlockSize, "dynamic linear allocator page", __FILE__, __LINE__), BlockSize);
+        ++m_BlockAllocationCount;
 
         auto& block = m_Blocks.back();
         auto* Ptr   = AlignUp(block.Data, align);
@@ -198,6 +199,13 @@ public:
         return m_Blocks.size();
     }
 
+    /// Returns the total number of blocks that were requested from the parent allocator.
+    /// Unlike GetBlockCount(), the value is not affected by Free().
+    size_t GetBlockAllocationCount() const
+    {
+        return m_BlockAllocationCount;
+    }
+
     template <typename HandlerType>
     void ProcessBlocks(HandlerType&& Handler) const
     {
@@ -217,8 +225,9 @@ private:
     };
 
     std::vector<Block> m_Blocks;
-    const Uint32       m_BlockSize  = 4 << 10;
-    IMemoryAllocator*  m_pAllocator = nullptr;
+    const Uint32       m_BlockSize            = 4 << 10;
+    IMemoryAllocator*  m_pAllocator           = nullptr;
+    size_t             m_BlockAllocationCount = 0;
 };
 
 } // namespace Diligent
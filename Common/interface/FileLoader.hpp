@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Batched file loading
+
+#include <functional>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ThreadPool.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Callback that is called for every loaded file.
+
+/// \param [in] FileIndex - Index of the file in the LoadFilesAttribs::ppPaths array.
+/// \param [in] pData     - File contents, or null if the file could not be loaded.
+using LoadFileCallbackType = std::function<void(Uint32 FileIndex, IDataBlob* pData)>;
+
+/// LoadFiles() and LoadFilesAsync() attributes
+struct LoadFilesAttribs
+{
+    /// Paths of the files to load.
+    const Char* const* ppPaths = nullptr;
+
+    /// The number of elements in the ppPaths array.
+    Uint32 NumFiles = 0;
+
+    /// Callback that is called for every file once it has been loaded.
+
+    /// \remarks    The order in which the files are completed is not defined.
+    ///             When the files are loaded by the thread pool, the callback
+    ///             may be called from multiple threads simultaneously.
+    LoadFileCallbackType Callback;
+
+    /// The maximum number of reads to keep in flight when the platform supports
+    /// asynchronous file reads (see IsAsyncFileReadSupported()).
+
+    /// \remarks    This is also the maximum number of files that are open at the same time.
+    ///             If the process runs out of file descriptors, the remaining files are opened
+    ///             after the reads in flight complete, or are read synchronously.
+    Uint32 QueueDepth = 64;
+
+    /// An optional thread pool.
+
+    /// \remarks    If the platform supports asynchronous file reads, the reads are
+    ///             submitted in batches by the calling thread and the thread pool is not used.
+    ///             Otherwise, the files are read in parallel by the pool threads and
+    ///             the calling thread. If the pool is null, the files are read sequentially.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Returns true if the platform supports asynchronous file reads (io_uring on Linux)
+/// that allow LoadFiles() to keep multiple reads in flight without worker threads.
+bool IsAsyncFileReadSupported();
+
+/// Loads the files and calls the callback for each of them.
+/// The function returns when all files have been processed.
+void LoadFiles(const LoadFilesAttribs& Attribs);
+
+/// Runs LoadFiles() as a task in the thread pool given by Attribs.pThreadPool, which must not be null.
+/// The paths are copied, and the ppPaths array does not need to outlive the call.
+RefCntAutoPtr<IAsyncTask> LoadFilesAsync(const LoadFilesAttribs& Attribs);
+
+} // namespace Diligent
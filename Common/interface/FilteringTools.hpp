@@ -32,6 +32,7 @@
 #include "BasicMath.hpp"
 
 #include "../../Graphics/GraphicsEngine/interface/Sampler.h"
+#include "ThreadPool.h"
 
 namespace Diligent
 {
@@ -88,29 +89,15 @@ struct LinearTexFilterSampleInfo
     }
 };
 
-/// Returns linear texture filter sample info, see Diligent::LinearTexFilterSampleInfo.
+/// Applies texture address mode to the texel index.
 ///
-/// \tparam AddressMode       - Texture addressing mode, see Diligent::TEXTURE_ADDRESS_MODE.
-/// \tparam IsNormalizedCoord - Whether sample coordinate is normalized.
-///
-/// \param [in] Width    - Texture width.
-/// \param [in] u        - Texture sample coordinate.
-/// \return                Linear texture filter sample information, see Diligent::LinearTexFilterSampleInfo.
-template <TEXTURE_ADDRESS_MODE AddressMode, bool IsNormalizedCoord>
-LinearTexFilterSampleInfo GetLinearTexFilterSampleInfo(Uint32 Width, float u)
+/// \param [in] i           - Texel index.
+/// \param [in] Width       - Texture width.
+/// \param [in] AddressMode - Texture addressing mode, see Diligent::TEXTURE_ADDRESS_MODE.
+///                           TEXTURE_ADDRESS_UNKNOWN leaves the index unchanged.
+/// \return                   Texel index.
+inline Int32 ApplyTexAddressMode(Int32 i, Uint32 Width, TEXTURE_ADDRESS_MODE AddressMode)
 {
-    float x  = IsNormalizedCoord ? u * static_cast<float>(Width) : u;
-    float x0 = FastFloor(x - 0.5f);
-
-    // clang-format off
-    LinearTexFilterSampleInfo SampleInfo
-    {
-        static_cast<Int32>(x0),
-        static_cast<Int32>(x0 + 1),
-        x - 0.5f - x0
-    };
-    // clang-format on
-
     auto WrapCoord = [](Int32 i, Uint32 Width) //
     {
         auto w = static_cast<Int32>(Width);
@@ -133,26 +120,48 @@ LinearTexFilterSampleInfo GetLinearTexFilterSampleInfo(Uint32 Width, float u)
     {
         case TEXTURE_ADDRESS_UNKNOWN:
             // do nothing
-            break;
+            return i;
 
         case TEXTURE_ADDRESS_WRAP:
-            SampleInfo.i0 = WrapCoord(SampleInfo.i0, Width);
-            SampleInfo.i1 = WrapCoord(SampleInfo.i1, Width);
-            break;
+            return WrapCoord(i, Width);
 
         case TEXTURE_ADDRESS_MIRROR:
-            SampleInfo.i0 = MirrorCoord(SampleInfo.i0, Width);
-            SampleInfo.i1 = MirrorCoord(SampleInfo.i1, Width);
-            break;
+            return MirrorCoord(i, Width);
 
         case TEXTURE_ADDRESS_CLAMP:
-            SampleInfo.i0 = clamp(SampleInfo.i0, 0, static_cast<Int32>(Width - 1));
-            SampleInfo.i1 = clamp(SampleInfo.i1, 0, static_cast<Int32>(Width - 1));
-            break;
+            return clamp(i, 0, static_cast<Int32>(Width - 1));
 
         default:
             UNEXPECTED("Unexpected texture address mode");
+            return i;
     }
+}
+
+/// Returns linear texture filter sample info, see Diligent::LinearTexFilterSampleInfo.
+///
+/// \tparam AddressMode       - Texture addressing mode, see Diligent::TEXTURE_ADDRESS_MODE.
+/// \tparam IsNormalizedCoord - Whether sample coordinate is normalized.
+///
+/// \param [in] Width    - Texture width.
+/// \param [in] u        - Texture sample coordinate.
+/// \return                Linear texture filter sample information, see Diligent::LinearTexFilterSampleInfo.
+template <TEXTURE_ADDRESS_MODE AddressMode, bool IsNormalizedCoord>
+LinearTexFilterSampleInfo GetLinearTexFilterSampleInfo(Uint32 Width, float u)
+{
+    float x  = IsNormalizedCoord ? u * static_cast<float>(Width) : u;
+    float x0 = FastFloor(x - 0.5f);
+
+    // clang-format off
+    LinearTexFilterSampleInfo SampleInfo
+    {
+        static_cast<Int32>(x0),
+        static_cast<Int32>(x0 + 1),
+        x - 0.5f - x0
+    };
+    // clang-format on
+
+    SampleInfo.i0 = ApplyTexAddressMode(SampleInfo.i0, Width, AddressMode);
+    SampleInfo.i1 = ApplyTexAddressMode(SampleInfo.i1, Width, AddressMode);
 
     return SampleInfo;
 }
@@ -245,4 +254,87 @@ DstType FilterTexture2DBilinearClampUC(Uint32         Width,
     return FilterTexture2DBilinear<SrcType, DstType, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, false>(Width, Height, pData, Stride, u, v);
 }
 
+
+/// Image resampling filter
+enum RESAMPLE_FILTER : Uint8
+{
+    /// Box filter. When upsampling, this is the nearest-neighbor filter.
+    RESAMPLE_FILTER_BOX = 0,
+
+    /// Triangle filter. When upsampling, this is the bilinear filter
+    /// that produces the same result as FilterTexture2DBilinear.
+    RESAMPLE_FILTER_BILINEAR,
+
+    /// Lanczos filter with three lobes.
+    RESAMPLE_FILTER_LANCZOS3,
+
+    /// Kaiser-windowed sinc filter (width 3, alpha 4).
+    RESAMPLE_FILTER_KAISER,
+
+    RESAMPLE_FILTER_COUNT
+};
+
+/// ResampleImage function attributes
+struct ResampleImageAttribs
+{
+    /// Source image width.
+    Uint32 SrcWidth = 0;
+
+    /// Source image height.
+    Uint32 SrcHeight = 0;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source row stride, in bytes.
+    size_t SrcStride = 0;
+
+    /// Destination image width.
+    Uint32 DstWidth = 0;
+
+    /// Destination image height.
+    Uint32 DstHeight = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination row stride, in bytes.
+    size_t DstStride = 0;
+
+    /// Component type, must be VT_UINT8 or VT_FLOAT32.
+    /// VT_UINT8 values are treated as normalized and are filtered in floating point.
+    VALUE_TYPE ComponentType = VT_UINT8;
+
+    /// The number of components per pixel, from 1 to 4.
+    Uint32 NumComponents = 4;
+
+    /// Resampling filter.
+    RESAMPLE_FILTER Filter = RESAMPLE_FILTER_LANCZOS3;
+
+    /// Horizontal address mode: TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR or TEXTURE_ADDRESS_CLAMP.
+    TEXTURE_ADDRESS_MODE AddressModeU = TEXTURE_ADDRESS_CLAMP;
+
+    /// Vertical address mode: TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR or TEXTURE_ADDRESS_CLAMP.
+    TEXTURE_ADDRESS_MODE AddressModeV = TEXTURE_ADDRESS_CLAMP;
+
+    /// Optional thread pool. When not null, bands of destination rows
+    /// are processed in parallel by the pool threads and the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Resamples an image using a separable filter.
+
+/// \remarks   Destination pixel x samples the source image at the unnormalized coordinate
+///            (x + 0.5) * SrcWidth / DstWidth, and similarly in the vertical direction.
+///            When downsampling, the filter is stretched by the scale factor to cover all
+///            source pixels that contribute to the destination pixel.
+///            Filter weights are computed once per destination column and row, and
+///            texels outside of the image are addressed using the address modes.
+///
+///            Filters with negative lobes may produce values outside of the source range.
+///            VT_UINT8 results are clamped to [0, 255], VT_FLOAT32 results are not clamped.
+///
+///            Source and destination memory must not overlap.
+void ResampleImage(const ResampleImageAttribs& Attribs);
+
 } // namespace Diligent
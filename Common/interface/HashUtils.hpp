@@ -28,6 +28,7 @@
 #pragma once
 
 #include <functional>
+#include <string>
 #include <memory>
 #include <cstring>
 #include <algorithm>
@@ -139,50 +140,10 @@ std::size_t ComputeHash(const FirstArgType& FirstArg, const RestArgsType&... Res
     return Seed;
 }
 
-inline std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept
-{
-    size_t Hash = 0;
-
-    const auto* BytePtr  = static_cast<const Uint8*>(pData);
-    const auto* EndPtr   = BytePtr + Size;
-    const auto* DwordPtr = static_cast<const Uint32*>(AlignUp(pData, alignof(Uint32)));
-
-    // Process initial bytes before we get to the 32-bit aligned pointer
-    Uint64 Buffer = 0;
-    Uint64 Shift  = 0;
-    while (BytePtr < EndPtr && BytePtr < reinterpret_cast<const Uint8*>(DwordPtr))
-    {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
-    }
-    VERIFY_EXPR(Shift <= 24);
-
-    // Process dwords
-    while (DwordPtr + 1 <= reinterpret_cast<const Uint32*>(EndPtr))
-    {
-        Buffer |= Uint64{*(DwordPtr++)} << Shift;
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
-    }
-
-    // Process the remaining bytes
-    BytePtr = reinterpret_cast<const Uint8*>(DwordPtr);
-    while (BytePtr < EndPtr)
-    {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
-    }
-    VERIFY_EXPR(Shift <= (3 + 3) * 8);
-
-    while (Shift != 0)
-    {
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
-        Shift -= (std::min)(Shift, Uint64{32});
-    }
+/// Computes the hash of a raw memory block using XXH3.
 
-    return Hash;
-}
+/// \remarks   The hash does not depend on the alignment of the data.
+std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept;
 
 template <typename CharType>
 struct CStringHash
@@ -1308,27 +1269,110 @@ struct HashCombiner<HasherType, VertexPoolElementDesc> : HashCombinerBase<Hasher
     }
 };
 
+/// Hasher used by the std::hash specializations of the engine structures.
+
+/// The fields are appended to a fixed-size canonical byte buffer (strings are inlined
+/// with their terminators, nested structures are expanded in place) that is hashed
+/// with ComputeHashRaw() every time it fills up, rather than combining the fields
+/// one at a time. The hasher never allocates memory.
 struct DefaultHasher
 {
+    template <typename T>
+    typename std::enable_if<(std::is_fundamental<T>::value && !std::is_floating_point<T>::value) || std::is_enum<T>::value>::type Update(const T& Val) noexcept
+    {
+        UpdateRaw(&Val, sizeof(Val));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type Update(const T& Val) noexcept
+    {
+        // 0 and -0 compare equal, so they must produce the same bits
+        const T CanonicalVal = Val == T{0} ? T{0} : Val;
+        UpdateRaw(&CanonicalVal, sizeof(CanonicalVal));
+    }
+
+    template <typename T>
+    typename std::enable_if<(std::is_same<typename std::remove_cv<T>::type, char>::value ||
+                             std::is_same<typename std::remove_cv<T>::type, wchar_t>::value),
+                            void>::type
+    Update(T* Str) noexcept
+    {
+        // Null strings are hashed as empty strings, the same way they are compared
+        if (Str != nullptr)
+            UpdateRaw(Str, std::char_traits<typename std::remove_cv<T>::type>::length(Str) * sizeof(T));
+        Update(typename std::remove_cv<T>::type{0});
+    }
+
+    template <typename CharType>
+    void Update(const std::basic_string<CharType>& Str) noexcept
+    {
+        UpdateRaw(Str.c_str(), Str.length() * sizeof(CharType));
+        Update(CharType{0});
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value>::type Update(const T& Val) noexcept
+    {
+        HashCombiner<DefaultHasher, T> Combiner{*this};
+        Combiner(Val);
+    }
+
+    template <typename FirstArgType, typename... RestArgsType>
+    void Update(const FirstArgType& FirstArg, const RestArgsType&... RestArgs) noexcept
+    {
+        Update(FirstArg);
+        Update(RestArgs...);
+    }
+
     template <typename... ArgsType>
-    std::size_t operator()(const ArgsType&... Args) noexcept
+    void operator()(const ArgsType&... Args) noexcept
     {
-        HashCombine(m_Seed, Args...);
-        return m_Seed;
+        Update(Args...);
     }
 
     void UpdateRaw(const void* pData, uint64_t Size) noexcept
     {
-        HashCombine(m_Seed, ComputeHashRaw(pData, static_cast<size_t>(Size)));
+        if (Size == 0)
+            return;
+
+        if (Size > BufferSize - m_BufferSize)
+        {
+            FlushBuffer();
+            if (Size > BufferSize)
+            {
+                // Large blocks (e.g. shader bytecode) are hashed directly
+                HashCombine(m_Seed, ComputeHashRaw(pData, static_cast<size_t>(Size)));
+                return;
+            }
+        }
+
+        std::memcpy(&m_Buffer[m_BufferSize], pData, static_cast<size_t>(Size));
+        m_BufferSize += static_cast<size_t>(Size);
     }
 
-    size_t Get() const
+    size_t Get() const noexcept
     {
-        return m_Seed;
+        size_t Seed = m_Seed;
+        if (m_BufferSize > 0)
+            HashCombine(Seed, ComputeHashRaw(m_Buffer, m_BufferSize));
+        return Seed;
     }
 
 private:
-    size_t m_Seed = 0;
+    void FlushBuffer() noexcept
+    {
+        if (m_BufferSize > 0)
+        {
+            HashCombine(m_Seed, ComputeHashRaw(m_Buffer, m_BufferSize));
+            m_BufferSize = 0;
+        }
+    }
+
+    static constexpr size_t BufferSize = 256;
+
+    size_t  m_Seed       = 0;
+    size_t  m_BufferSize = 0;
+    uint8_t m_Buffer[BufferSize];
 };
 
 template <typename Type>
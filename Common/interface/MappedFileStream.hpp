@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the MappedFileStream class
+
+#include <memory>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Platforms/interface/MappedFile.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Read-only file stream that accesses the file contents through Diligent::MappedFile.
+
+/// On platforms that support memory mapping, the file is mapped into the address space
+/// and its contents are never copied unless Read() or ReadBlob() is called. GetDataBlob()
+/// returns a data blob that references the mapped memory directly.
+class MappedFileStream final : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    // {2E1B5F3A-7C4D-4E8B-9A61-3D0F8C2B7E45}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x2e1b5f3a, 0x7c4d, 0x4e8b, {0x9a, 0x61, 0x3d, 0xf, 0x8c, 0x2b, 0x7e, 0x45}};
+
+    /// Opens the file. Returns null if the file could not be opened.
+    static RefCntAutoPtr<MappedFileStream> Create(const Char* Path);
+
+    MappedFileStream(IReferenceCounters* pRefCounters,
+                     const Char*         Path);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Reads the remaining data from the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override final;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override final;
+
+    /// The stream is read-only: this method always fails
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override final;
+
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override final;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override final;
+
+    /// Returns a read-only data blob that references the entire file contents without copying them.
+    /// The blob keeps the stream, and thus the mapping, alive.
+    RefCntAutoPtr<IDataBlob> GetDataBlob();
+
+    /// Gives a hint about how the file contents will be accessed, see Diligent::MappedFileAccessHint.
+    void Advise(MappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0}) const
+    {
+        m_File.Advise(Hint, Offset, Size);
+    }
+
+    const void* GetData() const { return m_File.GetData(); }
+
+    /// Returns the time of the last modification of the file in nanoseconds since the epoch,
+    /// or zero if it is not known on this platform.
+    Uint64 GetModificationTime() const { return m_File.GetModificationTime(); }
+
+private:
+    MappedFile m_File;
+    size_t     m_CurrentOffset = 0;
+};
+
+} // namespace Diligent
@@ -43,6 +43,10 @@ class ProxyDataBlob : public ObjectBase<IDataBlob>
 public:
     typedef ObjectBase<IDataBlob> TBase;
 
+    // {A7C25E1D-3F64-4B0A-8E2C-5D91F6B4A038}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0xa7c25e1d, 0x3f64, 0x4b0a, {0x8e, 0x2c, 0x5d, 0x91, 0xf6, 0xb4, 0xa0, 0x38}};
+
     ProxyDataBlob(IReferenceCounters* pRefCounters,
                   void*               pData,
                   size_t              Size,
@@ -71,7 +75,7 @@ public:
         return RefCntAutoPtr<ProxyDataBlob>{MakeNewRCObj<ProxyDataBlob>()(std::forward<ArgsType>(Args)...)};
     }
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DataBlob, TBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_DataBlob, IID_InternalImpl, TBase)
 
     /// Sets the size of the internal data buffer
     virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override
@@ -99,6 +103,12 @@ public:
         return static_cast<const Uint8*>(m_pConstData) + Offset;
     }
 
+    /// Returns the object that owns the data, or null if the blob does not own it
+    IObject* GetDataContainer() const
+    {
+        return m_pDataContainer;
+    }
+
 private:
     void* const            m_pData;
     const void* const      m_pConstData;
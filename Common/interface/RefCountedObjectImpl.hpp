@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "../../Primitives/interface/Object.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -43,6 +45,85 @@
 namespace Diligent
 {
 
+/// Enables or disables biased reference counting for the objects created afterwards.
+
+/// When biased reference counting is enabled, the strong reference counter of a new object
+/// is split in two: a biased counter that is only modified by the thread that created the object
+/// (the owner thread) without atomic read-modify-write operations, and a shared atomic counter
+/// that is used by all other threads. When the biased counter reaches zero, it is merged into
+/// the shared counter and the object reverts to regular atomic reference counting.
+///
+/// \remarks   If the last reference to an object is released by a thread other than its owner
+///            while the owner still has to merge its counter, the object is destroyed by the owner
+///            thread when it calls ProcessBiasedReferenceCountMerges() or exits. Releasing references
+///            never processes the merges. IDeviceContext::FinishFrame() processes them for the calling thread.
+void SetBiasedReferenceCountingEnabled(bool Enable);
+
+/// Returns true if biased reference counting is enabled, see SetBiasedReferenceCountingEnabled().
+bool IsBiasedReferenceCountingEnabled();
+
+/// Merges the reference counters of all objects owned by the calling thread whose
+/// last shared references have been released by other threads.
+void ProcessBiasedReferenceCountMerges();
+
+class RefCountersImpl;
+
+// Per-thread state of the biased reference counting.
+// The object is kept alive by its thread and by every object whose biased counter it owns.
+class BiasedRefCountsOwner
+{
+public:
+    // Returns the state of the calling thread, or null if it has not been created.
+    static BiasedRefCountsOwner* GetCurrentThread() noexcept
+    {
+        return s_pCurrentThread;
+    }
+
+    // Returns the state of the calling thread, creating it if necessary.
+    // Returns null if the thread is exiting.
+    static BiasedRefCountsOwner* GetOrCreateCurrentThread();
+
+    void AddOwnedObject()
+    {
+        m_NumRefs.fetch_add(+1);
+    }
+
+    void ReleaseOwnedObject()
+    {
+        if (m_NumRefs.fetch_add(-1) - 1 == 0)
+            delete this;
+    }
+
+    // Requests the owner thread to merge the counters of the object.
+    // If the owner thread has exited, the counters are merged immediately.
+    void RequestMerge(RefCountersImpl* pRefCounters);
+
+    // Must only be called by the owner thread.
+    void ProcessPendingMerges()
+    {
+        if (m_HasPendingMerges.load(std::memory_order_relaxed))
+            MergePending();
+    }
+
+private:
+    BiasedRefCountsOwner() noexcept {}
+
+    void MergePending();
+    void OnThreadExit();
+
+    friend struct BiasedRefCountsOwnerThreadHolder;
+
+    static thread_local BiasedRefCountsOwner* s_pCurrentThread;
+
+    std::atomic<bool> m_HasPendingMerges{false};
+    // One reference is held by the thread itself
+    std::atomic<long> m_NumRefs{1};
+
+    std::mutex                    m_PendingMergesMtx;
+    std::vector<RefCountersImpl*> m_PendingMerges;
+    bool                          m_IsOrphaned = false;
+};
+
 // This class controls the lifetime of a refcounted object
 class RefCountersImpl final : public IReferenceCounters
 {
@@ -51,7 +132,14 @@ public:
     {
         VERIFY(m_ObjectState.load() == ObjectState::Alive, "Attempting to increment strong reference counter for a destroyed or not initialized object!");
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
-        return m_NumStrongReferences.fetch_add(+1) + 1;
+        if (IsBiasedOwnerThread())
+        {
+            // Only the owner thread modifies the biased counter, so no read-modify-write is required
+            const auto NumBiasedRefs = m_NumBiasedReferences.load(std::memory_order_relaxed) + 1;
+            m_NumBiasedReferences.store(NumBiasedRefs, std::memory_order_relaxed);
+            return NumBiasedRefs + UnpackRefCount(m_NumStrongReferences.load(std::memory_order_relaxed));
+        }
+        return UnpackRefCount(m_NumStrongReferences.fetch_add(+RefCountUnit) + RefCountUnit);
     }
 
     template <class TPreObjectDestroy>
@@ -60,20 +148,54 @@ public:
         VERIFY(m_ObjectState.load() == ObjectState::Alive, "Attempting to decrement strong reference counter for an object that is not alive");
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
 
+        if (IsBiasedOwnerThread())
+        {
+            ReferenceCounterValueType RefCount = 0;
+            if (ReleaseBiasedRef(RefCount))
+                return RefCount;
+            // The last biased reference has been transferred to the shared counter
+            // and is released below.
+        }
+
         struct IObject* WrappedObject = nullptr;
         QueryObject(&WrappedObject);
-        if(WrappedObject)
-            m_NumStrongReferences.fetch_add(-1); // QueryObject increments internally strong refs
+        if (WrappedObject)
+            m_NumStrongReferences.fetch_add(-RefCountUnit); // QueryObject increments internally strong refs
+
+        // The owner must be read before the counter is decremented as
+        // the object may be merged and destroyed by the owner thread right after that.
+        BiasedRefCountsOwner* const pBiasOwner = m_pBiasOwner.load(std::memory_order_acquire);
 
-        // Decrement strong reference counter without acquiring the lock.
-        const auto RefCount = m_NumStrongReferences.fetch_add(-1) - 1;
-        VERIFY(RefCount >= 0, "Inconsistent call to ReleaseStrongRef()");
-        if (RefCount == 0)
+        ReferenceCounterValueType PackedRefCount = 0;
+        bool                      RequestMerge   = false;
+        if (pBiasOwner == nullptr)
+        {
+            // Decrement strong reference counter without acquiring the lock.
+            PackedRefCount = m_NumStrongReferences.fetch_add(-RefCountUnit) - RefCountUnit;
+        }
+        else
+        {
+            PackedRefCount = DecrementSharedRefCount(RequestMerge);
+        }
+
+        const auto RefCount = UnpackRefCount(PackedRefCount);
+        if ((PackedRefCount & RefCountFlagMerged) != 0)
+        {
+            VERIFY(RefCount >= 0, "Inconsistent call to ReleaseStrongRef()");
+            if (RefCount == 0)
+            {
+                ExecuteReleaseCallback(WrappedObject, this);
+
+                PreObjectDestroy();
+                TryDestroyObject();
+            }
+        }
+        else if (RequestMerge)
         {
-            ExecuteReleaseCallback(WrappedObject, this);
-            
-            PreObjectDestroy();
-            TryDestroyObject();
+            // The remaining references (if any) are held by the biased counter of the owner thread.
+            // Only the owner thread may merge the counters. Note that the object may be destroyed
+            // by the time RequestMerge() returns.
+            pBiasOwner->RequestMerge(this);
         }
 
         return RefCount;
@@ -143,7 +265,7 @@ public:
         //
         if (NumWeakReferences == 0 && /*m_NumStrongReferences == 0 &&*/ m_ObjectState.load() == ObjectState::Destroyed)
         {
-            VERIFY_EXPR(m_NumStrongReferences.load() == 0);
+            VERIFY_EXPR(UnpackRefCount(m_NumStrongReferences.load()) == 0);
             VERIFY(m_ObjectWrapperBuffer[0] == 0 && m_ObjectWrapperBuffer[1] == 0, "Object wrapper must be null");
             // m_ObjectState is set to ObjectState::Destroyed under the lock. If the state is not Destroyed,
             // ReleaseStrongRef() will take care of it.
@@ -185,7 +307,8 @@ public:
         //
         Threading::SpinLockGuard Guard{m_Lock};
 
-        const auto StrongRefCnt = m_NumStrongReferences.fetch_add(+1) + 1;
+        const auto PackedStrongRefCnt = m_NumStrongReferences.fetch_add(+RefCountUnit) + RefCountUnit;
+        const auto StrongRefCnt       = UnpackRefCount(PackedStrongRefCnt);
 
         // Checking if m_ObjectState == ObjectState::Alive only is not reliable:
         //
@@ -201,7 +324,11 @@ public:
         //   5. Decrement m_NumStrongReferences     |
         //                                          |    5. Destroy the object
 
-        if (m_ObjectState == ObjectState::Alive && StrongRefCnt > 1)
+        // If the biased counter has not been merged yet, the object may only be destroyed by
+        // the merge, which will account for the reference we are holding. The object is alive
+        // even if the shared counter is not positive as the owner thread may hold references.
+        const bool IsMerged = (PackedStrongRefCnt & RefCountFlagMerged) != 0;
+        if (m_ObjectState == ObjectState::Alive && (StrongRefCnt > 1 || !IsMerged))
         {
             VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
             // QueryInterface() must not lock the object, or a deadlock happens.
@@ -210,12 +337,12 @@ public:
             auto* pWrapper = reinterpret_cast<ObjectWrapperBase*>(m_ObjectWrapperBuffer);
             pWrapper->QueryInterface(IID_Unknown, ppObject);
         }
-        m_NumStrongReferences.fetch_add(-1);
+        m_NumStrongReferences.fetch_add(-RefCountUnit);
     }
 
     inline virtual ReferenceCounterValueType GetNumStrongRefs() const override final
     {
-        return m_NumStrongReferences.load();
+        return UnpackRefCount(m_NumStrongReferences.load()) + m_NumBiasedReferences.load(std::memory_order_relaxed);
     }
 
     inline virtual ReferenceCounterValueType GetNumWeakRefs() const override final
@@ -227,8 +354,124 @@ private:
     template <typename AllocatorType, typename ObjectType>
     friend class MakeNewRCObj;
 
+    friend class BiasedRefCountsOwner;
+
     RefCountersImpl() noexcept
     {
+        if (IsBiasedReferenceCountingEnabled())
+        {
+            if (auto* pOwner = BiasedRefCountsOwner::GetOrCreateCurrentThread())
+            {
+                pOwner->AddOwnedObject();
+                m_pBiasOwner.store(pOwner, std::memory_order_relaxed);
+                m_NumStrongReferences.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool IsBiasedOwnerThread() const noexcept
+    {
+        const auto* pOwner = m_pBiasOwner.load(std::memory_order_relaxed);
+        return pOwner != nullptr && pOwner == BiasedRefCountsOwner::GetCurrentThread();
+    }
+
+    // Releases a biased reference on the owner thread. Returns false if this was the last
+    // biased reference and it has been transferred to the shared counter, in which case
+    // the caller must release it.
+    bool ReleaseBiasedRef(ReferenceCounterValueType& RefCount)
+    {
+        BiasedRefCountsOwner* const pOwner = m_pBiasOwner.load(std::memory_order_relaxed);
+
+        const auto NumBiasedRefs = m_NumBiasedReferences.load(std::memory_order_relaxed) - 1;
+        VERIFY(NumBiasedRefs >= 0, "Inconsistent call to ReleaseStrongRef()");
+        if (NumBiasedRefs > 0)
+        {
+            m_NumBiasedReferences.store(NumBiasedRefs, std::memory_order_relaxed);
+            RefCount = NumBiasedRefs + UnpackRefCount(m_NumStrongReferences.load(std::memory_order_relaxed));
+            return true;
+        }
+
+        auto PackedRefCount = m_NumStrongReferences.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if ((PackedRefCount & RefCountFlagQueued) != 0)
+            {
+                // Another thread has released the last shared reference and requested the merge.
+                // The counters will be merged and the object destroyed when the owner thread
+                // processes the pending merges or exits.
+                m_NumBiasedReferences.store(0, std::memory_order_relaxed);
+                RefCount = UnpackRefCount(PackedRefCount);
+                return true;
+            }
+
+            // Transfer the last biased reference to the shared counter and mark the counters as merged
+            if (m_NumStrongReferences.compare_exchange_weak(PackedRefCount, (PackedRefCount + RefCountUnit) | RefCountFlagMerged))
+                break;
+        }
+
+        m_NumBiasedReferences.store(0, std::memory_order_relaxed);
+        m_pBiasOwner.store(nullptr, std::memory_order_release);
+        pOwner->ReleaseOwnedObject();
+        return false;
+    }
+
+    // Decrements the shared counter of an object that has a biased owner. If the counters have not been
+    // merged and the shared counter drops to zero, atomically marks the object as queued for the merge.
+    ReferenceCounterValueType DecrementSharedRefCount(bool& RequestMerge)
+    {
+        auto PackedRefCount = m_NumStrongReferences.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto NewPackedRefCount = PackedRefCount - RefCountUnit;
+
+            RequestMerge = (NewPackedRefCount & (RefCountFlagMerged | RefCountFlagQueued)) == 0 && UnpackRefCount(NewPackedRefCount) <= 0;
+            if (RequestMerge)
+                NewPackedRefCount |= RefCountFlagQueued;
+
+            if (m_NumStrongReferences.compare_exchange_weak(PackedRefCount, NewPackedRefCount))
+                return NewPackedRefCount;
+        }
+    }
+
+    // Merges the biased counter into the shared counter after the merge has been requested by another thread.
+    // Called by the owner thread, or by any thread once the owner thread has exited.
+    void MergeBiasedRefs()
+    {
+        BiasedRefCountsOwner* const pOwner = m_pBiasOwner.load(std::memory_order_relaxed);
+        VERIFY_EXPR(pOwner != nullptr);
+
+        // Add one extra reference that keeps the object alive until it is released below.
+        const auto NumBiasedRefs  = m_NumBiasedReferences.load(std::memory_order_relaxed);
+        auto       PackedRefCount = m_NumStrongReferences.load(std::memory_order_relaxed);
+        while (!m_NumStrongReferences.compare_exchange_weak(PackedRefCount, ((PackedRefCount & ~RefCountFlagQueued) + (NumBiasedRefs + 1) * RefCountUnit) | RefCountFlagMerged))
+        {
+        }
+        VERIFY((PackedRefCount & RefCountFlagQueued) != 0, "The merge has not been requested");
+
+        m_NumBiasedReferences.store(0, std::memory_order_relaxed);
+        m_pBiasOwner.store(nullptr, std::memory_order_release);
+        pOwner->ReleaseOwnedObject();
+
+        // Release the extra reference through the object itself so that its Release() override
+        // runs if this is the last reference.
+        IObject* pObject  = nullptr;
+        auto*    pWrapper = reinterpret_cast<ObjectWrapperBase*>(m_ObjectWrapperBuffer);
+        pWrapper->QueryInterface(IID_Unknown, &pObject);
+        if (pObject != nullptr)
+        {
+            pObject->Release();
+            pObject->Release();
+        }
+        else
+        {
+            ReleaseStrongRef();
+        }
+    }
+
+    static ReferenceCounterValueType UnpackRefCount(ReferenceCounterValueType PackedRefCount) noexcept
+    {
+        // Note that the counter may be negative
+        return (PackedRefCount - (PackedRefCount & RefCountFlagsMask)) / RefCountUnit;
     }
 
     class ObjectWrapperBase
@@ -364,7 +607,7 @@ private:
 
 #ifdef DILIGENT_DEBUG
         {
-            auto NumStrongRefs = m_NumStrongReferences.load();
+            auto NumStrongRefs = UnpackRefCount(m_NumStrongReferences.load());
             VERIFY(NumStrongRefs == 0 || NumStrongRefs == 1, "Num strong references (", NumStrongRefs, ") is expected to be 0 or 1");
         }
 #endif
@@ -376,10 +619,10 @@ private:
         // decrements the ref counter. If it reads 1 after incrementing the counter,
         // it does not return the reference to the object and decrements the counter.
         // If we acquired the lock, QueryObject() will not start until we are done
-        VERIFY_EXPR(m_NumStrongReferences.load() == 0 && m_ObjectState.load() == ObjectState::Alive);
+        VERIFY_EXPR(UnpackRefCount(m_NumStrongReferences.load()) == 0 && m_ObjectState.load() == ObjectState::Alive);
 
         // Extra caution
-        if (m_NumStrongReferences.load() == 0 && m_ObjectState.load() == ObjectState::Alive)
+        if (UnpackRefCount(m_NumStrongReferences.load()) == 0 && m_ObjectState.load() == ObjectState::Alive)
         {
             VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
             // We cannot destroy the object while reference counters are locked as this will
@@ -463,8 +706,12 @@ private:
 
     ~RefCountersImpl()
     {
-        VERIFY(m_NumStrongReferences.load() == 0 && m_NumWeakReferences.load() == 0,
+        VERIFY(GetNumStrongRefs() == 0 && m_NumWeakReferences.load() == 0,
                "There exist outstanding references to the object being destroyed");
+
+        // The counters are never merged if the object constructor throws an exception
+        if (auto* pOwner = m_pBiasOwner.load(std::memory_order_relaxed))
+            pOwner->ReleaseOwnedObject();
     }
 
     // No copies/moves
@@ -486,9 +733,21 @@ private:
 
     alignas(ObjectWrapper<IObjectStub, IMemoryAllocator>) size_t m_ObjectWrapperBuffer[ObjectWrapperBufferSize]{};
 
-    std::atomic<ReferenceCounterValueType> m_NumStrongReferences{0};
+    // The strong reference counter is stored in the upper bits of m_NumStrongReferences,
+    // while the lower bits contain the biased reference counting flags.
+    static constexpr ReferenceCounterValueType RefCountUnit       = 4;
+    static constexpr ReferenceCounterValueType RefCountFlagMerged = 1; // The counters are merged, or the object has no biased owner
+    static constexpr ReferenceCounterValueType RefCountFlagQueued = 2; // The merge has been requested from the owner thread
+    static constexpr ReferenceCounterValueType RefCountFlagsMask  = RefCountFlagMerged | RefCountFlagQueued;
+
+    std::atomic<ReferenceCounterValueType> m_NumStrongReferences{RefCountFlagMerged};
     std::atomic<ReferenceCounterValueType> m_NumWeakReferences{0};
 
+    // Biased reference counter that is only accessed by the owner thread.
+    // Atomic load and store are used to avoid formal data races in GetNumStrongRefs().
+    std::atomic<ReferenceCounterValueType> m_NumBiasedReferences{0};
+    std::atomic<BiasedRefCountsOwner*>     m_pBiasOwner{nullptr};
+
     Threading::SpinLock m_Lock;
 
     enum class ObjectState : Int32
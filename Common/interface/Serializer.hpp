@@ -279,6 +279,19 @@ public:
         return m_Ptr;
     }
 
+    /// Moves the current position by Size bytes without accessing the data
+    bool Skip(size_t Size)
+    {
+        static_assert(Mode == SerializerMode::Read, "This method is only allowed in Read mode");
+        if (Size > GetRemainingSize())
+        {
+            UNEXPECTED("Not enough data to skip ", Size, " bytes");
+            return false;
+        }
+        m_Ptr += Size;
+        return true;
+    }
+
     bool IsEnded() const
     {
         return m_Ptr == m_End;
@@ -28,9 +28,11 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -223,4 +225,52 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls the handler for every item in the range [0, NumItems).
+
+/// \remarks   When the thread pool is not null, the items are processed in parallel by
+///            the pool threads and the calling thread, otherwise they are processed
+///            sequentially by the calling thread. The function returns when all items
+///            have been processed. The order in which the items are processed is not
+///            defined, and the handler must be thread-safe.
+template <typename HandlerType>
+void ParallelFor(IThreadPool* pThreadPool, Uint32 NumItems, HandlerType&& Handler)
+{
+    const Uint32 NumTasks = (pThreadPool != nullptr && NumItems > 1) ?
+        std::min(NumItems - 1, std::max(std::thread::hardware_concurrency(), 1u)) :
+        0;
+    if (NumTasks == 0)
+    {
+        for (Uint32 Item = 0; Item < NumItems; ++Item)
+            Handler(Item);
+        return;
+    }
+
+    std::atomic<Uint32> NextItem{0};
+
+    auto ProcessItems = [&]() {
+        for (Uint32 Item = NextItem.fetch_add(1); Item < NumItems; Item = NextItem.fetch_add(1))
+            Handler(Item);
+    };
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve(NumTasks);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                            [&ProcessItems](Uint32 ThreadId) {
+                                                ProcessItems();
+                                                return ASYNC_TASK_STATUS_COMPLETE;
+                                            }));
+    }
+
+    ProcessItems();
+
+    // All items have been taken. Tasks that have not started yet have nothing left to do.
+    for (auto& pTask : Tasks)
+    {
+        if (!pThreadPool->RemoveTask(pTask))
+            pTask->WaitForCompletion();
+    }
+}
+
 } // namespace Diligent
@@ -27,10 +27,12 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -73,10 +75,9 @@ bool GetArray2DMinMaxValueAVX2(const float* pData,
     {
         const float* pRowStart = pData + row * StrideInFloats;
         const float* pRowEnd   = pRowStart + Width;
-        const float* pAVXEnd   = pRowEnd - 8;
 
         const float* Ptr = pRowStart;
-        for (; Ptr < pAVXEnd; Ptr += 8)
+        for (; Ptr + 8 <= pRowEnd; Ptr += 8)
         {
             // NOTE: MSVC generates vmovups when using _mm256_load_ps regardless,
             //       so no reason to bother with aligning the pointer.
@@ -125,7 +126,317 @@ bool GetArray2DMinMaxValueAVX2(const float* pData,
 
     return true;
 }
+#elif DILIGENT_SSE2_ENABLED
+bool GetArray2DMinMaxValueSSE2(const float* pData,
+                               size_t       StrideInFloats,
+                               Uint32       Width,
+                               Uint32       Height,
+                               float&       MinValue,
+                               float&       MaxValue)
+{
+    auto mMin = _mm_set1_ps(MinValue);
+    auto mMax = _mm_set1_ps(MaxValue);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRowStart = pData + row * StrideInFloats;
+        const float* pRowEnd   = pRowStart + Width;
+
+        const float* Ptr = pRowStart;
+        for (; Ptr + 4 <= pRowEnd; Ptr += 4)
+        {
+            const auto mVal = _mm_loadu_ps(Ptr);
+
+            mMin = _mm_min_ps(mMin, mVal);
+            mMax = _mm_max_ps(mMax, mVal);
+        }
+
+        for (; Ptr < pRowEnd; ++Ptr)
+        {
+            MinValue = std::min(MinValue, *Ptr);
+            MaxValue = std::max(MaxValue, *Ptr);
+        }
+    }
+
+    // |  A  |  B  |  C  |  D  |  =>  | min(A, C) | min(B, D) | ... |
+    mMin = _mm_min_ps(mMin, _mm_movehl_ps(mMin, mMin));
+    mMax = _mm_max_ps(mMax, _mm_movehl_ps(mMax, mMax));
+    mMin = _mm_min_ss(mMin, _mm_shuffle_ps(mMin, mMin, _MM_SHUFFLE(1, 1, 1, 1)));
+    mMax = _mm_max_ss(mMax, _mm_shuffle_ps(mMax, mMax, _MM_SHUFFLE(1, 1, 1, 1)));
+
+    MinValue = std::min(_mm_cvtss_f32(mMin), MinValue);
+    MaxValue = std::max(_mm_cvtss_f32(mMax), MaxValue);
+
+    return true;
+}
+#endif
+
+// 16-bit values are processed as signed 16-bit keys whose order matches the order of the values,
+// which lets both the scalar and the SIMD code use a single signed min/max instruction:
+//  - Half: the sign bit is kept and the remaining bits of negative values are inverted
+//  - Uint16: the sign bit is flipped
+// In both cases the key is computed as Value ^ ((Value & 0x8000 ? NegXor : 0) ^ Xor).
+struct Key16Transform
+{
+    Uint16 NegXor = 0;
+    Uint16 Xor    = 0;
+
+    explicit Key16Transform(VALUE_TYPE ValueType) :
+        NegXor{static_cast<Uint16>(ValueType == VT_FLOAT16 ? 0x7FFFu : 0u)},
+        Xor{static_cast<Uint16>(ValueType == VT_UINT16 ? 0x8000u : 0u)}
+    {}
+
+    Int16 ToKey(Uint16 Val) const
+    {
+        return static_cast<Int16>(Val ^ (((Val & 0x8000u) != 0 ? NegXor : 0u) ^ Xor));
+    }
+
+    // The transform is an involution for halfs. For uint16 values, the sign bit
+    // of the key is inverted relative to the value.
+    Uint16 FromKey(Int16 Key) const
+    {
+        const Uint16 Val = static_cast<Uint16>(static_cast<Uint16>(Key) ^ Xor);
+        return static_cast<Uint16>(Val ^ ((Val & 0x8000u) != 0 ? NegXor : 0u));
+    }
+};
+
+float HalfToFloat(Uint16 h)
+{
+    const Uint32 Sign = (Uint32{h} & 0x8000u) << 16u;
+    const Uint32 Exp  = (Uint32{h} >> 10u) & 0x1Fu;
+    const Uint32 Mant = Uint32{h} & 0x3FFu;
+
+    Uint32 f = 0;
+    if (Exp == 0)
+    {
+        const float Val = static_cast<float>(Mant) * (1.f / 16777216.f);
+        memcpy(&f, &Val, sizeof(f));
+        f |= Sign;
+    }
+    else if (Exp == 31)
+    {
+        f = Sign | 0x7F800000u | (Mant << 13u);
+    }
+    else
+    {
+        f = Sign | ((Exp + 112u) << 23u) | (Mant << 13u);
+    }
+
+    float Val;
+    memcpy(&Val, &f, sizeof(Val));
+    return Val;
+}
+
+// Row min/max accumulators. If Init is true, the destination rows are initialized with the source row.
+template <bool Init>
+void AccumulateRowMinMax(const float* pSrc, float* pMin, float* pMax, Uint32 Width)
+{
+    Uint32 x = 0;
+#if DILIGENT_SSE2_ENABLED
+    for (; x + 4 <= Width; x += 4)
+    {
+        const auto mVal = _mm_loadu_ps(pSrc + x);
+        _mm_storeu_ps(pMin + x, Init ? mVal : _mm_min_ps(_mm_loadu_ps(pMin + x), mVal));
+        _mm_storeu_ps(pMax + x, Init ? mVal : _mm_max_ps(_mm_loadu_ps(pMax + x), mVal));
+    }
+#endif
+    for (; x < Width; ++x)
+    {
+        pMin[x] = Init ? pSrc[x] : std::min(pMin[x], pSrc[x]);
+        pMax[x] = Init ? pSrc[x] : std::max(pMax[x], pSrc[x]);
+    }
+}
+
+template <bool Init>
+void AccumulateRowMinMax(const Uint16* pSrc, Int16* pMin, Int16* pMax, Uint32 Width, const Key16Transform& Transform)
+{
+    Uint32 x = 0;
+#if DILIGENT_SSE2_ENABLED
+    const auto mNegXor = _mm_set1_epi16(static_cast<short>(Transform.NegXor));
+    const auto mXor    = _mm_set1_epi16(static_cast<short>(Transform.Xor));
+    for (; x + 8 <= Width; x += 8)
+    {
+        const auto mVal = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x));
+        // Sign mask is 0xFFFF for values with the sign bit set
+        const auto mSign = _mm_srai_epi16(mVal, 15);
+        const auto mKey  = _mm_xor_si128(mVal, _mm_xor_si128(_mm_and_si128(mSign, mNegXor), mXor));
+
+        auto* pMin128 = reinterpret_cast<__m128i*>(pMin + x);
+        auto* pMax128 = reinterpret_cast<__m128i*>(pMax + x);
+        _mm_storeu_si128(pMin128, Init ? mKey : _mm_min_epi16(_mm_loadu_si128(pMin128), mKey));
+        _mm_storeu_si128(pMax128, Init ? mKey : _mm_max_epi16(_mm_loadu_si128(pMax128), mKey));
+    }
+#endif
+    for (; x < Width; ++x)
+    {
+        const Int16 Key = Transform.ToKey(pSrc[x]);
+
+        pMin[x] = Init ? Key : std::min(pMin[x], Key);
+        pMax[x] = Init ? Key : std::max(pMax[x], Key);
+    }
+}
+
+// Computes the vertical min/max of rows [Row0, Row1) of the source array restricted to
+// columns [Col0, Col1). The results are written to pMin[0..Col1-Col0) and pMax[0..Col1-Col0).
+template <typename KeyType>
+void ComputeColumnsMinMax(const Array2DDesc&    Array,
+                          Uint32                Col0,
+                          Uint32                Col1,
+                          Uint32                Row0,
+                          Uint32                Row1,
+                          KeyType*              pMin,
+                          KeyType*              pMax,
+                          const Key16Transform& Transform);
+
+template <>
+void ComputeColumnsMinMax<float>(const Array2DDesc& Array,
+                                 Uint32             Col0,
+                                 Uint32             Col1,
+                                 Uint32             Row0,
+                                 Uint32             Row1,
+                                 float*             pMin,
+                                 float*             pMax,
+                                 const Key16Transform&)
+{
+    const auto* pData = static_cast<const Uint8*>(Array.pData);
+    for (Uint32 row = Row0; row < Row1; ++row)
+    {
+        const auto* pRow = reinterpret_cast<const float*>(pData + row * Array.Stride) + Col0;
+        if (row == Row0)
+            AccumulateRowMinMax<true>(pRow, pMin, pMax, Col1 - Col0);
+        else
+            AccumulateRowMinMax<false>(pRow, pMin, pMax, Col1 - Col0);
+    }
+}
+
+template <>
+void ComputeColumnsMinMax<Int16>(const Array2DDesc&    Array,
+                                 Uint32                Col0,
+                                 Uint32                Col1,
+                                 Uint32                Row0,
+                                 Uint32                Row1,
+                                 Int16*                pMin,
+                                 Int16*                pMax,
+                                 const Key16Transform& Transform)
+{
+    const auto* pData = static_cast<const Uint8*>(Array.pData);
+    for (Uint32 row = Row0; row < Row1; ++row)
+    {
+        const auto* pRow = reinterpret_cast<const Uint16*>(pData + row * Array.Stride) + Col0;
+        if (row == Row0)
+            AccumulateRowMinMax<true>(pRow, pMin, pMax, Col1 - Col0, Transform);
+        else
+            AccumulateRowMinMax<false>(pRow, pMin, pMax, Col1 - Col0, Transform);
+    }
+}
+
+float KeyToFloat(float Key, VALUE_TYPE, const Key16Transform&)
+{
+    return Key;
+}
+
+float KeyToFloat(Int16 Key, VALUE_TYPE ValueType, const Key16Transform& Transform)
+{
+    const Uint16 Val = Transform.FromKey(Key);
+    return ValueType == VT_FLOAT16 ? HalfToFloat(Val) : static_cast<float>(Val);
+}
+
+// Computes level-0 texels [TileX0, TileX1) x [TileY0, TileY1) of the min/max pyramid
+template <typename KeyType>
+void ComputeTilesMinMax(const Array2DDesc& Array,
+                        Uint32             TileSize,
+                        Uint32             TileX0,
+                        Uint32             TileX1,
+                        Uint32             TileY0,
+                        Uint32             TileY1,
+                        float*             pDstMin,
+                        float*             pDstMax,
+                        size_t             DstStride)
+{
+    const Key16Transform Transform{Array.ValueType};
+
+    const Uint32 Col0 = TileX0 * TileSize;
+    const Uint32 Col1 = std::min(TileX1 * TileSize, Array.Width);
+
+    std::vector<KeyType> ColMinMax(size_t{Col1 - Col0} * 2);
+    KeyType*             pColMin = ColMinMax.data();
+    KeyType*             pColMax = pColMin + (Col1 - Col0);
+
+    for (Uint32 ty = TileY0; ty < TileY1; ++ty)
+    {
+        const Uint32 Row0 = ty * TileSize;
+        const Uint32 Row1 = std::min(Row0 + TileSize, Array.Height);
+        ComputeColumnsMinMax<KeyType>(Array, Col0, Col1, Row0, Row1, pColMin, pColMax, Transform);
+
+        float* pRowMin = pDstMin + ty * DstStride;
+        float* pRowMax = pDstMax + ty * DstStride;
+        for (Uint32 tx = TileX0; tx < TileX1; ++tx)
+        {
+            const Uint32 c0 = tx * TileSize - Col0;
+            const Uint32 c1 = std::min(c0 + TileSize, Col1 - Col0);
+
+            KeyType Min = pColMin[c0];
+            KeyType Max = pColMax[c0];
+            for (Uint32 c = c0 + 1; c < c1; ++c)
+            {
+                Min = std::min(Min, pColMin[c]);
+                Max = std::max(Max, pColMax[c]);
+            }
+            pRowMin[tx] = KeyToFloat(Min, Array.ValueType, Transform);
+            pRowMax[tx] = KeyToFloat(Max, Array.ValueType, Transform);
+        }
+    }
+}
+
+// Computes the 2x2 reduction of rows 2*y and 2*y+1 of the source level for destination texels [x0, x1)
+void Reduce2x2Row(const float* pSrcMin0,
+                  const float* pSrcMin1,
+                  const float* pSrcMax0,
+                  const float* pSrcMax1,
+                  Uint32       SrcWidth,
+                  Uint32       x0,
+                  Uint32       x1,
+                  float*       pDstMin,
+                  float*       pDstMax)
+{
+    Uint32 x = x0;
+#if DILIGENT_SSE2_ENABLED
+    // Process 4 destination texels at a time while both source columns exist
+    const Uint32 NumFullPairs = SrcWidth / 2;
+    for (; x + 4 <= std::min(x1, NumFullPairs); x += 4)
+    {
+        //  | a0 | a1 | a2 | a3 |  | a4 | a5 | a6 | a7 |    (row 0)
+        //  | b0 | b1 | b2 | b3 |  | b4 | b5 | b6 | b7 |    (row 1)
+        //  ->  | min(a0, a1, b0, b1) | min(a2, a3, b2, b3) | min(a4, a5, b4, b5) | min(a6, a7, b6, b7) |
+        const auto mMin0 = _mm_min_ps(_mm_loadu_ps(pSrcMin0 + 2 * x), _mm_loadu_ps(pSrcMin1 + 2 * x));
+        const auto mMin1 = _mm_min_ps(_mm_loadu_ps(pSrcMin0 + 2 * x + 4), _mm_loadu_ps(pSrcMin1 + 2 * x + 4));
+        const auto mMax0 = _mm_max_ps(_mm_loadu_ps(pSrcMax0 + 2 * x), _mm_loadu_ps(pSrcMax1 + 2 * x));
+        const auto mMax1 = _mm_max_ps(_mm_loadu_ps(pSrcMax0 + 2 * x + 4), _mm_loadu_ps(pSrcMax1 + 2 * x + 4));
+
+        const auto mMin = _mm_min_ps(_mm_shuffle_ps(mMin0, mMin1, _MM_SHUFFLE(2, 0, 2, 0)),
+                                     _mm_shuffle_ps(mMin0, mMin1, _MM_SHUFFLE(3, 1, 3, 1)));
+        const auto mMax = _mm_max_ps(_mm_shuffle_ps(mMax0, mMax1, _MM_SHUFFLE(2, 0, 2, 0)),
+                                     _mm_shuffle_ps(mMax0, mMax1, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_ps(pDstMin + x, mMin);
+        _mm_storeu_ps(pDstMax + x, mMax);
+    }
 #endif
+    for (; x < x1; ++x)
+    {
+        const Uint32 sx0 = x * 2;
+        const Uint32 sx1 = std::min(sx0 + 1, SrcWidth - 1);
+
+        pDstMin[x] = std::min(std::min(pSrcMin0[sx0], pSrcMin0[sx1]), std::min(pSrcMin1[sx0], pSrcMin1[sx1]));
+        pDstMax[x] = std::max(std::max(pSrcMax0[sx0], pSrcMax0[sx1]), std::max(pSrcMax1[sx0], pSrcMax1[sx1]));
+    }
+}
+
+// Returns the number of rows processed by one thread pool task so that every task
+// handles at least a few thousand elements.
+Uint32 GetRowsPerTask(size_t ElementsPerRow)
+{
+    constexpr size_t MinElementsPerTask = 16384;
+    return static_cast<Uint32>(std::max(MinElementsPerTask / std::max(ElementsPerRow, size_t{1}), size_t{1}));
+}
 
 } // namespace
 
@@ -147,9 +458,195 @@ void GetArray2DMinMaxValue(const float* pData,
 #if DILIGENT_AVX2_ENABLED
     if (GetArray2DMinMaxValueAVX2(pData, StrideInFloats, Width, Height, MinValue, MaxValue))
         return;
+#elif DILIGENT_SSE2_ENABLED
+    if (GetArray2DMinMaxValueSSE2(pData, StrideInFloats, Width, Height, MinValue, MaxValue))
+        return;
 #endif
 
     GetArray2DMinMaxValueGeneric(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
 }
 
+bool IsArray2DMinMaxTypeSupported(VALUE_TYPE ValueType)
+{
+    return ValueType == VT_FLOAT32 || ValueType == VT_FLOAT16 || ValueType == VT_UINT16;
+}
+
+void GetArray2DMinMaxValue(const Array2DDesc& Array,
+                           float&             MinValue,
+                           float&             MaxValue)
+{
+    if (Array.Width == 0 || Array.Height == 0)
+        return;
+
+    DEV_CHECK_ERR(IsArray2DMinMaxTypeSupported(Array.ValueType), "Value type ", Uint32{Array.ValueType}, " is not supported");
+    if (Array.ValueType == VT_FLOAT32)
+    {
+        DEV_CHECK_ERR(Array.Stride % sizeof(float) == 0, "Row stride (", Array.Stride, ") must be a multiple of the element size");
+        GetArray2DMinMaxValue(static_cast<const float*>(Array.pData), Array.Stride / sizeof(float), Array.Width, Array.Height, MinValue, MaxValue);
+        return;
+    }
+
+    DEV_CHECK_ERR(Array.pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Array.Height == 1 || Array.Stride >= Array.Width * sizeof(Uint16), "Row stride (", Array.Stride, ") must be at least ", Array.Width * sizeof(Uint16));
+    DEV_CHECK_ERR(AlignDown(Array.pData, alignof(Uint16)) == Array.pData, "Data pointer is not naturally aligned");
+
+    // Accumulate vertical min/max of all rows and reduce the result
+    const Key16Transform Transform{Array.ValueType};
+
+    std::vector<Int16> ColMinMax(size_t{Array.Width} * 2);
+    Int16*             pColMin = ColMinMax.data();
+    Int16*             pColMax = pColMin + Array.Width;
+    ComputeColumnsMinMax<Int16>(Array, 0, Array.Width, 0, Array.Height, pColMin, pColMax, Transform);
+
+    Int16 Min = pColMin[0];
+    Int16 Max = pColMax[0];
+    for (Uint32 x = 1; x < Array.Width; ++x)
+    {
+        Min = std::min(Min, pColMin[x]);
+        Max = std::max(Max, pColMax[x]);
+    }
+    MinValue = KeyToFloat(Min, Array.ValueType, Transform);
+    MaxValue = KeyToFloat(Max, Array.ValueType, Transform);
+}
+
+
+void Array2DMinMaxPyramid::Build(const Array2DDesc& Array,
+                                 Uint32             TileSize,
+                                 IThreadPool*       pThreadPool)
+{
+    Clear();
+    if (Array.Width == 0 || Array.Height == 0)
+        return;
+
+    DEV_CHECK_ERR(Array.pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(IsArray2DMinMaxTypeSupported(Array.ValueType), "Value type ", Uint32{Array.ValueType}, " is not supported");
+    DEV_CHECK_ERR(TileSize > 0, "Tile size must not be zero");
+    DEV_CHECK_ERR(Array.Height == 1 || Array.Stride >= Array.Width * (Array.ValueType == VT_FLOAT32 ? sizeof(float) : sizeof(Uint16)), "Row stride (", Array.Stride, ") is too small");
+
+    m_ValueType = Array.ValueType;
+    m_Width     = Array.Width;
+    m_Height    = Array.Height;
+    m_TileSize  = std::max(TileSize, 1u);
+
+    Uint32 LevelWidth  = (m_Width + m_TileSize - 1) / m_TileSize;
+    Uint32 LevelHeight = (m_Height + m_TileSize - 1) / m_TileSize;
+    size_t Offset      = 0;
+    while (true)
+    {
+        LevelInfo Level;
+        Level.Offset = Offset;
+        Level.Width  = LevelWidth;
+        Level.Height = LevelHeight;
+        m_Levels.push_back(Level);
+        Offset += size_t{LevelWidth} * size_t{LevelHeight};
+
+        if (LevelWidth == 1 && LevelHeight == 1)
+            break;
+
+        LevelWidth  = (LevelWidth + 1) / 2;
+        LevelHeight = (LevelHeight + 1) / 2;
+    }
+    m_Min.resize(Offset);
+    m_Max.resize(Offset);
+
+    Update(Array, 0, 0, m_Width, m_Height, pThreadPool);
+}
+
+void Array2DMinMaxPyramid::Update(const Array2DDesc& Array,
+                                  Uint32             Left,
+                                  Uint32             Top,
+                                  Uint32             Right,
+                                  Uint32             Bottom,
+                                  IThreadPool*       pThreadPool)
+{
+    if (m_Levels.empty())
+        return;
+
+    DEV_CHECK_ERR(Array.pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Array.ValueType == m_ValueType && Array.Width == m_Width && Array.Height == m_Height,
+                  "The array must have the same type and size as the one used to build the pyramid");
+
+    Right  = std::min(Right, m_Width);
+    Bottom = std::min(Bottom, m_Height);
+    if (Left >= Right || Top >= Bottom)
+        return;
+
+    // Level-0 texels that cover the modified region
+    Uint32 x0 = Left / m_TileSize;
+    Uint32 y0 = Top / m_TileSize;
+    Uint32 x1 = (Right + m_TileSize - 1) / m_TileSize;
+    Uint32 y1 = (Bottom + m_TileSize - 1) / m_TileSize;
+    UpdateLevel0(Array, x0, y0, x1, y1, pThreadPool);
+
+    for (Uint32 Level = 1; Level < m_Levels.size(); ++Level)
+    {
+        // Texel i of the parent level covers texels 2*i and 2*i+1 of the child level
+        x0 = x0 / 2;
+        y0 = y0 / 2;
+        x1 = (x1 - 1) / 2 + 1;
+        y1 = (y1 - 1) / 2 + 1;
+        UpdateLevel(Level, x0, y0, x1, y1, pThreadPool);
+    }
+}
+
+void Array2DMinMaxPyramid::UpdateLevel0(const Array2DDesc& Array, Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1, IThreadPool* pThreadPool)
+{
+    const auto&  Level       = m_Levels[0];
+    const Uint32 RowsPerTask = GetRowsPerTask(size_t{x1 - x0} * m_TileSize * m_TileSize);
+    const Uint32 NumTasks    = (y1 - y0 + RowsPerTask - 1) / RowsPerTask;
+
+    float* pMin = &m_Min[Level.Offset];
+    float* pMax = &m_Max[Level.Offset];
+    ParallelFor(pThreadPool, NumTasks, [&](Uint32 Task) {
+        const Uint32 TaskY0 = y0 + Task * RowsPerTask;
+        const Uint32 TaskY1 = std::min(TaskY0 + RowsPerTask, y1);
+        if (m_ValueType == VT_FLOAT32 && m_TileSize == 1)
+        {
+            // Level 0 is a copy of the source array
+            for (Uint32 y = TaskY0; y < TaskY1; ++y)
+            {
+                const auto* pSrcRow = reinterpret_cast<const float*>(static_cast<const Uint8*>(Array.pData) + y * Array.Stride) + x0;
+                memcpy(pMin + size_t{y} * Level.Width + x0, pSrcRow, sizeof(float) * (x1 - x0));
+                memcpy(pMax + size_t{y} * Level.Width + x0, pSrcRow, sizeof(float) * (x1 - x0));
+            }
+        }
+        else if (m_ValueType == VT_FLOAT32)
+            ComputeTilesMinMax<float>(Array, m_TileSize, x0, x1, TaskY0, TaskY1, pMin, pMax, Level.Width);
+        else
+            ComputeTilesMinMax<Int16>(Array, m_TileSize, x0, x1, TaskY0, TaskY1, pMin, pMax, Level.Width);
+    });
+}
+
+void Array2DMinMaxPyramid::UpdateLevel(Uint32 Level, Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1, IThreadPool* pThreadPool)
+{
+    const auto&  Src         = m_Levels[Level - 1];
+    const auto&  Dst         = m_Levels[Level];
+    const Uint32 RowsPerTask = GetRowsPerTask(size_t{x1 - x0} * 4);
+    const Uint32 NumTasks    = (y1 - y0 + RowsPerTask - 1) / RowsPerTask;
+
+    ParallelFor(pThreadPool, NumTasks, [&](Uint32 Task) {
+        const Uint32 TaskY0 = y0 + Task * RowsPerTask;
+        const Uint32 TaskY1 = std::min(TaskY0 + RowsPerTask, y1);
+        for (Uint32 y = TaskY0; y < TaskY1; ++y)
+        {
+            const size_t SrcRow0 = Src.Offset + size_t{y * 2} * Src.Width;
+            const size_t SrcRow1 = Src.Offset + size_t{std::min(y * 2 + 1, Src.Height - 1)} * Src.Width;
+            const size_t DstRow  = Dst.Offset + size_t{y} * Dst.Width;
+            Reduce2x2Row(&m_Min[SrcRow0], &m_Min[SrcRow1], &m_Max[SrcRow0], &m_Max[SrcRow1],
+                         Src.Width, x0, x1, &m_Min[DstRow], &m_Max[DstRow]);
+        }
+    });
+}
+
+void Array2DMinMaxPyramid::Clear()
+{
+    m_Levels.clear();
+    m_Min.clear();
+    m_Max.clear();
+    m_ValueType = VT_UNDEFINED;
+    m_Width     = 0;
+    m_Height    = 0;
+    m_TileSize  = 1;
+}
+
 } // namespace Diligent
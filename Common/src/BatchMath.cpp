@@ -0,0 +1,414 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BatchMath.hpp"
+
+#include <algorithm>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every SIMD operation below matches the corresponding scalar operation in BasicMath.hpp,
+// including the order of additions, so that the results are the same as the scalar ones.
+// Min(a, b) and Max(a, b) follow the semantics of std::min(a, b) and std::max(a, b).
+
+#if DILIGENT_SSE2_ENABLED
+struct SIMD4
+{
+    using Vec                     = __m128;
+    static constexpr size_t Width = 4;
+
+    static Vec  Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+    static void Store3(float* p, Vec v)
+    {
+        _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+        _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+    }
+    static Vec Splat(float f) { return _mm_set1_ps(f); }
+    static Vec SplatW(Vec v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+    static Vec Zero() { return _mm_setzero_ps(); }
+    static Vec Add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec Mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static Vec Div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+    static Vec Min(Vec a, Vec b) { return _mm_min_ps(b, a); }
+    static Vec Max(Vec a, Vec b) { return _mm_max_ps(b, a); }
+};
+#elif DILIGENT_NEON_ENABLED
+struct SIMD4
+{
+    using Vec                     = float32x4_t;
+    static constexpr size_t Width = 4;
+
+    static Vec  Load(const float* p) { return vld1q_f32(p); }
+    static void Store(float* p, Vec v) { vst1q_f32(p, v); }
+    static void Store3(float* p, Vec v)
+    {
+        vst1_f32(p, vget_low_f32(v));
+        vst1q_lane_f32(p + 2, v, 2);
+    }
+    static Vec Splat(float f) { return vdupq_n_f32(f); }
+    static Vec SplatW(Vec v) { return vdupq_lane_f32(vget_high_f32(v), 1); }
+    static Vec Zero() { return vdupq_n_f32(0); }
+    static Vec Add(Vec a, Vec b) { return vaddq_f32(a, b); }
+    static Vec Mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+#    if defined(__aarch64__) || defined(_M_ARM64)
+    static Vec Div(Vec a, Vec b)
+    {
+        return vdivq_f32(a, b);
+    }
+#    else
+    static Vec Div(Vec a, Vec b)
+    {
+        float fa[4], fb[4];
+        vst1q_f32(fa, a);
+        vst1q_f32(fb, b);
+        for (int i = 0; i < 4; ++i)
+            fa[i] /= fb[i];
+        return vld1q_f32(fa);
+    }
+#    endif
+    // Use comparisons rather than vminq/vmaxq to get the same results for signed zeros
+    static Vec Min(Vec a, Vec b) { return vbslq_f32(vcltq_f32(b, a), b, a); }
+    static Vec Max(Vec a, Vec b) { return vbslq_f32(vcltq_f32(a, b), b, a); }
+};
+#endif
+
+#if DILIGENT_AVX2_ENABLED
+struct SIMD8
+{
+    using Vec                     = __m256;
+    static constexpr size_t Width = 8;
+
+    static Vec  Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+    static Vec  Splat(float f) { return _mm256_set1_ps(f); }
+    static Vec  Min(Vec a, Vec b) { return _mm256_min_ps(b, a); }
+    static Vec  Max(Vec a, Vec b) { return _mm256_max_ps(b, a); }
+};
+using SIMDWide = SIMD8;
+#elif DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+using SIMDWide = SIMD4;
+#endif
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+
+struct MatrixRows
+{
+    explicit MatrixRows(const float4x4& m) :
+        r0{SIMD4::Load(m[0])},
+        r1{SIMD4::Load(m[1])},
+        r2{SIMD4::Load(m[2])},
+        r3{SIMD4::Load(m[3])}
+    {}
+
+    // Computes (((x * r0 + y * r1) + z * r2) + w * r3)
+    SIMD4::Vec Transform(SIMD4::Vec x, SIMD4::Vec y, SIMD4::Vec z, SIMD4::Vec w) const
+    {
+        auto v = SIMD4::Add(SIMD4::Mul(x, r0), SIMD4::Mul(y, r1));
+        v      = SIMD4::Add(v, SIMD4::Mul(z, r2));
+        return SIMD4::Add(v, SIMD4::Mul(w, r3));
+    }
+
+    SIMD4::Vec r0;
+    SIMD4::Vec r1;
+    SIMD4::Vec r2;
+    SIMD4::Vec r3;
+};
+
+void TransformPointsSIMD(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    const MatrixRows Rows{Matrix};
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float3 Src = pSrc[i];
+
+        const auto v = Rows.Transform(SIMD4::Splat(Src.x), SIMD4::Splat(Src.y), SIMD4::Splat(Src.z), SIMD4::Splat(1));
+        SIMD4::Store3(&pDst[i].x, SIMD4::Div(v, SIMD4::SplatW(v)));
+    }
+}
+
+void TransformDirectionsSIMD(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    const MatrixRows Rows{Matrix};
+    const auto       Zero = SIMD4::Zero();
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float3 Src = pSrc[i];
+        SIMD4::Store3(&pDst[i].x, Rows.Transform(SIMD4::Splat(Src.x), SIMD4::Splat(Src.y), SIMD4::Splat(Src.z), Zero));
+    }
+}
+
+void TransformVectorsSIMD(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    const MatrixRows Rows{Matrix};
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float4 Src = pSrc[i];
+        SIMD4::Store(&pDst[i].x, Rows.Transform(SIMD4::Splat(Src.x), SIMD4::Splat(Src.y), SIMD4::Splat(Src.z), SIMD4::Splat(Src.w)));
+    }
+}
+
+void TransformBoundBoxesSIMD(const BoundBox* pSrc, size_t Count, const float4x4& Matrix, BoundBox* pDst)
+{
+    const MatrixRows Rows{Matrix};
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const BoundBox Src = pSrc[i];
+
+        auto Min = Rows.r3;
+        auto Max = Rows.r3;
+
+        auto v0 = SIMD4::Mul(Rows.r0, SIMD4::Splat(Src.Min.x));
+        auto v1 = SIMD4::Mul(Rows.r0, SIMD4::Splat(Src.Max.x));
+        Min     = SIMD4::Add(Min, SIMD4::Min(v0, v1));
+        Max     = SIMD4::Add(Max, SIMD4::Max(v0, v1));
+
+        v0  = SIMD4::Mul(Rows.r1, SIMD4::Splat(Src.Min.y));
+        v1  = SIMD4::Mul(Rows.r1, SIMD4::Splat(Src.Max.y));
+        Min = SIMD4::Add(Min, SIMD4::Min(v0, v1));
+        Max = SIMD4::Add(Max, SIMD4::Max(v0, v1));
+
+        v0  = SIMD4::Mul(Rows.r2, SIMD4::Splat(Src.Min.z));
+        v1  = SIMD4::Mul(Rows.r2, SIMD4::Splat(Src.Max.z));
+        Min = SIMD4::Add(Min, SIMD4::Min(v0, v1));
+        Max = SIMD4::Add(Max, SIMD4::Max(v0, v1));
+
+        SIMD4::Store3(&pDst[i].Min.x, Min);
+        SIMD4::Store3(&pDst[i].Max.x, Max);
+    }
+}
+
+void MultiplyMatricesSIMD(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    const MatrixRows Rows{Matrix};
+    const auto       Zero = SIMD4::Zero();
+
+    // Matrix4x4::Mul() accumulates the products starting from zero
+    const auto MulRow = [&](const float* Row) {
+        auto v = SIMD4::Add(Zero, SIMD4::Mul(SIMD4::Splat(Row[0]), Rows.r0));
+        v      = SIMD4::Add(v, SIMD4::Mul(SIMD4::Splat(Row[1]), Rows.r1));
+        v      = SIMD4::Add(v, SIMD4::Mul(SIMD4::Splat(Row[2]), Rows.r2));
+        return SIMD4::Add(v, SIMD4::Mul(SIMD4::Splat(Row[3]), Rows.r3));
+    };
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float4x4& Src = pSrc[i];
+
+        // Compute all rows before storing them as pDst may be equal to pSrc
+        const auto Row0 = MulRow(Src[0]);
+        const auto Row1 = MulRow(Src[1]);
+        const auto Row2 = MulRow(Src[2]);
+        const auto Row3 = MulRow(Src[3]);
+
+        float4x4& Dst = pDst[i];
+        SIMD4::Store(Dst[0], Row0);
+        SIMD4::Store(Dst[1], Row1);
+        SIMD4::Store(Dst[2], Row2);
+        SIMD4::Store(Dst[3], Row3);
+    }
+}
+
+// Computes the per-component minimum and maximum of an array of records of RecordSize floats.
+// Returns the number of processed records; the remaining records must be processed by the caller.
+template <size_t RecordSize>
+size_t GetRecordsMinMaxSIMD(const float* pData, size_t NumRecords, float* Min, float* Max)
+{
+    // Each iteration loads three registers, which contain a whole number of records
+    // both for 3-float (points) and 6-float (boxes) records.
+    constexpr size_t ChunkSize = SIMDWide::Width * 3;
+    static_assert(ChunkSize % RecordSize == 0, "Chunk size must be a multiple of the record size");
+    constexpr size_t RecordsPerChunk = ChunkSize / RecordSize;
+
+    const size_t NumChunks = NumRecords / RecordsPerChunk;
+    if (NumChunks == 0)
+        return 0;
+
+    SIMDWide::Vec mmMin[3];
+    SIMDWide::Vec mmMax[3];
+    for (size_t j = 0; j < 3; ++j)
+    {
+        mmMin[j] = SIMDWide::Splat(+FLT_MAX);
+        mmMax[j] = SIMDWide::Splat(-FLT_MAX);
+    }
+
+    for (size_t i = 0; i < NumChunks; ++i)
+    {
+        const float* pChunk = pData + i * ChunkSize;
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const auto mmVal = SIMDWide::Load(pChunk + j * SIMDWide::Width);
+            mmMin[j]         = SIMDWide::Min(mmMin[j], mmVal);
+            mmMax[j]         = SIMDWide::Max(mmMax[j], mmVal);
+        }
+    }
+
+    // Lane k of the chunk always holds component k % RecordSize
+    float ChunkMin[ChunkSize];
+    float ChunkMax[ChunkSize];
+    for (size_t j = 0; j < 3; ++j)
+    {
+        SIMDWide::Store(ChunkMin + j * SIMDWide::Width, mmMin[j]);
+        SIMDWide::Store(ChunkMax + j * SIMDWide::Width, mmMax[j]);
+    }
+    for (size_t k = 0; k < ChunkSize; ++k)
+    {
+        Min[k % RecordSize] = (std::min)(Min[k % RecordSize], ChunkMin[k]);
+        Max[k % RecordSize] = (std::max)(Max[k % RecordSize], ChunkMax[k]);
+    }
+
+    return NumChunks * RecordsPerChunk;
+}
+
+#endif
+
+} // namespace
+
+void TransformPoints(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    if (Count == 0)
+        return;
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    TransformPointsSIMD(pSrc, Count, Matrix, pDst);
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * Matrix;
+#endif
+}
+
+void TransformDirections(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    if (Count == 0)
+        return;
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    TransformDirectionsSIMD(pSrc, Count, Matrix, pDst);
+#else
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float4 v = float4{pSrc[i].x, pSrc[i].y, pSrc[i].z, 0} * Matrix;
+        pDst[i]        = float3{v.x, v.y, v.z};
+    }
+#endif
+}
+
+void TransformVectors(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    if (Count == 0)
+        return;
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    TransformVectorsSIMD(pSrc, Count, Matrix, pDst);
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * Matrix;
+#endif
+}
+
+void TransformBoundBoxes(const BoundBox* pSrc, size_t Count, const float4x4& Matrix, BoundBox* pDst)
+{
+    if (Count == 0)
+        return;
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    TransformBoundBoxesSIMD(pSrc, Count, Matrix, pDst);
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i].Transform(Matrix);
+#endif
+}
+
+void MultiplyMatrices(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    if (Count == 0)
+        return;
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    MultiplyMatricesSIMD(pSrc, Count, Matrix, pDst);
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * Matrix;
+#endif
+}
+
+BoundBox GetPointsBoundBox(const float3* pPoints, size_t Count)
+{
+    BoundBox Box = BoundBox::Invalid();
+    if (Count == 0)
+        return Box;
+    DEV_CHECK_ERR(pPoints != nullptr, "Points must not be null");
+
+    size_t Start = 0;
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    static_assert(sizeof(float3) == sizeof(float) * 3, "Unexpected float3 size");
+    Start = GetRecordsMinMaxSIMD<3>(&pPoints[0].x, Count, Box.Min.Data(), Box.Max.Data());
+#endif
+
+    for (size_t i = Start; i < Count; ++i)
+        Box = Box.Enclose(pPoints[i]);
+
+    return Box;
+}
+
+BoundBox CombineBoundBoxes(const BoundBox* pBoxes, size_t Count)
+{
+    BoundBox Box = BoundBox::Invalid();
+    if (Count == 0)
+        return Box;
+    DEV_CHECK_ERR(pBoxes != nullptr, "Boxes must not be null");
+
+    size_t Start = 0;
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    static_assert(sizeof(BoundBox) == sizeof(float) * 6, "Unexpected BoundBox size");
+    float Min[6] = {+FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX};
+    float Max[6] = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+    Start        = GetRecordsMinMaxSIMD<6>(&pBoxes[0].Min.x, Count, Min, Max);
+    // The first three components of every record are the box minimum, the last three are the maximum
+    Box.Min = float3{Min[0], Min[1], Min[2]};
+    Box.Max = float3{Max[3], Max[4], Max[5]};
+#endif
+
+    for (size_t i = Start; i < Count; ++i)
+        Box = Box.Combine(pBoxes[i]);
+
+    return Box;
+}
+
+} // namespace Diligent
@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "FileLoader.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "../../Platforms/interface/FileReadQueue.hpp"
+#include "../../Platforms/interface/FileSystem.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+bool IsAsyncFileReadSupported()
+{
+    static const bool IsSupported = FileReadQueue{1}.IsValid();
+    return IsSupported;
+}
+
+namespace
+{
+
+RefCntAutoPtr<IDataBlob> ReadFileSync(const Char* Path)
+{
+    if (!FileSystem::FileExists(Path))
+        return {};
+
+    FileWrapper File{Path, EFileAccessMode::Read};
+    if (!File)
+        return {};
+
+    auto pData = DataBlobImpl::Create();
+    if (!File->Read(pData))
+        return {};
+
+    return RefCntAutoPtr<IDataBlob>{pData};
+}
+
+void LoadFilesWithQueue(const LoadFilesAttribs& Attribs, FileReadQueue& Queue)
+{
+    std::vector<RefCntAutoPtr<DataBlobImpl>> Blobs(Attribs.NumFiles);
+    std::vector<Uint32>                      RequestToFile;
+
+    // Every open file holds a descriptor until its read completes, so the files are opened
+    // lazily and no more than QueueDepth of them are open at the same time.
+    const Uint32 MaxOpenFiles = std::max(Attribs.QueueDepth, 1u);
+
+    Uint32 NumOpenFiles = 0;
+    Uint32 NextFile     = 0;
+    while (NextFile < Attribs.NumFiles || NumOpenFiles > 0)
+    {
+        while (NextFile < Attribs.NumFiles && NumOpenFiles < MaxOpenFiles)
+        {
+            const Uint32 FileIndex = NextFile;
+
+            Uint32     RequestId = 0;
+            size_t     Size      = 0;
+            const auto Res       = Queue.Open(Attribs.ppPaths[FileIndex], RequestId, Size);
+            if (Res == EFileReadQueueOpenResult::TooManyOpenFiles && NumOpenFiles > 0)
+            {
+                // Wait until one of the reads in flight completes and releases its descriptor
+                break;
+            }
+
+            ++NextFile;
+            if (Res == EFileReadQueueOpenResult::TooManyOpenFiles)
+            {
+                // The descriptors are held by someone else: try reading the file synchronously
+                Attribs.Callback(FileIndex, ReadFileSync(Attribs.ppPaths[FileIndex]));
+                continue;
+            }
+            else if (Res != EFileReadQueueOpenResult::Success)
+            {
+                Attribs.Callback(FileIndex, nullptr);
+                continue;
+            }
+
+            if (RequestId >= RequestToFile.size())
+                RequestToFile.resize(size_t{RequestId} + 1);
+            RequestToFile[RequestId] = FileIndex;
+
+            Blobs[FileIndex] = DataBlobImpl::Create(Size);
+            Queue.Read(RequestId, Size > 0 ? Blobs[FileIndex]->GetDataPtr() : nullptr);
+            ++NumOpenFiles;
+        }
+
+        if (NumOpenFiles == 0)
+            continue;
+
+        // WaitForCompletion() only returns false when no reads are in flight,
+        // so the blobs are never released while the kernel may write to them.
+        Uint32 RequestId = 0;
+        bool   Success   = false;
+        if (!Queue.WaitForCompletion(RequestId, Success))
+        {
+            UNEXPECTED("There are open files, but no outstanding requests");
+            break;
+        }
+        --NumOpenFiles;
+
+        const Uint32 FileIndex = RequestToFile[RequestId];
+        if (Success)
+        {
+            Attribs.Callback(FileIndex, Blobs[FileIndex].RawPtr());
+        }
+        else
+        {
+            // The read may fail if the kernel does not support it or if the ring becomes unusable.
+            // Retry synchronously so that the result does not depend on the queue.
+            Attribs.Callback(FileIndex, ReadFileSync(Attribs.ppPaths[FileIndex]));
+        }
+        Blobs[FileIndex].Release();
+    }
+}
+
+} // namespace
+
+void LoadFiles(const LoadFilesAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.ppPaths != nullptr || Attribs.NumFiles == 0, "ppPaths must not be null");
+    DEV_CHECK_ERR(Attribs.Callback, "Callback must not be null");
+    if (Attribs.NumFiles == 0 || !Attribs.Callback)
+        return;
+
+    if (IsAsyncFileReadSupported())
+    {
+        FileReadQueue Queue{Attribs.QueueDepth};
+        if (Queue.IsValid())
+        {
+            LoadFilesWithQueue(Attribs, Queue);
+            return;
+        }
+    }
+
+    ParallelFor(Attribs.pThreadPool, Attribs.NumFiles,
+                [&Attribs](Uint32 FileIndex) {
+                    auto pData = ReadFileSync(Attribs.ppPaths[FileIndex]);
+                    Attribs.Callback(FileIndex, pData);
+                });
+}
+
+RefCntAutoPtr<IAsyncTask> LoadFilesAsync(const LoadFilesAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.pThreadPool != nullptr, "Thread pool must not be null");
+    DEV_CHECK_ERR(Attribs.ppPaths != nullptr || Attribs.NumFiles == 0, "ppPaths must not be null");
+    DEV_CHECK_ERR(Attribs.Callback, "Callback must not be null");
+    if (Attribs.pThreadPool == nullptr)
+        return {};
+
+    std::vector<String> Paths(Attribs.NumFiles);
+    for (Uint32 i = 0; i < Attribs.NumFiles; ++i)
+        Paths[i] = Attribs.ppPaths[i];
+
+    return EnqueueAsyncWork(Attribs.pThreadPool,
+                            [Attribs, Paths = std::move(Paths)](Uint32 ThreadId) {
+                                std::vector<const Char*> pPaths(Paths.size());
+                                for (size_t i = 0; i < Paths.size(); ++i)
+                                    pPaths[i] = Paths[i].c_str();
+
+                                LoadFilesAttribs TaskAttribs{Attribs};
+                                TaskAttribs.ppPaths = pPaths.data();
+                                LoadFiles(TaskAttribs);
+                                return ASYNC_TASK_STATUS_COMPLETE;
+                            });
+}
+
+} // namespace Diligent
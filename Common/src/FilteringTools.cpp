@@ -0,0 +1,407 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FilteringTools.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "Intrinsics.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+float Sinc(float x)
+{
+    if (std::abs(x) < 1e-6f)
+        return 1.f;
+    x *= PI_F;
+    return std::sin(x) / x;
+}
+
+// Zeroth-order modified Bessel function of the first kind
+float BesselI0(float x)
+{
+    const float HalfX2 = x * x * 0.25f;
+
+    float Sum  = 1.f;
+    float Term = 1.f;
+    for (int k = 1; k < 32 && Term > Sum * 1e-8f; ++k)
+    {
+        Term *= HalfX2 / static_cast<float>(k * k);
+        Sum += Term;
+    }
+    return Sum;
+}
+
+float BoxFilter(float x)
+{
+    return (x >= -0.5f && x < 0.5f) ? 1.f : 0.f;
+}
+
+float TriangleFilter(float x)
+{
+    x = std::abs(x);
+    return x < 1.f ? 1.f - x : 0.f;
+}
+
+float Lanczos3Filter(float x)
+{
+    return std::abs(x) < 3.f ? Sinc(x) * Sinc(x / 3.f) : 0.f;
+}
+
+float KaiserFilter(float x)
+{
+    constexpr float Width = 3.f;
+    constexpr float Alpha = 4.f;
+
+    const float t = x / Width;
+    if (t * t >= 1.f)
+        return 0.f;
+
+    static const float InvI0Alpha = 1.f / BesselI0(Alpha);
+    return Sinc(x) * BesselI0(Alpha * std::sqrt(1.f - t * t)) * InvI0Alpha;
+}
+
+struct FilterKernel
+{
+    float Radius;
+    float (*Eval)(float);
+};
+
+FilterKernel GetFilterKernel(RESAMPLE_FILTER Filter)
+{
+    static_assert(RESAMPLE_FILTER_COUNT == 4, "Please handle the new filter type below");
+    switch (Filter)
+    {
+        case RESAMPLE_FILTER_BOX: return {0.5f, BoxFilter};
+        case RESAMPLE_FILTER_BILINEAR: return {1.f, TriangleFilter};
+        case RESAMPLE_FILTER_LANCZOS3: return {3.f, Lanczos3Filter};
+        case RESAMPLE_FILTER_KAISER: return {3.f, KaiserFilter};
+
+        default:
+            UNEXPECTED("Unexpected filter");
+            return {1.f, TriangleFilter};
+    }
+}
+
+// Filter taps for every destination sample in one dimension.
+// Every sample uses the same number of taps, unused taps have zero weight.
+struct FilterTaps
+{
+    Uint32             NumTaps = 0;
+    std::vector<Int32> Indices;
+    std::vector<float> Weights;
+
+    const Int32* GetIndices(Uint32 i) const { return &Indices[size_t{i} * NumTaps]; }
+    const float* GetWeights(Uint32 i) const { return &Weights[size_t{i} * NumTaps]; }
+};
+
+FilterTaps ComputeFilterTaps(Uint32 SrcSize, Uint32 DstSize, RESAMPLE_FILTER Filter, TEXTURE_ADDRESS_MODE AddressMode)
+{
+    const FilterKernel Kernel = GetFilterKernel(Filter);
+
+    const float Scale = static_cast<float>(SrcSize) / static_cast<float>(DstSize);
+    // Stretch the filter when downsampling
+    const float FilterScale    = std::max(Scale, 1.f);
+    const float InvFilterScale = 1.f / FilterScale;
+    const float Radius         = Kernel.Radius * FilterScale;
+
+    FilterTaps Taps;
+    Taps.NumTaps = static_cast<Uint32>(std::ceil(Radius * 2.f)) + 1;
+    Taps.Indices.resize(size_t{DstSize} * Taps.NumTaps);
+    Taps.Weights.resize(size_t{DstSize} * Taps.NumTaps);
+
+    for (Uint32 i = 0; i < DstSize; ++i)
+    {
+        Int32* pIndices = &Taps.Indices[size_t{i} * Taps.NumTaps];
+        float* pWeights = &Taps.Weights[size_t{i} * Taps.NumTaps];
+
+        // Source texel j is centered at j + 0.5
+        const float Center = (static_cast<float>(i) + 0.5f) * Scale;
+        const Int32 First  = static_cast<Int32>(std::ceil(Center - Radius - 0.5f));
+        const Int32 Last   = std::min(static_cast<Int32>(std::floor(Center + Radius - 0.5f)), First + static_cast<Int32>(Taps.NumTaps) - 1);
+
+        float WeightSum = 0;
+        for (Int32 j = First; j <= Last; ++j)
+        {
+            const float Weight = Kernel.Eval((static_cast<float>(j) + 0.5f - Center) * InvFilterScale);
+
+            pIndices[j - First] = ApplyTexAddressMode(j, SrcSize, AddressMode);
+            pWeights[j - First] = Weight;
+            WeightSum += Weight;
+        }
+
+        if (WeightSum != 0)
+        {
+            for (Uint32 t = 0; t < Taps.NumTaps; ++t)
+                pWeights[t] /= WeightSum;
+        }
+        else
+        {
+            // Fall back to the nearest texel
+            pIndices[0] = ApplyTexAddressMode(static_cast<Int32>(std::floor(Center)), SrcSize, AddressMode);
+            pWeights[0] = 1;
+        }
+    }
+
+    return Taps;
+}
+
+void ConvertRowToFloat(const Uint8* pSrc, float* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const auto Zero = _mm_setzero_si128();
+    for (; i + 16 <= Count; i += 16)
+    {
+        const auto Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+        const auto Lo16  = _mm_unpacklo_epi8(Bytes, Zero);
+        const auto Hi16  = _mm_unpackhi_epi8(Bytes, Zero);
+        _mm_storeu_ps(pDst + i + 0, _mm_cvtepi32_ps(_mm_unpacklo_epi16(Lo16, Zero)));
+        _mm_storeu_ps(pDst + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(Lo16, Zero)));
+        _mm_storeu_ps(pDst + i + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(Hi16, Zero)));
+        _mm_storeu_ps(pDst + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(Hi16, Zero)));
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = static_cast<float>(pSrc[i]);
+}
+
+void ConvertRowToUint8(const float* pSrc, Uint8* pDst, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    // Note that _mm_cvtps_epi32 rounds to nearest, and the packs saturate to [0, 255]
+    for (; i + 16 <= Count; i += 16)
+    {
+        const auto I0 = _mm_cvtps_epi32(_mm_loadu_ps(pSrc + i + 0));
+        const auto I1 = _mm_cvtps_epi32(_mm_loadu_ps(pSrc + i + 4));
+        const auto I2 = _mm_cvtps_epi32(_mm_loadu_ps(pSrc + i + 8));
+        const auto I3 = _mm_cvtps_epi32(_mm_loadu_ps(pSrc + i + 12));
+        const auto Lo = _mm_packs_epi32(I0, I1);
+        const auto Hi = _mm_packs_epi32(I2, I3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm_packus_epi16(Lo, Hi));
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = static_cast<Uint8>(clamp(std::nearbyint(pSrc[i]), 0.f, 255.f));
+}
+
+// Filters one row in the horizontal direction
+template <Uint32 NumComponents>
+void FilterRowHorizontal(const float* pSrc, float* pDst, Uint32 DstWidth, const FilterTaps& Taps)
+{
+    for (Uint32 x = 0; x < DstWidth; ++x)
+    {
+        const Int32* pIndices = Taps.GetIndices(x);
+        const float* pWeights = Taps.GetWeights(x);
+
+        float Acc[NumComponents] = {};
+        for (Uint32 t = 0; t < Taps.NumTaps; ++t)
+        {
+            const float* pTexel = pSrc + size_t{static_cast<Uint32>(pIndices[t])} * NumComponents;
+            for (Uint32 c = 0; c < NumComponents; ++c)
+                Acc[c] += pTexel[c] * pWeights[t];
+        }
+        for (Uint32 c = 0; c < NumComponents; ++c)
+            pDst[x * NumComponents + c] = Acc[c];
+    }
+}
+
+#if DILIGENT_SSE2_ENABLED
+template <>
+void FilterRowHorizontal<4>(const float* pSrc, float* pDst, Uint32 DstWidth, const FilterTaps& Taps)
+{
+    for (Uint32 x = 0; x < DstWidth; ++x)
+    {
+        const Int32* pIndices = Taps.GetIndices(x);
+        const float* pWeights = Taps.GetWeights(x);
+
+        auto Acc = _mm_setzero_ps();
+        for (Uint32 t = 0; t < Taps.NumTaps; ++t)
+        {
+            const auto Texel = _mm_loadu_ps(pSrc + size_t{static_cast<Uint32>(pIndices[t])} * 4);
+            Acc              = _mm_add_ps(Acc, _mm_mul_ps(Texel, _mm_set1_ps(pWeights[t])));
+        }
+        _mm_storeu_ps(pDst + size_t{x} * 4, Acc);
+    }
+}
+#endif
+
+// pAcc[i] = pRow[i] * Weight (Init == true) or pAcc[i] += pRow[i] * Weight (Init == false)
+template <bool Init>
+void AccumulateRow(float* pAcc, const float* pRow, float Weight, size_t Count)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const auto mWeight = _mm_set1_ps(Weight);
+    for (; i + 4 <= Count; i += 4)
+    {
+        const auto Val = _mm_mul_ps(_mm_loadu_ps(pRow + i), mWeight);
+        _mm_storeu_ps(pAcc + i, Init ? Val : _mm_add_ps(_mm_loadu_ps(pAcc + i), Val));
+    }
+#endif
+    for (; i < Count; ++i)
+        pAcc[i] = Init ? pRow[i] * Weight : pAcc[i] + pRow[i] * Weight;
+}
+
+bool IsResampleAddressModeSupported(TEXTURE_ADDRESS_MODE AddressMode)
+{
+    return AddressMode == TEXTURE_ADDRESS_WRAP || AddressMode == TEXTURE_ADDRESS_MIRROR || AddressMode == TEXTURE_ADDRESS_CLAMP;
+}
+
+using FilterRowHorizontalType = void (*)(const float*, float*, Uint32, const FilterTaps&);
+
+FilterRowHorizontalType GetFilterRowHorizontalFunc(Uint32 NumComponents)
+{
+    switch (NumComponents)
+    {
+        case 1: return FilterRowHorizontal<1>;
+        case 2: return FilterRowHorizontal<2>;
+        case 3: return FilterRowHorizontal<3>;
+        case 4: return FilterRowHorizontal<4>;
+
+        default:
+            UNEXPECTED("Unexpected number of components");
+            return nullptr;
+    }
+}
+
+} // namespace
+
+void ResampleImage(const ResampleImageAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.ComponentType == VT_UINT8 || Attribs.ComponentType == VT_FLOAT32, "Component type must be VT_UINT8 or VT_FLOAT32");
+    DEV_CHECK_ERR(Attribs.NumComponents >= 1 && Attribs.NumComponents <= 4, "The number of components (", Attribs.NumComponents, ") must be between 1 and 4");
+    DEV_CHECK_ERR(Attribs.Filter < RESAMPLE_FILTER_COUNT, "Invalid filter");
+    DEV_CHECK_ERR(IsResampleAddressModeSupported(Attribs.AddressModeU), "Address mode U must be WRAP, MIRROR or CLAMP");
+    DEV_CHECK_ERR(IsResampleAddressModeSupported(Attribs.AddressModeV), "Address mode V must be WRAP, MIRROR or CLAMP");
+    if (Attribs.SrcWidth == 0 || Attribs.SrcHeight == 0 || Attribs.DstWidth == 0 || Attribs.DstHeight == 0)
+        return;
+
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+    if ((Attribs.ComponentType != VT_UINT8 && Attribs.ComponentType != VT_FLOAT32) ||
+        Attribs.NumComponents < 1 || Attribs.NumComponents > 4 ||
+        Attribs.Filter >= RESAMPLE_FILTER_COUNT ||
+        !IsResampleAddressModeSupported(Attribs.AddressModeU) ||
+        !IsResampleAddressModeSupported(Attribs.AddressModeV))
+        return;
+
+    const size_t ComponentSize  = Attribs.ComponentType == VT_UINT8 ? 1 : sizeof(float);
+    const size_t SrcRowElements = size_t{Attribs.SrcWidth} * Attribs.NumComponents;
+    const size_t DstRowElements = size_t{Attribs.DstWidth} * Attribs.NumComponents;
+    DEV_CHECK_ERR(Attribs.SrcHeight <= 1 || Attribs.SrcStride >= SrcRowElements * ComponentSize, "Source stride is too small");
+    DEV_CHECK_ERR(Attribs.DstHeight <= 1 || Attribs.DstStride >= DstRowElements * ComponentSize, "Destination stride is too small");
+
+    const FilterTaps HorzTaps = ComputeFilterTaps(Attribs.SrcWidth, Attribs.DstWidth, Attribs.Filter, Attribs.AddressModeU);
+    const FilterTaps VertTaps = ComputeFilterTaps(Attribs.SrcHeight, Attribs.DstHeight, Attribs.Filter, Attribs.AddressModeV);
+
+    const auto FilterRowHorizontalFunc = GetFilterRowHorizontalFunc(Attribs.NumComponents);
+
+    // Every task processes a band of destination rows. It filters the source rows that the band
+    // needs in the horizontal direction once, and then filters them in the vertical direction.
+    constexpr Uint32 BandHeight = 32;
+    const Uint32     NumBands   = (Attribs.DstHeight + BandHeight - 1) / BandHeight;
+    ParallelFor(Attribs.pThreadPool, NumBands, [&](Uint32 Band) {
+        const Uint32 BandStart = Band * BandHeight;
+        const Uint32 BandEnd   = std::min(BandStart + BandHeight, Attribs.DstHeight);
+
+        // Find the source rows used by the band and assign them slots in the horizontally filtered rows buffer
+        std::vector<Int32>  RowSlots(Attribs.SrcHeight, -1);
+        std::vector<Uint32> SlotRows;
+        for (Uint32 y = BandStart; y < BandEnd; ++y)
+        {
+            const Int32* pIndices = VertTaps.GetIndices(y);
+            const float* pWeights = VertTaps.GetWeights(y);
+            for (Uint32 t = 0; t < VertTaps.NumTaps; ++t)
+            {
+                if (pWeights[t] != 0 && RowSlots[pIndices[t]] < 0)
+                {
+                    RowSlots[pIndices[t]] = static_cast<Int32>(SlotRows.size());
+                    SlotRows.push_back(static_cast<Uint32>(pIndices[t]));
+                }
+            }
+        }
+
+        std::vector<float> FilteredRows(SlotRows.size() * DstRowElements);
+        std::vector<float> SrcRow(Attribs.ComponentType == VT_UINT8 ? SrcRowElements : 0);
+        std::vector<float> DstRow(DstRowElements);
+        for (size_t Slot = 0; Slot < SlotRows.size(); ++Slot)
+        {
+            const auto* pSrcRow = static_cast<const Uint8*>(Attribs.pSrcData) + SlotRows[Slot] * Attribs.SrcStride;
+
+            const float* pSrcRowF = nullptr;
+            if (Attribs.ComponentType == VT_UINT8)
+            {
+                ConvertRowToFloat(pSrcRow, SrcRow.data(), SrcRowElements);
+                pSrcRowF = SrcRow.data();
+            }
+            else
+            {
+                pSrcRowF = reinterpret_cast<const float*>(pSrcRow);
+            }
+            FilterRowHorizontalFunc(pSrcRowF, &FilteredRows[Slot * DstRowElements], Attribs.DstWidth, HorzTaps);
+        }
+
+        for (Uint32 y = BandStart; y < BandEnd; ++y)
+        {
+            const Int32* pIndices = VertTaps.GetIndices(y);
+            const float* pWeights = VertTaps.GetWeights(y);
+
+            bool Init = true;
+            for (Uint32 t = 0; t < VertTaps.NumTaps; ++t)
+            {
+                if (pWeights[t] == 0)
+                    continue;
+
+                const float* pRow = &FilteredRows[RowSlots[pIndices[t]] * DstRowElements];
+                if (Init)
+                    AccumulateRow<true>(DstRow.data(), pRow, pWeights[t], DstRowElements);
+                else
+                    AccumulateRow<false>(DstRow.data(), pRow, pWeights[t], DstRowElements);
+                Init = false;
+            }
+            VERIFY(!Init, "At least one tap must have non-zero weight");
+
+            auto* pDstRow = static_cast<Uint8*>(Attribs.pDstData) + y * Attribs.DstStride;
+            if (Attribs.ComponentType == VT_UINT8)
+                ConvertRowToUint8(DstRow.data(), pDstRow, DstRowElements);
+            else
+                std::memcpy(pDstRow, DstRow.data(), DstRowElements * sizeof(float));
+        }
+    });
+}
+
+} // namespace Diligent
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "MappedFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ProxyDataBlob.hpp"
+
+namespace Diligent
+{
+
+RefCntAutoPtr<MappedFileStream> MappedFileStream::Create(const Char* Path)
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        DEV_ERROR("Path must not be null or empty");
+        return {};
+    }
+
+    RefCntAutoPtr<MappedFileStream> pStream{MakeNewRCObj<MappedFileStream>()(Path)};
+    if (!pStream->IsValid())
+        pStream.Release();
+    return pStream;
+}
+
+MappedFileStream::MappedFileStream(IReferenceCounters* pRefCounters,
+                                   const Char*         Path) :
+    TBase{pRefCounters},
+    m_File{Path}
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE2(MappedFileStream, IID_FileStream, IID_InternalImpl, TBase)
+
+bool MappedFileStream::Read(void* Data, size_t Size)
+{
+    const size_t BytesLeft   = m_File.GetSize() - std::min(m_CurrentOffset, m_File.GetSize());
+    const size_t BytesToRead = std::min(BytesLeft, Size);
+    if (BytesToRead > 0)
+        memcpy(Data, static_cast<const Uint8*>(m_File.GetData()) + m_CurrentOffset, BytesToRead);
+    m_CurrentOffset += BytesToRead;
+    return Size == BytesToRead;
+}
+
+void MappedFileStream::ReadBlob(IDataBlob* pData)
+{
+    VERIFY_EXPR(pData != nullptr);
+    const size_t BytesLeft = m_File.GetSize() - std::min(m_CurrentOffset, m_File.GetSize());
+    pData->Resize(BytesLeft);
+    if (BytesLeft > 0)
+    {
+        bool res = Read(pData->GetDataPtr(), BytesLeft);
+        VERIFY_EXPR(res);
+        (void)res;
+    }
+}
+
+bool MappedFileStream::Write(const void* Data, size_t Size)
+{
+    DEV_ERROR("Mapped file stream is read-only");
+    return false;
+}
+
+bool MappedFileStream::IsValid()
+{
+    return m_File.IsValid();
+}
+
+size_t MappedFileStream::GetSize()
+{
+    return m_File.GetSize();
+}
+
+size_t MappedFileStream::GetPos()
+{
+    return m_CurrentOffset;
+}
+
+bool MappedFileStream::SetPos(size_t Offset, int Origin)
+{
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        case FilePosOrigin::Start:
+            m_CurrentOffset = Offset;
+            break;
+
+        case FilePosOrigin::Curr:
+            m_CurrentOffset += Offset;
+            break;
+
+        case FilePosOrigin::End:
+            m_CurrentOffset = m_File.GetSize() + Offset;
+            break;
+    }
+
+    return true;
+}
+
+RefCntAutoPtr<IDataBlob> MappedFileStream::GetDataBlob()
+{
+    // Empty files have no mapping, but the blob must still return a valid pointer
+    static constexpr char EmptyData[] = "";
+
+    const void* pData = m_File.GetSize() > 0 ? m_File.GetData() : EmptyData;
+    return RefCntAutoPtr<IDataBlob>{ProxyDataBlob::Create(pData, m_File.GetSize(), this)};
+}
+
+} // namespace Diligent
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RefCountedObjectImpl.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+std::atomic<bool> g_BiasedReferenceCountingEnabled{false};
+
+// Set when the thread state has been released at thread exit
+thread_local bool t_BiasedRefCountsOwnerReleased = false;
+
+} // namespace
+
+void SetBiasedReferenceCountingEnabled(bool Enable)
+{
+    g_BiasedReferenceCountingEnabled.store(Enable);
+}
+
+bool IsBiasedReferenceCountingEnabled()
+{
+    return g_BiasedReferenceCountingEnabled.load(std::memory_order_relaxed);
+}
+
+void ProcessBiasedReferenceCountMerges()
+{
+    if (auto* pOwner = BiasedRefCountsOwner::GetCurrentThread())
+        pOwner->ProcessPendingMerges();
+}
+
+
+thread_local BiasedRefCountsOwner* BiasedRefCountsOwner::s_pCurrentThread = nullptr;
+
+// Releases the state of the thread when the thread exits
+struct BiasedRefCountsOwnerThreadHolder
+{
+    ~BiasedRefCountsOwnerThreadHolder()
+    {
+        if (pOwner != nullptr)
+            pOwner->OnThreadExit();
+    }
+
+    BiasedRefCountsOwner* pOwner = nullptr;
+};
+
+BiasedRefCountsOwner* BiasedRefCountsOwner::GetOrCreateCurrentThread()
+{
+    if (s_pCurrentThread != nullptr)
+        return s_pCurrentThread;
+
+    // Do not create new state while thread-local objects are being destroyed
+    if (t_BiasedRefCountsOwnerReleased)
+        return nullptr;
+
+    static thread_local BiasedRefCountsOwnerThreadHolder Holder;
+
+    Holder.pOwner    = new BiasedRefCountsOwner{};
+    s_pCurrentThread = Holder.pOwner;
+    return s_pCurrentThread;
+}
+
+void BiasedRefCountsOwner::RequestMerge(RefCountersImpl* pRefCounters)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingMergesMtx};
+        if (!m_IsOrphaned)
+        {
+            m_PendingMerges.push_back(pRefCounters);
+            m_HasPendingMerges.store(true, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // The owner thread has exited. The mutex synchronizes with the last
+    // modifications of the biased counter, so it is safe to merge it here.
+    pRefCounters->MergeBiasedRefs();
+}
+
+void BiasedRefCountsOwner::MergePending()
+{
+    std::vector<RefCountersImpl*> PendingMerges;
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingMergesMtx};
+        PendingMerges.swap(m_PendingMerges);
+        m_HasPendingMerges.store(false, std::memory_order_relaxed);
+    }
+
+    // Merging may destroy objects, which may in turn request new merges
+    for (auto* pRefCounters : PendingMerges)
+        pRefCounters->MergeBiasedRefs();
+}
+
+void BiasedRefCountsOwner::OnThreadExit()
+{
+    VERIFY_EXPR(s_pCurrentThread == this);
+
+    // Merging may destroy objects whose destructors release biased references and request
+    // new merges, so keep processing the queue until it is empty. Once the state is marked
+    // as orphaned, the biased counters of this thread must not be modified anymore.
+    while (true)
+    {
+        std::vector<RefCountersImpl*> PendingMerges;
+        {
+            std::lock_guard<std::mutex> Lock{m_PendingMergesMtx};
+            if (m_PendingMerges.empty())
+            {
+                // From now on, merges requested by other threads are performed immediately
+                m_IsOrphaned = true;
+                break;
+            }
+            PendingMerges.swap(m_PendingMerges);
+            m_HasPendingMerges.store(false, std::memory_order_relaxed);
+        }
+
+        for (auto* pRefCounters : PendingMerges)
+            pRefCounters->MergeBiasedRefs();
+    }
+
+    s_pCurrentThread               = nullptr;
+    t_BiasedRefCountsOwnerReleased = true;
+    ReleaseOwnedObject();
+}
+
+} // namespace Diligent
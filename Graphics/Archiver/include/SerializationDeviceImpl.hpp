@@ -61,6 +61,8 @@ public:
 
     UNSUPPORTED_METHOD(void, CreateBuffer,      const BufferDesc&  Desc, const BufferData*  pData, IBuffer**  ppBuffer)
     UNSUPPORTED_METHOD(void, CreateTexture,     const TextureDesc& Desc, const TextureData* pData, ITexture** ppTexture)
+    UNSUPPORTED_METHOD(void, CreateBuffers,     Uint32 NumBuffers,  const BufferDesc*  pBuffDescs, const BufferData*  pBuffData, IBuffer**  ppBuffers)
+    UNSUPPORTED_METHOD(void, CreateTextures,    Uint32 NumTextures, const TextureDesc* pTexDescs,  const TextureData* pData,     ITexture** ppTextures)
 
     UNSUPPORTED_METHOD(void, CreateSampler,     const SamplerDesc&            Desc, ISampler**            ppSampler)
     UNSUPPORTED_METHOD(void, CreateFence,       const FenceDesc&              Desc, IFence**              ppFence)
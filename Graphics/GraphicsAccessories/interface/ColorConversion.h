@@ -47,6 +47,13 @@ inline float GammaToLinear(float x)
 float LinearToGamma(Uint8 x);
 float GammaToLinear(Uint8 x);
 
+/// Converts a linear value to the 8-bit gamma-encoded value.
+
+/// \remarks   The result is the same as round(LinearToGamma(x) * 255) evaluated in double precision,
+///            but the function uses a lookup table and does not compute the power function.
+///            Values outside of [0, 1] range are clamped.
+Uint8 LinearToGamma8(float x);
+
 inline float FastLinearToGamma(float x)
 {
     return x < 0.0031308f ? 12.92f * x : 1.13005f * sqrtf(std::abs(x - 0.00228f)) - 0.13448f * x + 0.005719f;
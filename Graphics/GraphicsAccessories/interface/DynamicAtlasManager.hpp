@@ -121,6 +121,20 @@ public:
     Uint32 GetHeight() const { return m_Height; }
     Uint64 GetTotalFreeArea() const { return m_TotalFreeArea; }
 
+    /// Returns the maximum width of a free region.
+    /// A region of size W x H can only be allocated if
+    /// W <= GetMaxFreeRegionWidth() and H <= GetMaxFreeRegionHeight().
+    Uint32 GetMaxFreeRegionWidth() const
+    {
+        return !m_FreeRegionsByWidth.empty() ? m_FreeRegionsByWidth.rbegin()->first.width : 0;
+    }
+
+    /// Returns the maximum height of a free region.
+    Uint32 GetMaxFreeRegionHeight() const
+    {
+        return !m_FreeRegionsByHeight.empty() ? m_FreeRegionsByHeight.rbegin()->first.height : 0;
+    }
+
     bool IsEmpty() const
     {
         VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
@@ -27,7 +27,11 @@
 
 #include <array>
 #include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include "ColorConversion.h"
+#include "DebugUtilities.hpp"
 
 namespace Diligent
 {
@@ -77,8 +81,90 @@ private:
     };
 };
 
+// Linear to 8-bit gamma conversion table.
+// The [2^-13, 1) range is split into buckets by the exponent and the top 7 bits of the mantissa.
+// The buckets are narrow enough to contain at most one rounding threshold, so the 8-bit value is
+// obtained by a single comparison with the threshold stored in the bucket.
+class LinearToGamma8Map
+{
+public:
+    Uint8 operator()(float x) const
+    {
+        if (!(x >= MinValue))
+            return 0; // Also handles NaN
+        if (x >= 1.f)
+            return 255;
+
+        Uint32 Bits;
+        memcpy(&Bits, &x, sizeof(Bits));
+
+        const auto& Bucket = m_Buckets[(Bits - MinValueBits) >> BucketShift];
+        return static_cast<Uint8>(Bucket.Value + (x >= Bucket.Threshold ? 1 : 0));
+    }
+
+private:
+    static constexpr float  MinValue     = 1.f / 8192.f;
+    static constexpr Uint32 MinValueBits = (127u - 13u) << 23u;
+    static constexpr Uint32 BucketShift  = 16;
+    static constexpr Uint32 NumBuckets   = 13u << (23u - BucketShift);
+
+    struct BucketInfo
+    {
+        float Threshold;
+        Uint8 Value;
+    };
+
+    const std::array<BucketInfo, NumBuckets> m_Buckets{
+        []() {
+            // Linear values at which the 8-bit gamma value switches from i to i + 1
+            std::array<double, 255> Thresholds;
+            for (Uint32 i = 0; i < Thresholds.size(); ++i)
+            {
+                const double Gamma = (static_cast<double>(i) + 0.5) / 255.0;
+                Thresholds[i]      = Gamma <= 0.04045 ? Gamma / 12.92 : std::pow((Gamma + 0.055) / 1.055, 2.4);
+            }
+
+            std::array<BucketInfo, NumBuckets> Buckets;
+            for (Uint32 i = 0; i < Buckets.size(); ++i)
+            {
+                const Uint32 StartBits = MinValueBits + (i << BucketShift);
+                const Uint32 EndBits   = StartBits + (1u << BucketShift);
+
+                float Start, End;
+                memcpy(&Start, &StartBits, sizeof(Start));
+                memcpy(&End, &EndBits, sizeof(End));
+
+                // The first threshold that is greater than the bucket start
+                const auto NextThreshold = std::upper_bound(Thresholds.begin(), Thresholds.end(), static_cast<double>(Start));
+
+                auto& Bucket     = Buckets[i];
+                Bucket.Value     = static_cast<Uint8>(NextThreshold - Thresholds.begin());
+                Bucket.Threshold = std::numeric_limits<float>::max();
+                if (NextThreshold != Thresholds.end() && *NextThreshold < static_cast<double>(End))
+                {
+                    // Smallest float that is not less than the threshold
+                    float Threshold = static_cast<float>(*NextThreshold);
+                    if (static_cast<double>(Threshold) < *NextThreshold)
+                        Threshold = std::nextafter(Threshold, 2.f);
+                    Bucket.Threshold = Threshold;
+
+                    VERIFY(NextThreshold + 1 == Thresholds.end() || *(NextThreshold + 1) >= static_cast<double>(End),
+                           "Bucket contains more than one threshold");
+                }
+            }
+            return Buckets;
+        }(),
+    };
+};
+
 } // namespace
 
+Uint8 LinearToGamma8(float x)
+{
+    static const LinearToGamma8Map map;
+    return map(x);
+}
+
 float LinearToGamma(Uint8 x)
 {
     static const LinearToGammaMap map;
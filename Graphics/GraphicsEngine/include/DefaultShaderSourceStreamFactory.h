@@ -29,6 +29,8 @@
 
 #include "../../GraphicsEngine/interface/Shader.h"
 
+#include "../../../Primitives/interface/DefineRefMacro.h"
+
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
 
@@ -38,4 +40,40 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory);
 
+
+/// Default shader source stream factory create info
+struct DefaultShaderSourceStreamFactoryCreateInfo
+{
+    /// Semicolon-separated list of search directories.
+    const Char* SearchDirectories DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to prefetch the files included by every opened source file.
+    ///
+    /// \remarks    When a source file is opened, its #include directives are resolved against the
+    ///             search directories and the included files that have not been prefetched yet
+    ///             are read in one batch. On platforms that support asynchronous file reads
+    ///             (io_uring on Linux), the batch is read through Diligent::FileReadQueue with all
+    ///             reads in flight at once. Otherwise, the files are mapped into memory and read
+    ///             by the OS in the background. The prefetched files are kept separately for
+    ///             every thread and are dropped when the thread opens a file that was not prefetched.
+    ///
+    ///             Prefetching is disabled on platforms that support neither asynchronous reads
+    ///             nor memory-mapped files.
+    Bool PrefetchIncludes DEFAULT_INITIALIZER(False);
+};
+typedef struct DefaultShaderSourceStreamFactoryCreateInfo DefaultShaderSourceStreamFactoryCreateInfo;
+
+
+#if DILIGENT_CPP_INTERFACE
+
+/// Creates a default shader source stream factory
+/// \param [in]  CI                          - Factory create info, see Diligent::DefaultShaderSourceStreamFactoryCreateInfo.
+/// \param [out] ppShaderSourceStreamFactory - Memory address where the pointer to the shader source stream factory will be written.
+void CreateDefaultShaderSourceStreamFactory(const DefaultShaderSourceStreamFactoryCreateInfo& CI,
+                                            IShaderSourceInputStreamFactory**                 ppShaderSourceStreamFactory);
+
+#endif
+
+#include "../../../Primitives/interface/UndefRefMacro.h"
+
 DILIGENT_END_NAMESPACE // namespace Diligent
@@ -49,6 +49,8 @@
 #include "BasicMath.hpp"
 #include "PlatformMisc.hpp"
 #include "Align.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "EngineMemory.h"
 
 namespace Diligent
 {
@@ -307,7 +309,8 @@ public:
 
     virtual void DILIGENT_CALL_TYPE ClearStats() override final
     {
-        m_Stats = {};
+        m_Stats                                  = {};
+        m_FrameArenaBlockAllocationsAtStatsClear = m_FrameArena.GetBlockAllocationCount();
     }
 
     virtual const DeviceContextStats& DILIGENT_CALL_TYPE GetStats() const override final
@@ -315,6 +318,14 @@ public:
         return m_Stats;
     }
 
+    /// Returns the number of heap allocations performed by the frame arena since it was last
+    /// reset at the end of the frame or by Flush(). Once the arena has reached the size required
+    /// by the application, this value is expected to be zero.
+    size_t GetFrameArenaHeapAllocationCount() const
+    {
+        return m_FrameArena.GetBlockAllocationCount() - m_FrameArenaBlockAllocationsAtReset;
+    }
+
     /// Returns currently bound pipeline state and blend factors
     inline void GetPipelineState(IPipelineState** ppPSO, float* BlendFactors, Uint32& StencilRef);
 
@@ -493,6 +504,43 @@ protected:
     void EndFrame()
     {
         ++m_FrameNumber;
+
+        // Scratch memory allocated from the frame arena is only valid until the end of the frame
+        ResetFrameArena();
+
+        // Destroy the objects owned by this thread whose last references have been released by other threads
+        ProcessBiasedReferenceCountMerges();
+    }
+
+    /// Reclaims the frame arena memory. Must only be called when no memory allocated
+    /// from the arena is in use, e.g. at the end of the frame or of Flush().
+    void ResetFrameArena()
+    {
+        m_FrameArena.Discard();
+        m_FrameArenaBlockAllocationsAtReset = m_FrameArena.GetBlockAllocationCount();
+    }
+
+    /// Allocates an uninitialized transient array from the frame arena.
+    template <typename T>
+    T* AllocateFrameArray(size_t Count)
+    {
+        T* Ptr = m_FrameArena.Allocate<T>(Count);
+        UpdateTransientHeapAllocationStats();
+        return Ptr;
+    }
+
+    /// Allocates a transient array from the frame arena and constructs its elements from the arguments.
+    template <typename T, typename... ArgsType>
+    T* ConstructFrameArray(size_t Count, const ArgsType&... Args)
+    {
+        T* Ptr = m_FrameArena.ConstructArray<T>(Count, Args...);
+        UpdateTransientHeapAllocationStats();
+        return Ptr;
+    }
+
+    void UpdateTransientHeapAllocationStats()
+    {
+        m_Stats.TransientHeapAllocations = static_cast<Uint32>(m_FrameArena.GetBlockAllocationCount() - m_FrameArenaBlockAllocationsAtStatsClear);
     }
 
     void PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount);
@@ -683,6 +731,12 @@ protected:
 
     std::vector<Uint8> m_ScratchSpace;
 
+    /// Linear allocator for transient arrays used while recording commands, see AllocateFrameArray().
+    /// The memory is reclaimed by EndFrame() and Flush(), so pointers must not be kept across them.
+    DynamicLinearAllocator m_FrameArena{GetRawAllocator(), 4 << 10};
+    size_t                 m_FrameArenaBlockAllocationsAtReset      = 0;
+    size_t                 m_FrameArenaBlockAllocationsAtStatsClear = 0;
+
 #ifdef DILIGENT_DEBUG
     // std::unordered_map is unbelievably slow. Keeping track of mapped buffers
     // in release builds is not feasible
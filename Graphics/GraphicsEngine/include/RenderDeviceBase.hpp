@@ -38,6 +38,8 @@
 
 #include "RenderDevice.h"
 #include "DeviceObjectBase.hpp"
+#include "BufferBase.hpp"
+#include "TextureBase.hpp"
 #include "Defines.h"
 #include "ResourceMappingImpl.hpp"
 #include "ObjectsRegistry.hpp"
@@ -253,6 +255,34 @@ public:
         }
     }
 
+    /// Implementation of IRenderDevice::CreateBuffers().
+    virtual void DILIGENT_CALL_TYPE CreateBuffers(Uint32            NumBuffers,
+                                                  const BufferDesc* pBuffDescs,
+                                                  const BufferData* pBuffData,
+                                                  IBuffer**         ppBuffers) override
+    {
+        if (!ValidateBufferBatch(NumBuffers, pBuffDescs, pBuffData, ppBuffers))
+            return;
+
+        CreateBufferBatch(NumBuffers, pBuffDescs, pBuffData, ppBuffers);
+    }
+
+    /// Implementation of IRenderDevice::CreateTextures().
+    virtual void DILIGENT_CALL_TYPE CreateTextures(Uint32             NumTextures,
+                                                   const TextureDesc* pTexDescs,
+                                                   const TextureData* pData,
+                                                   ITexture**         ppTextures) override
+    {
+        if (!ValidateTextureBatch(NumTextures, pTexDescs, pData, ppTextures))
+            return;
+
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            const TextureData* pTexData = pData != nullptr && pData[i].pSubResources != nullptr ? &pData[i] : nullptr;
+            this->CreateTexture(pTexDescs[i], pTexData, &ppTextures[i]);
+        }
+    }
+
 
     /// Implementation of IRenderDevice::GetDeviceInfo().
     virtual const RenderDeviceInfo& DILIGENT_CALL_TYPE GetDeviceInfo() const override final
@@ -414,6 +444,83 @@ protected:
             m_pShaderCompilationThreadPool = CreateThreadPool(ThreadPoolCI);
         }
     }
+
+    /// Validates all buffer descriptions of a batch before any buffer is created.
+
+    /// \return     true if all descriptions are valid, and false otherwise.
+    ///             In the latter case, all elements of ppBuffers are set to null.
+    bool ValidateBufferBatch(Uint32 NumBuffers, const BufferDesc* pBuffDescs, const BufferData* pBuffData, IBuffer** ppBuffers)
+    {
+        return ValidateObjectBatch("buffer", NumBuffers, pBuffDescs, ppBuffers,
+                                   [&](Uint32 i) //
+                                   {
+                                       ValidateBufferDesc(pBuffDescs[i], this);
+                                       ValidateBufferInitData(pBuffDescs[i], pBuffData != nullptr ? &pBuffData[i] : nullptr);
+                                   });
+    }
+
+    /// Validates all texture descriptions and initial data of a batch before any texture is created.
+    bool ValidateTextureBatch(Uint32 NumTextures, const TextureDesc* pTexDescs, const TextureData* pData, ITexture** ppTextures)
+    {
+        return ValidateObjectBatch("texture", NumTextures, pTexDescs, ppTextures,
+                                   [&](Uint32 i) //
+                                   {
+                                       ValidateTextureDesc(pTexDescs[i], this);
+                                       ValidateTextureInitData(pTexDescs[i], pData != nullptr ? &pData[i] : nullptr);
+                                   });
+    }
+
+    /// Creates the buffers of a batch that has been validated by ValidateBufferBatch().
+    void CreateBufferBatch(Uint32 NumBuffers, const BufferDesc* pBuffDescs, const BufferData* pBuffData, IBuffer** ppBuffers)
+    {
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+        {
+            const BufferData* pData = pBuffData != nullptr && pBuffData[i].pData != nullptr ? &pBuffData[i] : nullptr;
+            this->CreateBuffer(pBuffDescs[i], pData, &ppBuffers[i]);
+        }
+    }
+
+    template <typename ObjectType, typename ObjectDescType, typename ValidatorType>
+    bool ValidateObjectBatch(const char*           ObjectTypeName,
+                             Uint32                NumObjects,
+                             const ObjectDescType* pDescs,
+                             ObjectType**          ppObjects,
+                             ValidatorType         Validate)
+    {
+        if (NumObjects == 0)
+            return false;
+
+        DEV_CHECK_ERR(ppObjects != nullptr, "Null pointer provided");
+        if (ppObjects == nullptr)
+            return false;
+
+        for (Uint32 i = 0; i < NumObjects; ++i)
+        {
+            DEV_CHECK_ERR(ppObjects[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+            ppObjects[i] = nullptr;
+        }
+
+        DEV_CHECK_ERR(pDescs != nullptr, "Null pointer provided");
+        if (pDescs == nullptr)
+            return false;
+
+        for (Uint32 i = 0; i < NumObjects; ++i)
+        {
+            try
+            {
+                Validate(i);
+            }
+            catch (...)
+            {
+                LOG_ERROR("Failed to create ", ObjectTypeName, " batch: ", ObjectTypeName, " ", i, " ('",
+                          (pDescs[i].Name != nullptr ? pDescs[i].Name : ""), "') is invalid. No ", ObjectTypeName, "s were created.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /// Helper template function to facilitate device object creation
 
     /// \tparam ObjectType            - The type of the object being created (IBuffer, ITexture, etc.).
@@ -49,6 +49,9 @@ struct CopyTextureAttribs;
 /// Validates texture description and throws an exception in case of an error.
 void ValidateTextureDesc(const TextureDesc& TexDesc, const IRenderDevice* pDevice) noexcept(false);
 
+/// Validates texture initial data and throws an exception in case of an error.
+void ValidateTextureInitData(const TextureDesc& TexDesc, const TextureData* pInitData) noexcept(false);
+
 /// Validates and corrects texture view description; throws an exception in case of an error.
 void ValidatedAndCorrectTextureViewDesc(const TextureDesc& TexDesc, TextureViewDesc& ViewDesc) noexcept(false);
 
@@ -2423,6 +2423,13 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// The number of heap allocations performed by the context to store
+    /// transient command data since the statistics were last cleared.
+    ///
+    /// \remarks   Once the context has processed a few frames of a typical
+    ///             workload, this value is expected to stay zero.
+    Uint32 TransientHeapAllocations DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
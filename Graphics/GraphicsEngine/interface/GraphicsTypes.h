@@ -3955,17 +3955,39 @@ struct DeviceFeaturesVk
     ///             If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports VK_EXT_graphics_pipeline_library extension.
+    ///
+    /// \remarks    When the extension is enabled, graphics pipelines are linked from vertex input,
+    ///             pre-rasterization, fragment shader and fragment output libraries. The libraries
+    ///             are cached by the render device and shared by all pipelines with the same state.
+    ///             If the device has a shader compilation thread pool (see
+    ///             EngineCreateInfo::pAsyncShaderCompilationThreadPool), the pipelines are then
+    ///             re-linked with link-time optimizations in the background.
+    DEVICE_FEATURE_STATE GraphicsPipelineLibrary DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_descriptor_buffer extension.
+    ///
+    /// \remarks    When the extension is enabled, shader resources are not written to descriptor sets.
+    ///             Instead, every device context writes the descriptors with vkGetDescriptorEXT directly
+    ///             into a host-visible descriptor buffer when the resources are committed, and binds them
+    ///             by offset. This removes descriptor pool allocations and vkUpdateDescriptorSets calls
+    ///             from the dynamic resource commit path.
+    ///             The extension requires buffer device address support, which is enabled as well.
+    ///             Unlike other Vulkan features, this feature is disabled by default in EngineVkCreateInfo.
+    DEVICE_FEATURE_STATE DescriptorBuffer DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
     Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(HostImageCopy) \
+    Handler(GraphicsPipelineLibrary) \
+    Handler(DescriptorBuffer)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 4, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4146,6 +4168,20 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     ///               DynamicHeapPageSize.
     Uint32 DynamicHeapPageSize              DEFAULT_INITIALIZER(256 << 10);
 
+    /// Size of the host-visible descriptor buffer shared by all contexts.
+    ///
+    /// \remarks    This member is only used when DeviceFeaturesVk::DescriptorBuffer is enabled.
+    ///             Descriptors of committed shader resources are written to the descriptor buffer
+    ///             and, similar to the dynamic heap, the space is recycled when all command buffers
+    ///             that reference it are executed by the GPU. The size is clamped by the
+    ///             VkPhysicalDeviceDescriptorBufferPropertiesEXT::maxSamplerDescriptorBufferRange
+    ///             and maxResourceDescriptorBufferRange limits.
+    Uint32 DescriptorBufferHeapSize         DEFAULT_INITIALIZER(4 << 20);
+
+    /// Size of the memory chunk suballocated by immediate/deferred context from
+    /// the global descriptor buffer, see DynamicHeapPageSize.
+    Uint32 DescriptorBufferHeapPageSize     DEFAULT_INITIALIZER(64 << 10);
+
     /// Query pool size for each query type.
     ///
     /// \remarks    In Vulkan, queries are allocated from the pool, and
@@ -4179,7 +4215,13 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     explicit EngineVkCreateInfo(const EngineCreateInfo &EngineCI) noexcept :
         EngineCreateInfo{EngineCI},
         FeaturesVk{DEVICE_FEATURE_STATE_OPTIONAL}
-    {}
+    {
+        // Descriptor buffers change the way shader resources are bound, so the application must opt in.
+        FeaturesVk.DescriptorBuffer = DEVICE_FEATURE_STATE_DISABLED;
+        // Pipelines linked from libraries may perform worse until they are re-linked with
+        // link-time optimization, so the application must opt in.
+        FeaturesVk.GraphicsPipelineLibrary = DEVICE_FEATURE_STATE_DISABLED;
+    }
 #endif
 };
 typedef struct EngineVkCreateInfo EngineVkCreateInfo;
@@ -4251,6 +4293,14 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// the global dynamic heap to perform lock-free dynamic suballocations.
     Uint32 DynamicHeapPageSize DEFAULT_INITIALIZER(256 << 10);
 
+    /// The maximum number of bind groups kept in the device-wide bind group cache.
+    ///
+    /// \remarks   When the resources of a shader resource binding change, the engine looks up
+    ///             the bind group with the same layout and resources in the cache before creating
+    ///             a new one. The least recently used bind groups are released when the cache is full.
+    ///             Set this value to 0 to disable the cache.
+    Uint32 BindGroupCacheSize  DEFAULT_INITIALIZER(1024);
+
     /// Query pool size for each query type.
     Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES]
 #if DILIGENT_CPP_INTERFACE
@@ -345,6 +345,50 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     VIRTUAL void METHOD(CreateDeferredContext)(THIS_
                                                IDeviceContext** ppContext) PURE;
 
+
+    /// Creates multiple buffer objects.
+
+    /// \param [in]  NumBuffers - The number of buffers to create.
+    /// \param [in]  pBuffDescs - Array of NumBuffers buffer descriptions, see Diligent::BufferDesc for details.
+    /// \param [in]  pBuffData  - Array of NumBuffers Diligent::BufferData structures that describe
+    ///                          initial data of every buffer, or nullptr if no data is provided for
+    ///                          any buffer. Elements with null pData are treated as no data.
+    /// \param [out] ppBuffers  - Array of NumBuffers memory locations where pointers to the
+    ///                          buffer interfaces will be written. The function calls AddRef()
+    ///                          for every new buffer.
+    ///
+    /// \remarks    All descriptions are validated before any buffer is created. If any of them
+    ///             is invalid, no buffers are created and all elements of ppBuffers are set to null.
+    ///
+    ///             Compared to calling CreateBuffer() for every buffer, backends may reduce the
+    ///             per-object overhead. In Vulkan backend, memory for all device-local buffers
+    ///             in the batch is reserved in a single memory block.
+    VIRTUAL void METHOD(CreateBuffers)(THIS_
+                                       Uint32            NumBuffers,
+                                       const BufferDesc* pBuffDescs,
+                                       const BufferData* pBuffData,
+                                       IBuffer**         ppBuffers) PURE;
+
+
+    /// Creates multiple texture objects.
+
+    /// \param [in]  NumTextures - The number of textures to create.
+    /// \param [in]  pTexDescs   - Array of NumTextures texture descriptions, see Diligent::TextureDesc for details.
+    /// \param [in]  pData       - Array of NumTextures Diligent::TextureData structures that describe
+    ///                           initial data of every texture, or nullptr if no data is provided for
+    ///                           any texture. Elements with null pSubResources are treated as no data.
+    /// \param [out] ppTextures  - Array of NumTextures memory locations where pointers to the
+    ///                           texture interfaces will be written. The function calls AddRef()
+    ///                           for every new texture.
+    ///
+    /// \remarks    All descriptions are validated before any texture is created. If any of them
+    ///             is invalid, no textures are created and all elements of ppTextures are set to null.
+    VIRTUAL void METHOD(CreateTextures)(THIS_
+                                        Uint32             NumTextures,
+                                        const TextureDesc* pTexDescs,
+                                        const TextureData* pData,
+                                        ITexture**         ppTextures) PURE;
+
     /// Returns the device information, see Diligent::RenderDeviceInfo for details.
     VIRTUAL const RenderDeviceInfo REF METHOD(GetDeviceInfo)(THIS) CONST PURE;
 
@@ -464,6 +508,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_CreateDeviceMemory(This, ...)              CALL_IFACE_METHOD(RenderDevice, CreateDeviceMemory,              This, __VA_ARGS__)
 #    define IRenderDevice_CreatePipelineStateCache(This, ...)        CALL_IFACE_METHOD(RenderDevice, CreatePipelineStateCache,        This, __VA_ARGS__)
 #    define IRenderDevice_CreateDeferredContext(This, ...)           CALL_IFACE_METHOD(RenderDevice, CreateDeferredContext,           This, __VA_ARGS__)
+#    define IRenderDevice_CreateBuffers(This, ...)                   CALL_IFACE_METHOD(RenderDevice, CreateBuffers,                   This, __VA_ARGS__)
+#    define IRenderDevice_CreateTextures(This, ...)                  CALL_IFACE_METHOD(RenderDevice, CreateTextures,                  This, __VA_ARGS__)
 #    define IRenderDevice_GetAdapterInfo(This)                       CALL_IFACE_METHOD(RenderDevice, GetAdapterInfo,                  This)
 #    define IRenderDevice_GetDeviceInfo(This)                        CALL_IFACE_METHOD(RenderDevice, GetDeviceInfo,                   This)
 #    define IRenderDevice_GetTextureFormatInfo(This, ...)            CALL_IFACE_METHOD(RenderDevice, GetTextureFormatInfo,            This, __VA_ARGS__)
@@ -27,10 +27,20 @@
 
 #include "DefaultShaderSourceStreamFactory.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 #include "BasicFileStream.hpp"
+#include "MappedFileStream.hpp"
+#include "MemoryFileStream.hpp"
+#include "FileLoader.hpp"
+#include "ParsingTools.hpp"
 
 namespace Diligent
 {
@@ -38,7 +48,7 @@ namespace Diligent
 class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
 {
 public:
-    DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories);
+    DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const DefaultShaderSourceStreamFactoryCreateInfo& CI);
 
     virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final;
 
@@ -48,14 +58,102 @@ public:
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>)
 
+private:
+    String                     FindFile(const Char* Name) const;
+    RefCntAutoPtr<IFileStream> CreateFileStream(const Char* Name);
+
+    struct PrefetchedFile
+    {
+        RefCntAutoPtr<IFileStream> pStream;
+
+        // File contents that are scanned for nested includes. The memory is owned by the stream.
+        const Char* pData = nullptr;
+        size_t      Size  = 0;
+    };
+    using PrefetchedFilesMap = std::unordered_map<String, PrefetchedFile>;
+    PrefetchedFilesMap PrefetchIncludes(const Char* pSource, size_t SourceSize);
+
 private:
     std::vector<String> m_SearchDirectories;
+
+    // When enabled, the files included by every opened source are read in one batch
+    // before the include processor asks for them.
+    const bool m_PrefetchIncludes;
+
+    // Whether the batch is read through the file read queue (io_uring on Linux) rather than
+    // by mapping the files and letting the OS read them in the background.
+    const bool m_UseFileReadQueue;
+
+    // Files prefetched for the compilation that is running on each thread.
+    // A compilation opens its sources and includes on the same thread, so keeping
+    // the files per thread prevents concurrent compilations from affecting each other.
+    std::mutex                                              m_PrefetchedFilesMtx;
+    std::unordered_map<std::thread::id, PrefetchedFilesMap> m_PrefetchedFiles;
 };
 
-DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories) :
-    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters)
+namespace
+{
+
+// Calls the handler for the file name of every #include directive in the source.
+// Malformed directives are ignored: they are reported by the include processor.
+template <typename HandlerType>
+void FindIncludeNames(const Char* pSource, size_t SourceSize, HandlerType&& Handler) noexcept
+{
+    using namespace Parsing;
+
+    const Char* const pEnd = pSource + SourceSize;
+    try
+    {
+        const Char* Pos = pSource;
+        while (Pos < pEnd)
+        {
+            Pos = SkipDelimitersAndComments(Pos, pEnd); // May throw
+            if (Pos == pEnd)
+                break;
+
+            if (*Pos != '#')
+            {
+                ++Pos;
+                continue;
+            }
+
+            // # /* ... */ include <File.h>
+            // ^
+            const Char* const LineEnd = SkipLine(Pos, pEnd);
+
+            const Char* DirectiveStart = SkipDelimitersAndComments(Pos + 1, LineEnd, " \t", SKIP_COMMENT_FLAG_MULTILINE); // May throw
+            const Char* DirectiveEnd   = SkipIdentifier(DirectiveStart, LineEnd);
+            Pos                        = LineEnd;
+            if (DirectiveEnd - DirectiveStart != 7 || strncmp(DirectiveStart, "include", 7) != 0)
+                continue;
+
+            // # /* ... */ include <File.h>
+            //                     ^
+            const Char* NameStart = SkipDelimitersAndComments(DirectiveEnd, LineEnd, " \t", SKIP_COMMENT_FLAG_MULTILINE); // May throw
+            if (NameStart == LineEnd || (*NameStart != '"' && *NameStart != '<'))
+                continue;
+
+            const Char* NameEnd = std::find(NameStart + 1, LineEnd, *NameStart == '<' ? '>' : '"');
+            if (NameEnd == LineEnd)
+                continue;
+
+            Handler(String{NameStart + 1, NameEnd});
+        }
+    }
+    catch (...)
+    {
+    }
+}
+
+} // namespace
+
+DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters*                               pRefCounters,
+                                                                   const DefaultShaderSourceStreamFactoryCreateInfo& CI) :
+    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters),
+    m_PrefetchIncludes{CI.PrefetchIncludes && (IsAsyncFileReadSupported() || MappedFile::IsMemoryMapped)},
+    m_UseFileReadQueue{m_PrefetchIncludes && IsAsyncFileReadSupported()}
 {
-    FileSystem::SplitPathList(SearchDirectories,
+    FileSystem::SplitPathList(CI.SearchDirectories,
                               [&](const char* Path, size_t Len) //
                               {
                                   String SearchPath{Path, Len};
@@ -74,41 +172,197 @@ void DefaultShaderSourceStreamFactory::CreateInputStream(const Char*   Name,
     CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
 }
 
-void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*                             Name,
-                                                          CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
-                                                          IFileStream**                           ppStream)
+String DefaultShaderSourceStreamFactory::FindFile(const Char* Name) const
+{
+    if (FileSystem::IsPathAbsolute(Name))
+        return FileSystem::FileExists(Name) ? String{Name} : String{};
+
+    for (const auto& SearchDir : m_SearchDirectories)
+    {
+        auto FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
+        if (FileSystem::FileExists(FullPath.c_str()))
+            return FullPath;
+    }
+    return {};
+}
+
+RefCntAutoPtr<IFileStream> DefaultShaderSourceStreamFactory::CreateFileStream(const Char* Name)
+{
+    const auto Path = FindFile(Name);
+    if (Path.empty())
+        return {};
+
+    RefCntAutoPtr<IFileStream> pFileStream;
+    if (MappedFile::IsMemoryMapped)
+    {
+        // Memory-mapped streams let the consumers reference the file contents without copying them
+        pFileStream = MappedFileStream::Create(Path.c_str());
+    }
+    else
+    {
+        pFileStream = BasicFileStream::Create(Path.c_str(), EFileAccessMode::Read);
+        if (!pFileStream->IsValid())
+            pFileStream.Release();
+    }
+    return pFileStream;
+}
+
+DefaultShaderSourceStreamFactory::PrefetchedFilesMap DefaultShaderSourceStreamFactory::PrefetchIncludes(const Char* pSource, size_t SourceSize)
 {
-    auto CreateFileStream = [](const char* Path) //
+    std::vector<String> Names;
+    FindIncludeNames(pSource, SourceSize,
+                     [&](String&& Name) //
+                     {
+                         if (std::find(Names.begin(), Names.end(), Name) == Names.end())
+                             Names.emplace_back(std::move(Name));
+                     });
+
     {
-        RefCntAutoPtr<BasicFileStream> pFileStream;
-        if (FileSystem::FileExists(Path))
+        // Skip the files that have already been prefetched for this compilation
+        std::lock_guard<std::mutex> Lock{m_PrefetchedFilesMtx};
+
+        auto thread_it = m_PrefetchedFiles.find(std::this_thread::get_id());
+        if (thread_it != m_PrefetchedFiles.end())
         {
-            pFileStream = BasicFileStream::Create(Path, EFileAccessMode::Read);
-            if (!pFileStream->IsValid())
-                pFileStream.Release();
+            const auto& ThreadFiles = thread_it->second;
+            Names.erase(std::remove_if(Names.begin(), Names.end(),
+                                       [&ThreadFiles](const String& Name) {
+                                           return ThreadFiles.find(Name) != ThreadFiles.end();
+                                       }),
+                        Names.end());
         }
-        return pFileStream;
-    };
+    }
 
-    RefCntAutoPtr<BasicFileStream> pFileStream;
-    if (FileSystem::IsPathAbsolute(Name))
+    // Resolve the names the same way CreateFileStream() does
+    std::vector<String> Paths;
+    for (auto it = Names.begin(); it != Names.end();)
     {
-        pFileStream = CreateFileStream(Name);
+        auto Path = FindFile(it->c_str());
+        if (!Path.empty())
+        {
+            Paths.emplace_back(std::move(Path));
+            ++it;
+        }
+        else
+        {
+            it = Names.erase(it);
+        }
+    }
+
+    PrefetchedFilesMap Files;
+    if (Names.empty())
+        return Files;
+
+    if (m_UseFileReadQueue)
+    {
+        // Keep all reads in flight at once. Without a thread pool, the callback
+        // is called by this thread.
+        std::vector<const Char*> pPaths(Paths.size());
+        for (size_t i = 0; i < Paths.size(); ++i)
+            pPaths[i] = Paths[i].c_str();
+
+        LoadFilesAttribs Attribs;
+        Attribs.ppPaths  = pPaths.data();
+        Attribs.NumFiles = static_cast<Uint32>(pPaths.size());
+        Attribs.Callback = [&](Uint32 FileIndex, IDataBlob* pData) {
+            if (pData == nullptr)
+                return;
+
+            PrefetchedFile File;
+            File.pData   = static_cast<const Char*>(pData->GetConstDataPtr());
+            File.Size    = pData->GetSize();
+            File.pStream = MemoryFileStream::Create(pData);
+            Files.emplace(std::move(Names[FileIndex]), std::move(File));
+        };
+        LoadFiles(Attribs);
     }
     else
     {
-        for (const auto& SearchDir : m_SearchDirectories)
+        for (size_t i = 0; i < Names.size(); ++i)
         {
-            const auto FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
-            pFileStream         = CreateFileStream(FullPath.c_str());
-            if (pFileStream)
-                break;
+            if (auto pStream = MappedFileStream::Create(Paths[i].c_str()))
+            {
+                // Start reading the contents in the background. The stream is handed out
+                // as is, so the include processor references the mapped memory.
+                pStream->Advise(MappedFileAccessHint::WillNeed);
+
+                PrefetchedFile File;
+                File.pData   = static_cast<const Char*>(pStream->GetData());
+                File.Size    = pStream->GetSize();
+                File.pStream = std::move(pStream);
+                Files.emplace(std::move(Names[i]), std::move(File));
+            }
+        }
+    }
+
+    return Files;
+}
+
+void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*                             Name,
+                                                          CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                          IFileStream**                           ppStream)
+{
+    RefCntAutoPtr<IFileStream> pFileStream;
+    if (m_PrefetchIncludes)
+    {
+        const auto ThreadId = std::this_thread::get_id();
+
+        PrefetchedFile File;
+        {
+            std::lock_guard<std::mutex> Lock{m_PrefetchedFilesMtx};
+
+            auto thread_it = m_PrefetchedFiles.find(ThreadId);
+            if (thread_it != m_PrefetchedFiles.end())
+            {
+                auto& ThreadFiles = thread_it->second;
+
+                auto it = ThreadFiles.find(Name);
+                if (it != ThreadFiles.end())
+                {
+                    File = std::move(it->second);
+                    ThreadFiles.erase(it);
+                }
+
+                // A file that was not prefetched starts a new compilation on this thread.
+                // Drop the files prefetched for the previous one, including the unused ones,
+                // so that their contents are never returned after the files change.
+                if (!File.pStream || ThreadFiles.empty())
+                    m_PrefetchedFiles.erase(thread_it);
+            }
+        }
+
+        if (!File.pStream)
+        {
+            File.pStream = CreateFileStream(Name);
+            if (RefCntAutoPtr<MappedFileStream> pMappedStream{File.pStream, MappedFileStream::IID_InternalImpl})
+            {
+                File.pData = static_cast<const Char*>(pMappedStream->GetData());
+                File.Size  = pMappedStream->GetSize();
+            }
+        }
+        pFileStream = std::move(File.pStream);
+
+        if (File.pData != nullptr)
+        {
+            auto Includes = PrefetchIncludes(File.pData, File.Size);
+            if (!Includes.empty())
+            {
+                std::lock_guard<std::mutex> Lock{m_PrefetchedFilesMtx};
+
+                auto& ThreadFiles = m_PrefetchedFiles[ThreadId];
+                for (auto& it : Includes)
+                    ThreadFiles.emplace(it.first, std::move(it.second));
+            }
         }
     }
+    else
+    {
+        pFileStream = CreateFileStream(Name);
+    }
 
     if (pFileStream)
     {
-        pFileStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+        *ppStream = pFileStream.Detach();
     }
     else
     {
@@ -122,13 +376,21 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
 
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
+{
+    DefaultShaderSourceStreamFactoryCreateInfo CI;
+    CI.SearchDirectories = SearchDirectories;
+    CreateDefaultShaderSourceStreamFactory(CI, ppShaderSourceStreamFactory);
+}
+
+void CreateDefaultShaderSourceStreamFactory(const DefaultShaderSourceStreamFactoryCreateInfo& CI,
+                                            IShaderSourceInputStreamFactory**                 ppShaderSourceStreamFactory)
 {
     DEV_CHECK_ERR(ppShaderSourceStreamFactory != nullptr, "ppShaderSourceStreamFactory must not be null.");
     DEV_CHECK_ERR(*ppShaderSourceStreamFactory == nullptr, "*ppShaderSourceStreamFactory is not null. Make sure the pointer is null to avoid memory leaks.");
 
     auto& Allocator = GetRawAllocator();
     auto* pStreamFactory =
-        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(SearchDirectories);
+        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(CI);
     pStreamFactory->QueryInterface(IID_IShaderSourceInputStreamFactory, reinterpret_cast<IObject**>(ppShaderSourceStreamFactory));
 }
 
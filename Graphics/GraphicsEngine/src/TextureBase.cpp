@@ -321,6 +321,48 @@ void ValidateTextureDesc(const TextureDesc& Desc, const IRenderDevice* pDevice)
     }
 }
 
+void ValidateTextureInitData(const TextureDesc& Desc, const TextureData* pInitData) noexcept(false)
+{
+    const bool HasInitData = pInitData != nullptr && pInitData->pSubResources != nullptr;
+    if (!HasInitData)
+    {
+        if (Desc.Usage == USAGE_IMMUTABLE)
+            LOG_TEXTURE_ERROR_AND_THROW("initial data must not be null as immutable textures must be initialized at creation time.");
+        return;
+    }
+
+    VERIFY_TEXTURE(Desc.Usage != USAGE_SPARSE, "initial data must be null for sparse textures.");
+
+    const Uint32 ArraySize       = Desc.Is3D() ? 1 : Desc.GetArraySize();
+    const Uint32 NumSubresources = Desc.MipLevels * ArraySize;
+    VERIFY_TEXTURE(pInitData->NumSubresources == NumSubresources,
+                   "incorrect number of subresources in init data. ", NumSubresources, " expected, while ", pInitData->NumSubresources, " provided.");
+
+    for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            const TextureSubResData& SubResData = pInitData->pSubResources[Slice * Desc.MipLevels + Mip];
+            VERIFY_TEXTURE((SubResData.pData != nullptr) ^ (SubResData.pSrcBuffer != nullptr),
+                           "either CPU data pointer (pData) or GPU buffer (pSrcBuffer) of subresource ", Slice * Desc.MipLevels + Mip,
+                           " must not be null, but not both.");
+
+            if (Desc.Is1D())
+                continue;
+
+            const MipLevelProperties MipProps = GetMipLevelProperties(Desc, Mip);
+            VERIFY_TEXTURE(SubResData.Stride >= MipProps.RowSize,
+                           "the stride (", SubResData.Stride, ") of mip level ", Mip, " in slice ", Slice, " is below the row size (", MipProps.RowSize, ").");
+            if (Desc.Is3D() && MipProps.Depth > 1)
+            {
+                const Uint64 NumRows = MipProps.RowSize > 0 ? MipProps.DepthSliceSize / MipProps.RowSize : 0;
+                VERIFY_TEXTURE(SubResData.DepthStride >= SubResData.Stride * NumRows,
+                               "the depth stride (", SubResData.DepthStride, ") of mip level ", Mip, " is below the depth slice size (", SubResData.Stride * NumRows, ").");
+            }
+        }
+    }
+}
+
 
 void ValidateTextureRegion(const TextureDesc& TexDesc, Uint32 MipLevel, Uint32 Slice, const Box& Box)
 {
@@ -1062,6 +1062,9 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     // Setting pipeline state to null makes sure that render targets and other
     // states will be restored in the command list next time a PSO is bound.
     m_pPipelineState = nullptr;
+
+    // No memory allocated from the frame arena is in use between commands
+    ResetFrameArena();
 }
 
 void DeviceContextD3D12Impl::Flush()
@@ -2740,11 +2743,13 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
 
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC    d3d12BuildASDesc   = {};
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& d3d12BuildASInputs = d3d12BuildASDesc.Inputs;
-    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>           Geometries;
+    D3D12_RAYTRACING_GEOMETRY_DESC*                       Geometries         = nullptr;
+    Uint32                                                GeometryCount      = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        Geometries.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        Geometries    = ConstructFrameArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -2816,7 +2821,8 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        Geometries.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        Geometries    = ConstructFrameArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -2852,8 +2858,8 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     d3d12BuildASInputs.Type           = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
     d3d12BuildASInputs.Flags          = BuildASFlagsToD3D12ASBuildFlags(BLASDesc.Flags);
     d3d12BuildASInputs.DescsLayout    = D3D12_ELEMENTS_LAYOUT_ARRAY;
-    d3d12BuildASInputs.NumDescs       = static_cast<UINT>(Geometries.size());
-    d3d12BuildASInputs.pGeometryDescs = Geometries.data();
+    d3d12BuildASInputs.NumDescs       = GeometryCount;
+    d3d12BuildASInputs.pGeometryDescs = Geometries;
 
     d3d12BuildASDesc.DestAccelerationStructureData    = pBLASD3D12->GetGPUAddress();
     d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Attribs.ScratchBufferOffset;
@@ -304,6 +304,12 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetSwapChain(ISwapChainGL* pSwapChain) override final;
 
+    /// Implementation of IDeviceContextGL::GetVAOCacheStats().
+    virtual void DILIGENT_CALL_TYPE GetVAOCacheStats(VAOCacheStatsGL& Stats) const override final;
+
+    /// Implementation of IDeviceContextGL::GetResourceBindingStats().
+    virtual void DILIGENT_CALL_TYPE GetResourceBindingStats(ResourceBindingStatsGL& Stats) const override final;
+
     virtual void ResetRenderTargets() override final;
 
     GLuint GetDefaultFBO() const;
@@ -35,6 +35,7 @@
 #include "UniqueIdentifier.hpp"
 #include "GLContext.hpp"
 #include "AsyncWritableResource.hpp"
+#include "DeviceContextGL.h"
 
 namespace Diligent
 {
@@ -48,7 +49,7 @@ public:
 
     void SetProgram        (const GLObjectWrappers::GLProgramObj&     GLProgram);
     void SetPipeline       (const GLObjectWrappers::GLPipelineObj&    GLPipeline);
-    void BindVAO           (const GLObjectWrappers::GLVertexArrayObj& VAO);
+    bool BindVAO           (const GLObjectWrappers::GLVertexArrayObj& VAO);
     void BindFBO           (const GLObjectWrappers::GLFrameBufferObj& FBO);
     void SetActiveTexture  (Int32 Index);
     void BindTexture       (Int32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex);
@@ -93,6 +94,38 @@ public:
     void SetNumPatchVertices(Int32 NumVertices);
     void Invalidate();
 
+    // Resource binding batch. While the batch is alive, texture, sampler, uniform buffer
+    // and storage block bindings to non-negative slots that change the state are recorded
+    // rather than issued. When the batch is destroyed, every contiguous range of changed
+    // slots is bound with a single multi-bind call (ARB_multi_bind).
+    // If multi-bind is not supported, bindings are issued immediately.
+    class ResourceBindingBatch
+    {
+    public:
+        explicit ResourceBindingBatch(GLContextState& State) :
+            m_State{State}
+        {
+            m_State.BeginResourceBindings();
+        }
+
+        ~ResourceBindingBatch()
+        {
+            m_State.CommitResourceBindings();
+        }
+
+        // clang-format off
+        ResourceBindingBatch           (const ResourceBindingBatch&)  = delete;
+        ResourceBindingBatch           (      ResourceBindingBatch&&) = delete;
+        ResourceBindingBatch& operator=(const ResourceBindingBatch&)  = delete;
+        ResourceBindingBatch& operator=(      ResourceBindingBatch&&) = delete;
+        // clang-format on
+
+    private:
+        GLContextState& m_State;
+    };
+
+    const ResourceBindingStatsGL& GetResourceBindingStats() const { return m_BindingStats; }
+
     void InvalidateVAO()
     {
         m_VAOId = -1;
@@ -116,6 +149,7 @@ public:
         bool  IsFillModeSelectionSupported = true;
         bool  IsProgramPipelineSupported   = true;
         bool  IsDepthClampSupported        = true;
+        bool  IsMultiBindSupported         = false;
         GLint MaxCombinedTexUnits          = 0;
         GLint MaxDrawBuffers               = 0;
         GLint MaxUniformBufferBindings     = 0;
@@ -239,6 +273,40 @@ private:
 
     MEMORY_BARRIER m_PendingMemoryBarriers = MEMORY_BARRIER_NONE;
 
+    // Only used by ResourceBindingBatch, so that every batch that is opened is also committed
+    void BeginResourceBindings();
+    void CommitResourceBindings();
+
+    // Bindings recorded between BeginResourceBindings() and CommitResourceBindings()
+    class PendingBindings
+    {
+    public:
+        void Add(Uint32 Slot, GLuint Handle, GLintptr Offset = 0, GLsizeiptr Size = 0);
+        void Remove(Uint32 Slot);
+
+        // Calls Handler(First, Count, Handles, Offsets, Sizes) for every contiguous range of
+        // pending slots and clears the list.
+        template <typename HandlerType>
+        void Flush(HandlerType&& Handler);
+
+    private:
+        std::vector<GLuint>     m_Handles;
+        std::vector<GLintptr>   m_Offsets;
+        std::vector<GLsizeiptr> m_Sizes;
+        std::vector<Uint8>      m_IsPending;
+
+        Uint32 m_MinSlot = ~0u;
+        Uint32 m_MaxSlot = 0;
+    };
+    PendingBindings m_PendingTextures;
+    PendingBindings m_PendingSamplers;
+    PendingBindings m_PendingUniformBuffers;
+    PendingBindings m_PendingStorageBlocks;
+
+    bool m_DeferResourceBindings = false;
+
+    ResourceBindingStatsGL m_BindingStats;
+
     class EnableStateHelper
     {
     public:
@@ -533,6 +533,10 @@
 #   define GL_MAX_IMAGE_UNITS 0x8F38
 #endif
 
+#ifndef GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET
+#   define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+#endif
+
 #ifndef GL_ARB_shader_storage_buffer_object
 #   define GL_ARB_shader_storage_buffer_object 1
 #endif
@@ -1236,6 +1240,18 @@ void UnsupportedGLFunctionStub( const T &Name )
     typedef void (GL_APIENTRY* PFNGLSHADERSTORAGEBLOCKBINDINGPROC) (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding);
     extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC glShaderStorageBlockBinding;
 
+    #define LOAD_GL_VERTEX_ATTRIB_BINDING
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBFORMATPROC) (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+    extern PFNGLVERTEXATTRIBFORMATPROC glVertexAttribFormat;
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBIFORMATPROC) (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+    extern PFNGLVERTEXATTRIBIFORMATPROC glVertexAttribIFormat;
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBBINDINGPROC) (GLuint attribindex, GLuint bindingindex);
+    extern PFNGLVERTEXATTRIBBINDINGPROC glVertexAttribBinding;
+    typedef void (GL_APIENTRY* PFNGLVERTEXBINDINGDIVISORPROC) (GLuint bindingindex, GLuint divisor);
+    extern PFNGLVERTEXBINDINGDIVISORPROC glVertexBindingDivisor;
+    typedef void (GL_APIENTRY* PFNGLBINDVERTEXBUFFERPROC) (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+    extern PFNGLBINDVERTEXBUFFERPROC glBindVertexBuffer;
+
 #endif //GL_ES_VERSION_3_1
 
 // GL_OES_texture_buffer or GL_EXT_texture_buffer or 3.2
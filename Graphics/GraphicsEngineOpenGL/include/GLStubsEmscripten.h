@@ -657,6 +657,10 @@
 #    define GL_DOUBLE_VEC4 0x8FFE
 #endif
 
+#ifndef GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET
+#    define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+#endif
+
 
 // Define unsupported GL function stubs
 // We need a Variatic Template to turn off the warning about unused variables
@@ -709,3 +713,8 @@ static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64* params)
 #define glDispatchCompute(...)         UnsupportedGLFunctionStub("glDispatchCompute", __VA_ARGS__)
 #define glPatchParameteri(...)         UnsupportedGLFunctionStub("glPatchParameteri", __VA_ARGS__)
 #define glTexStorage2DMultisample(...) UnsupportedGLFunctionStub("glTexStorage2DMultisample", __VA_ARGS__)
+#define glVertexAttribFormat(...)      UnsupportedGLFunctionStub("glVertexAttribFormat", __VA_ARGS__)
+#define glVertexAttribIFormat(...)     UnsupportedGLFunctionStub("glVertexAttribIFormat", __VA_ARGS__)
+#define glVertexAttribBinding(...)     UnsupportedGLFunctionStub("glVertexAttribBinding", __VA_ARGS__)
+#define glVertexBindingDivisor(...)    UnsupportedGLFunctionStub("glVertexBindingDivisor", __VA_ARGS__)
+#define glBindVertexBuffer(...)        UnsupportedGLFunctionStub("glBindVertexBuffer", __VA_ARGS__)
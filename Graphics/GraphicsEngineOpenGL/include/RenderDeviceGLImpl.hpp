@@ -204,6 +204,9 @@ public:
     void      OnDestroyPSO(PipelineStateGLImpl& PSO);
     void      OnDestroyBuffer(BufferGLImpl& Buffer);
 
+    // Returns zero statistics if the context has no VAO cache yet
+    VAOCacheStatsGL GetVAOCacheStats(GLContext::NativeGLContextType Context) const;
+
     void PurgeContextCaches(GLContext::NativeGLContextType Context);
 
     GLProgramCache& GetProgramCache() { return m_ProgramCache; }
@@ -217,13 +220,16 @@ public:
         GLint MaxTextureUnits;
         GLint MaxStorageBlock;
         GLint MaxImagesUnits;
+        GLint MaxVertexAttribRelativeOffset;
     };
     const GLDeviceLimits& GetDeviceLimits() const { return m_DeviceLimits; }
 
     struct GLDeviceCaps
     {
-        bool FramebufferSRGB  = false;
-        bool SemalessCubemaps = false;
+        bool FramebufferSRGB     = false;
+        bool SemalessCubemaps    = false;
+        bool VertexAttribBinding = false;
+        bool MultiBind           = false;
     };
     const GLDeviceCaps& GetGLCaps() const { return m_GLCaps; }
 
@@ -242,7 +248,7 @@ protected:
 
     std::unordered_set<String> m_ExtensionStrings;
 
-    Threading::SpinLock                                          m_VAOCacheLock;
+    mutable Threading::SpinLock                                  m_VAOCacheLock;
     std::unordered_map<GLContext::NativeGLContextType, VAOCache> m_VAOCache;
 
     Threading::SpinLock                                          m_FBOCacheLock;
@@ -37,6 +37,7 @@
 #include "SpinLock.hpp"
 #include "HashUtils.hpp"
 #include "DeviceContextBase.hpp"
+#include "DeviceContextGL.h"
 
 namespace Diligent
 {
@@ -47,7 +48,9 @@ class BufferGLImpl;
 class VAOCache
 {
 public:
-    VAOCache();
+    // MaxVertexAttribRelativeOffset is the value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET,
+    // or zero if separate attribute format and buffer bindings are not supported.
+    explicit VAOCache(Uint32 MaxVertexAttribRelativeOffset);
     ~VAOCache();
 
     // clang-format off
@@ -64,10 +67,23 @@ public:
         VertexStreamInfo<BufferGLImpl>* const VertexStreams;
         const Uint32                          NumVertexStreams;
     };
-    const GLObjectWrappers::GLVertexArrayObj& GetVAO(const VAOAttribs&     Attribs,
-                                                     class GLContextState& GLContextState);
+    // Finds or creates the VAO for the pipeline state and bound buffers, and binds it
+    void                                      BindVAO(const VAOAttribs&     Attribs,
+                                                      class GLContextState& GLContextState);
     const GLObjectWrappers::GLVertexArrayObj& GetEmptyVAO();
 
+    // Binds the VAO that matches the input layout of the pipeline state and attaches
+    // vertex and index buffers to it using separate attribute format and buffer bindings
+    // (GL4.3+, GLES3.1+ or ARB_vertex_attrib_binding). One VAO is shared by all pipelines
+    // with the same layout, and only buffer bindings that changed since the VAO was last
+    // used are updated.
+    // Returns false if the layout can't be expressed with separate bindings, in which
+    // case the application must fall back to BindVAO().
+    bool BindLayoutVAO(const VAOAttribs&     Attribs,
+                       class GLContextState& GLContextState);
+
+    VAOCacheStatsGL GetStatistics() const;
+
     void OnDestroyBuffer(const BufferGLImpl& Buffer);
     void OnDestroyPSO(const PipelineStateGLImpl& PSO);
 
@@ -120,15 +136,80 @@ private:
         };
     };
 
+    // Input layout key of the VAO used by BindLayoutVAO(). Buffer strides are
+    // not part of the VAO format and are set by glBindVertexBuffer.
+    struct LayoutVAOKey
+    {
+        struct Element
+        {
+            Uint32                  InputIndex           = 0;
+            Uint32                  BufferSlot           = 0;
+            Uint32                  NumComponents        = 0;
+            Uint32                  RelativeOffset       = 0;
+            Uint32                  InstanceDataStepRate = 0;
+            VALUE_TYPE              ValueType            = VT_UNDEFINED;
+            INPUT_ELEMENT_FREQUENCY Frequency            = INPUT_ELEMENT_FREQUENCY_UNDEFINED;
+            bool                    IsNormalized         = false;
+
+            bool operator==(const Element& rhs) const noexcept;
+        };
+        std::vector<Element> Elements;
+
+        size_t Hash = 0;
+
+        bool operator==(const LayoutVAOKey& Key) const noexcept
+        {
+            return Hash == Key.Hash && Elements == Key.Elements;
+        }
+
+        struct Hasher
+        {
+            std::size_t operator()(const LayoutVAOKey& Key) const noexcept
+            {
+                return Key.Hash;
+            }
+        };
+    };
+
+    struct LayoutVAO
+    {
+        GLObjectWrappers::GLVertexArrayObj VAO{true};
+
+        Uint32 UsedSlotsMask = 0;
+
+        // Buffers currently attached to the VAO. Unique IDs are never reused,
+        // so stale entries for destroyed buffers never match a live buffer.
+        struct BoundStream
+        {
+            UniqueIdentifier BufferUId = -1;
+            Uint64           Offset    = 0;
+            Uint32           Stride    = 0;
+        } Streams[MAX_BUFFER_SLOTS];
+
+        UniqueIdentifier IndexBufferUId = -1;
+    };
+
+    // Returns the layout VAO for the pipeline, or null if the pipeline layout can't
+    // be expressed with separate attribute format and buffer bindings.
+    LayoutVAO* GetLayoutVAO(const PipelineStateGLImpl& PSO, GLContextState& GLState);
+
     // Clears stale entries from m_PSOToKey and m_BuffToKey when a VAO is removed from m_Cache
     void ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys);
 
-    Threading::SpinLock                                                                    m_CacheLock;
+    mutable Threading::SpinLock                                                            m_CacheLock;
     std::unordered_map<VAOHashKey, GLObjectWrappers::GLVertexArrayObj, VAOHashKey::Hasher> m_Cache;
 
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_PSOToKey;
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_BuffToKey;
 
+    std::unordered_map<LayoutVAOKey, LayoutVAO, LayoutVAOKey::Hasher> m_LayoutVAOs;
+    // Null value indicates that the pipeline layout is not supported by BindLayoutVAO()
+    std::unordered_map<UniqueIdentifier, LayoutVAO*> m_PSOToLayoutVAO;
+
+    const Uint32 m_MaxVertexAttribRelativeOffset;
+
+    VAOCacheStatsGL m_Stats;
+
     // Any draw command fails if no VAO is bound. We will use this empty
     // VAO for draw commands with null input layout, such as these that
     // only use VertexID as input.
@@ -40,6 +40,51 @@ struct ISwapChainGL;
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextGL =
     {0x3464fdf1, 0xc548, 0x4935, {0x96, 0xc3, 0xb4, 0x54, 0xc9, 0xdf, 0x6f, 0x6a}};
 
+/// Statistics of the vertex array object (VAO) cache of a GL context.
+
+/// When separate attribute formats and buffer bindings are supported (GL4.3+, GLES3.1+ or
+/// GL_ARB_vertex_attrib_binding), the context uses one VAO per input layout and only rebinds
+/// the buffers that changed. Otherwise, it creates a VAO for every combination of
+/// pipeline state and bound buffers.
+struct VAOCacheStatsGL
+{
+    /// The number of VAOs created for combinations of pipeline states and bound buffers.
+    Uint32 NumVAOsCreated DEFAULT_INITIALIZER(0);
+
+    /// The number of VAOs created for input layouts.
+    Uint32 NumLayoutVAOsCreated DEFAULT_INITIALIZER(0);
+
+    /// The number of draw commands that required setting up the vertex input.
+    Uint64 NumRequests DEFAULT_INITIALIZER(0);
+
+    /// The number of GL calls issued to set up the vertex input, including
+    /// VAO creation and binding. Memory barriers and error checks are not counted.
+    Uint64 NumGLCalls DEFAULT_INITIALIZER(0);
+};
+typedef struct VAOCacheStatsGL VAOCacheStatsGL;
+
+/// Shader resource binding statistics of a GL context.
+
+/// When GL_ARB_multi_bind is supported (GL4.4+), the context binds every contiguous range
+/// of textures, samplers, uniform buffers and storage blocks that changed with a single call.
+struct ResourceBindingStatsGL
+{
+    /// The number of GL calls issued to bind textures, samplers, images,
+    /// uniform buffers and storage blocks.
+    Uint64 NumGLCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of GL calls that bound a range of resources at once
+    /// (glBindTextures, glBindSamplers and glBindBuffersRange).
+    Uint64 NumMultiBindCalls DEFAULT_INITIALIZER(0);
+
+    /// The number of bindings that changed the context state.
+    Uint64 NumBindings DEFAULT_INITIALIZER(0);
+
+    /// The number of bindings skipped because the resource was already bound.
+    Uint64 NumRedundantBindings DEFAULT_INITIALIZER(0);
+};
+typedef struct ResourceBindingStatsGL ResourceBindingStatsGL;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextGL
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -72,6 +117,17 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextGL, IDeviceContext)
     /// to obtain the default FBO handle.
     VIRTUAL void METHOD(SetSwapChain)(THIS_
                                       struct ISwapChainGL* pSwapChain) PURE;
+
+    /// Returns the statistics of the VAO cache of the current GL context, see Diligent::VAOCacheStatsGL.
+    VIRTUAL void METHOD(GetVAOCacheStats)(THIS_
+                                          VAOCacheStatsGL REF Stats) CONST PURE;
+
+    /// Returns the shader resource binding statistics of the context, see Diligent::ResourceBindingStatsGL.
+    ///
+    /// \remarks   The counters are never reset. To get the statistics for a range of commands,
+    ///             compute the difference between the values returned before and after them.
+    VIRTUAL void METHOD(GetResourceBindingStats)(THIS_
+                                                 ResourceBindingStatsGL REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -84,6 +140,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContextGL_UpdateCurrentGLContext(This)      CALL_IFACE_METHOD(DeviceContextGL, UpdateCurrentGLContext,      This)
 #    define IDeviceContextGL_PurgeCurrentGLContextCaches(This) CALL_IFACE_METHOD(DeviceContextGL, PurgeCurrentGLContextCaches, This)
 #    define IDeviceContextGL_SetSwapChain(This, ...)           CALL_IFACE_METHOD(DeviceContextGL, SetSwapChain,                This, __VA_ARGS__)
+#    define IDeviceContextGL_GetVAOCacheStats(This, ...)       CALL_IFACE_METHOD(DeviceContextGL, GetVAOCacheStats,            This, __VA_ARGS__)
+#    define IDeviceContextGL_GetResourceBindingStats(This, ...) CALL_IFACE_METHOD(DeviceContextGL, GetResourceBindingStats,     This, __VA_ARGS__)
 
 // clang-format on
 
@@ -682,28 +682,33 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
 
     m_CommittedResourcesTentativeBarriers = MEMORY_BARRIER_NONE;
 
-    while (BindSRBMask != 0)
+    // Changed texture, sampler and buffer bindings from all signatures are issued
+    // together so that adjacent slots can be bound with a single multi-bind call.
     {
-        auto SignBit = ExtractLSB(BindSRBMask);
-        auto sign    = PlatformMisc::GetLSB(SignBit);
-        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
-        const auto& BaseBindings = m_pPipelineState->GetBaseBindings(sign);
+        GLContextState::ResourceBindingBatch BindingBatch{m_ContextState};
+        while (BindSRBMask != 0)
+        {
+            auto SignBit = ExtractLSB(BindSRBMask);
+            auto sign    = PlatformMisc::GetLSB(SignBit);
+            VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+            const auto& BaseBindings = m_pPipelineState->GetBaseBindings(sign);
 #ifdef DILIGENT_DEVELOPMENT
-        m_BindInfo.BaseBindings[sign] = BaseBindings;
+            m_BindInfo.BaseBindings[sign] = BaseBindings;
 #endif
 
-        const auto* pResourceCache = m_BindInfo.ResourceCaches[sign];
-        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at index ", sign, " is null");
-        if (m_BindInfo.StaleSRBMask & SignBit)
-            pResourceCache->BindResources(GetContextState(), BaseBindings, m_BoundWritableTextures, m_BoundWritableBuffers);
-        else
-        {
-            VERIFY((m_BindInfo.DynamicSRBMask & SignBit) != 0,
-                   "When bit in StaleSRBMask is not set, the same bit in DynamicSRBMask must be set. Check GetCommitMask().");
-            DEV_CHECK_ERR(pResourceCache->HasDynamicResources(),
-                          "Bit in DynamicSRBMask is set, but the cache does not contain dynamic resources. This may indicate that resources "
-                          "in the cache have changed, but the SRB has not been committed before the draw/dispatch command.");
-            pResourceCache->BindDynamicBuffers(GetContextState(), BaseBindings);
+            const auto* pResourceCache = m_BindInfo.ResourceCaches[sign];
+            DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at index ", sign, " is null");
+            if (m_BindInfo.StaleSRBMask & SignBit)
+                pResourceCache->BindResources(GetContextState(), BaseBindings, m_BoundWritableTextures, m_BoundWritableBuffers);
+            else
+            {
+                VERIFY((m_BindInfo.DynamicSRBMask & SignBit) != 0,
+                       "When bit in StaleSRBMask is not set, the same bit in DynamicSRBMask must be set. Check GetCommitMask().");
+                DEV_CHECK_ERR(pResourceCache->HasDynamicResources(),
+                              "Bit in DynamicSRBMask is set, but the cache does not contain dynamic resources. This may indicate that resources "
+                              "in the cache have changed, but the SRB has not been committed before the draw/dispatch command.");
+                pResourceCache->BindDynamicBuffers(GetContextState(), BaseBindings);
+            }
         }
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
@@ -777,8 +782,10 @@ void DeviceContextGLImpl::PrepareForDraw(DRAW_FLAGS Flags, bool IsIndexed, GLenu
                     m_VertexStreams,
                     m_NumVertexStreams //
                 };
-            const auto& VAO = VaoCache.GetVAO(vaoAttribs, m_ContextState);
-            m_ContextState.BindVAO(VAO);
+            // With separate attribute format and buffer bindings, one VAO is used per input
+            // layout, and vertex buffers are switched with glBindVertexBuffer.
+            if (!m_pDevice->GetGLCaps().VertexAttribBinding || !VaoCache.BindLayoutVAO(vaoAttribs, m_ContextState))
+                VaoCache.BindVAO(vaoAttribs, m_ContextState);
         }
         else
         {
@@ -1663,6 +1670,16 @@ void DeviceContextGLImpl::PurgeCurrentGLContextCaches()
         m_pDevice->PurgeContextCaches(NativeGLContext);
 }
 
+void DeviceContextGLImpl::GetVAOCacheStats(VAOCacheStatsGL& Stats) const
+{
+    Stats = m_pDevice->GetVAOCacheStats(m_ContextState.GetCurrentGLContext());
+}
+
+void DeviceContextGLImpl::GetResourceBindingStats(ResourceBindingStatsGL& Stats) const
+{
+    Stats = m_ContextState.GetResourceBindingStats();
+}
+
 void DeviceContextGLImpl::UpdateBuffer(IBuffer*                       pBuffer,
                                        Uint64                         Offset,
                                        Uint64                         Size,
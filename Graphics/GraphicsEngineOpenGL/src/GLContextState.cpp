@@ -48,6 +48,9 @@ GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
     m_Caps.IsFillModeSelectionSupported = AdapterInfo.Features.WireframeFill;
     m_Caps.IsProgramPipelineSupported   = AdapterInfo.Features.SeparablePrograms;
     m_Caps.IsDepthClampSupported        = AdapterInfo.Features.DepthClamp;
+#if GL_ARB_multi_bind
+    m_Caps.IsMultiBindSupported = pDeviceGL->GetGLCaps().MultiBind;
+#endif
 
     {
         m_Caps.MaxCombinedTexUnits = 0;
@@ -119,6 +122,8 @@ void GLContextState::Invalidate()
 
     m_iActiveTexture   = -1;
     m_NumPatchVertices = -1;
+
+    VERIFY(!m_DeferResourceBindings, "Context state is invalidated while resource bindings are being recorded");
 }
 
 template <typename ObjectType>
@@ -167,14 +172,15 @@ void GLContextState::SetPipeline(const GLPipelineObj& GLPipeline)
     }
 }
 
-void GLContextState::BindVAO(const GLVertexArrayObj& VAO)
+bool GLContextState::BindVAO(const GLVertexArrayObj& VAO)
 {
     GLuint VAOHandle = 0;
-    if (UpdateBoundObject(m_VAOId, VAO, VAOHandle))
-    {
-        glBindVertexArray(VAOHandle);
-        DEV_CHECK_GL_ERROR("Failed to set VAO");
-    }
+    if (!UpdateBoundObject(m_VAOId, VAO, VAOHandle))
+        return false;
+
+    glBindVertexArray(VAOHandle);
+    DEV_CHECK_GL_ERROR("Failed to set VAO");
+    return true;
 }
 
 void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
@@ -216,6 +222,10 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
 {
     VERIFY_EXPR(BindTarget != 0);
 
+    // Negative indices are used by texture operations that expect the texture
+    // to be bound to the active unit, so these bindings are never deferred.
+    const bool Defer = m_DeferResourceBindings && Index >= 0;
+
     if (Index < 0)
     {
         Index += m_Caps.MaxCombinedTexUnits;
@@ -223,7 +233,8 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
     VERIFY(0 <= Index && Index < m_Caps.MaxCombinedTexUnits, "Texture unit is out of range");
 
     // Always update active texture unit
-    SetActiveTexture(Index);
+    if (!Defer)
+        SetActiveTexture(Index);
 
     if (static_cast<size_t>(Index) >= m_BoundTextures.size())
         m_BoundTextures.resize(Index + 1);
@@ -235,15 +246,37 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
         // Unbind texture from the previous target.
         // This is necessary as at least on NVidia, having different textures bound to
         // multiple targets simultaneously may cause problems.
-        if (BoundTex.BindTarget != 0 && BoundTex.BindTarget != BindTarget && BoundTex.TexID != 0)
+        const bool UnbindPrevTarget = BoundTex.BindTarget != 0 && BoundTex.BindTarget != BindTarget && BoundTex.TexID != 0;
+        if (Defer && !UnbindPrevTarget)
         {
-            glBindTexture(BoundTex.BindTarget, 0);
-            DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BindTarget, " slot ", Index, ".");
+            // glBindTextures binds every texture to its own target
+            m_PendingTextures.Add(Index, TexObj);
+        }
+        else
+        {
+            if (m_DeferResourceBindings)
+                m_PendingTextures.Remove(Index);
+            if (Defer)
+                SetActiveTexture(Index);
+
+            if (UnbindPrevTarget)
+            {
+                glBindTexture(BoundTex.BindTarget, 0);
+                DEV_CHECK_GL_ERROR("Failed to unbind texture from target ", BindTarget, " slot ", Index, ".");
+                ++m_BindingStats.NumGLCalls;
+                ++m_BindingStats.NumMultiBindCalls;
+            }
+            glBindTexture(BindTarget, TexObj);
+            DEV_CHECK_GL_ERROR("Failed to bind texture to target ", BindTarget, " slot ", Index, ".");
+            ++m_BindingStats.NumGLCalls;
         }
-        glBindTexture(BindTarget, TexObj);
-        DEV_CHECK_GL_ERROR("Failed to bind texture to target ", BindTarget, " slot ", Index, ".");
 
         BoundTex = NewTex;
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 }
 
@@ -255,8 +288,21 @@ void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSampler
     GLuint GLSamplerHandle = 0;
     if (UpdateBoundObject(m_BoundSamplers[Index], GLSampler, GLSamplerHandle))
     {
-        glBindSampler(Index, GLSamplerHandle);
-        DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
+        if (m_DeferResourceBindings)
+        {
+            m_PendingSamplers.Add(Index, GLSamplerHandle);
+        }
+        else
+        {
+            glBindSampler(Index, GLSamplerHandle);
+            DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
+            ++m_BindingStats.NumGLCalls;
+        }
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 }
 
@@ -286,6 +332,14 @@ void GLContextState::BindImage(Uint32             Index,
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, MipLevel, IsLayered, Layer, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        // glBindImageTextures binds whole levels with access and format derived from the
+        // texture, so images are always bound individually.
+        ++m_BindingStats.NumGLCalls;
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -312,6 +366,12 @@ void GLContextState::BindImage(Uint32 Index, BufferViewGLImpl* pBuffView, GLenum
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, 0, GL_FALSE, 0, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_BindingStats.NumGLCalls;
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
@@ -364,10 +424,23 @@ void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBu
     {
         m_BoundUniformBuffers[Index] = NewUBOInfo;
         GLuint GLBufferHandle        = Buff;
-        // In addition to binding buffer to the indexed buffer binding target, glBindBufferBase also binds
-        // buffer to the generic buffer binding point specified by target.
-        glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
-        DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
+        if (m_DeferResourceBindings)
+        {
+            m_PendingUniformBuffers.Add(Index, GLBufferHandle, Offset, Size);
+        }
+        else
+        {
+            // In addition to binding buffer to the indexed buffer binding target, glBindBufferBase also binds
+            // buffer to the generic buffer binding point specified by target.
+            glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
+            DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
+            ++m_BindingStats.NumGLCalls;
+        }
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 }
 
@@ -382,16 +455,126 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
     {
         m_BoundStorageBlocks[Index] = NewSSBOInfo;
         GLuint GLBufferHandle       = Buff;
-        // In addition to binding buffer to the indexed buffer binding target, glBindBufferRange also binds
-        // buffer to the generic buffer binding point specified by target.
-        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
-        DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
+        if (m_DeferResourceBindings)
+        {
+            m_PendingStorageBlocks.Add(Index, GLBufferHandle, Offset, Size);
+        }
+        else
+        {
+            // In addition to binding buffer to the indexed buffer binding target, glBindBufferRange also binds
+            // buffer to the generic buffer binding point specified by target.
+            glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
+            DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
+            ++m_BindingStats.NumGLCalls;
+        }
+        ++m_BindingStats.NumBindings;
+    }
+    else
+    {
+        ++m_BindingStats.NumRedundantBindings;
     }
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
 }
 
+void GLContextState::PendingBindings::Add(Uint32 Slot, GLuint Handle, GLintptr Offset, GLsizeiptr Size)
+{
+    if (Slot >= m_IsPending.size())
+    {
+        const size_t NewSize = size_t{Slot} + 1;
+        m_Handles.resize(NewSize);
+        m_Offsets.resize(NewSize);
+        m_Sizes.resize(NewSize);
+        m_IsPending.resize(NewSize);
+    }
+
+    m_Handles[Slot]   = Handle;
+    m_Offsets[Slot]   = Offset;
+    m_Sizes[Slot]     = Size;
+    m_IsPending[Slot] = 1;
+
+    m_MinSlot = std::min(m_MinSlot, Slot);
+    m_MaxSlot = std::max(m_MaxSlot, Slot);
+}
+
+void GLContextState::PendingBindings::Remove(Uint32 Slot)
+{
+    if (Slot < m_IsPending.size())
+        m_IsPending[Slot] = 0;
+}
+
+template <typename HandlerType>
+void GLContextState::PendingBindings::Flush(HandlerType&& Handler)
+{
+    if (m_MinSlot > m_MaxSlot)
+        return;
+
+    for (Uint32 Slot = m_MinSlot; Slot <= m_MaxSlot;)
+    {
+        if (!m_IsPending[Slot])
+        {
+            ++Slot;
+            continue;
+        }
+
+        const auto First = Slot;
+        while (Slot <= m_MaxSlot && m_IsPending[Slot])
+            m_IsPending[Slot++] = 0;
+
+        Handler(First, Slot - First, &m_Handles[First], &m_Offsets[First], &m_Sizes[First]);
+    }
+
+    m_MinSlot = ~0u;
+    m_MaxSlot = 0;
+}
+
+void GLContextState::BeginResourceBindings()
+{
+    VERIFY(!m_DeferResourceBindings, "Resource bindings are already being recorded");
+    m_DeferResourceBindings = m_Caps.IsMultiBindSupported;
+}
+
+void GLContextState::CommitResourceBindings()
+{
+    if (!m_DeferResourceBindings)
+        return;
+
+    m_DeferResourceBindings = false;
+
+#if GL_ARB_multi_bind
+    m_PendingTextures.Flush([this](Uint32 First, Uint32 Count, const GLuint* Handles, const GLintptr*, const GLsizeiptr*) {
+        glBindTextures(First, Count, Handles);
+        DEV_CHECK_GL_ERROR("Failed to bind ", Count, " textures starting at slot ", First);
+        ++m_BindingStats.NumGLCalls;
+    });
+
+    m_PendingSamplers.Flush([this](Uint32 First, Uint32 Count, const GLuint* Handles, const GLintptr*, const GLsizeiptr*) {
+        glBindSamplers(First, Count, Handles);
+        DEV_CHECK_GL_ERROR("Failed to bind ", Count, " samplers starting at slot ", First);
+        ++m_BindingStats.NumGLCalls;
+        ++m_BindingStats.NumMultiBindCalls;
+    });
+
+    // Note that unlike glBindBufferRange, glBindBuffersRange does not modify the generic binding point
+    m_PendingUniformBuffers.Flush([this](Uint32 First, Uint32 Count, const GLuint* Handles, const GLintptr* Offsets, const GLsizeiptr* Sizes) {
+        glBindBuffersRange(GL_UNIFORM_BUFFER, First, Count, Handles, Offsets, Sizes);
+        DEV_CHECK_GL_ERROR("Failed to bind ", Count, " uniform buffers starting at slot ", First);
+        ++m_BindingStats.NumGLCalls;
+        ++m_BindingStats.NumMultiBindCalls;
+    });
+
+    m_PendingStorageBlocks.Flush([this](Uint32 First, Uint32 Count, const GLuint* Handles, const GLintptr* Offsets, const GLsizeiptr* Sizes) {
+        glBindBuffersRange(GL_SHADER_STORAGE_BUFFER, First, Count, Handles, Offsets, Sizes);
+        DEV_CHECK_GL_ERROR("Failed to bind ", Count, " shader storage blocks starting at slot ", First);
+        ++m_BindingStats.NumGLCalls;
+        ++m_BindingStats.NumMultiBindCalls;
+    });
+#else
+    UNEXPECTED("Resource bindings should never be deferred when GL_ARB_multi_bind is not available");
+#endif
+}
+
 void GLContextState::BindBuffer(GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO)
 {
     // Binding ARRAY_BUFFER or ELEMENT_ARRAY_BUFFER affects currently bound VAO
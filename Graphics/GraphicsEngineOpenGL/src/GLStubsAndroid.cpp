@@ -57,6 +57,14 @@
     DECLARE_GL_FUNCTION( glMemoryBarrier, PFNGLMEMORYBARRIERPROC, GLbitfield barriers )
 #endif
 
+#ifdef LOAD_GL_VERTEX_ATTRIB_BINDING
+    DECLARE_GL_FUNCTION( glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
+    DECLARE_GL_FUNCTION( glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
+    DECLARE_GL_FUNCTION( glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, GLuint attribindex, GLuint bindingindex )
+    DECLARE_GL_FUNCTION( glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, GLuint bindingindex, GLuint divisor )
+    DECLARE_GL_FUNCTION( glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
+#endif
+
 #ifdef LOAD_DRAW_ELEMENTS_INDIRECT
     DECLARE_GL_FUNCTION( glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, GLenum mode, GLenum type, const GLvoid *indirect )
 #endif
@@ -356,6 +364,14 @@ void LoadGLFunctions()
     LOAD_GL_FUNCTION(glMemoryBarrier)
 #endif
 
+#ifdef LOAD_GL_VERTEX_ATTRIB_BINDING
+    LOAD_GL_FUNCTION(glVertexAttribFormat)
+    LOAD_GL_FUNCTION(glVertexAttribIFormat)
+    LOAD_GL_FUNCTION(glVertexAttribBinding)
+    LOAD_GL_FUNCTION(glVertexBindingDivisor)
+    LOAD_GL_FUNCTION(glBindVertexBuffer)
+#endif
+
 #ifdef LOAD_DRAW_ELEMENTS_INDIRECT
     LOAD_GL_FUNCTION(glDrawElementsIndirect)
 #endif
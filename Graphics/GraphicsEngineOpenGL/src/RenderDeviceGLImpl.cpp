@@ -331,6 +331,12 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
             CHECK_GL_ERROR("glGetIntegerv(GL_MAX_IMAGE_UNITS) failed");
 #endif
         }
+
+        if (m_GLCaps.VertexAttribBinding)
+        {
+            glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, &m_DeviceLimits.MaxVertexAttribRelativeOffset);
+            CHECK_GL_ERROR("glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET) failed");
+        }
     }
 
     if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
@@ -826,6 +832,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
         if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
         {
             const bool IsGL46OrAbove = GLVersion >= Version{4, 6};
+            const bool IsGL44OrAbove = GLVersion >= Version{4, 4};
             const bool IsGL43OrAbove = GLVersion >= Version{4, 3};
             const bool IsGL42OrAbove = GLVersion >= Version{4, 2};
             const bool IsGL41OrAbove = GLVersion >= Version{4, 1};
@@ -892,8 +899,10 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             SamProps.LODBiasSupported = True;
             ASSERT_SIZEOF(SamProps, 3, "Did you add a new member to SamplerProperites? Please initialize it here.");
 
-            m_GLCaps.FramebufferSRGB  = IsGL40OrAbove || CheckExtension("GL_ARB_framebuffer_sRGB");
-            m_GLCaps.SemalessCubemaps = IsGL40OrAbove || CheckExtension("GL_ARB_seamless_cube_map");
+            m_GLCaps.FramebufferSRGB     = IsGL40OrAbove || CheckExtension("GL_ARB_framebuffer_sRGB");
+            m_GLCaps.SemalessCubemaps    = IsGL40OrAbove || CheckExtension("GL_ARB_seamless_cube_map");
+            m_GLCaps.VertexAttribBinding = IsGL43OrAbove || CheckExtension("GL_ARB_vertex_attrib_binding");
+            m_GLCaps.MultiBind           = IsGL44OrAbove || CheckExtension("GL_ARB_multi_bind");
         }
         else
         {
@@ -972,8 +981,10 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             SamProps.LODBiasSupported = GL_TEXTURE_LOD_BIAS && IsGLES31OrAbove;
             ASSERT_SIZEOF(SamProps, 3, "Did you add a new member to SamplerProperites? Please initialize it here.");
 
-            m_GLCaps.FramebufferSRGB  = strstr(Extensions, "sRGB_write_control");
-            m_GLCaps.SemalessCubemaps = false;
+            m_GLCaps.FramebufferSRGB     = strstr(Extensions, "sRGB_write_control");
+            m_GLCaps.SemalessCubemaps    = false;
+            m_GLCaps.VertexAttribBinding = IsGLES31OrAbove;
+            m_GLCaps.MultiBind           = false;
         }
 
 #ifdef GL_KHR_shader_subgroup
@@ -1691,7 +1702,22 @@ void RenderDeviceGLImpl::OnReleaseTexture(ITexture* pTexture)
 VAOCache& RenderDeviceGLImpl::GetVAOCache(GLContext::NativeGLContextType Context)
 {
     Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
-    return m_VAOCache[Context];
+
+    auto it = m_VAOCache.find(Context);
+    if (it == m_VAOCache.end())
+    {
+        const auto MaxRelativeOffset = static_cast<Uint32>(std::max(m_DeviceLimits.MaxVertexAttribRelativeOffset, 0));
+        it                           = m_VAOCache.emplace(std::piecewise_construct, std::forward_as_tuple(Context), std::forward_as_tuple(MaxRelativeOffset)).first;
+    }
+    return it->second;
+}
+
+VAOCacheStatsGL RenderDeviceGLImpl::GetVAOCacheStats(GLContext::NativeGLContextType Context) const
+{
+    Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
+
+    auto it = m_VAOCache.find(Context);
+    return it != m_VAOCache.end() ? it->second.GetStatistics() : VAOCacheStatsGL{};
 }
 
 void RenderDeviceGLImpl::OnDestroyPSO(PipelineStateGLImpl& PSO)
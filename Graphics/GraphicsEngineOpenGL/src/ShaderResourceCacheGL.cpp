@@ -278,7 +278,7 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
     {
         const auto& SSBO = GetConstSSBO(ssbo);
         if (!SSBO.pBufferView)
-            return;
+            continue;
 
         auto* const pBufferViewGL = SSBO.pBufferView.ConstPtr();
         const auto& ViewDesc      = pBufferViewGL->GetDesc();
@@ -44,7 +44,8 @@
 namespace Diligent
 {
 
-VAOCache::VAOCache() :
+VAOCache::VAOCache(Uint32 MaxVertexAttribRelativeOffset) :
+    m_MaxVertexAttribRelativeOffset{MaxVertexAttribRelativeOffset},
     m_EmptyVAO{true}
 {
     m_Cache.max_load_factor(0.5f);
@@ -100,6 +101,9 @@ void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
         m_PSOToKey.erase(it);
     }
 
+    // Layout VAOs are shared between pipelines and are kept alive
+    m_PSOToLayoutVAO.erase(PSO.GetUniqueID());
+
     // Clear stale entries in m_PSOToKey and m_BuffToKey that refer to dead VAOs
     // to avoid memory leaks.
     ClearStaleKeys(StaleKeys);
@@ -112,6 +116,8 @@ void VAOCache::Clear()
     m_Cache.clear();
     m_PSOToKey.clear();
     m_BuffToKey.clear();
+    m_PSOToLayoutVAO.clear();
+    m_LayoutVAOs.clear();
 }
 
 void VAOCache::ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys)
@@ -167,6 +173,45 @@ void VAOCache::ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys)
     RemoveStaleEntries(CandidateBuffers, m_BuffToKey);
 }
 
+static void ExecuteVertexInputBarriers(const VAOCache::VAOAttribs& Attribs, Uint32 UsedSlotsMask, GLContextState& GLState)
+{
+    for (auto SlotMask = UsedSlotsMask; SlotMask != 0;)
+    {
+        const auto SlotBit = ExtractLSB(SlotMask);
+        const auto Slot    = PlatformMisc::GetLSB(SlotBit);
+
+        auto& pBuffer = Attribs.VertexStreams[Slot].pBuffer;
+        VERIFY_EXPR(pBuffer);
+        pBuffer->BufferMemoryBarrier(
+            MEMORY_BARRIER_VERTEX_BUFFER, // Vertex data sourced from buffer objects after the barrier
+                                          // will reflect data written by shaders prior to the barrier.
+                                          // The set of buffer objects affected by this bit is derived
+                                          // from the GL_VERTEX_ARRAY_BUFFER_BINDING bindings
+            GLState);
+    }
+
+    if (Attribs.pIndexBuffer)
+    {
+        Attribs.pIndexBuffer->BufferMemoryBarrier(
+            MEMORY_BARRIER_INDEX_BUFFER, // Vertex array indices sourced from buffer objects after the barrier
+                                         // will reflect data written by shaders prior to the barrier.
+                                         // The buffer objects affected by this bit are derived from the
+                                         // ELEMENT_ARRAY_BUFFER binding.
+            GLState);
+    }
+}
+
+static bool IsIntegerVertexAttrib(VALUE_TYPE ValueType, bool IsNormalized)
+{
+    return (!IsNormalized &&
+            (ValueType == VT_INT8 ||
+             ValueType == VT_INT16 ||
+             ValueType == VT_INT32 ||
+             ValueType == VT_UINT8 ||
+             ValueType == VT_UINT16 ||
+             ValueType == VT_UINT32));
+}
+
 VAOCache::VAOHashKey::VAOHashKey(const VAOAttribs& Attribs) :
     // clang-format off
     PsoUId         {Attribs.PSO.GetUniqueID()},
@@ -239,8 +284,8 @@ bool VAOCache::VAOHashKey::operator==(const VAOHashKey& Key) const noexcept
     return true;
 }
 
-const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Attribs,
-                                                           GLContextState&   GLState)
+void VAOCache::BindVAO(const VAOAttribs& Attribs,
+                       GLContextState&   GLState)
 {
     // Lock the cache
     Threading::SpinLockGuard CacheGuard{m_CacheLock};
@@ -248,46 +293,27 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
     // Construct the key
     VAOHashKey Key{Attribs};
 
-    for (auto SlotMask = Key.UsedSlotsMask; SlotMask != 0;)
-    {
-        const auto SlotBit = ExtractLSB(SlotMask);
-        const auto Slot    = PlatformMisc::GetLSB(SlotBit);
-
-        auto& pBuffer = Attribs.VertexStreams[Slot].pBuffer;
-        VERIFY_EXPR(pBuffer);
-        VERIFY_EXPR(Key.Streams[Slot].BufferUId == pBuffer->GetUniqueID());
-
-        pBuffer->BufferMemoryBarrier(
-            MEMORY_BARRIER_VERTEX_BUFFER, // Vertex data sourced from buffer objects after the barrier
-                                          // will reflect data written by shaders prior to the barrier.
-                                          // The set of buffer objects affected by this bit is derived
-                                          // from the GL_VERTEX_ARRAY_BUFFER_BINDING bindings
-            GLState);
-    }
+    ExecuteVertexInputBarriers(Attribs, Key.UsedSlotsMask, GLState);
 
-    if (Attribs.pIndexBuffer)
-    {
-        Attribs.pIndexBuffer->BufferMemoryBarrier(
-            MEMORY_BARRIER_INDEX_BUFFER, // Vertex array indices sourced from buffer objects after the barrier
-                                         // will reflect data written by shaders prior to the barrier.
-                                         // The buffer objects affected by this bit are derived from the
-                                         // ELEMENT_ARRAY_BUFFER binding.
-            GLState);
-    }
+    ++m_Stats.NumRequests;
 
     // Try to find VAO in the map
     auto It = m_Cache.find(Key);
     if (It != m_Cache.end())
     {
-        return It->second;
+        if (GLState.BindVAO(It->second))
+            ++m_Stats.NumGLCalls;
     }
     else
     {
         // Create a new VAO
         GLObjectWrappers::GLVertexArrayObj NewVAO{true};
+        // glGenVertexArrays
+        ++m_Stats.NumGLCalls;
 
         // Initialize VAO
-        GLState.BindVAO(NewVAO);
+        if (GLState.BindVAO(NewVAO))
+            ++m_Stats.NumGLCalls;
 
         const auto& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
         const auto* LayoutElems = InputLayout.LayoutElements;
@@ -308,13 +334,7 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
             GLvoid* DataStartOffset = reinterpret_cast<GLvoid*>(StaticCast<size_t>(CurrStream.Offset) + static_cast<size_t>(LayoutElem.RelativeOffset));
 
             const auto GlType = TypeToGLType(LayoutElem.ValueType);
-            if (!LayoutElem.IsNormalized &&
-                (LayoutElem.ValueType == VT_INT8 ||
-                 LayoutElem.ValueType == VT_INT16 ||
-                 LayoutElem.ValueType == VT_INT32 ||
-                 LayoutElem.ValueType == VT_UINT8 ||
-                 LayoutElem.ValueType == VT_UINT16 ||
-                 LayoutElem.ValueType == VT_UINT32))
+            if (IsIntegerVertexAttrib(LayoutElem.ValueType, LayoutElem.IsNormalized))
                 glVertexAttribIPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, Stride, DataStartOffset);
             else
                 glVertexAttribPointer(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.IsNormalized, Stride, DataStartOffset);
@@ -325,14 +345,19 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
                 // buffer. If divisor is non-zero, then the current instance is divided by this divisor, and
                 // the result of that is used to access the attribute array.
                 glVertexAttribDivisor(LayoutElem.InputIndex, LayoutElem.InstanceDataStepRate);
+                ++m_Stats.NumGLCalls;
             }
             glEnableVertexAttribArray(LayoutElem.InputIndex);
+            // glBindBuffer, glVertexAttrib(I)Pointer, glEnableVertexAttribArray
+            m_Stats.NumGLCalls += 3;
         }
         if (Attribs.pIndexBuffer)
         {
             constexpr bool ResetVAO = false;
             GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
+            ++m_Stats.NumGLCalls;
         }
+        ++m_Stats.NumVAOsCreated;
 
         auto NewElems = m_Cache.emplace(std::make_pair(Key, std::move(NewVAO)));
         // New element must be actually inserted
@@ -361,7 +386,6 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
 
             m_BuffToKey[Key.Streams[Slot].BufferUId].push_back(Key);
         }
-        return NewElems.first->second;
     }
 }
 
@@ -370,4 +394,180 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetEmptyVAO()
     return m_EmptyVAO;
 }
 
+bool VAOCache::LayoutVAOKey::Element::operator==(const Element& rhs) const noexcept
+{
+    // clang-format off
+    return InputIndex           == rhs.InputIndex           &&
+           BufferSlot           == rhs.BufferSlot           &&
+           NumComponents        == rhs.NumComponents        &&
+           RelativeOffset       == rhs.RelativeOffset       &&
+           InstanceDataStepRate == rhs.InstanceDataStepRate &&
+           ValueType            == rhs.ValueType            &&
+           Frequency            == rhs.Frequency            &&
+           IsNormalized         == rhs.IsNormalized;
+    // clang-format on
+}
+
+VAOCache::LayoutVAO* VAOCache::GetLayoutVAO(const PipelineStateGLImpl& PSO, GLContextState& GLState)
+{
+    const auto PSOIt = m_PSOToLayoutVAO.find(PSO.GetUniqueID());
+    if (PSOIt != m_PSOToLayoutVAO.end())
+        return PSOIt->second;
+
+    const auto& InputLayout = PSO.GetGraphicsPipelineDesc().InputLayout;
+
+    LayoutVAOKey Key;
+    Key.Elements.resize(InputLayout.NumElements);
+
+    // Instance step rate is a property of the buffer binding rather than the attribute
+    Uint32 SlotStepRates[MAX_BUFFER_SLOTS] = {};
+    Uint32 UsedSlotsMask                   = 0;
+
+    bool IsSupported = true;
+    for (Uint32 i = 0; i < InputLayout.NumElements && IsSupported; ++i)
+    {
+        const auto& SrcElem = InputLayout.LayoutElements[i];
+        auto&       DstElem = Key.Elements[i];
+
+        DstElem.InputIndex           = SrcElem.InputIndex;
+        DstElem.BufferSlot           = SrcElem.BufferSlot;
+        DstElem.NumComponents        = SrcElem.NumComponents;
+        DstElem.RelativeOffset       = SrcElem.RelativeOffset;
+        DstElem.InstanceDataStepRate = SrcElem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE ? SrcElem.InstanceDataStepRate : 0;
+        DstElem.ValueType            = SrcElem.ValueType;
+        DstElem.Frequency            = SrcElem.Frequency;
+        DstElem.IsNormalized         = SrcElem.IsNormalized;
+        HashCombine(Key.Hash, DstElem.InputIndex, DstElem.BufferSlot, DstElem.NumComponents, DstElem.RelativeOffset,
+                    DstElem.InstanceDataStepRate, DstElem.ValueType, DstElem.Frequency, DstElem.IsNormalized);
+
+        VERIFY_EXPR(DstElem.BufferSlot < MAX_BUFFER_SLOTS);
+        const auto SlotBit = 1u << DstElem.BufferSlot;
+        if ((UsedSlotsMask & SlotBit) == 0)
+        {
+            SlotStepRates[DstElem.BufferSlot] = DstElem.InstanceDataStepRate;
+            UsedSlotsMask |= SlotBit;
+        }
+        else if (SlotStepRates[DstElem.BufferSlot] != DstElem.InstanceDataStepRate)
+        {
+            // Elements that share a buffer slot must use the same step rate
+            IsSupported = false;
+        }
+
+        if (DstElem.RelativeOffset > m_MaxVertexAttribRelativeOffset)
+            IsSupported = false;
+    }
+
+    if (!IsSupported)
+    {
+        m_PSOToLayoutVAO.emplace(PSO.GetUniqueID(), nullptr);
+        return nullptr;
+    }
+
+    auto LayoutIt = m_LayoutVAOs.find(Key);
+    if (LayoutIt == m_LayoutVAOs.end())
+    {
+        LayoutIt = m_LayoutVAOs.emplace(std::move(Key), LayoutVAO{}).first;
+        // glGenVertexArrays
+        ++m_Stats.NumGLCalls;
+
+        auto& NewVAO         = LayoutIt->second;
+        NewVAO.UsedSlotsMask = UsedSlotsMask;
+
+        if (GLState.BindVAO(NewVAO.VAO))
+            ++m_Stats.NumGLCalls;
+        for (const auto& Elem : LayoutIt->first.Elements)
+        {
+            const auto GlType = TypeToGLType(Elem.ValueType);
+            if (IsIntegerVertexAttrib(Elem.ValueType, Elem.IsNormalized))
+                glVertexAttribIFormat(Elem.InputIndex, Elem.NumComponents, GlType, Elem.RelativeOffset);
+            else
+                glVertexAttribFormat(Elem.InputIndex, Elem.NumComponents, GlType, Elem.IsNormalized, Elem.RelativeOffset);
+            glVertexAttribBinding(Elem.InputIndex, Elem.BufferSlot);
+            glEnableVertexAttribArray(Elem.InputIndex);
+            DEV_CHECK_GL_ERROR("Failed to set up vertex attribute ", Elem.InputIndex);
+        }
+        // glVertexAttrib(I)Format, glVertexAttribBinding, glEnableVertexAttribArray
+        m_Stats.NumGLCalls += LayoutIt->first.Elements.size() * 3;
+
+        for (auto SlotMask = UsedSlotsMask; SlotMask != 0;)
+        {
+            const auto SlotBit = ExtractLSB(SlotMask);
+            const auto Slot    = PlatformMisc::GetLSB(SlotBit);
+            if (SlotStepRates[Slot] != 0)
+            {
+                glVertexBindingDivisor(Slot, SlotStepRates[Slot]);
+                DEV_CHECK_GL_ERROR("Failed to set binding divisor for slot ", Slot);
+                ++m_Stats.NumGLCalls;
+            }
+        }
+
+        ++m_Stats.NumLayoutVAOsCreated;
+    }
+
+    m_PSOToLayoutVAO.emplace(PSO.GetUniqueID(), &LayoutIt->second);
+    return &LayoutIt->second;
+}
+
+bool VAOCache::BindLayoutVAO(const VAOAttribs& Attribs, GLContextState& GLState)
+{
+    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+
+    auto* pLayoutVAO = GetLayoutVAO(Attribs.PSO, GLState);
+    if (pLayoutVAO == nullptr)
+        return false;
+
+    ExecuteVertexInputBarriers(Attribs, pLayoutVAO->UsedSlotsMask, GLState);
+
+    ++m_Stats.NumRequests;
+
+    if (GLState.BindVAO(pLayoutVAO->VAO))
+        ++m_Stats.NumGLCalls;
+
+    for (auto SlotMask = pLayoutVAO->UsedSlotsMask; SlotMask != 0;)
+    {
+        const auto SlotBit = ExtractLSB(SlotMask);
+        const auto Slot    = PlatformMisc::GetLSB(SlotBit);
+        DEV_CHECK_ERR(Slot < Attribs.NumVertexStreams, "Input layout requires at least ", Slot + 1,
+                      " buffer", (Slot > 0 ? "s" : ""), ", but only ", Attribs.NumVertexStreams, ' ',
+                      (Attribs.NumVertexStreams == 1 ? "is" : "are"), " bound.");
+
+        const auto& SrcStream = Attribs.VertexStreams[Slot];
+        DEV_CHECK_ERR(SrcStream.pBuffer, "VAO requires buffer at slot ", Slot, ", but none is bound in the context.");
+
+        const auto BuffId = SrcStream.pBuffer ? SrcStream.pBuffer->GetUniqueID() : 0;
+        const auto Stride = Attribs.PSO.GetBufferStride(Slot);
+
+        auto& DstStream = pLayoutVAO->Streams[Slot];
+        if (DstStream.BufferUId != BuffId || DstStream.Offset != SrcStream.Offset || DstStream.Stride != Stride)
+        {
+            const GLuint GLBuffer = SrcStream.pBuffer ? static_cast<GLuint>(SrcStream.pBuffer->m_GlBuffer) : 0;
+            glBindVertexBuffer(Slot, GLBuffer, StaticCast<GLintptr>(SrcStream.Offset), Stride);
+            DEV_CHECK_GL_ERROR("Failed to bind vertex buffer to slot ", Slot);
+            ++m_Stats.NumGLCalls;
+
+            DstStream.BufferUId = BuffId;
+            DstStream.Offset    = SrcStream.Offset;
+            DstStream.Stride    = Stride;
+        }
+    }
+
+    if (Attribs.pIndexBuffer != nullptr && pLayoutVAO->IndexBufferUId != Attribs.pIndexBuffer->GetUniqueID())
+    {
+        // Element array buffer binding is part of the VAO state
+        constexpr bool ResetVAO = false;
+        GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
+        ++m_Stats.NumGLCalls;
+
+        pLayoutVAO->IndexBufferUId = Attribs.pIndexBuffer->GetUniqueID();
+    }
+
+    return true;
+}
+
+VAOCacheStatsGL VAOCache::GetStatistics() const
+{
+    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    return m_Stats;
+}
+
 } // namespace Diligent
@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::BufferVkImpl class
 
+#include <vector>
+
 #include "EngineVkImplTraits.hpp"
 #include "BufferBase.hpp"
 #include "BufferViewVkImpl.hpp" // Required by BufferBase
@@ -42,6 +44,30 @@
 namespace Diligent
 {
 
+/// Memory blocks that the device-local buffers of an IRenderDevice::CreateBuffers() batch are packed into.
+
+/// The blocks are allocated by RenderDeviceVkImpl::CreateBuffers() before the buffers are created,
+/// and every buffer of the batch takes the next part of the block with its memory type.
+struct BufferBatchMemoryVk
+{
+    struct Block
+    {
+        uint32_t              MemoryTypeIndex = 0;
+        VkMemoryAllocateFlags AllocateFlags   = 0;
+
+        // The parts of the block taken by the buffers start and end at offsets aligned by this value
+        VkDeviceSize Alignment = 0;
+
+        // The part of the block that has not been taken yet
+        VulkanUtilities::VulkanMemoryAllocation Remainder;
+    };
+    std::vector<Block> Blocks;
+
+    /// Takes the next part of the block with the given memory type and allocation flags.
+    /// Returns an empty allocation if there is no such block or the memory does not fit into it.
+    VulkanUtilities::VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags);
+};
+
 /// Buffer object implementation in Vulkan backend.
 class BufferVkImpl final : public BufferBase<EngineVkImplTraits>
 {
@@ -52,7 +78,8 @@ public:
                  FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                  RenderDeviceVkImpl*        pDeviceVk,
                  const BufferDesc&          BuffDesc,
-                 const BufferData*          pBuffData = nullptr);
+                 const BufferData*          pBuffData    = nullptr,
+                 BufferBatchMemoryVk*       pBatchMemory = nullptr);
 
     BufferVkImpl(IReferenceCounters*        pRefCounters,
                  FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
@@ -108,8 +135,9 @@ private:
 
     VulkanUtilities::BufferViewWrapper CreateView(struct BufferViewDesc& ViewDesc);
 
-    Uint32       m_DynamicOffsetAlignment    = 0;
-    VkDeviceSize m_BufferMemoryAlignedOffset = 0;
+    Uint32          m_DynamicOffsetAlignment    = 0;
+    VkDeviceSize    m_BufferMemoryAlignedOffset = 0;
+    VkDeviceAddress m_VkDeviceAddress           = 0;
 
     VulkanUtilities::BufferWrapper          m_VulkanBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
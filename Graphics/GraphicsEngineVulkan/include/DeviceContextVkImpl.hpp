@@ -321,6 +321,12 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::GetDescriptorCommitStats().
+    virtual void DILIGENT_CALL_TYPE GetDescriptorCommitStats(DescriptorCommitStatsVk& Stats) const override final
+    {
+        Stats = m_DescrCommitStats;
+    }
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -482,11 +488,11 @@ private:
                              Uint64                         DstBufferOffset,
                              Uint32                         DstBufferRowStrideInTexels);
 
-    __forceinline void          PrepareForDraw(DRAW_FLAGS Flags);
-    __forceinline void          PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
+    __forceinline bool          PrepareForDraw(DRAW_FLAGS Flags);
+    __forceinline bool          PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
     __forceinline BufferVkImpl* PrepareIndirectAttribsBuffer(IBuffer* pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode, const char* OpName);
-    __forceinline void          PrepareForDispatchCompute();
-    __forceinline void          PrepareForRayTracing();
+    __forceinline bool          PrepareForDispatchCompute();
+    __forceinline bool          PrepareForRayTracing();
 
     void DvpLogRenderPass_PSOMismatch();
 
@@ -554,7 +560,14 @@ private:
 
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
-    __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    // Returns false if the resources could not be committed, in which case the command must be skipped
+    __forceinline bool CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    __forceinline bool CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    // Writes static/mutable descriptors to the persistent descriptor buffer memory of the SRB if they have
+    // changed since the last time and returns the offset of the set in the descriptor buffer.
+    bool CommitPersistentDescriptorSet(const PipelineResourceSignatureVkImpl& Signature,
+                                       const ShaderResourceCacheVk&           ResourceCache,
+                                       VkDeviceSize&                          SetOffset);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -568,6 +581,13 @@ private:
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
+    /// Temporary arrays used by CommitDescriptorBuffers
+    std::array<VkDeviceSize, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorBufferOffsets = {};
+    std::array<uint32_t, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)>     m_DescriptorBufferIndices = {}; // Always 0
+
+    /// Descriptor commit statistics of both paths, see IDeviceContextVk::GetDescriptorCommitStats().
+    DescriptorCommitStatsVk m_DescrCommitStats;
+
     /// Render pass that matches currently bound render targets.
     /// This render pass may or may not be currently set in the command buffer
     VkRenderPass m_vkRenderPass = VK_NULL_HANDLE;
@@ -644,6 +664,10 @@ private:
     VulkanDynamicHeap             m_DynamicHeap;
     DynamicDescriptorSetAllocator m_DynamicDescrSetAllocator;
 
+    // Descriptor buffer heap, only created when VK_EXT_descriptor_buffer is enabled,
+    // in which case dynamic descriptor sets are never allocated.
+    std::unique_ptr<VulkanDynamicHeap> m_pDescriptorBufferHeap;
+
     // In Vulkan we can't bind null vertex buffer, so we have to create a dummy VB
     RefCntAutoPtr<BufferVkImpl> m_DummyVB;
 
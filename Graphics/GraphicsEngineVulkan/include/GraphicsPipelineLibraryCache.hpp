@@ -0,0 +1,230 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GraphicsPipelineLibraryCache class
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "PipelineState.h"
+#include "RenderDeviceVk.h"
+#include "GraphicsTypesX.hpp"
+#include "HashUtils.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class PipelineResourceSignatureVkImpl;
+
+/// Device-wide cache of graphics pipeline library parts (VK_EXT_graphics_pipeline_library).
+
+/// A graphics pipeline is split into four independently compiled parts: vertex input,
+/// pre-rasterization shaders, fragment shader and fragment output. Pipelines that share
+/// a part (e.g. the same shaders with different blend states) reuse the library object, and
+/// the final pipeline is produced by a cheap link step instead of a full compilation.
+///
+/// The cache only keeps weak references to the library parts: pipeline states own the parts
+/// they are linked from, and a part is destroyed and evicted once the last pipeline is released.
+class GraphicsPipelineLibraryCache
+{
+public:
+    GraphicsPipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    GraphicsPipelineLibraryCache             (const GraphicsPipelineLibraryCache&) = delete;
+    GraphicsPipelineLibraryCache             (GraphicsPipelineLibraryCache&&)      = delete;
+    GraphicsPipelineLibraryCache& operator = (const GraphicsPipelineLibraryCache&) = delete;
+    GraphicsPipelineLibraryCache& operator = (GraphicsPipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    ~GraphicsPipelineLibraryCache();
+
+    enum LIBRARY_TYPE : Uint8
+    {
+        LIBRARY_TYPE_VERTEX_INPUT = 0,
+        LIBRARY_TYPE_PRE_RASTERIZATION,
+        LIBRARY_TYPE_FRAGMENT_SHADER,
+        LIBRARY_TYPE_FRAGMENT_OUTPUT,
+        LIBRARY_TYPE_COUNT
+    };
+
+    using LibraryPtr   = std::shared_ptr<const VulkanUtilities::PipelineWrapper>;
+    using LibraryArray = std::array<LibraryPtr, LIBRARY_TYPE_COUNT>;
+
+    struct LibrariesCreateAttribs
+    {
+        /// Fully initialized create info of the monolithic pipeline.
+        const VkGraphicsPipelineCreateInfo& PipelineCI;
+
+        const GraphicsPipelineDesc& GraphicsPipeline;
+
+        /// Render pass the pipeline is created with (explicit or implicit),
+        /// or null when dynamic rendering is used.
+        IRenderPass* pRenderPass;
+
+        /// SPIR-V byte code of every shader in PipelineCI.pStages.
+        const std::vector<uint32_t>* const* ppSPIRVs;
+
+        const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures;
+        Uint32                                                SignatureCount;
+
+        VkPipelineCache vkPSOCache;
+    };
+
+    /// Returns library parts for the pipeline, creating the ones that are not in the cache yet.
+    /// The caller must keep the returned parts alive for as long as the linked pipeline is in use.
+    LibraryArray GetLibraries(const LibrariesCreateAttribs& Attribs) noexcept(false);
+
+    /// Links the library parts into a complete pipeline.
+
+    /// \param [in] Libraries     - Library parts returned by GetLibraries().
+    /// \param [in] vkLayout      - Pipeline layout that is identically defined to the layout
+    ///                             used to create the libraries.
+    /// \param [in] Optimize      - Whether to perform link-time optimization. Optimized linking is
+    ///                             considerably slower and is intended to run on a worker thread.
+    ///                             Requires libraries created with the device's shader compilation
+    ///                             thread pool present.
+    /// \param [in] vkPSOCache    - Optional Vulkan pipeline cache.
+    /// \param [in] Name          - Pipeline name.
+    VulkanUtilities::PipelineWrapper LinkPipeline(const LibraryArray& Libraries,
+                                                  VkPipelineLayout    vkLayout,
+                                                  bool                Optimize,
+                                                  VkPipelineCache     vkPSOCache,
+                                                  const char*         Name) const noexcept(false);
+
+    /// Returns true if the libraries retain the information required for link-time optimization.
+    bool IsLinkTimeOptimizationSupported() const { return m_RetainLinkTimeOptimizationInfo; }
+
+    void GetStats(GraphicsPipelineLibraryStatsVk& Stats) const;
+
+    void Destroy();
+
+private:
+    struct ShaderKey
+    {
+        VkShaderStageFlagBits Stage = {};
+        std::string           EntryPoint;
+        std::vector<uint32_t> SPIRV;
+
+        bool operator==(const ShaderKey& rhs) const
+        {
+            return Stage == rhs.Stage && EntryPoint == rhs.EntryPoint && SPIRV == rhs.SPIRV;
+        }
+    };
+
+    // Only the members that affect the library part of the given type are initialized.
+    struct LibraryKey
+    {
+        LIBRARY_TYPE          Type  = LIBRARY_TYPE_COUNT;
+        VkPipelineCreateFlags Flags = 0;
+
+        // Vertex input and pre-rasterization
+        PRIMITIVE_TOPOLOGY Topology = PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+        // Vertex input
+        InputLayoutDescX InputLayout;
+
+        // Pre-rasterization
+        RasterizerStateDesc Rasterizer;
+        Uint8               NumViewports = 0;
+
+        // Fragment shader
+        DepthStencilStateDesc DepthStencil;
+
+        // Fragment output
+        BlendStateDesc Blend;
+
+        // Fragment shader and fragment output
+        SampleDesc Samples;
+        Uint32     SampleMask = 0;
+
+        // All parts except vertex input
+        PIPELINE_SHADING_RATE_FLAGS ShadingRateFlags = PIPELINE_SHADING_RATE_FLAG_NONE;
+        RefCntAutoPtr<IRenderPass>  pRenderPass;
+        Uint8                       SubpassIndex                   = 0;
+        Uint8                       NumRenderTargets               = 0;
+        bool                        ReadOnlyDSV                    = false;
+        TEXTURE_FORMAT              DSVFormat                      = TEX_FORMAT_UNKNOWN;
+        TEXTURE_FORMAT              RTVFormats[MAX_RENDER_TARGETS] = {};
+
+        // Pre-rasterization and fragment shader
+        std::vector<ShaderKey>                                      Shaders;
+        std::vector<RefCntAutoPtr<PipelineResourceSignatureVkImpl>> Signatures;
+
+        bool operator==(const LibraryKey& rhs) const noexcept;
+
+        size_t GetHash() const noexcept;
+
+    private:
+        mutable size_t Hash = 0;
+    };
+
+    struct LibraryKeyHash
+    {
+        std::size_t operator()(const LibraryKey& Key) const
+        {
+            return Key.GetHash();
+        }
+    };
+
+    static LibraryKey CreateKey(LIBRARY_TYPE Type, const LibrariesCreateAttribs& Attribs);
+
+    VulkanUtilities::PipelineWrapper CreateLibrary(LIBRARY_TYPE Type, const LibrariesCreateAttribs& Attribs) const noexcept(false);
+
+    // Removes the entries whose libraries have been released. Must be called with m_Mutex locked.
+    void PurgeExpiredLibraries();
+
+private:
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    // Libraries must retain link-time optimization info if pipelines
+    // are to be re-linked with optimization in the background.
+    const bool m_RetainLinkTimeOptimizationInfo;
+
+    using WeakLibraryPtr = std::weak_ptr<const VulkanUtilities::PipelineWrapper>;
+
+    mutable std::mutex                                             m_Mutex;
+    std::unordered_map<LibraryKey, WeakLibraryPtr, LibraryKeyHash> m_Cache;
+
+    // The number of libraries released since the last purge
+    std::shared_ptr<std::atomic<Uint32>> m_pNumExpiredLibraries;
+
+    GraphicsPipelineLibraryStatsVk m_Stats;
+};
+
+} // namespace Diligent
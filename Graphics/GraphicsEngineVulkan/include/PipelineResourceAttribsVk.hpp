@@ -199,5 +199,22 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+// Descriptor buffers (VK_EXT_descriptor_buffer) do not support descriptors with dynamic offsets.
+// Such resources use regular buffer descriptors, and the offset is added to the buffer address
+// when the descriptor is written.
+inline VkDescriptorType DescriptorTypeToVkDescriptorBufferType(DescriptorType Type)
+{
+    switch (Type)
+    {
+        // clang-format off
+        case DescriptorType::UniformBufferDynamic:          return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case DescriptorType::StorageBufferDynamic:          return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        case DescriptorType::StorageBufferDynamic_ReadOnly: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        // clang-format on
+        default:
+            return DescriptorTypeToVkDescriptorType(Type);
+    }
+}
+
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -123,6 +124,14 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Indicates if descriptor set layouts were created for descriptor buffers (VK_EXT_descriptor_buffer).
+    // In this mode, no Vulkan descriptor sets are allocated, and descriptors are written directly
+    // to the descriptor buffer memory by WriteDescriptorBuffer().
+    bool UsesDescriptorBuffer() const { return m_UseDescriptorBuffer; }
+
+    // Returns the size of the descriptor set layout in the descriptor buffer memory, in bytes
+    VkDeviceSize GetDescriptorBufferSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorBufferSetSizes[SetId]; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -130,9 +139,18 @@ public:
     // Make the base class method visible
     using TPipelineResourceSignatureBase::CopyStaticResources;
 
-    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet
-    void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                VkDescriptorSet              vkDynamicDescriptorSet) const;
+    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet.
+    // Returns the number of descriptors written.
+    Uint32 CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                  VkDescriptorSet              vkDynamicDescriptorSet) const;
+
+    // Writes descriptors of all resources in the descriptor set identified by SetId to the descriptor
+    // buffer memory pointed to by pDstData. The memory must be at least GetDescriptorBufferSetSize(SetId) bytes.
+    // Null resources are skipped. Returns the number of descriptors written.
+    Uint32 WriteDescriptorBuffer(const ShaderResourceCacheVk& ResourceCache,
+                                 DESCRIPTOR_SET_ID            SetId,
+                                 DeviceContextVkImpl&         Ctx,
+                                 Uint8*                       pDstData) const;
 
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
@@ -177,6 +195,7 @@ private:
     void Destruct();
 
     void CreateSetLayouts(bool IsSerialized);
+    void InitDescriptorBufferBindings();
 
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
@@ -187,6 +206,22 @@ private:
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Location of the binding in the descriptor buffer set layout
+    struct DescriptorBufferBinding
+    {
+        VkDeviceSize Offset             = 0; // Binding offset from the start of the set
+        Uint32       DescriptorSize     = 0; // Size of a single descriptor; 0 if the binding is not used
+        VkSampler    vkImmutableSampler = VK_NULL_HANDLE;
+    };
+    // Descriptor buffer bindings of resources in m_Desc.Resources
+    std::vector<DescriptorBufferBinding> m_DescriptorBufferResBindings;
+    // Descriptor buffer bindings of immutable samplers that are not assigned to any resource
+    std::vector<DescriptorBufferBinding> m_DescriptorBufferSamplerBindings;
+    // Descriptor buffer set layout sizes indexed by DESCRIPTOR_SET_ID
+    std::array<VkDeviceSize, DESCRIPTOR_SET_ID_NUM_SETS> m_DescriptorBufferSetSizes = {};
+
+    bool m_UseDescriptorBuffer = false;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineStateVkImpl class
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include "EngineVkImplTraits.hpp"
@@ -39,6 +40,7 @@
 
 #include "ShaderVariableManagerVk.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "AsyncInitializer.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
@@ -69,7 +71,11 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    /// Returns the pipeline re-linked with link-time optimization once it is ready.
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        return m_OptimizedPipelineReady.load(std::memory_order_acquire) ? m_OptimizedPipeline : m_Pipeline;
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
@@ -141,6 +147,16 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // When the graphics pipeline is fast-linked from pipeline libraries, it is re-linked
+    // with link-time optimization on the shader compilation thread pool.
+    VulkanUtilities::PipelineWrapper  m_OptimizedPipeline;
+    std::atomic<bool>                 m_OptimizedPipelineReady{false};
+    std::unique_ptr<AsyncInitializer> m_OptimizePipelineTask;
+
+    // Library parts the graphics pipeline is linked from. The library cache only keeps weak
+    // references, so the parts are evicted from the cache when the last pipeline is released.
+    GraphicsPipelineLibraryCache::LibraryArray m_PipelineLibraries;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
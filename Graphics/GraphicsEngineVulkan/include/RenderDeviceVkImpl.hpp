@@ -51,6 +51,7 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "GraphicsPipelineLibraryCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -93,6 +94,12 @@ public:
                                                  const BufferData* pBuffData,
                                                  IBuffer**         ppBuffer) override final;
 
+    /// Implementation of IRenderDevice::CreateBuffers() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreateBuffers(Uint32            NumBuffers,
+                                                  const BufferDesc* pBuffDescs,
+                                                  const BufferData* pBuffData,
+                                                  IBuffer**         ppBuffers) override final;
+
     /// Implementation of IRenderDevice::CreateShader() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCreateInfo,
                                                  IShader**               ppShader,
@@ -228,6 +235,12 @@ public:
     /// Implementation of IRenderDeviceVk::GetDeviceFeaturesVk().
     virtual void DILIGENT_CALL_TYPE GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const override final;
 
+    /// Implementation of IRenderDeviceVk::GetGraphicsPipelineLibraryStats().
+    virtual void DILIGENT_CALL_TYPE GetGraphicsPipelineLibraryStats(GraphicsPipelineLibraryStatsVk& Stats) const override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryPageStats().
+    virtual void DILIGENT_CALL_TYPE GetMemoryPageStats(MemoryPageStatsVk& Stats) const override final;
+
     DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
@@ -242,6 +255,9 @@ public:
     FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
     RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
 
+    // Returns null if VK_EXT_graphics_pipeline_library is not enabled
+    GraphicsPipelineLibraryCache* GetGraphicsPipelineLibraryCache() { return m_GraphicsPipelineLibraryCache.get(); }
+
     VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
         return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
@@ -257,14 +273,18 @@ public:
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
 
+    // Returns null if VK_EXT_descriptor_buffer is not enabled
+    VulkanDynamicMemoryManager* GetDescriptorBufferMemoryManager() { return m_DescriptorBufferMemoryManager.get(); }
+
     void FlushStaleResources(SoftwareQueueIndex CmdQueueIndex);
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
 
     struct Properties
     {
-        Uint32 UploadHeapPageSize  = 0;
-        Uint32 DynamicHeapPageSize = 0;
+        Uint32 UploadHeapPageSize           = 0;
+        Uint32 DynamicHeapPageSize          = 0;
+        Uint32 DescriptorBufferHeapPageSize = 0;
     };
 
     const Properties& GetProperties() const { return m_Properties; }
@@ -305,6 +325,8 @@ private:
     std::unique_ptr<FramebufferCache> m_FramebufferCache;
     std::unique_ptr<RenderPassCache>  m_ImplicitRenderPassCache;
 
+    std::unique_ptr<GraphicsPipelineLibraryCache> m_GraphicsPipelineLibraryCache;
+
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
@@ -320,6 +342,8 @@ private:
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    std::unique_ptr<VulkanDynamicMemoryManager> m_DescriptorBufferMemoryManager;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
 };
 
@@ -55,11 +55,13 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
 #include "BufferVkImpl.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "VariableSizeAllocationsManager.hpp"
 #include "PipelineResourceAttribsVk.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 
@@ -67,8 +69,9 @@ namespace Diligent
 {
 
 class DeviceContextVkImpl;
+class RenderDeviceVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -132,6 +135,15 @@ public:
         template <DescriptorType DescrType>
         auto GetDescriptorWriteInfo() const;
 
+        // Writes the resource descriptor to the descriptor buffer memory (VK_EXT_descriptor_buffer).
+        // Buffers are referenced by device address, so the dynamic offset is added to the address.
+        // vkImmutableSampler must be provided if an immutable sampler is assigned to the resource.
+        void WriteDescriptorBufferData(DeviceContextVkImpl&                        Ctx,
+                                       const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                       VkSampler                                   vkImmutableSampler,
+                                       size_t                                      DescriptorSize,
+                                       void*                                       pDescriptor) const;
+
         void SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _RangeOffset, Uint64 _RangeSize);
         void SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView);
 
@@ -140,7 +152,7 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
@@ -169,12 +181,21 @@ public:
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
         }
 
+        // The version is incremented every time a resource or a dynamic buffer offset in the set changes
+        Uint32 GetVersion() const { return m_Version; }
+
+        // Indicates if the set contains buffers whose address may change between draw calls
+        // (see ShaderResourceCacheVk::HasDynamicResources())
+        bool HasDynamicBuffers() const { return m_NumDynamicBuffers > 0; }
+
     private:
         // clang-format off
 /* 0 */ const Uint32            m_NumResources = 0;
 /* 8 */ Resource* const         m_pResources   = nullptr;
 /*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/*48 */ Uint32                  m_Version           = 0;
+/*52 */ Uint16                  m_NumDynamicBuffers = 0;
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -245,6 +266,44 @@ public:
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
 
+    // Descriptor buffer memory that holds the static/mutable descriptor set of an SRB when
+    // VK_EXT_descriptor_buffer is used. The descriptors are written once and are written to a new
+    // block only when the set version changes, so that draw commands only write the dynamic set.
+    // The previous block is released through the device release queue as the GPU may still read it.
+    struct PersistentDescriptorBuffer
+    {
+        explicit PersistentDescriptorBuffer(RenderDeviceVkImpl& _Device) noexcept :
+            Device{_Device}
+        {}
+
+        // clang-format off
+        PersistentDescriptorBuffer             (const PersistentDescriptorBuffer&) = delete;
+        PersistentDescriptorBuffer             (PersistentDescriptorBuffer&&)      = delete;
+        PersistentDescriptorBuffer& operator = (const PersistentDescriptorBuffer&) = delete;
+        PersistentDescriptorBuffer& operator = (PersistentDescriptorBuffer&&)      = delete;
+        // clang-format on
+
+        ~PersistentDescriptorBuffer();
+
+        // Releases the current block, if any
+        void Release();
+
+        RenderDeviceVkImpl& Device;
+
+        // Device contexts may commit the same SRB concurrently
+        std::mutex Mtx;
+
+        VariableSizeAllocationsManager::Allocation Block;
+
+        VkDeviceSize AlignedOffset = 0; // Offset of the set from the start of the descriptor buffer
+        Uint32       SetVersion    = 0; // Version of the set whose descriptors are stored in the block
+    };
+
+    void InitializePersistentDescriptorBuffer(RenderDeviceVkImpl& Device);
+
+    // Returns null if the cache does not use persistent descriptor buffer memory
+    PersistentDescriptorBuffer* GetPersistentDescriptorBuffer() const { return m_pPersistentDescrBuffer.get(); }
+
 
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
@@ -282,6 +341,8 @@ private:
 
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    std::unique_ptr<PersistentDescriptorBuffer> m_pPersistentDescrBuffer;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
@@ -122,7 +122,10 @@ struct VulkanDynamicAllocation
 //  |_______________________________________________________________________|
 //
 // We cannot use global memory manager for dynamic resources because they
-// need to use the same Vulkan buffer
+// need to use the same Vulkan buffer.
+// When VK_EXT_descriptor_buffer is enabled, the render device creates another manager
+// that hosts the descriptor buffer. Device contexts write descriptors to this buffer in
+// exactly the same way they write dynamic resource data to the dynamic buffer.
 class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager
 {
 public:
@@ -133,7 +136,8 @@ public:
     VulkanDynamicMemoryManager(IMemoryAllocator&         Allocator,
                                class RenderDeviceVkImpl& DeviceVk,
                                Uint32                    Size,
-                               Uint64                    CommandQueueMask);
+                               Uint64                    CommandQueueMask,
+                               bool                      IsDescriptorBuffer = false);
     ~VulkanDynamicMemoryManager();
 
     // clang-format off
@@ -142,8 +146,9 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    VkBuffer        GetVkBuffer()        const{return m_VkBuffer;}
+    Uint8*          GetCPUAddress()      const{return m_CPUAddress;}
+    VkDeviceAddress GetVkDeviceAddress() const{return m_VkDeviceAddress;}
     // clang-format on
 
     void Destroy();
@@ -156,8 +161,10 @@ private:
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_VkDeviceAddress = 0;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
+    const bool                           m_IsDescriptorBuffer;
     OffsetType                           m_TotalPeakSize = 0;
 };
 
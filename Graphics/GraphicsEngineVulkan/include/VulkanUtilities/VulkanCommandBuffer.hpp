@@ -504,6 +504,40 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("BindDescriptorBuffer is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "No descriptor buffer bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("SetDescriptorBufferOffsets is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -822,6 +856,8 @@ public:
         uint32_t      InsidePassQueries    = 0;
         uint32_t      OutsidePassQueries   = 0;
         size_t        DynamicRenderingHash = 0;
+
+        VkDeviceAddress DescriptorBufferAddress = 0;
     };
 
     __forceinline bool IsInRenderScope() const { return m_State.RenderPass != VK_NULL_HANDLE || m_State.DynamicRenderingHash != 0; }
@@ -188,6 +188,7 @@ public:
     VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer) const;
     VkMemoryRequirements GetImageMemoryRequirements (VkImage  vkImage ) const;
     VkDeviceAddress      GetAccelerationStructureDeviceAddress(VkAccelerationStructureKHR AS) const;
+    VkDeviceAddress      GetBufferDeviceAddress(VkBuffer vkBuffer) const;
 
     VkResult BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
     VkResult BindImageMemory (VkImage image,   VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
@@ -244,6 +245,10 @@ public:
 
     VkResult GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const;
 
+    VkDeviceSize GetDescriptorSetLayoutSize(VkDescriptorSetLayout Layout) const;
+    VkDeviceSize GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout Layout, uint32_t Binding) const;
+    void         GetDescriptor(const VkDescriptorGetInfoEXT& GetInfo, size_t DataSize, void* pDescriptor) const;
+
     VkPipelineStageFlags GetSupportedStagesMask(HardwareQueueIndex QueueFamilyIndex) const { return m_SupportedStagesMask[QueueFamilyIndex]; }
     VkAccessFlags        GetSupportedAccessMask(HardwareQueueIndex QueueFamilyIndex) const { return m_SupportedAccessMask[QueueFamilyIndex]; }
 
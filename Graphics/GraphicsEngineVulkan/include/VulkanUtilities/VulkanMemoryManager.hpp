@@ -193,7 +193,8 @@ public:
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize},
+        m_PageStats         {rhs.m_PageStats        }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
@@ -210,7 +211,16 @@ public:
 
     VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
     VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
-    void                   ShrinkMemory();
+
+    struct PageStats
+    {
+        uint64_t NumAllocations  = 0; // Total number of allocations made from the pages
+        uint64_t NumPagesCreated = 0; // Total number of created pages
+        uint32_t NumPages        = 0; // Current number of pages
+    };
+    PageStats GetPageStats(bool HostVisible) const;
+
+    void ShrinkMemory();
 
 protected:
     friend class VulkanMemoryPage;
@@ -225,7 +235,7 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
+    mutable std::mutex m_PagesMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
@@ -266,12 +276,18 @@ protected:
 
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
+    // m_PagesMtx must be locked
+    VulkanMemoryPage& CreatePage(const MemoryPageIndex& PageIdx, VkDeviceSize MinSize);
+
     // 0 == Device local, 1 == Host-visible
     std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
     std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
     std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
     std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
 
+    // Protected by m_PagesMtx
+    std::array<PageStats, 2> m_PageStats = {};
+
     // If adding new member, do not forget to update move ctor
 };
 
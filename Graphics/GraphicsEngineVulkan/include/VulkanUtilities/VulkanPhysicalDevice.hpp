@@ -48,27 +48,29 @@ public:
 
     struct ExtensionFeatures
     {
-        VkPhysicalDeviceMeshShaderFeaturesEXT             MeshShader             = {};
-        VkPhysicalDevice16BitStorageFeaturesKHR           Storage16Bit           = {};
-        VkPhysicalDevice8BitStorageFeaturesKHR            Storage8Bit            = {};
-        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR      ShaderFloat16Int8      = {};
-        VkPhysicalDeviceAccelerationStructureFeaturesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelineFeaturesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceRayQueryFeaturesKHR               RayQuery               = {};
-        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR    BufferDeviceAddress    = {};
-        VkPhysicalDeviceDescriptorIndexingFeaturesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetFeaturesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceHostQueryResetFeatures            HostQueryReset         = {};
-        VkPhysicalDeviceFragmentShadingRateFeaturesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapFeaturesEXT     FragmentDensityMap     = {}; // Only for desktop devices
-        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT    FragmentDensityMap2    = {}; // Only for mobile devices
-        VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
-        VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
-        VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
-        VkPhysicalDeviceDynamicRenderingFeaturesKHR       DynamicRendering       = {};
-        VkPhysicalDeviceHostImageCopyFeaturesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceMeshShaderFeaturesEXT              MeshShader              = {};
+        VkPhysicalDevice16BitStorageFeaturesKHR            Storage16Bit            = {};
+        VkPhysicalDevice8BitStorageFeaturesKHR             Storage8Bit             = {};
+        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR       ShaderFloat16Int8       = {};
+        VkPhysicalDeviceAccelerationStructureFeaturesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelineFeaturesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceRayQueryFeaturesKHR                RayQuery                = {};
+        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR     BufferDeviceAddress     = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetFeaturesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceHostQueryResetFeatures             HostQueryReset          = {};
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapFeaturesEXT      FragmentDensityMap      = {}; // Only for desktop devices
+        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT     FragmentDensityMap2     = {}; // Only for mobile devices
+        VkPhysicalDeviceMultiviewFeaturesKHR               Multiview               = {}; // Required for RenderPass2
+        VkPhysicalDeviceMultiDrawFeaturesEXT               MultiDraw               = {};
+        VkPhysicalDeviceShaderDrawParametersFeatures       ShaderDrawParameters    = {};
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR        DynamicRendering        = {};
+        VkPhysicalDeviceHostImageCopyFeaturesEXT           HostImageCopy           = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT        DescriptorBuffer        = {};
 
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
@@ -81,21 +83,23 @@ public:
 
     struct ExtensionProperties
     {
-        VkPhysicalDeviceMeshShaderPropertiesEXT             MeshShader             = {};
-        VkPhysicalDeviceAccelerationStructurePropertiesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelinePropertiesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceDescriptorIndexingPropertiesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetPropertiesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceSubgroupProperties                  Subgroup               = {};
-        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphorePropertiesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceFragmentShadingRatePropertiesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapPropertiesEXT     FragmentDensityMap     = {};
-        VkPhysicalDeviceMultiviewPropertiesKHR              Multiview              = {};
-        VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
-        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
-        VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
-        VkPhysicalDeviceHostImageCopyPropertiesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceMeshShaderPropertiesEXT              MeshShader              = {};
+        VkPhysicalDeviceAccelerationStructurePropertiesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetPropertiesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceSubgroupProperties                   Subgroup                = {};
+        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphorePropertiesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapPropertiesEXT      FragmentDensityMap      = {};
+        VkPhysicalDeviceMultiviewPropertiesKHR               Multiview               = {};
+        VkPhysicalDeviceMaintenance3Properties               Maintenance3            = {};
+        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT     FragmentDensityMap2     = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT               MultiDraw               = {};
+        VkPhysicalDeviceHostImageCopyPropertiesEXT           HostImageCopy           = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT        DescriptorBuffer        = {};
 
         std::unique_ptr<VkImageLayout[]> HostImageCopyLayouts;
     };
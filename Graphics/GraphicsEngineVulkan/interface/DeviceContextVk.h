@@ -39,6 +39,40 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Descriptor commit statistics of a Vulkan device context.
+
+/// The context updates either the descriptor set or the descriptor buffer members,
+/// depending on whether DeviceFeaturesVk::DescriptorBuffer is enabled.
+struct DescriptorCommitStatsVk
+{
+    /// The number of dynamic descriptor sets allocated from the descriptor pools.
+    Uint64 DescriptorSetsAllocated DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptors written to dynamic descriptor sets with vkUpdateDescriptorSets.
+    Uint64 DescriptorSetWrites DEFAULT_INITIALIZER(0);
+
+    /// The number of vkCmdBindDescriptorSets calls.
+    Uint64 DescriptorSetBinds DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptors written to the descriptor buffer memory that is
+    /// allocated for every draw or dispatch command.
+    Uint64 DescriptorBufferWrites DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptors written to the persistent descriptor buffer memory of
+    /// shader resource bindings. Static and mutable descriptors are only written when they change.
+    Uint64 PersistentDescriptorBufferWrites DEFAULT_INITIALIZER(0);
+
+    /// The amount of descriptor buffer memory allocated for draw and dispatch commands, in bytes.
+    Uint64 DescriptorBufferBytes DEFAULT_INITIALIZER(0);
+
+    /// The number of vkCmdSetDescriptorBufferOffsetsEXT calls.
+    Uint64 DescriptorBufferBinds DEFAULT_INITIALIZER(0);
+
+    /// The number of commands that were skipped because descriptor buffer memory could not be allocated.
+    Uint64 SkippedCommands DEFAULT_INITIALIZER(0);
+};
+typedef struct DescriptorCommitStatsVk DescriptorCommitStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -84,6 +118,11 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     ///           calling IDeviceContext::InvalidateState() and then manually restore all required states via
     ///           appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Returns the descriptor commit statistics accumulated since the context was created,
+    /// see Diligent::DescriptorCommitStatsVk.
+    VIRTUAL void METHOD(GetDescriptorCommitStats)(THIS_
+                                                  DescriptorCommitStatsVk REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +132,9 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)    CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,    This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)      CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,      This, __VA_ARGS__)
+#    define IDeviceContextVk_GetDescriptorCommitStats(This, ...) CALL_IFACE_METHOD(DeviceContextVk, GetDescriptorCommitStats, This, __VA_ARGS__)
 
 // clang-format on
 
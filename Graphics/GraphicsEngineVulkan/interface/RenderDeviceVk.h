@@ -38,6 +38,47 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Statistics of the graphics pipeline library cache of a Vulkan device.
+
+/// Graphics pipelines are linked from library parts when DeviceFeaturesVk::GraphicsPipelineLibrary
+/// is enabled. Every pipeline requests four parts: vertex input, pre-rasterization shaders,
+/// fragment shader and fragment output.
+struct GraphicsPipelineLibraryStatsVk
+{
+    /// The number of library part requests that were served from the cache.
+    Uint64 Hits DEFAULT_INITIALIZER(0);
+
+    /// The number of library part requests that required compiling a new part.
+    Uint64 Misses DEFAULT_INITIALIZER(0);
+
+    /// The number of library parts removed from the cache after all pipelines that use them were released.
+    Uint64 Evictions DEFAULT_INITIALIZER(0);
+
+    /// The number of library parts currently in the cache.
+    Uint32 NumLibraries DEFAULT_INITIALIZER(0);
+};
+typedef struct GraphicsPipelineLibraryStatsVk GraphicsPipelineLibraryStatsVk;
+
+/// Statistics of the memory pages of a Vulkan device.
+
+/// Buffers, textures and staging memory are suballocated from memory pages,
+/// every page is a separate Vulkan device memory object.
+struct MemoryPageStatsVk
+{
+    /// The total number of allocations made from the memory pages.
+
+    /// \remarks    Device-local buffers created by IRenderDevice::CreateBuffers() are packed
+    ///             into one allocation per memory type and are not counted individually.
+    Uint64 NumAllocations DEFAULT_INITIALIZER(0);
+
+    /// The total number of memory pages that were created.
+    Uint64 NumPagesCreated DEFAULT_INITIALIZER(0);
+
+    /// The number of memory pages that currently exist.
+    Uint32 NumPages DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryPageStatsVk MemoryPageStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -161,6 +202,16 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
     /// Returns Vulkan-specific device features, see Diligent::DeviceFeaturesVk.
     VIRTUAL void METHOD(GetDeviceFeaturesVk)(THIS_
                                              DeviceFeaturesVk REF FeaturesVk) CONST PURE;
+
+    /// Returns the statistics of the graphics pipeline library cache, see Diligent::GraphicsPipelineLibraryStatsVk.
+
+    /// \remarks    If graphics pipeline libraries are not enabled, all statistics are zero.
+    VIRTUAL void METHOD(GetGraphicsPipelineLibraryStats)(THIS_
+                                                         GraphicsPipelineLibraryStatsVk REF Stats) CONST PURE;
+
+    /// Returns the statistics of the memory pages, see Diligent::MemoryPageStatsVk.
+    VIRTUAL void METHOD(GetMemoryPageStats)(THIS_
+                                            MemoryPageStatsVk REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -170,15 +221,17 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IRenderDeviceVk_GetVkDevice(This)                         CALL_IFACE_METHOD(RenderDeviceVk, GetVkDevice,                    This)
-#    define IRenderDeviceVk_GetVkPhysicalDevice(This)                 CALL_IFACE_METHOD(RenderDeviceVk, GetVkPhysicalDevice,            This)
-#    define IRenderDeviceVk_GetVkInstance(This)                       CALL_IFACE_METHOD(RenderDeviceVk, GetVkInstance,                  This)
-#    define IRenderDeviceVk_CreateTextureFromVulkanImage(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTextureFromVulkanImage,   This, __VA_ARGS__)
-#    define IRenderDeviceVk_CreateBufferFromVulkanResource(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, CreateBufferFromVulkanResource, This, __VA_ARGS__)
-#    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
-#    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
-#    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
-#    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetVkDevice(This)                          CALL_IFACE_METHOD(RenderDeviceVk, GetVkDevice,                     This)
+#    define IRenderDeviceVk_GetVkPhysicalDevice(This)                  CALL_IFACE_METHOD(RenderDeviceVk, GetVkPhysicalDevice,             This)
+#    define IRenderDeviceVk_GetVkInstance(This)                        CALL_IFACE_METHOD(RenderDeviceVk, GetVkInstance,                   This)
+#    define IRenderDeviceVk_CreateTextureFromVulkanImage(This, ...)    CALL_IFACE_METHOD(RenderDeviceVk, CreateTextureFromVulkanImage,    This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateBufferFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateBufferFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,    This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,    This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,   This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)             CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,             This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetGraphicsPipelineLibraryStats(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, GetGraphicsPipelineLibraryStats, This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryPageStats(This, ...)              CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryPageStats,              This, __VA_ARGS__)
 
 // clang-format on
 
@@ -40,11 +40,42 @@
 namespace Diligent
 {
 
+VulkanUtilities::VulkanMemoryAllocation BufferBatchMemoryVk::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags)
+{
+    for (Block& Blk : Blocks)
+    {
+        VulkanUtilities::VulkanMemoryAllocation& Remainder = Blk.Remainder;
+        if (Blk.MemoryTypeIndex != MemoryTypeIndex || Blk.AllocateFlags != AllocateFlags || !Remainder)
+            continue;
+
+        const VkDeviceSize BlockEnd      = Remainder.UnalignedOffset + Remainder.Size;
+        const VkDeviceSize AlignedOffset = AlignUp(Remainder.UnalignedOffset, Alignment);
+        if (AlignedOffset + Size > BlockEnd)
+            break;
+
+        // Take the part of the block up to the next aligned offset after the buffer, so that
+        // the page allocator can release the parts individually when the buffers are destroyed.
+        const VkDeviceSize PartEnd = std::min(AlignUp(AlignedOffset + Size, Blk.Alignment), BlockEnd);
+
+        VulkanUtilities::VulkanMemoryAllocation Allocation{Remainder.Page, Remainder.UnalignedOffset, PartEnd - Remainder.UnalignedOffset};
+
+        Remainder.UnalignedOffset = PartEnd;
+        Remainder.Size            = BlockEnd - PartEnd;
+        if (Remainder.Size == 0)
+            Remainder.Page = nullptr;
+
+        return Allocation;
+    }
+
+    return {};
+}
+
 BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceVkImpl*        pRenderDeviceVk,
                            const BufferDesc&          BuffDesc,
-                           const BufferData*          pBuffData /*= nullptr*/) :
+                           const BufferData*          pBuffData /*= nullptr*/,
+                           BufferBatchMemoryVk*       pBatchMemory /*= nullptr*/) :
     TBufferBase{
         pRefCounters,
         BuffViewObjMemAllocator,
@@ -180,6 +211,21 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    // With descriptor buffers, shader-visible buffers are referenced in descriptors by their device address.
+    // Dynamic buffers without a backing buffer are suballocated from the dynamic heap buffer, which already
+    // has the device address usage. Sparse buffers are not supported in this mode.
+    constexpr VkBufferUsageFlags DescriptorUsage =
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+    if ((VkBuffCI.usage & DescriptorUsage) != 0 &&
+        m_Desc.Usage != USAGE_SPARSE &&
+        LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+    {
+        VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -307,7 +353,10 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         VERIFY(IsPowerOfTwo(RequiredAlignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        if (pBatchMemory != nullptr)
+            m_MemoryAllocation = pBatchMemory->Allocate(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        if (!m_MemoryAllocation)
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
         if (!m_MemoryAllocation)
             LOG_ERROR_AND_THROW("Failed to allocate memory for buffer '", m_Desc.Name, "'.");
 
@@ -317,6 +366,11 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         VkResult       err    = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Memory, m_BufferMemoryAlignedOffset);
         CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
+        // Descriptor buffers reference the buffer by its address every time the descriptor is written,
+        // so query the address once.
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
 #ifdef DILIGENT_DEBUG
@@ -555,6 +609,9 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
+    if (m_VkDeviceAddress != 0)
+        return m_VkDeviceAddress;
+
     constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
 
     if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
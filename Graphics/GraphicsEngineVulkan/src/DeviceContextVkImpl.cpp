@@ -108,6 +108,14 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
         m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer);
     }
 
+    if (VulkanDynamicMemoryManager* pDescrBufferMemMgr = pDeviceVkImpl->GetDescriptorBufferMemoryManager())
+    {
+        m_pDescriptorBufferHeap = std::make_unique<VulkanDynamicHeap>(
+            *pDescrBufferMemMgr,
+            GetContextObjectName("Descriptor buffer heap", Desc.IsDeferred, Desc.ContextId),
+            pDeviceVkImpl->GetProperties().DescriptorBufferHeapPageSize);
+    }
+
     BufferDesc DummyVBDesc;
     DummyVBDesc.Name      = "Dummy vertex buffer";
     DummyVBDesc.BindFlags = BIND_VERTEX_BUFFER;
@@ -157,8 +165,26 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     DEV_CHECK_ERR(m_UploadHeap.GetStalePagesCount()                  == 0, "All allocated upload heap pages must have been released at this point");
     DEV_CHECK_ERR(m_DynamicHeap.GetAllocatedMasterBlockCount()       == 0, "All allocated dynamic heap master blocks must have been released");
     DEV_CHECK_ERR(m_DynamicDescrSetAllocator.GetAllocatedPoolCount() == 0, "All allocated dynamic descriptor set pools must have been released at this point");
+    DEV_CHECK_ERR(!m_pDescriptorBufferHeap || m_pDescriptorBufferHeap->GetAllocatedMasterBlockCount() == 0, "All allocated descriptor buffer heap master blocks must have been released");
     // clang-format on
 
+    if (m_pDescriptorBufferHeap)
+    {
+        LOG_INFO_MESSAGE(GetContextObjectName("Descriptor buffer", IsDeferred(), GetContextId()),
+                         " commit stats: ", m_DescrCommitStats.DescriptorBufferWrites, " descriptors written per command, ",
+                         m_DescrCommitStats.PersistentDescriptorBufferWrites, " persistent descriptors written, ",
+                         FormatMemorySize(m_DescrCommitStats.DescriptorBufferBytes, 2), " of descriptor memory used, ",
+                         m_DescrCommitStats.DescriptorBufferBinds, " offset binds, ",
+                         m_DescrCommitStats.SkippedCommands, " commands skipped.");
+    }
+    else
+    {
+        LOG_INFO_MESSAGE(GetContextObjectName("Descriptor set", IsDeferred(), GetContextId()),
+                         " commit stats: ", m_DescrCommitStats.DescriptorSetsAllocated, " dynamic sets allocated, ",
+                         m_DescrCommitStats.DescriptorSetWrites, " dynamic descriptors written, ",
+                         m_DescrCommitStats.DescriptorSetBinds, " set binds.");
+    }
+
     // NB: If there are any command buffers in the release queue, they will always be returned to the pool
     //     before the pool itself is released because the pool will always end up later in the queue,
     //     so we do not need to idle the GPU.
@@ -415,10 +441,13 @@ DeviceContextVkImpl::ResourceBindInfo& DeviceContextVkImpl::GetBindInfo(PIPELINE
     return m_BindInfo[Indices[Uint32{Type}]];
 }
 
-void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+bool DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDescriptorBufferHeap)
+        return CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
@@ -477,8 +506,177 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
     m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
                                        m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    ++m_DescrCommitStats.DescriptorSetBinds;
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+
+    return true;
+}
+
+bool DeviceContextVkImpl::CommitPersistentDescriptorSet(const PipelineResourceSignatureVkImpl& Signature,
+                                                        const ShaderResourceCacheVk&           ResourceCache,
+                                                        VkDeviceSize&                          SetOffset)
+{
+    constexpr PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId = PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE;
+
+    ShaderResourceCacheVk::PersistentDescriptorBuffer* pPersistentBuffer = ResourceCache.GetPersistentDescriptorBuffer();
+    VERIFY(pPersistentBuffer != nullptr, "Persistent descriptor buffer must have been initialized by InitSRBResourceCache()");
+
+    const Uint32 SetVersion = ResourceCache.GetDescriptorSet(Signature.GetDescriptorSetIndex<SetId>()).GetVersion();
+
+    std::lock_guard<std::mutex> Lock{pPersistentBuffer->Mtx};
+    if (!pPersistentBuffer->Block.IsValid() || pPersistentBuffer->SetVersion != SetVersion)
+    {
+        VulkanDynamicMemoryManager& DescrBufferMemMgr = *m_pDevice->GetDescriptorBufferMemoryManager();
+
+        const VkDeviceSize OffsetAlignment = m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment;
+        const VkDeviceSize SetSize         = Signature.GetDescriptorBufferSetSize(SetId);
+
+        // Commands recorded earlier may still use the previous descriptors, so they are never overwritten
+        VulkanDynamicMemoryManager::MasterBlock NewBlock = DescrBufferMemMgr.AllocateMasterBlock(StaticCast<size_t>(SetSize), StaticCast<size_t>(OffsetAlignment));
+        if (!NewBlock.IsValid())
+        {
+            LOG_ERROR_MESSAGE("Failed to allocate ", SetSize, " bytes in the descriptor buffer for static and mutable resources of signature '",
+                              Signature.GetDesc().Name, "'. Increase EngineVkCreateInfo::DescriptorBufferHeapSize.");
+            return false;
+        }
+
+        pPersistentBuffer->Release();
+        pPersistentBuffer->Block         = NewBlock;
+        pPersistentBuffer->AlignedOffset = AlignUp(NewBlock.UnalignedOffset, OffsetAlignment);
+        pPersistentBuffer->SetVersion    = SetVersion;
+
+        Uint8* const pSetData = DescrBufferMemMgr.GetCPUAddress() + pPersistentBuffer->AlignedOffset;
+        m_DescrCommitStats.PersistentDescriptorBufferWrites += Signature.WriteDescriptorBuffer(ResourceCache, SetId, *this, pSetData);
+    }
+
+    SetOffset = pPersistentBuffer->AlignedOffset;
+    return true;
+}
+
+bool DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY_EXPR(m_pDescriptorBufferHeap);
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    using DESCRIPTOR_SET_ID = PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID;
+
+    VulkanDynamicMemoryManager& DescrBufferMemMgr = *m_pDevice->GetDescriptorBufferMemoryManager();
+    const Uint32                OffsetAlignment   = StaticCast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    // There is one global descriptor buffer from which descriptors of all contexts are suballocated,
+    // so it only needs to be bound once per command buffer.
+    m_CommandBuffer.BindDescriptorBuffer(DescrBufferMemMgr.GetVkDeviceAddress(),
+                                         VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    // Set offsets of the sets with consecutive indices in a single call
+    uint32_t FirstSetToBind = 0;
+    uint32_t SetCount       = 0;
+
+    const auto SetOffsets = [&]() {
+        if (SetCount == 0)
+            return;
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, SetCount,
+                                                   m_DescriptorBufferIndices.data(), m_DescriptorBufferOffsets.data());
+        ++m_DescrCommitStats.DescriptorBufferBinds;
+        SetCount = 0;
+    };
+
+    while (CommitSRBMask != 0)
+    {
+        const Uint32 SignBit = ExtractLSB(CommitSRBMask);
+        const Uint32 sign    = PlatformMisc::GetLSB(SignBit);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+
+        ResourceBindInfo::DescriptorSetInfo&   SetInfo        = BindInfo.SetInfo[sign];
+        const ShaderResourceCacheVk*           pResourceCache = BindInfo.ResourceCaches[sign];
+        const PipelineResourceSignatureVkImpl* pSignature     = m_pPipelineState->GetResourceSignature(sign);
+        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null");
+        VERIFY_EXPR(pSignature != nullptr && pSignature->UsesDescriptorBuffer());
+
+        // Offsets of the signature sets in the descriptor buffer, in the set index order
+        std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> SetBufferOffsets{};
+
+        // Sets that are written to the memory allocated for this command
+        std::array<DESCRIPTOR_SET_ID, MAX_DESCR_SET_PER_SIGNATURE> CommandSetIds{};
+        std::array<Uint32, MAX_DESCR_SET_PER_SIGNATURE>            CommandSetIndices{};
+        std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE>      CommandSetDataOffsets{};
+
+        Uint32       NumCommandSets  = 0;
+        VkDeviceSize CommandDataSize = 0;
+
+        const auto AddCommandSet = [&](DESCRIPTOR_SET_ID SetId, Uint32 SetIdx) {
+            CommandSetIds[NumCommandSets]         = SetId;
+            CommandSetIndices[NumCommandSets]     = SetIdx;
+            CommandSetDataOffsets[NumCommandSets] = AlignUp(CommandDataSize, VkDeviceSize{OffsetAlignment});
+            CommandDataSize                       = CommandSetDataOffsets[NumCommandSets] + pSignature->GetDescriptorBufferSetSize(SetId);
+            ++NumCommandSets;
+        };
+
+        if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        {
+            const Uint32 SetIdx = pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>();
+            if (pResourceCache->GetDescriptorSet(SetIdx).HasDynamicBuffers())
+            {
+                // Addresses of dynamic buffers may change between commands,
+                // so the set is written to the memory allocated for this command
+                AddCommandSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE, SetIdx);
+            }
+            else if (!CommitPersistentDescriptorSet(*pSignature, *pResourceCache, SetBufferOffsets[SetIdx]))
+            {
+                // The signature remains stale, so all sets will be committed again by the next command
+                ++m_DescrCommitStats.SkippedCommands;
+                return false;
+            }
+        }
+
+        if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC))
+        {
+            AddCommandSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC,
+                          pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
+        }
+
+        if (NumCommandSets > 0)
+        {
+            VulkanDynamicAllocation Allocation = m_pDescriptorBufferHeap->Allocate(StaticCast<Uint32>(CommandDataSize), OffsetAlignment);
+            if (!Allocation)
+            {
+                LOG_ERROR_MESSAGE("Failed to allocate ", CommandDataSize, " bytes in the descriptor buffer heap for resource signature '",
+                                  pSignature->GetDesc().Name, "'. Increase EngineVkCreateInfo::DescriptorBufferHeapSize. The command will be skipped.");
+                ++m_DescrCommitStats.SkippedCommands;
+                return false;
+            }
+            m_DescrCommitStats.DescriptorBufferBytes += Allocation.Size;
+
+            Uint8* const pAllocData = DescrBufferMemMgr.GetCPUAddress() + Allocation.AlignedOffset;
+            for (Uint32 s = 0; s < NumCommandSets; ++s)
+            {
+                m_DescrCommitStats.DescriptorBufferWrites += pSignature->WriteDescriptorBuffer(*pResourceCache, CommandSetIds[s], *this, pAllocData + CommandSetDataOffsets[s]);
+                // Offsets are relative to the start of the descriptor buffer
+                SetBufferOffsets[CommandSetIndices[s]] = Allocation.AlignedOffset + CommandSetDataOffsets[s];
+            }
+        }
+
+        // Start a new range if there is a gap between this signature's sets and the previous ones
+        if (SetCount > 0 && FirstSetToBind + SetCount != SetInfo.BaseInd)
+            SetOffsets();
+        if (SetCount == 0)
+            FirstSetToBind = SetInfo.BaseInd;
+
+        const Uint32 NumSets = pSignature->GetNumDescriptorSets();
+        for (Uint32 s = 0; s < NumSets; ++s)
+            m_DescriptorBufferOffsets[SetCount++] = SetBufferOffsets[s];
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    SetOffsets();
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+
+    return true;
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -499,13 +697,23 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         DEV_CHECK_ERR((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) == 0, "CommitDescriptorSets() must be called before validation.");
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
-        const Uint32                               DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        if (m_pDescriptorBufferHeap)
         {
-            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
-                          "descriptor set with index ", s, " is not bound for resource signature '",
+            // Descriptor buffers are written from the committed resource cache
+            DEV_CHECK_ERR(BindInfo.ResourceCaches[i] != nullptr,
+                          "no shader resource binding is committed for resource signature '",
                           pSign->GetDesc().Name, "', binding index ", i, ".");
         }
+        else
+        {
+            const Uint32 DSCount = pSign->GetNumDescriptorSets();
+            for (Uint32 s = 0; s < DSCount; ++s)
+            {
+                DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
+                              "descriptor set with index ", s, " is not bound for resource signature '",
+                              pSign->GetDesc().Name, "', binding index ", i, ".");
+            }
+        }
 
         DEV_CHECK_ERR(SetInfo.LastBoundBaseInd == SetInfo.BaseInd,
                       "Shader resource binding at index ", i, " has descriptor set base offset ", SetInfo.BaseInd,
@@ -567,6 +775,13 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     // are set by SetPipelineState().
     SetInfo.vkSets = {};
 
+    if (m_pDescriptorBufferHeap)
+    {
+        // With descriptor buffers, all descriptors of the SRB are written to the descriptor buffer
+        // by CommitDescriptorBuffers() when the next draw or dispatch command is issued.
+        return;
+    }
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -597,7 +812,8 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
 
         // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+        m_DescrCommitStats.DescriptorSetWrites += pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+        ++m_DescrCommitStats.DescriptorSetsAllocated;
 
         SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
         ++DSIndex;
@@ -723,7 +939,7 @@ void DeviceContextVkImpl::DvpLogRenderPass_PSOMismatch()
     LOG_ERROR_MESSAGE(ss.str());
 }
 
-void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
+bool DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 {
     if (m_vkFramebuffer == VK_NULL_HANDLE && !m_DynamicRenderingInfo && m_State.NullRenderTargets)
     {
@@ -763,7 +979,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     // calls we do not need to bind the sets again.
     if (Uint32 CommitMask = BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
@@ -785,6 +1002,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 
         CommitRenderPassAndFramebuffer((Flags & DRAW_FLAG_VERIFY_STATES) != 0);
     }
+
+    return true;
 }
 
 BufferVkImpl* DeviceContextVkImpl::PrepareIndirectAttribsBuffer(IBuffer*                       pAttribsBuffer,
@@ -805,9 +1024,10 @@ BufferVkImpl* DeviceContextVkImpl::PrepareIndirectAttribsBuffer(IBuffer*
     return pIndirectDrawAttribsVk;
 }
 
-void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
+bool DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
 {
-    PrepareForDraw(Flags);
+    if (!PrepareForDraw(Flags))
+        return false;
 
 #ifdef DILIGENT_DEVELOPMENT
     if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
@@ -818,13 +1038,16 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
     DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
     VkIndexType vkIndexType = TypeToVkIndexType(IndexType);
     m_CommandBuffer.BindIndexBuffer(m_pIndexBuffer->GetVkBuffer(), m_IndexDataStartOffset + GetDynamicBufferOffset(m_pIndexBuffer), vkIndexType);
+
+    return true;
 }
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
     TDeviceContextBase::Draw(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
     {
@@ -837,7 +1060,8 @@ void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.NumInstances == 0)
         return;
@@ -880,7 +1104,8 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
     {
@@ -893,7 +1118,8 @@ void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 {
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.NumInstances == 0)
         return;
@@ -943,7 +1169,8 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextVkImpl::DrawIndirect)") :
         nullptr;
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.DrawCount > 0)
     {
@@ -978,7 +1205,8 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextVkImpl::DrawIndexedIndirect)") :
         nullptr;
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.DrawCount > 0)
     {
@@ -1006,7 +1234,8 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     TDeviceContextBase::DrawMesh(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
     {
@@ -1026,7 +1255,8 @@ void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Counter buffer (DeviceContextVkImpl::DrawMeshIndirect)") :
         nullptr;
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.CommandCount > 0)
     {
@@ -1051,7 +1281,7 @@ void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
     ++m_State.NumCommands;
 }
 
-void DeviceContextVkImpl::PrepareForDispatchCompute()
+bool DeviceContextVkImpl::PrepareForDispatchCompute()
 {
     EnsureVkCmdBuffer();
 
@@ -1061,36 +1291,43 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
     ResourceBindInfo& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
     if (Uint32 CommitMask = BindInfo.GetCommitMask())
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
     DvpValidateCommittedShaderResources(BindInfo);
 #endif
+
+    return true;
 }
 
-void DeviceContextVkImpl::PrepareForRayTracing()
+bool DeviceContextVkImpl::PrepareForRayTracing()
 {
     EnsureVkCmdBuffer();
 
     ResourceBindInfo& BindInfo = GetBindInfo(PIPELINE_TYPE_RAY_TRACING);
     if (Uint32 CommitMask = BindInfo.GetCommitMask())
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
     DvpValidateCommittedShaderResources(BindInfo);
 #endif
+
+    return true;
 }
 
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
-    PrepareForDispatchCompute();
+    if (!PrepareForDispatchCompute())
+        return;
 
     if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
     {
@@ -1103,7 +1340,8 @@ void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectA
 {
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
-    PrepareForDispatchCompute();
+    if (!PrepareForDispatchCompute())
+        return;
 
     BufferVkImpl* pBufferVk = ClassPtrCast<BufferVkImpl>(Attribs.pAttribsBuffer);
 
@@ -1424,6 +1662,10 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Descriptor buffer heap works the same way as the dynamic heap.
+    if (m_pDescriptorBufferHeap)
+        m_pDescriptorBufferHeap->ReleaseMasterBlocks(*m_pDevice, QueueMask);
+
     EndFrame();
 }
 
@@ -1444,11 +1686,9 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
                   "Flushing device context inside an active render pass.");
 
-    // TODO: replace with small_vector
-    std::vector<VkCommandBuffer>               vkCmdBuffs;
-    std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs;
-    vkCmdBuffs.reserve(size_t{NumCommandLists} + 1);
-    DeferredCtxs.reserve(size_t{NumCommandLists} + 1);
+    VkCommandBuffer*               vkCmdBuffs      = AllocateFrameArray<VkCommandBuffer>(size_t{NumCommandLists} + 1);
+    RefCntAutoPtr<IDeviceContext>* DeferredCtxs    = ConstructFrameArray<RefCntAutoPtr<IDeviceContext>>(NumCommandLists);
+    Uint32                         NumVkCmdBuffers = 0;
 
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
@@ -1473,7 +1713,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
             m_CommandBuffer.FlushBarriers();
             m_CommandBuffer.EndCommandBuffer();
 
-            vkCmdBuffs.push_back(vkCmdBuff);
+            vkCmdBuffs[NumVkCmdBuffers++] = vkCmdBuff;
         }
     }
 
@@ -1483,11 +1723,10 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         CommandListVkImpl* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
         DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
-        DeferredCtxs.emplace_back();
-        vkCmdBuffs.emplace_back();
-        pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back());
-        VERIFY(vkCmdBuffs.back() != VK_NULL_HANDLE, "Trying to execute empty command buffer");
-        VERIFY_EXPR(DeferredCtxs.back() != nullptr);
+        VkCommandBuffer& vkCmdListBuff = vkCmdBuffs[NumVkCmdBuffers++];
+        pCmdListVk->Close(DeferredCtxs[i], vkCmdListBuff);
+        VERIFY(vkCmdListBuff != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(DeferredCtxs[i] != nullptr);
     }
 
     VERIFY_EXPR(m_VkWaitSemaphores.size() == m_WaitManagedSemaphores.size() + m_WaitRecycledSemaphores.size());
@@ -1548,8 +1787,8 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     VkSubmitInfo SubmitInfo{};
     SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     SubmitInfo.pNext                = nullptr;
-    SubmitInfo.commandBufferCount   = static_cast<uint32_t>(vkCmdBuffs.size());
-    SubmitInfo.pCommandBuffers      = vkCmdBuffs.data();
+    SubmitInfo.commandBufferCount   = NumVkCmdBuffers;
+    SubmitInfo.pCommandBuffers      = NumVkCmdBuffers != 0 ? vkCmdBuffs : nullptr;
     SubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(m_VkWaitSemaphores.size());
     SubmitInfo.pWaitSemaphores      = SubmitInfo.waitSemaphoreCount != 0 ? m_VkWaitSemaphores.data() : nullptr;
     SubmitInfo.pWaitDstStageMask    = SubmitInfo.waitSemaphoreCount != 0 ? m_WaitDstStageMasks.data() : nullptr;
@@ -1608,9 +1847,11 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
         // It is OK to dispose command buffer from another thread. We are not going to
         // record any commands and only need to add the buffer to the queue
-        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), vkCmdBuffs[buff_idx], SubmittedFenceValue);
+        // The arena does not run destructors
+        DeferredCtxs[i].Release();
     }
-    VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
+    VERIFY_EXPR(buff_idx == NumVkCmdBuffers);
 
     m_State    = {};
     m_BindInfo = {};
@@ -1618,6 +1859,9 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     m_pPipelineState    = nullptr;
     m_pActiveRenderPass = nullptr;
     m_pBoundFramebuffer = nullptr;
+
+    // The command buffer and deferred context arrays are no longer used
+    ResetFrameArena();
 }
 
 void DeviceContextVkImpl::SetVertexBuffers(Uint32                         StartSlot,
@@ -3516,14 +3760,16 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
-    VkAccelerationStructureBuildGeometryInfoKHR           vkASBuildInfo = {};
-    std::vector<VkAccelerationStructureBuildRangeInfoKHR> vkRanges;
-    std::vector<VkAccelerationStructureGeometryKHR>       vkGeometries;
+    VkAccelerationStructureBuildGeometryInfoKHR vkASBuildInfo = {};
+    VkAccelerationStructureBuildRangeInfoKHR*   vkRanges      = nullptr;
+    VkAccelerationStructureGeometryKHR*         vkGeometries  = nullptr;
+    Uint32                                      GeometryCount = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        vkGeometries.resize(Attribs.TriangleDataCount);
-        vkRanges.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        vkGeometries  = ConstructFrameArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = ConstructFrameArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -3608,8 +3854,9 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        vkGeometries.resize(Attribs.BoxDataCount);
-        vkRanges.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        vkGeometries  = ConstructFrameArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = ConstructFrameArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -3652,7 +3899,7 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
         }
     }
 
-    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges.data();
+    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges;
 
     vkASBuildInfo.sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
     vkASBuildInfo.type                      = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;                 // type must be compatible with create info
@@ -3660,8 +3907,8 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     vkASBuildInfo.mode                      = Attribs.Update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
     vkASBuildInfo.srcAccelerationStructure  = Attribs.Update ? pBLASVk->GetVkBLAS() : VK_NULL_HANDLE;
     vkASBuildInfo.dstAccelerationStructure  = pBLASVk->GetVkBLAS();
-    vkASBuildInfo.geometryCount             = static_cast<uint32_t>(vkGeometries.size());
-    vkASBuildInfo.pGeometries               = vkGeometries.data();
+    vkASBuildInfo.geometryCount             = GeometryCount;
+    vkASBuildInfo.pGeometries               = vkGeometries;
     vkASBuildInfo.ppGeometries              = nullptr;
     vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Attribs.ScratchBufferOffset;
 
@@ -3902,7 +4149,9 @@ void DeviceContextVkImpl::TraceRays(const TraceRaysAttribs& Attribs)
     const ShaderBindingTableVkImpl* pSBTVk       = ClassPtrCast<const ShaderBindingTableVkImpl>(Attribs.pSBT);
     const BindingTableVk&           BindingTable = pSBTVk->GetVkBindingTable();
 
-    PrepareForRayTracing();
+    if (!PrepareForRayTracing())
+        return;
+
     m_CommandBuffer.TraceRays(BindingTable.RaygenShader, BindingTable.MissShader, BindingTable.HitShader, BindingTable.CallableShader,
                               Attribs.DimensionX, Attribs.DimensionY, Attribs.DimensionZ);
     ++m_State.NumCommands;
@@ -3918,7 +4167,9 @@ void DeviceContextVkImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attr
     BufferVkImpl* const pIndirectAttribsVk = PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Trace rays indirect (DeviceContextVkImpl::TraceRaysIndirect)");
     const Uint64        IndirectBuffOffset = Attribs.ArgsByteOffset + TraceRaysIndirectCommandSBTSize;
 
-    PrepareForRayTracing();
+    if (!PrepareForRayTracing())
+        return;
+
     m_CommandBuffer.TraceRaysIndirect(BindingTable.RaygenShader, BindingTable.MissShader, BindingTable.HitShader, BindingTable.CallableShader,
                                       pIndirectAttribsVk->GetVkDeviceAddress() + IndirectBuffOffset);
     ++m_State.NumCommands;
@@ -4073,11 +4324,17 @@ void DeviceContextVkImpl::BindSparseResourceMemory(const BindSparseResourceMemor
             ++ImageBindCount;
     }
 
-    std::vector<VkSparseBufferMemoryBindInfo>      vkBufferBinds{Attribs.NumBufferBinds};
-    std::vector<VkSparseImageOpaqueMemoryBindInfo> vkImageOpaqueBinds{ImageOpqBindCount};
-    std::vector<VkSparseImageMemoryBindInfo>       vkImageBinds{ImageBindCount};
-    std::vector<VkSparseMemoryBind>                vkMemoryBinds{MemoryBindCount};
-    std::vector<VkSparseImageMemoryBind>           vkImageMemoryBinds{ImageMemoryBindCount};
+    VkSparseBufferMemoryBindInfo*      vkBufferBinds      = ConstructFrameArray<VkSparseBufferMemoryBindInfo>(Attribs.NumBufferBinds);
+    VkSparseImageOpaqueMemoryBindInfo* vkImageOpaqueBinds = ConstructFrameArray<VkSparseImageOpaqueMemoryBindInfo>(ImageOpqBindCount);
+    VkSparseImageMemoryBindInfo*       vkImageBinds       = ConstructFrameArray<VkSparseImageMemoryBindInfo>(ImageBindCount);
+    VkSparseMemoryBind*                vkMemoryBinds      = ConstructFrameArray<VkSparseMemoryBind>(MemoryBindCount);
+    VkSparseImageMemoryBind*           vkImageMemoryBinds = ConstructFrameArray<VkSparseImageMemoryBind>(ImageMemoryBindCount);
+#ifdef DILIGENT_DEBUG
+    const Uint32 TotalMemoryBindCount      = MemoryBindCount;
+    const Uint32 TotalImageMemoryBindCount = ImageMemoryBindCount;
+    const Uint32 TotalImageBindCount       = ImageBindCount;
+    const Uint32 TotalImageOpqBindCount    = ImageOpqBindCount;
+#endif
 
     MemoryBindCount      = 0;
     ImageMemoryBindCount = 0;
@@ -4194,19 +4451,20 @@ void DeviceContextVkImpl::BindSparseResourceMemory(const BindSparseResourceMemor
         }
     }
 
-    VERIFY_EXPR(MemoryBindCount == vkMemoryBinds.size());
-    VERIFY_EXPR(ImageMemoryBindCount == vkImageMemoryBinds.size());
-    VERIFY_EXPR(ImageBindCount == vkImageBinds.size());
-    VERIFY_EXPR(ImageOpqBindCount == vkImageOpaqueBinds.size());
+    VERIFY_EXPR(MemoryBindCount == TotalMemoryBindCount);
+    VERIFY_EXPR(ImageMemoryBindCount == TotalImageMemoryBindCount);
+    VERIFY_EXPR(ImageBindCount == TotalImageBindCount);
+    VERIFY_EXPR(ImageOpqBindCount == TotalImageOpqBindCount);
 
+    // Zero-sized arrays are allocated as null pointers
     VkBindSparseInfo BindSparse{};
     BindSparse.sType                = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
-    BindSparse.bufferBindCount      = StaticCast<uint32_t>(vkBufferBinds.size());
-    BindSparse.pBufferBinds         = !vkBufferBinds.empty() ? vkBufferBinds.data() : nullptr;
-    BindSparse.imageOpaqueBindCount = StaticCast<uint32_t>(vkImageOpaqueBinds.size());
-    BindSparse.pImageOpaqueBinds    = !vkImageOpaqueBinds.empty() ? vkImageOpaqueBinds.data() : nullptr;
-    BindSparse.imageBindCount       = StaticCast<uint32_t>(vkImageBinds.size());
-    BindSparse.pImageBinds          = !vkImageBinds.empty() ? vkImageBinds.data() : nullptr;
+    BindSparse.bufferBindCount      = Attribs.NumBufferBinds;
+    BindSparse.pBufferBinds         = vkBufferBinds;
+    BindSparse.imageOpaqueBindCount = ImageOpqBindCount;
+    BindSparse.pImageOpaqueBinds    = vkImageOpaqueBinds;
+    BindSparse.imageBindCount       = ImageBindCount;
+    BindSparse.pImageBinds          = vkImageBinds;
 
     VERIFY_EXPR(m_VkSignalSemaphores.empty() && m_SignalSemaphoreValues.empty());
     VERIFY_EXPR(m_VkWaitSemaphores.empty() && m_WaitSemaphoreValues.empty());
@@ -1264,6 +1264,48 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.GraphicsPipelineLibrary)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            if (EnabledFeaturesVk.DescriptorBuffer)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                // Disable unused features
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+
+                // Descriptors reference buffers by device address.
+                // Buffer device address may have already been enabled for ray tracing.
+                if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                {
+                    VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME), "VK_KHR_buffer_device_address extension must be supported");
+                    DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+                    EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                    *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                    NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                }
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
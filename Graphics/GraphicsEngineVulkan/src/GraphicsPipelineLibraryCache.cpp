@@ -0,0 +1,431 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "GraphicsPipelineLibraryCache.hpp"
+
+#include "RenderDeviceVkImpl.hpp"
+#include "PipelineResourceSignatureVkImpl.hpp"
+
+namespace Diligent
+{
+
+GraphicsPipelineLibraryCache::GraphicsPipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept :
+    m_DeviceVkImpl{DeviceVk},
+    m_RetainLinkTimeOptimizationInfo{DeviceVk.GetShaderCompilationThreadPool() != nullptr},
+    m_pNumExpiredLibraries{std::make_shared<std::atomic<Uint32>>(0)}
+{}
+
+GraphicsPipelineLibraryCache::~GraphicsPipelineLibraryCache()
+{
+    // The keys keep references to render passes and resource signatures whose destructors
+    // call SafeReleaseDeviceObject, so the cache must be cleared while the device is alive.
+    VERIFY(m_Cache.empty(), "Graphics pipeline library cache is not empty. Did you call Destroy?");
+}
+
+void GraphicsPipelineLibraryCache::Destroy()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    m_Cache.clear();
+}
+
+void GraphicsPipelineLibraryCache::PurgeExpiredLibraries()
+{
+    if (m_pNumExpiredLibraries->exchange(0) == 0)
+        return;
+
+    for (auto it = m_Cache.begin(); it != m_Cache.end();)
+    {
+        if (it->second.expired())
+        {
+            it = m_Cache.erase(it);
+            ++m_Stats.Evictions;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void GraphicsPipelineLibraryCache::GetStats(GraphicsPipelineLibraryStatsVk& Stats) const
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    Stats = m_Stats;
+    // Entries whose libraries have been released but that have not been purged yet are
+    // reported as evicted, the same way PurgeExpiredLibraries() would count them.
+    Stats.NumLibraries = 0;
+    for (const auto& it : m_Cache)
+    {
+        if (it.second.expired())
+            ++Stats.Evictions;
+        else
+            ++Stats.NumLibraries;
+    }
+}
+
+bool GraphicsPipelineLibraryCache::LibraryKey::operator==(const LibraryKey& rhs) const noexcept
+{
+    // clang-format off
+    if (GetHash()        != rhs.GetHash()        ||
+        Type             != rhs.Type             ||
+        Flags            != rhs.Flags            ||
+        Topology         != rhs.Topology         ||
+        NumViewports     != rhs.NumViewports     ||
+        SampleMask       != rhs.SampleMask       ||
+        ShadingRateFlags != rhs.ShadingRateFlags ||
+        pRenderPass      != rhs.pRenderPass      ||
+        SubpassIndex     != rhs.SubpassIndex     ||
+        NumRenderTargets != rhs.NumRenderTargets ||
+        ReadOnlyDSV      != rhs.ReadOnlyDSV      ||
+        DSVFormat        != rhs.DSVFormat        ||
+        !(Samples        == rhs.Samples)         ||
+        !(Rasterizer     == rhs.Rasterizer)      ||
+        !(DepthStencil   == rhs.DepthStencil)    ||
+        !(Blend          == rhs.Blend)           ||
+        !(InputLayout    == rhs.InputLayout)     ||
+        Shaders.size()    != rhs.Shaders.size()  ||
+        Signatures.size() != rhs.Signatures.size())
+    {
+        return false;
+    }
+    // clang-format on
+
+    for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
+    {
+        if (RTVFormats[rt] != rhs.RTVFormats[rt])
+            return false;
+    }
+
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        if (!(Shaders[i] == rhs.Shaders[i]))
+            return false;
+    }
+
+    // Libraries that are linked together must use identically defined pipeline layouts.
+    // Compatible signatures produce identical descriptor set layouts.
+    for (size_t i = 0; i < Signatures.size(); ++i)
+    {
+        const PipelineResourceSignatureVkImpl* pSign0 = Signatures[i];
+        const PipelineResourceSignatureVkImpl* pSign1 = rhs.Signatures[i];
+        if (pSign0 == pSign1)
+            continue;
+        if (pSign0 == nullptr || pSign1 == nullptr || !pSign0->IsCompatibleWith(pSign1))
+            return false;
+    }
+
+    return true;
+}
+
+size_t GraphicsPipelineLibraryCache::LibraryKey::GetHash() const noexcept
+{
+    if (Hash == 0)
+    {
+        Hash = ComputeHash(Type, Flags, Topology, NumViewports, SampleMask, ShadingRateFlags, pRenderPass.RawPtr(),
+                           SubpassIndex, NumRenderTargets, ReadOnlyDSV, DSVFormat);
+        HashCombine(Hash, Samples, Rasterizer, DepthStencil, Blend, InputLayout.Get());
+        for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
+            HashCombine(Hash, RTVFormats[rt]);
+
+        for (const ShaderKey& Shader : Shaders)
+        {
+            HashCombine(Hash, Shader.Stage, ComputeHashRaw(Shader.EntryPoint.data(), Shader.EntryPoint.size()),
+                        ComputeHashRaw(Shader.SPIRV.data(), Shader.SPIRV.size() * sizeof(uint32_t)));
+        }
+
+        for (const RefCntAutoPtr<PipelineResourceSignatureVkImpl>& pSign : Signatures)
+            HashCombine(Hash, pSign ? pSign->GetHash() : size_t{0});
+    }
+    return Hash;
+}
+
+GraphicsPipelineLibraryCache::LibraryKey GraphicsPipelineLibraryCache::CreateKey(LIBRARY_TYPE Type, const LibrariesCreateAttribs& Attribs)
+{
+    const VkGraphicsPipelineCreateInfo& PipelineCI       = Attribs.PipelineCI;
+    const GraphicsPipelineDesc&         GraphicsPipeline = Attribs.GraphicsPipeline;
+
+    LibraryKey Key;
+    Key.Type  = Type;
+    Key.Flags = PipelineCI.flags;
+
+    if (Type == LIBRARY_TYPE_VERTEX_INPUT)
+    {
+        Key.InputLayout = GraphicsPipeline.InputLayout;
+        Key.Topology    = GraphicsPipeline.PrimitiveTopology;
+        return Key;
+    }
+
+    Key.ShadingRateFlags = GraphicsPipeline.ShadingRateFlags;
+    Key.pRenderPass      = Attribs.pRenderPass;
+    Key.SubpassIndex     = GraphicsPipeline.SubpassIndex;
+    Key.NumRenderTargets = GraphicsPipeline.NumRenderTargets;
+    Key.ReadOnlyDSV      = GraphicsPipeline.ReadOnlyDSV;
+    Key.DSVFormat        = GraphicsPipeline.DSVFormat;
+    for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+        Key.RTVFormats[rt] = GraphicsPipeline.RTVFormats[rt];
+
+    if (Type == LIBRARY_TYPE_PRE_RASTERIZATION || Type == LIBRARY_TYPE_FRAGMENT_SHADER)
+    {
+        for (uint32_t s = 0; s < PipelineCI.stageCount; ++s)
+        {
+            const VkPipelineShaderStageCreateInfo& StageCI = PipelineCI.pStages[s];
+
+            const bool IsFragmentStage = StageCI.stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+            if (IsFragmentStage != (Type == LIBRARY_TYPE_FRAGMENT_SHADER))
+                continue;
+
+            ShaderKey Shader;
+            Shader.Stage      = StageCI.stage;
+            Shader.EntryPoint = StageCI.pName;
+            Shader.SPIRV      = *Attribs.ppSPIRVs[s];
+            Key.Shaders.emplace_back(std::move(Shader));
+        }
+
+        Key.Signatures.assign(Attribs.ppSignatures, Attribs.ppSignatures + Attribs.SignatureCount);
+    }
+
+    switch (Type)
+    {
+        case LIBRARY_TYPE_PRE_RASTERIZATION:
+            Key.Topology     = GraphicsPipeline.PrimitiveTopology; // Patch control point count
+            Key.Rasterizer   = GraphicsPipeline.RasterizerDesc;
+            Key.NumViewports = GraphicsPipeline.NumViewports;
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_SHADER:
+            Key.DepthStencil = GraphicsPipeline.DepthStencilDesc;
+            Key.Samples      = GraphicsPipeline.SmplDesc;
+            Key.SampleMask   = GraphicsPipeline.SampleMask;
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_OUTPUT:
+            Key.Blend      = GraphicsPipeline.BlendDesc;
+            Key.Samples    = GraphicsPipeline.SmplDesc;
+            Key.SampleMask = GraphicsPipeline.SampleMask;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected library type");
+    }
+
+    return Key;
+}
+
+VulkanUtilities::PipelineWrapper GraphicsPipelineLibraryCache::CreateLibrary(LIBRARY_TYPE Type, const LibrariesCreateAttribs& Attribs) const noexcept(false)
+{
+    // Start with the monolithic pipeline create info and remove all state that
+    // does not belong to the library part (see VkGraphicsPipelineLibraryFlagBitsEXT).
+    VkGraphicsPipelineCreateInfo PipelineCI = Attribs.PipelineCI;
+
+    VkGraphicsPipelineLibraryCreateInfoEXT LibraryCI{};
+    LibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    LibraryCI.pNext = PipelineCI.pNext; // VkPipelineRenderingCreateInfoKHR when dynamic rendering is used
+
+    PipelineCI.pNext = &LibraryCI;
+    PipelineCI.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    if (m_RetainLinkTimeOptimizationInfo)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    std::vector<VkPipelineShaderStageCreateInfo> Stages;
+    for (uint32_t s = 0; s < Attribs.PipelineCI.stageCount; ++s)
+    {
+        const VkPipelineShaderStageCreateInfo& StageCI         = Attribs.PipelineCI.pStages[s];
+        const bool                             IsFragmentStage = StageCI.stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+        if ((Type == LIBRARY_TYPE_PRE_RASTERIZATION && !IsFragmentStage) ||
+            (Type == LIBRARY_TYPE_FRAGMENT_SHADER && IsFragmentStage))
+        {
+            Stages.push_back(StageCI);
+        }
+    }
+    PipelineCI.stageCount = static_cast<uint32_t>(Stages.size());
+    PipelineCI.pStages    = !Stages.empty() ? Stages.data() : nullptr;
+
+    const char* Name = nullptr;
+    switch (Type)
+    {
+        case LIBRARY_TYPE_VERTEX_INPUT:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+            LibraryCI.pNext = nullptr;
+
+            PipelineCI.layout              = VK_NULL_HANDLE;
+            PipelineCI.pTessellationState  = nullptr;
+            PipelineCI.pViewportState      = nullptr;
+            PipelineCI.pRasterizationState = nullptr;
+            PipelineCI.pMultisampleState   = nullptr;
+            PipelineCI.pDepthStencilState  = nullptr;
+            PipelineCI.pColorBlendState    = nullptr;
+            PipelineCI.pDynamicState       = nullptr;
+            PipelineCI.renderPass          = VK_NULL_HANDLE;
+            PipelineCI.subpass             = 0;
+
+            Name = "Vertex input library";
+            break;
+
+        case LIBRARY_TYPE_PRE_RASTERIZATION:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+
+            PipelineCI.pVertexInputState   = nullptr;
+            PipelineCI.pInputAssemblyState = nullptr;
+            PipelineCI.pMultisampleState   = nullptr;
+            PipelineCI.pDepthStencilState  = nullptr;
+            PipelineCI.pColorBlendState    = nullptr;
+
+            Name = "Pre-rasterization shaders library";
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_SHADER:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+
+            PipelineCI.pVertexInputState   = nullptr;
+            PipelineCI.pInputAssemblyState = nullptr;
+            PipelineCI.pTessellationState  = nullptr;
+            PipelineCI.pViewportState      = nullptr;
+            PipelineCI.pRasterizationState = nullptr;
+            PipelineCI.pColorBlendState    = nullptr;
+
+            Name = "Fragment shader library";
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_OUTPUT:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+
+            PipelineCI.layout              = VK_NULL_HANDLE;
+            PipelineCI.pVertexInputState   = nullptr;
+            PipelineCI.pInputAssemblyState = nullptr;
+            PipelineCI.pTessellationState  = nullptr;
+            PipelineCI.pViewportState      = nullptr;
+            PipelineCI.pRasterizationState = nullptr;
+            PipelineCI.pDepthStencilState  = nullptr;
+
+            Name = "Fragment output library";
+            break;
+
+        default:
+            UNEXPECTED("Unexpected library type");
+    }
+
+    return m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, Attribs.vkPSOCache, Name);
+}
+
+GraphicsPipelineLibraryCache::LibraryArray GraphicsPipelineLibraryCache::GetLibraries(const LibrariesCreateAttribs& Attribs) noexcept(false)
+{
+    LibraryArray Libraries;
+    for (Uint32 Type = 0; Type < LIBRARY_TYPE_COUNT; ++Type)
+    {
+        LibraryKey Key = CreateKey(static_cast<LIBRARY_TYPE>(Type), Attribs);
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+            PurgeExpiredLibraries();
+
+            auto it = m_Cache.find(Key);
+            if (it != m_Cache.end())
+            {
+                Libraries[Type] = it->second.lock();
+                if (Libraries[Type])
+                {
+                    ++m_Stats.Hits;
+                    continue;
+                }
+            }
+            ++m_Stats.Misses;
+        }
+
+        // Do not hold the lock while the library is being compiled.
+        // If another thread creates the same library in the meantime, its instance is used.
+        // The library is released once the last pipeline that uses it is destroyed.
+        std::shared_ptr<std::atomic<Uint32>> pNumExpiredLibraries = m_pNumExpiredLibraries;
+        RenderDeviceVkImpl&                  DeviceVk             = m_DeviceVkImpl;
+
+        LibraryPtr pLibrary{
+            new VulkanUtilities::PipelineWrapper{CreateLibrary(static_cast<LIBRARY_TYPE>(Type), Attribs)},
+            [&DeviceVk, pNumExpiredLibraries](const VulkanUtilities::PipelineWrapper* pLibrary) //
+            {
+                DeviceVk.SafeReleaseDeviceObject(std::move(*const_cast<VulkanUtilities::PipelineWrapper*>(pLibrary)), ~Uint64{0});
+                delete pLibrary;
+                pNumExpiredLibraries->fetch_add(1);
+            }};
+
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+
+        auto it = m_Cache.find(Key);
+        if (it == m_Cache.end())
+        {
+            m_Cache.emplace(std::move(Key), pLibrary);
+        }
+        else if (LibraryPtr pCachedLibrary = it->second.lock())
+        {
+            pLibrary = std::move(pCachedLibrary);
+        }
+        else
+        {
+            it->second = pLibrary;
+        }
+        Libraries[Type] = std::move(pLibrary);
+    }
+
+    return Libraries;
+}
+
+VulkanUtilities::PipelineWrapper GraphicsPipelineLibraryCache::LinkPipeline(const LibraryArray& Libraries,
+                                                                            VkPipelineLayout    vkLayout,
+                                                                            bool                Optimize,
+                                                                            VkPipelineCache     vkPSOCache,
+                                                                            const char*         Name) const noexcept(false)
+{
+    DEV_CHECK_ERR(!Optimize || m_RetainLinkTimeOptimizationInfo,
+                  "Link-time optimization requires libraries created with VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT flag");
+
+    std::array<VkPipeline, LIBRARY_TYPE_COUNT> vkLibraries{};
+    for (size_t i = 0; i < Libraries.size(); ++i)
+    {
+        VERIFY_EXPR(Libraries[i]);
+        vkLibraries[i] = *Libraries[i];
+    }
+
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.libraryCount = static_cast<uint32_t>(vkLibraries.size());
+    LibraryCI.pLibraries   = vkLibraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext              = &LibraryCI;
+    PipelineCI.flags              = Optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+    // Libraries inherit VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT from the monolithic create info,
+    // and the linked pipeline must use the same flag.
+    if (m_DeviceVkImpl.GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    return m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, vkPSOCache, Name);
+}
+
+} // namespace Diligent
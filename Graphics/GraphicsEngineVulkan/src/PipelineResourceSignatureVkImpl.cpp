@@ -112,6 +112,31 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
     return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
 }
 
+Uint32 GetDescriptorBufferDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                         VkDescriptorType                                     vkDescrType,
+                                         bool                                                 RobustBufferAccess)
+{
+    size_t Size = 0;
+    switch (vkDescrType)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_SAMPLER:                    Size = Props.samplerDescriptorSize;                break;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     Size = Props.combinedImageSamplerDescriptorSize;   break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              Size = Props.sampledImageDescriptorSize;           break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              Size = Props.storageImageDescriptorSize;           break;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           Size = Props.inputAttachmentDescriptorSize;        break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: Size = Props.accelerationStructureDescriptorSize;  break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER: Size = RobustBufferAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize; break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: Size = RobustBufferAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize; break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:       Size = RobustBufferAccess ? Props.robustUniformBufferDescriptorSize      : Props.uniformBufferDescriptorSize;      break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:       Size = RobustBufferAccess ? Props.robustStorageBufferDescriptorSize      : Props.storageBufferDescriptorSize;      break;
+        // clang-format on
+        default:
+            UNEXPECTED("Descriptor type ", vkDescrType, " is not supported in descriptor buffers");
+    }
+    return StaticCast<Uint32>(Size);
+}
+
 } // namespace
 
 inline PipelineResourceSignatureVkImpl::CACHE_GROUP PipelineResourceSignatureVkImpl::GetResourceCacheGroup(const PipelineResourceDesc& Res)
@@ -249,6 +274,14 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
+    // Descriptor buffers can only be used when the device is available (i.e. not in the archiver)
+    m_UseDescriptorBuffer = HasDevice() && GetDevice()->GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE;
+    if (m_UseDescriptorBuffer)
+    {
+        m_DescriptorBufferResBindings.resize(m_Desc.NumResources);
+        m_DescriptorBufferSamplerBindings.resize(m_Desc.NumImmutableSamplers);
+    }
+
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
     {
@@ -330,9 +363,17 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = m_UseDescriptorBuffer ?
+            DescriptorTypeToVkDescriptorBufferType(pAttribs->GetDescriptorType()) :
+            DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
+        if (m_UseDescriptorBuffer && pVkImmutableSamplers != nullptr)
+        {
+            // Immutable samplers are not taken from the set layout and must be written to the descriptor buffer
+            m_DescriptorBufferResBindings[i].vkImmutableSampler = pVkImmutableSamplers[0];
+        }
+
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
         {
             VERIFY(pAttribs->DescrSet == 0, "Static resources must always be allocated in descriptor set 0");
@@ -454,7 +495,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = m_UseDescriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
@@ -471,6 +512,54 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (m_UseDescriptorBuffer)
+            InitDescriptorBufferBindings();
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferBindings()
+{
+    VERIFY_EXPR(m_UseDescriptorBuffer);
+
+    const VulkanUtilities::VulkanLogicalDevice&          LogicalDevice      = GetDevice()->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props              = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    const bool                                           RobustBufferAccess = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    for (size_t SetId = 0; SetId < m_VkDescrSetLayouts.size(); ++SetId)
+    {
+        if (m_VkDescrSetLayouts[SetId])
+            m_DescriptorBufferSetSizes[SetId] = LogicalDevice.GetDescriptorSetLayoutSize(m_VkDescrSetLayouts[SetId]);
+    }
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        const ResourceAttribs&      Attr    = m_pResourceAttribs[i];
+        DescriptorBufferBinding&    Binding = m_DescriptorBufferResBindings[i];
+
+        const VkDescriptorSetLayout vkLayout = m_VkDescrSetLayouts[VarTypeToDescriptorSetId(ResDesc.VarType)];
+        Binding.Offset                       = LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Attr.BindingIndex);
+        Binding.DescriptorSize               = GetDescriptorBufferDescriptorSize(Props, DescriptorTypeToVkDescriptorBufferType(Attr.GetDescriptorType()), RobustBufferAccess);
+    }
+
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsVk& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        if (ImtblSampAttribs.DescrSet == ~0u)
+        {
+            // Immutable sampler is assigned to a resource
+            continue;
+        }
+
+        // Immutable samplers that are not assigned to resources are placed into the static/mutable
+        // set, unless it is empty, see CreateSetLayouts().
+        const DESCRIPTOR_SET_ID  SetId   = HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? DESCRIPTOR_SET_ID_STATIC_MUTABLE : DESCRIPTOR_SET_ID_DYNAMIC;
+        DescriptorBufferBinding& Binding = m_DescriptorBufferSamplerBindings[i];
+
+        Binding.Offset             = LogicalDevice.GetDescriptorSetLayoutBindingOffset(m_VkDescrSetLayouts[SetId], ImtblSampAttribs.BindingIndex);
+        Binding.DescriptorSize     = GetDescriptorBufferDescriptorSize(Props, VK_DESCRIPTOR_TYPE_SAMPLER, RobustBufferAccess);
+        Binding.vkImmutableSampler = m_pImmutableSamplers[i] ? m_pImmutableSamplers[i]->GetVkSampler() : VK_NULL_HANDLE;
     }
 }
 
@@ -515,6 +604,15 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    // With descriptor buffers, static/mutable descriptors are written to the persistent descriptor
+    // buffer memory of the SRB by the device context when the SRB is committed, so no descriptor set is allocated.
+    if (m_UseDescriptorBuffer)
+    {
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+            ResourceCache.InitializePersistentDescriptorBuffer(*GetDevice());
+        return;
+    }
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -606,10 +704,11 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+Uint32 PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                               VkDescriptorSet              vkDynamicDescriptorSet) const
 {
     VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+    VERIFY(!m_UseDescriptorBuffer, "Dynamic resources must be written by WriteDescriptorBuffer() when descriptor buffers are used");
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
@@ -647,6 +746,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
 
+    Uint32 NumDescriptorsWritten = 0;
     for (Uint32 ResIdx = DynResIdxRange.first, ArrElem = 0; ResIdx < DynResIdxRange.second;)
     {
         const PipelineResourceAttribsType& Attr        = GetResourceAttribs(ResIdx);
@@ -688,6 +788,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
                     *DescrIt = CachedRes.GetDescriptorWriteInfo<DescrType>();
                     ++DescrIt;
                     ++WriteDescrSetIt->descriptorCount;
+                    ++NumDescriptorsWritten;
                 }
                 else
                 {
@@ -795,6 +896,81 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
         LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+
+    return NumDescriptorsWritten;
+}
+
+Uint32 PipelineResourceSignatureVkImpl::WriteDescriptorBuffer(const ShaderResourceCacheVk& ResourceCache,
+                                                              DESCRIPTOR_SET_ID            SetId,
+                                                              DeviceContextVkImpl&         Ctx,
+                                                              Uint8*                       pDstData) const
+{
+    VERIFY(m_UseDescriptorBuffer, "This signature does not use descriptor buffers");
+    VERIFY(HasDescriptorSet(SetId), "This signature does not contain descriptor set ", Uint32{SetId});
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    VERIFY_EXPR(pDstData != nullptr);
+
+    const Uint32 SetIdx = SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE ?
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>() :
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+
+    const ShaderResourceCacheVk::DescriptorSet& SetResources  = ResourceCache.GetDescriptorSet(SetIdx);
+    const VulkanUtilities::VulkanLogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    Uint32 NumDescriptorsWritten = 0;
+
+    const auto WriteResources = [&](SHADER_RESOURCE_VARIABLE_TYPE VarType) {
+        const std::pair<Uint32, Uint32> ResIdxRange = GetResourceIndexRange(VarType);
+        for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+        {
+            const PipelineResourceAttribsType& Attr    = GetResourceAttribs(r);
+            const DescriptorBufferBinding&     Binding = m_DescriptorBufferResBindings[r];
+            VERIFY_EXPR(Binding.DescriptorSize != 0);
+            for (Uint32 ArrInd = 0; ArrInd < Attr.ArraySize; ++ArrInd)
+            {
+                const ShaderResourceCacheVk::Resource& CachedRes = SetResources.GetResource(Attr.CacheOffset(CacheType) + ArrInd);
+                // There are no null descriptors, so the descriptor of a null resource is left undefined,
+                // which is valid as long as the shader does not access it.
+                // Separate immutable samplers have no object, but still must be written.
+                if (!CachedRes && !(CachedRes.Type == DescriptorType::Sampler && CachedRes.HasImmutableSampler))
+                    continue;
+
+                CachedRes.WriteDescriptorBufferData(Ctx, LogicalDevice, Binding.vkImmutableSampler, Binding.DescriptorSize,
+                                                    pDstData + Binding.Offset + size_t{ArrInd} * Binding.DescriptorSize);
+                ++NumDescriptorsWritten;
+            }
+        }
+    };
+
+    if (SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE)
+    {
+        WriteResources(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+        WriteResources(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+    else
+    {
+        WriteResources(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    }
+
+    // Immutable samplers that are not assigned to any resource
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const DescriptorBufferBinding& Binding = m_DescriptorBufferSamplerBindings[i];
+        if (Binding.DescriptorSize == 0 || m_pImmutableSamplerAttribs[i].DescrSet != SetIdx)
+            continue;
+
+        VkDescriptorGetInfoEXT GetInfo{};
+        GetInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        GetInfo.pNext         = nullptr;
+        GetInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+        GetInfo.data.pSampler = &Binding.vkImmutableSampler;
+        LogicalDevice.GetDescriptor(GetInfo, Binding.DescriptorSize, pDstData + Binding.Offset);
+        ++NumDescriptorsWritten;
+    }
+
+    return NumDescriptorsWritten;
 }
 
 
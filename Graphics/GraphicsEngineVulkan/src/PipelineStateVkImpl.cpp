@@ -116,6 +116,9 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    // Pipelines that use descriptor buffers must be created with the corresponding flag
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -126,14 +129,18 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
-void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
-                            std::vector<VkPipelineShaderStageCreateInfo>& Stages,
-                            const PipelineLayoutVk&                       Layout,
-                            const PipelineStateDesc&                      PSODesc,
-                            const GraphicsPipelineDesc&                   GraphicsPipeline,
-                            VulkanUtilities::PipelineWrapper&             Pipeline,
-                            RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+void CreateGraphicsPipeline(RenderDeviceVkImpl*                                   pDeviceVk,
+                            std::vector<VkPipelineShaderStageCreateInfo>&         Stages,
+                            const PipelineStateVkImpl::TShaderStages&             ShaderStages,
+                            const PipelineLayoutVk&                               Layout,
+                            const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures,
+                            Uint32                                                SignatureCount,
+                            const PipelineStateDesc&                              PSODesc,
+                            const GraphicsPipelineDesc&                           GraphicsPipeline,
+                            VulkanUtilities::PipelineWrapper&                     Pipeline,
+                            GraphicsPipelineLibraryCache::LibraryArray&           Libraries,
+                            RefCntAutoPtr<IRenderPass>&                           pRenderPass,
+                            VkPipelineCache                                       vkPSOCache)
 {
     const VulkanUtilities::VulkanLogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::VulkanPhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -144,6 +151,9 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    // Pipelines that use descriptor buffers must be created with the corresponding flag
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
@@ -357,7 +367,26 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    // Mesh pipelines are always created as monolithic pipelines.
+    GraphicsPipelineLibraryCache* pLibraryCache = pDeviceVk->GetGraphicsPipelineLibraryCache();
+    if (pLibraryCache != nullptr && PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS)
+    {
+        // SPIR-V for every entry in Stages, see InitPipelineShaderStages()
+        std::vector<const std::vector<uint32_t>*> SPIRVs;
+        for (const PipelineStateVkImpl::ShaderStageInfo& Stage : ShaderStages)
+        {
+            for (const std::vector<uint32_t>& SPIRV : Stage.SPIRVs)
+                SPIRVs.push_back(&SPIRV);
+        }
+        VERIFY_EXPR(SPIRVs.size() == Stages.size());
+
+        Libraries = pLibraryCache->GetLibraries({PipelineCI, GraphicsPipeline, pRenderPass.RawPtr(), SPIRVs.data(), ppSignatures, SignatureCount, vkPSOCache});
+        Pipeline  = pLibraryCache->LinkPipeline(Libraries, PipelineCI.layout, /*Optimize = */ false, vkPSOCache, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -378,6 +407,9 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    // Pipelines that use descriptor buffers must be created with the corresponding flag
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -858,10 +890,34 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+
+    CreateGraphicsPipeline(m_pDevice, vkShaderStages, ShaderStages, m_PipelineLayout, m_Signatures, m_SignatureCount,
+                           m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, m_PipelineLibraries, GetRenderPassPtr(), vkSPOCache);
+
+    GraphicsPipelineLibraryCache* pLibraryCache = m_pDevice->GetGraphicsPipelineLibraryCache();
+    if (m_PipelineLibraries[GraphicsPipelineLibraryCache::LIBRARY_TYPE_VERTEX_INPUT] && pLibraryCache->IsLinkTimeOptimizationSupported())
+    {
+        // The fast-linked pipeline is usable right away. Re-link it with link-time optimization
+        // in the background and switch to the optimized pipeline once it is ready.
+        // Do not use the PSO cache as it may be released before the task runs.
+        m_OptimizePipelineTask = AsyncInitializer::Start(
+            m_pDevice->GetShaderCompilationThreadPool(),
+            [this, pLibraryCache](Uint32 ThreadId) //
+            {
+                try
+                {
+                    m_OptimizedPipeline = pLibraryCache->LinkPipeline(m_PipelineLibraries, m_PipelineLayout.GetVkPipelineLayout(), /*Optimize = */ true, VK_NULL_HANDLE, m_Desc.Name);
+                    m_OptimizedPipelineReady.store(true, std::memory_order_release);
+                }
+                catch (...)
+                {
+                    LOG_WARNING_MESSAGE("Failed to link optimized pipeline for PSO '", m_Desc.Name, "'. Fast-linked pipeline will be used.");
+                }
+            });
+    }
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
@@ -925,6 +981,7 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
     // Make sure that asynchrous task is complete as it references the pipeline object.
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion =*/true);
+    AsyncInitializer::Update(m_OptimizePipelineTask, /*WaitForCompletion =*/true);
 
     Destruct();
 }
@@ -932,6 +989,10 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
 void PipelineStateVkImpl::Destruct()
 {
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    if (m_OptimizedPipeline != VK_NULL_HANDLE)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
+    // Libraries that are not used by other pipelines are released and evicted from the cache
+    m_PipelineLibraries = {};
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
@@ -80,7 +80,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_Properties
     {
         EngineCI.UploadHeapPageSize,
-        EngineCI.DynamicHeapPageSize
+        EngineCI.DynamicHeapPageSize,
+        EngineCI.DescriptorBufferHeapPageSize
     },
     m_VulkanInstance         {Instance                 },
     m_PhysicalDevice         {std::move(PhysicalDevice)},
@@ -204,7 +205,41 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
 
+    if (m_LogicalVkDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer)
+    {
+        // Descriptor set offsets are relative to the start of the buffer, so the entire buffer must be
+        // addressable through a single binding.
+        const auto& DescrBufferProps = m_PhysicalDevice->GetExtProperties().DescriptorBuffer;
+
+        VkDeviceSize HeapSize = std::min({
+            VkDeviceSize{EngineCI.DescriptorBufferHeapSize},
+            DescrBufferProps.maxResourceDescriptorBufferRange,
+            DescrBufferProps.maxSamplerDescriptorBufferRange,
+            DescrBufferProps.samplerDescriptorBufferAddressSpaceSize,
+            DescrBufferProps.resourceDescriptorBufferAddressSpaceSize,
+            DescrBufferProps.descriptorBufferAddressSpaceSize,
+        });
+        HeapSize              = AlignDown(HeapSize, VkDeviceSize{VulkanDynamicMemoryManager::MasterBlockAlignment});
+        if (HeapSize < EngineCI.DescriptorBufferHeapSize)
+        {
+            LOG_WARNING_MESSAGE("Descriptor buffer heap size (", EngineCI.DescriptorBufferHeapSize, ") exceeds the device limits and is clamped to ", HeapSize, " bytes.");
+        }
+        if (EngineCI.DescriptorBufferHeapPageSize > HeapSize)
+        {
+            LOG_WARNING_MESSAGE("Descriptor buffer heap page size (", EngineCI.DescriptorBufferHeapPageSize, ") exceeds the heap size (", HeapSize,
+                                " bytes). Descriptor buffer allocations will fail.");
+        }
+
+        m_DescriptorBufferMemoryManager = std::make_unique<VulkanDynamicMemoryManager>(GetRawAllocator(), *this, StaticCast<Uint32>(HeapSize), ~Uint64{0}, /*IsDescriptorBuffer = */ true);
+    }
+
     InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
+
+    // The cache checks if the shader compilation thread pool is available, so it must be created after the pool is initialized.
+    if (m_LogicalVkDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary)
+    {
+        m_GraphicsPipelineLibraryCache = std::make_unique<GraphicsPipelineLibraryCache>(*this);
+    }
 }
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
@@ -212,6 +247,17 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     // Explicitly destroy dynamic heap. This will move resources owned by
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
+    if (m_DescriptorBufferMemoryManager)
+    {
+        m_DescriptorBufferMemoryManager->Destroy();
+    }
+
+    // Explicitly destroy pipeline library cache. This releases the render passes
+    // and resource signatures referenced by the cache keys.
+    if (m_GraphicsPipelineLibraryCache)
+    {
+        m_GraphicsPipelineLibraryCache->Destroy();
+    }
 
     // Explicitly destroy render pass cache
     if (m_ImplicitRenderPassCache)
@@ -227,6 +273,7 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     DEV_CHECK_ERR(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated descriptor sets must have been released now.");
     DEV_CHECK_ERR(m_DynamicDescriptorPool.GetAllocatedPoolCounter() == 0, "All allocated dynamic descriptor pools must have been released now.");
     DEV_CHECK_ERR(m_DynamicMemoryManager.GetMasterBlockCounter() == 0, "All allocated dynamic master blocks must have been returned to the pool.");
+    DEV_CHECK_ERR(!m_DescriptorBufferMemoryManager || m_DescriptorBufferMemoryManager->GetMasterBlockCounter() == 0, "All allocated descriptor buffer master blocks must have been returned to the pool.");
 
     // Immediately destroys all command pools
     for (auto& CmdPool : m_TransientCmdPoolMgrs)
@@ -602,6 +649,114 @@ void RenderDeviceVkImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferDa
     CreateBufferImpl(ppBuffer, BuffDesc, pBuffData);
 }
 
+void RenderDeviceVkImpl::CreateBuffers(Uint32 NumBuffers, const BufferDesc* pBuffDescs, const BufferData* pBuffData, IBuffer** ppBuffers)
+{
+    if (!ValidateBufferBatch(NumBuffers, pBuffDescs, pBuffData, ppBuffers))
+        return;
+
+    // Device-local buffers are packed into one memory block per memory type and allocation flags.
+    // The block is allocated once before the buffers are created, and every buffer takes the next
+    // part of it (see BufferBatchMemoryVk). Buffers that do not fit into the block allocate memory individually.
+    struct BlockInfo
+    {
+        VkBufferUsageFlags Usage      = 0;
+        VkDeviceSize       Size       = 0;
+        Uint32             NumBuffers = 0;
+    };
+    // Buffers without and with the device address allocation flag
+    std::array<BlockInfo, 2> BlockInfos;
+
+    const bool DescriptorBufferEnabled = m_LogicalVkDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE;
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        const BufferDesc& Desc = pBuffDescs[i];
+        // Ray tracing buffers require larger alignment and are not packed
+        if ((Desc.Usage != USAGE_DEFAULT && Desc.Usage != USAGE_IMMUTABLE) || (Desc.BindFlags & BIND_RAY_TRACING) != 0)
+            continue;
+
+        VkBufferUsageFlags Usage = 0;
+        if (Desc.BindFlags & BIND_VERTEX_BUFFER)
+            Usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+        if (Desc.BindFlags & BIND_INDEX_BUFFER)
+            Usage |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+        if (Desc.BindFlags & BIND_UNIFORM_BUFFER)
+            Usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        if (Desc.BindFlags & BIND_INDIRECT_DRAW_ARGS)
+            Usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        if (Desc.BindFlags & (BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS))
+            Usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+        // With descriptor buffers, shader-visible buffers are allocated with the device address flag (see BufferVkImpl)
+        const bool HasDeviceAddress = DescriptorBufferEnabled && (Desc.BindFlags & (BIND_UNIFORM_BUFFER | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS)) != 0;
+        if (HasDeviceAddress)
+            Usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+        BlockInfo& Info = BlockInfos[HasDeviceAddress ? 1 : 0];
+        Info.Usage |= Usage;
+        Info.Size += Desc.Size;
+        ++Info.NumBuffers;
+    }
+
+    BufferBatchMemoryVk BatchMemory;
+    for (size_t i = 0; i < BlockInfos.size(); ++i)
+    {
+        const BlockInfo& Info = BlockInfos[i];
+        if (Info.NumBuffers < 2)
+            continue;
+
+        try
+        {
+            // Use a temporary buffer to query memory type and alignment requirements
+            VkBufferCreateInfo VkBuffCI{};
+            VkBuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            VkBuffCI.size        = 1;
+            VkBuffCI.usage       = Info.Usage | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            VkBuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            VulkanUtilities::BufferWrapper vkProbeBuffer = m_LogicalVkDevice->CreateBuffer(VkBuffCI, "Batch memory probe buffer");
+            const VkMemoryRequirements     MemReqs       = m_LogicalVkDevice->GetBufferMemoryRequirements(vkProbeBuffer);
+
+            const uint32_t MemoryTypeIndex = m_PhysicalDevice->GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+            if (MemoryTypeIndex == VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex)
+                continue;
+
+            const VkPhysicalDeviceLimits& Limits = m_PhysicalDevice->GetProperties().limits;
+
+            BufferBatchMemoryVk::Block Block;
+            Block.MemoryTypeIndex = MemoryTypeIndex;
+            Block.AllocateFlags   = i == 1 ? VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT : 0;
+            Block.Alignment       = std::max({MemReqs.alignment,
+                                        VkDeviceSize{Limits.minStorageBufferOffsetAlignment},
+                                        VkDeviceSize{Limits.minUniformBufferOffsetAlignment},
+                                        VkDeviceSize{Limits.minTexelBufferOffsetAlignment}});
+
+            // Every buffer may be padded by up to one alignment at the start and at the end
+            VkDeviceSize BlockSize = AlignUp(Info.Size + Block.Alignment * 2 * Info.NumBuffers, Block.Alignment);
+            // The page allocator requires free ranges to be aligned by the smallest alignment of its allocations.
+            // An odd multiple of the block alignment makes sure that this alignment does not exceed the block
+            // alignment, so that the buffers can release their parts of the block individually.
+            if ((BlockSize / Block.Alignment) % 2 == 0)
+                BlockSize += Block.Alignment;
+
+            Block.Remainder = AllocateMemory(BlockSize, Block.Alignment, Block.MemoryTypeIndex, Block.AllocateFlags);
+            if (Block.Remainder)
+                BatchMemory.Blocks.emplace_back(std::move(Block));
+        }
+        catch (...)
+        {
+            // Buffers will allocate memory individually
+        }
+    }
+
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        const BufferData* pData = pBuffData != nullptr && pBuffData[i].pData != nullptr ? &pBuffData[i] : nullptr;
+        CreateBufferImpl(&ppBuffers[i], pBuffDescs[i], pData, !BatchMemory.Blocks.empty() ? &BatchMemory : nullptr);
+    }
+
+    // The parts of the blocks that were not taken by the buffers are returned to the pages when BatchMemory is destroyed
+}
+
 
 void RenderDeviceVkImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                                       IShader**               ppShader,
@@ -837,4 +992,24 @@ void RenderDeviceVkImpl::GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const
     FeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(m_LogicalVkDevice->GetEnabledExtFeatures());
 }
 
+void RenderDeviceVkImpl::GetGraphicsPipelineLibraryStats(GraphicsPipelineLibraryStatsVk& Stats) const
+{
+    if (m_GraphicsPipelineLibraryCache)
+        m_GraphicsPipelineLibraryCache->GetStats(Stats);
+    else
+        Stats = {};
+}
+
+void RenderDeviceVkImpl::GetMemoryPageStats(MemoryPageStatsVk& Stats) const
+{
+    Stats = {};
+    for (bool HostVisible : {false, true})
+    {
+        const VulkanUtilities::VulkanMemoryManager::PageStats PageStats = m_MemoryMgr.GetPageStats(HostVisible);
+        Stats.NumAllocations += PageStats.NumAllocations;
+        Stats.NumPagesCreated += PageStats.NumPagesCreated;
+        Stats.NumPages += PageStats.NumPages;
+    }
+}
+
 } // namespace Diligent
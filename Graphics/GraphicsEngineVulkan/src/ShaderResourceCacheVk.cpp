@@ -30,6 +30,7 @@
 #include "ShaderResourceCacheVk.hpp"
 
 #include "DeviceContextVkImpl.hpp"
+#include "RenderDeviceVkImpl.hpp"
 #include "BufferViewVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
 #include "TextureVkImpl.hpp"
@@ -300,7 +301,9 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     if (IsDynamicBuffer(DstRes))
     {
         VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
+        VERIFY_EXPR(DescrSet.m_NumDynamicBuffers > 0);
         --m_NumDynamicBuffers;
+        --DescrSet.m_NumDynamicBuffers;
     }
 
     static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
@@ -326,7 +329,9 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     if (IsDynamicBuffer(DstRes))
     {
         ++m_NumDynamicBuffers;
+        ++DescrSet.m_NumDynamicBuffers;
     }
+    ++DescrSet.m_Version;
 
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
     if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
@@ -431,6 +436,32 @@ void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
                   "Specified offset is out of buffer bounds");
 
     DstRes.BufferDynamicOffset = DynamicBufferOffset;
+    ++DescrSet.m_Version;
+}
+
+void ShaderResourceCacheVk::InitializePersistentDescriptorBuffer(RenderDeviceVkImpl& Device)
+{
+    VERIFY(!m_pPersistentDescrBuffer, "Persistent descriptor buffer has already been initialized");
+    VERIFY(GetContentType() == ResourceCacheContentType::SRB, "Only SRB caches use persistent descriptor buffer memory");
+    VERIFY_EXPR(Device.GetDescriptorBufferMemoryManager() != nullptr);
+    m_pPersistentDescrBuffer = std::make_unique<PersistentDescriptorBuffer>(Device);
+}
+
+ShaderResourceCacheVk::PersistentDescriptorBuffer::~PersistentDescriptorBuffer()
+{
+    Release();
+}
+
+void ShaderResourceCacheVk::PersistentDescriptorBuffer::Release()
+{
+    if (!Block.IsValid())
+        return;
+
+    // SRB descriptor sets may be used by any queue, see PipelineResourceSignatureVkImpl::InitSRBResourceCache()
+    std::vector<VariableSizeAllocationsManager::Allocation> Blocks{Block};
+    Device.GetDescriptorBufferMemoryManager()->ReleaseMasterBlocks(Blocks, Device, ~Uint64{0});
+    Block         = {};
+    AlignedOffset = 0;
 }
 
 
@@ -870,6 +901,122 @@ VkWriteDescriptorSetAccelerationStructureKHR ShaderResourceCacheVk::Resource::Ge
     return DescrAS;
 }
 
+static VkDeviceAddress GetBufferDescriptorAddress(const BufferVkImpl& BuffVk, DeviceContextVkImpl& Ctx)
+{
+    // Dynamic buffers without a backing buffer are suballocated from the dynamic heap
+    VulkanDynamicMemoryManager& DynamicMemMgr = BuffVk.GetDevice()->GetDynamicMemoryManager();
+    if (BuffVk.GetVkBuffer() == DynamicMemMgr.GetVkBuffer())
+        return DynamicMemMgr.GetVkDeviceAddress() + Ctx.GetDynamicBufferOffset(&BuffVk, /*VerifyAllocation = */ false);
+
+    DEV_CHECK_ERR(BuffVk.GetDesc().Usage != USAGE_SPARSE, "Sparse buffer '", BuffVk.GetDesc().Name, "' can't be used with descriptor buffers");
+    return BuffVk.GetVkDeviceAddress();
+}
+
+void ShaderResourceCacheVk::Resource::WriteDescriptorBufferData(DeviceContextVkImpl&                        Ctx,
+                                                                const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                                                VkSampler                                   vkImmutableSampler,
+                                                                size_t                                      DescriptorSize,
+                                                                void*                                       pDescriptor) const
+{
+    VERIFY(!HasImmutableSampler || vkImmutableSampler != VK_NULL_HANDLE, "Immutable sampler must be provided");
+    DEV_CHECK_ERR(pObject != nullptr || (Type == DescriptorType::Sampler && HasImmutableSampler),
+                  "Unable to write descriptor buffer data: cached object is null");
+
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.pNext = nullptr;
+    GetInfo.type  = DescriptorTypeToVkDescriptorBufferType(Type);
+
+    VkSampler                  vkSampler = VK_NULL_HANDLE;
+    VkDescriptorImageInfo      ImageInfo{};
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType  = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.format = VK_FORMAT_UNDEFINED;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Type)
+    {
+        case DescriptorType::Sampler:
+            vkSampler             = HasImmutableSampler ? vkImmutableSampler : pObject.ConstPtr<SamplerVkImpl>()->GetVkSampler();
+            GetInfo.data.pSampler = &vkSampler;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+            ImageInfo = GetImageDescriptorWriteInfo();
+            // Unlike descriptor sets, descriptor buffers do not take immutable samplers from the set layout
+            if (HasImmutableSampler)
+                ImageInfo.sampler = vkImmutableSampler;
+            GetInfo.data.pCombinedImageSampler = &ImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            ImageInfo                  = GetImageDescriptorWriteInfo();
+            GetInfo.data.pSampledImage = &ImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            ImageInfo                  = GetImageDescriptorWriteInfo();
+            GetInfo.data.pStorageImage = &ImageInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            ImageInfo                          = GetInputAttachmentDescriptorWriteInfo();
+            GetInfo.data.pInputAttachmentImage = &ImageInfo;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        {
+            const BufferVkImpl* pBuffVk = pObject.ConstPtr<BufferVkImpl>();
+
+            AddressInfo.address         = GetBufferDescriptorAddress(*pBuffVk, Ctx) + BufferBaseOffset + BufferDynamicOffset;
+            AddressInfo.range           = BufferRangeSize;
+            GetInfo.data.pUniformBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        {
+            const BufferVkImpl* pBuffVk = pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+            AddressInfo.address         = GetBufferDescriptorAddress(*pBuffVk, Ctx) + BufferBaseOffset + BufferDynamicOffset;
+            AddressInfo.range           = BufferRangeSize;
+            GetInfo.data.pStorageBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+
+            AddressInfo.address = GetBufferDescriptorAddress(*pBuffViewVk->GetBuffer<const BufferVkImpl>(), Ctx) + ViewDesc.ByteOffset;
+            AddressInfo.range   = ViewDesc.ByteWidth;
+            AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+            if (Type == DescriptorType::UniformTexelBuffer)
+                GetInfo.data.pUniformTexelBuffer = &AddressInfo;
+            else
+                GetInfo.data.pStorageTexelBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::AccelerationStructure:
+            GetInfo.data.accelerationStructure = pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return;
+    }
+
+    LogicalDevice.GetDescriptor(GetInfo, DescriptorSize, pDescriptor);
+}
 
 
 Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCtx,
@@ -47,12 +47,14 @@ static VkDeviceSize GetDefaultAlignment(const VulkanUtilities::VulkanPhysicalDev
 VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Allocator,
                                                        RenderDeviceVkImpl& DeviceVk,
                                                        Uint32              Size,
-                                                       Uint64              CommandQueueMask) :
+                                                       Uint64              CommandQueueMask,
+                                                       bool                IsDescriptorBuffer) :
     // clang-format off
-    TBase             {Allocator, Size},
-    m_DeviceVk        {DeviceVk},
-    m_DefaultAlignment{GetDefaultAlignment(DeviceVk.GetPhysicalDevice())},
-    m_CommandQueueMask{CommandQueueMask}
+    TBase               {Allocator, Size},
+    m_DeviceVk          {DeviceVk},
+    m_DefaultAlignment  {GetDefaultAlignment(DeviceVk.GetPhysicalDevice())},
+    m_CommandQueueMask  {CommandQueueMask},
+    m_IsDescriptorBuffer{IsDescriptorBuffer}
 // clang-format on
 {
     VERIFY((Size & (MasterBlockAlignment - 1)) == 0, "Heap size (", Size, " is not aligned by the master block alignment (", Uint32{MasterBlockAlignment}, ")");
@@ -62,19 +64,34 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     VkBuffCI.pNext = nullptr;
     VkBuffCI.flags = 0; // VK_BUFFER_CREATE_SPARSE_BINDING_BIT, VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT, VK_BUFFER_CREATE_SPARSE_ALIASED_BIT
     VkBuffCI.size  = Size;
-    VkBuffCI.usage =
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
-        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-        VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
-        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
-        VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    if (IsDescriptorBuffer)
+    {
+        // A single buffer holds both resource and sampler descriptors
+        VkBuffCI.usage =
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+    else
+    {
+        VkBuffCI.usage =
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+        // With descriptor buffers, dynamic buffers are referenced in descriptors by device address
+        if (DeviceVk.GetLogicalDevice().GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
     VkBuffCI.queueFamilyIndexCount = 0;
     VkBuffCI.pQueueFamilyIndices   = nullptr;
 
     const auto& LogicalDevice    = DeviceVk.GetLogicalDevice();
-    m_VkBuffer                   = LogicalDevice.CreateBuffer(VkBuffCI, "Dynamic heap buffer");
+    m_VkBuffer                   = LogicalDevice.CreateBuffer(VkBuffCI, IsDescriptorBuffer ? "Descriptor buffer" : "Dynamic heap buffer");
     VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VkBuffer);
 
     const auto& PhysicalDevice = DeviceVk.GetPhysicalDevice();
@@ -84,6 +101,14 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     MemAlloc.sType          = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize = MemReqs.size;
 
+    VkMemoryAllocateFlagsInfo MemFlagInfo{};
+    if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        MemFlagInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        MemFlagInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext    = &MemFlagInfo;
+    }
+
     // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
     // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
     // to the host (10.2)
@@ -95,7 +120,7 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
            "corresponding to a VkMemoryType with a propertyFlags that has both the VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT bit "
            "and the VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit set(11.6)");
 
-    m_BufferMemory = LogicalDevice.AllocateDeviceMemory(MemAlloc, "Host-visible memory for upload buffer");
+    m_BufferMemory = LogicalDevice.AllocateDeviceMemory(MemAlloc, IsDescriptorBuffer ? "Host-visible memory for descriptor buffer" : "Host-visible memory for upload buffer");
 
     void* Data = nullptr;
 
@@ -111,7 +136,13 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     err = LogicalDevice.BindBufferMemory(m_VkBuffer, m_BufferMemory, 0 /*offset*/);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
-    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+    if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VkBuffer);
+        VERIFY_EXPR(m_VkDeviceAddress != 0);
+    }
+
+    LOG_INFO_MESSAGE(IsDescriptorBuffer ? "GPU descriptor buffer heap created. Total buffer size: " : "GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
 }
 
 void VulkanDynamicMemoryManager::Destroy()
@@ -122,7 +153,8 @@ void VulkanDynamicMemoryManager::Destroy()
         m_DeviceVk.SafeReleaseDeviceObject(std::move(m_VkBuffer), m_CommandQueueMask);
         m_DeviceVk.SafeReleaseDeviceObject(std::move(m_BufferMemory), m_CommandQueueMask);
     }
-    m_CPUAddress = nullptr;
+    m_CPUAddress      = nullptr;
+    m_VkDeviceAddress = 0;
 }
 
 VulkanDynamicMemoryManager::~VulkanDynamicMemoryManager()
@@ -143,11 +175,15 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
     if (Alignment == 0)
         Alignment = MasterBlockAlignment;
 
+    const char* HeapSizeMemberName = m_IsDescriptorBuffer ?
+        "EngineVkCreateInfo::DescriptorBufferHeapSize" :
+        "EngineVkCreateInfo::DynamicHeapSize";
+
     if (SizeInBytes > GetSize())
     {
         LOG_ERROR("Requested dynamic allocation size ", SizeInBytes,
                   " exceeds maximum dynamic memory size ", GetSize(),
-                  ". The app should increase dynamic heap size.");
+                  ". The app should increase ", HeapSizeMemberName, '.');
         return MasterBlock{};
     }
 
@@ -183,14 +219,14 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
             {
                 LOG_ERROR_MESSAGE("Space in dynamic heap is exhausted! After idling for ",
                                   std::fixed, std::setprecision(1), IdleDuration.count() * 1000.0,
-                                  " ms still no space is available. Increase the size of the heap by setting "
-                                  "EngineVkCreateInfo::DynamicHeapSize to a greater value or optimize dynamic resource usage");
+                                  " ms still no space is available. Increase the size of the heap by setting ",
+                                  HeapSizeMemberName, " to a greater value or optimize dynamic resource usage");
             }
             else
             {
                 LOG_WARNING_MESSAGE("Space in dynamic heap is almost exhausted. Allocation forced idling the GPU. "
-                                    "Increase the size of the heap by setting EngineVkCreateInfo::DynamicHeapSize to a "
-                                    "greater value or optimize dynamic resource usage");
+                                    "Increase the size of the heap by setting ",
+                                    HeapSizeMemberName, " to a greater value or optimize dynamic resource usage");
             }
         }
         else
@@ -198,15 +234,15 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
             if (SleepIterations == 0)
             {
                 LOG_WARNING_MESSAGE("Space in dynamic heap is almost exhausted forcing mid-frame shrinkage. "
-                                    "Increase the size of the heap buffer by setting EngineVkCreateInfo::DynamicHeapSize to a "
-                                    "greater value or optimize dynamic resource usage");
+                                    "Increase the size of the heap buffer by setting ",
+                                    HeapSizeMemberName, " to a greater value or optimize dynamic resource usage");
             }
             else
             {
                 LOG_WARNING_MESSAGE("Space in dynamic heap is almost exhausted. Allocation forced wait time of ",
                                     std::fixed, std::setprecision(1), IdleDuration.count() * 1000.0,
-                                    " ms. Increase the size of the heap by setting EngineVkCreateInfo::DynamicHeapSize "
-                                    "to a greater value or optimize dynamic resource usage");
+                                    " ms. Increase the size of the heap by setting ",
+                                    HeapSizeMemberName, " to a greater value or optimize dynamic resource usage");
             }
         }
     }
@@ -2064,10 +2064,12 @@ DeviceFeaturesVk PhysicalDeviceFeaturesToDeviceFeaturesVk(const VulkanUtilities:
 
     INIT_FEATURE(DynamicRendering, ExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE);
     INIT_FEATURE(HostImageCopy, ExtFeatures.HostImageCopy.hostImageCopy != VK_FALSE);
+    INIT_FEATURE(GraphicsPipelineLibrary, ExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE);
+    INIT_FEATURE(DescriptorBuffer, ExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE && ExtFeatures.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE);
 
 #undef INIT_FEATURE
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 4, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return FeaturesVk;
 }
@@ -610,6 +610,21 @@ VkDeviceAddress VulkanLogicalDevice::GetAccelerationStructureDeviceAddress(VkAcc
 #endif
 }
 
+VkDeviceAddress VulkanLogicalDevice::GetBufferDeviceAddress(VkBuffer vkBuffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR Info = {};
+
+    Info.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    Info.buffer = vkBuffer;
+
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &Info);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return 0;
+#endif
+}
+
 void VulkanLogicalDevice::GetAccelerationStructureBuildSizes(const VkAccelerationStructureBuildGeometryInfoKHR& BuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR& SizeInfo) const
 {
 #if DILIGENT_USE_VOLK
@@ -760,4 +775,37 @@ VkResult VulkanLogicalDevice::GetRayTracingShaderGroupHandles(VkPipeline pipelin
 #endif
 }
 
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout Layout) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, Layout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout Layout, uint32_t Binding) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, Layout, Binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void VulkanLogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& GetInfo, size_t DataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    vkGetDescriptorEXT(m_VkDevice, &GetInfo, DataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
 } // namespace VulkanUtilities
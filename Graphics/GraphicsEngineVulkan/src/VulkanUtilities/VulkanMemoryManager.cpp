@@ -183,19 +183,7 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     size_t stat_ind = HostVisible ? 1 : 0;
     if (Allocation.Page == nullptr)
     {
-        auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
-
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
-
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
+        Allocation = CreatePage(PageIdx, Size).Allocate(Size, Alignment);
         DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
     }
 
@@ -204,12 +192,42 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
         VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
     }
 
+    if (Allocation.Page != nullptr)
+        ++m_PageStats[stat_ind].NumAllocations;
+
     m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
     m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
 
     return Allocation;
 }
 
+VulkanMemoryPage& VulkanMemoryManager::CreatePage(const MemoryPageIndex& PageIdx, VkDeviceSize MinSize)
+{
+    const size_t stat_ind = PageIdx.IsHostVisible ? 1 : 0;
+
+    auto PageSize = PageIdx.IsHostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+    while (PageSize < MinSize)
+        PageSize *= 2;
+
+    m_CurrAllocatedSize[stat_ind] += PageSize;
+    m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+    ++m_PageStats[stat_ind].NumPagesCreated;
+    ++m_PageStats[stat_ind].NumPages;
+
+    auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, PageIdx.MemoryTypeIndex, PageIdx.IsHostVisible, PageIdx.AllocateFlags});
+    LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (PageIdx.IsHostVisible ? "host-visible" : "device-local"),
+                     " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", PageIdx.MemoryTypeIndex,
+                     "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+    OnNewPageCreated(it->second);
+    return it->second;
+}
+
+VulkanMemoryManager::PageStats VulkanMemoryManager::GetPageStats(bool HostVisible) const
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    return m_PageStats[HostVisible ? 1 : 0];
+}
+
 void VulkanMemoryManager::ShrinkMemory()
 {
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
@@ -228,6 +246,7 @@ void VulkanMemoryManager::ShrinkMemory()
         {
             auto PageSize = Page.GetPageSize();
             m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
+            --m_PageStats[IsHostVisible ? 1 : 0].NumPages;
             LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
                              " page (", Diligent::FormatMemorySize(PageSize, 2),
                              "). Current allocated size: ",
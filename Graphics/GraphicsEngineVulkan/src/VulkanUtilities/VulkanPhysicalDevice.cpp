@@ -358,6 +358,36 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.HostImageCopy.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
         }
 
+        // Graphics pipeline library extension requires VK_KHR_pipeline_library.
+        if (IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+            IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.GraphicsPipelineLibrary;
+            NextFeat  = &m_ExtFeatures.GraphicsPipelineLibrary.pNext;
+
+            m_ExtFeatures.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.GraphicsPipelineLibrary;
+            NextProp  = &m_ExtProperties.GraphicsPipelineLibrary.pNext;
+
+            m_ExtProperties.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        }
+
+        // Descriptor buffer extension requires buffer device address.
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) &&
+            IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
         // make sure that last pNext is null
         *NextFeat = nullptr;
         *NextProp = nullptr;
@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BindGroupCacheWebGPU class
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+#include "RenderDeviceWebGPU.h"
+#include "WebGPUObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+// Device-wide LRU cache of bind groups keyed by the bind group layout and the
+// WebGPU objects referenced by the bind group entries.
+//
+// A cached bind group keeps the objects it references alive, so the cache must be notified
+// when a buffer, a texture view, a sampler or a bind group layout is destroyed to release
+// the bind groups that use it (see OnDestroyObject()). Otherwise, a new object created at
+// the same address would match the stale bind groups.
+class BindGroupCacheWebGPU
+{
+public:
+    BindGroupCacheWebGPU(WGPUDevice wgpuDevice, Uint32 MaxSize);
+
+    // clang-format off
+    BindGroupCacheWebGPU           (const BindGroupCacheWebGPU&)  = delete;
+    BindGroupCacheWebGPU           (      BindGroupCacheWebGPU&&) = delete;
+    BindGroupCacheWebGPU& operator=(const BindGroupCacheWebGPU&)  = delete;
+    BindGroupCacheWebGPU& operator=(      BindGroupCacheWebGPU&&) = delete;
+    // clang-format on
+
+    ~BindGroupCacheWebGPU();
+
+    // Returns the bind group for the given layout and entries, creating it if necessary.
+    // The returned wrapper holds its own reference to the bind group, so the bind group
+    // remains valid after it is evicted from the cache.
+    // Entries with chained structures can't be compared and are never cached.
+    WebGPUBindGroupWrapper GetBindGroup(WGPUBindGroupLayout       wgpuLayout,
+                                        const WGPUBindGroupEntry* pEntries,
+                                        Uint32                    NumEntries);
+
+    // Releases all bind groups that reference the given buffer, texture view, sampler or bind group layout.
+    void OnDestroyObject(const void* wgpuObject);
+
+    void Clear();
+
+    BindGroupCacheStatsWebGPU GetStatistics() const;
+
+private:
+    struct Key
+    {
+        WGPUBindGroupLayout             wgpuLayout = nullptr;
+        std::vector<WGPUBindGroupEntry> Entries;
+        size_t                          Hash = 0;
+
+        bool operator==(const Key& Rhs) const;
+
+        struct Hasher
+        {
+            size_t operator()(const Key& K) const
+            {
+                return K.Hash;
+            }
+        };
+    };
+
+    struct CacheEntry
+    {
+        WebGPUBindGroupWrapper          wgpuBindGroup;
+        std::list<const Key*>::iterator LRUIt;
+    };
+    using CacheMapType = std::unordered_map<Key, CacheEntry, Key::Hasher>;
+
+    void RemoveEntry(CacheMapType::iterator It);
+
+    // Calls the handler for the layout and every buffer, sampler and texture view of the key
+    template <typename HandlerType>
+    static void ProcessKeyObjects(const Key& K, HandlerType&& Handler);
+
+private:
+    const WGPUDevice m_wgpuDevice;
+    const Uint32     m_MaxSize;
+
+    mutable std::mutex m_Mtx;
+
+    CacheMapType m_Cache;
+
+    // Most recently used entries are at the front
+    std::list<const Key*> m_LRU;
+
+    // WebGPU object -> keys of the bind groups that reference it
+    std::unordered_multimap<const void*, const Key*> m_ObjectToKeys;
+
+    // Reused by GetBindGroup() to look up the cache; protected by m_Mtx
+    Key m_ScratchKey;
+
+    BindGroupCacheStatsWebGPU m_Stats;
+};
+
+} // namespace Diligent
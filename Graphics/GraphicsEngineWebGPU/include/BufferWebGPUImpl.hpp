@@ -65,6 +65,8 @@ public:
                      WGPUBuffer                 wgpuBuffer,
                      bool                       bIsDeviceInternal);
 
+    ~BufferWebGPUImpl();
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BufferWebGPU, TBufferBase)
 
     /// Implementation of IBuffer::GetNativeHandle().
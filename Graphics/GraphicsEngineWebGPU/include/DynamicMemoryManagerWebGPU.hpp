@@ -33,14 +33,18 @@
 #include <vector>
 
 #include "WebGPUObjectWrappers.hpp"
+#include "MappedStagingBufferWebGPU.hpp"
 #include "BasicTypes.h"
 
 namespace Diligent
 {
 
 // Dynamic memory manager provides dynamic memory allocations for dynamic buffers.
-// The data is copied to the CPU memory and is flushed to the GPU memory before the
-// command list is submitted to the queue.
+// Every page that is in use is backed by a mapped staging buffer the data is written to.
+// Before the command list is submitted to the queue, the staging buffer is unmapped and
+// its contents are copied to the page's region of the dynamic buffer with a single
+// copy command. The staging buffer is then mapped again asynchronously and is reused
+// by another page once the mapping completes.
 
 class DynamicMemoryManagerWebGPU
 {
@@ -77,13 +81,21 @@ public:
 
         Allocation Allocate(size_t Size, size_t Alignment = 16);
 
-        void FlushWrites(WGPUQueue wgpuQueue);
+        // Unmaps the staging buffer and records the copy to the dynamic buffer.
+        // Must be called before the command buffer that uses the page is submitted.
+        void FlushWrites(WGPUCommandEncoder wgpuCmdEncoder);
+
+        // Requests the staging buffer to be mapped again and returns the page to the manager.
+        // Must be called after the command buffer with the copy command is submitted.
         void Recycle();
 
         size_t GetSize() const { return m_Size; }
 
     private:
+        friend DynamicMemoryManagerWebGPU;
+
         DynamicMemoryManagerWebGPU* m_pMgr = nullptr;
+        MappedStagingBufferWebGPU   m_StagingBuffer;
 
         size_t m_Size       = 0;
         size_t m_CurrOffset = 0;
@@ -105,15 +117,20 @@ public:
 private:
     void RecyclePage(Page&& page);
 
+    MappedStagingBufferWebGPU GetStagingBuffer(size_t Size);
+
 private:
     const size_t        m_PageSize;
     const size_t        m_BufferSize;
     size_t              m_CurrentOffset = 0;
+    WGPUDevice          m_wgpuDevice;
     WebGPUBufferWrapper m_wgpuBuffer;
 
-    std::mutex         m_AvailablePagesMtx;
-    std::vector<Page>  m_AvailablePages;
-    std::vector<Uint8> m_MappedData;
+    std::mutex        m_AvailablePagesMtx;
+    std::vector<Page> m_AvailablePages;
+
+    // Staging buffers that are either mapped or have a pending map request
+    std::vector<MappedStagingBufferWebGPU> m_StagingBuffers;
 };
 
 } // namespace Diligent
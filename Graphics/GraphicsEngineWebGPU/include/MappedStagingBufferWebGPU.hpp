@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::MappedStagingBufferWebGPU class
+
+#include "WebGPUObjectWrappers.hpp"
+#include "SyncPointWebGPU.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+// A MapWrite | CopySrc buffer that the CPU writes to directly while the buffer is mapped and
+// that the GPU uses as a copy source.
+//
+//  - The buffer is created mapped and can be written to right away.
+//  - Unmap() must be called before the command buffer that reads from the buffer is submitted.
+//  - MapAsync() must be called after the command buffer is submitted. The sync point is
+//    triggered when the mapping completes, which happens after the GPU is done with the buffer.
+//  - Once the sync point is triggered, GetMappedData() returns the new mapped pointer.
+class MappedStagingBufferWebGPU
+{
+public:
+    MappedStagingBufferWebGPU() noexcept = default;
+    MappedStagingBufferWebGPU(WGPUDevice wgpuDevice, size_t Size, const char* Name);
+
+    MappedStagingBufferWebGPU(const MappedStagingBufferWebGPU&) = delete;
+    MappedStagingBufferWebGPU& operator=(const MappedStagingBufferWebGPU&) = delete;
+
+    MappedStagingBufferWebGPU(MappedStagingBufferWebGPU&& RHS) noexcept;
+    MappedStagingBufferWebGPU& operator=(MappedStagingBufferWebGPU&& RHS) noexcept;
+
+    explicit operator bool() const { return m_wgpuBuffer != nullptr; }
+
+    // Returns the pointer to the mapped memory, or null if the buffer is not mapped.
+    Uint8* GetMappedData();
+
+    // Returns true if the buffer is mapped and can be written to.
+    bool IsMapped() { return GetMappedData() != nullptr; }
+
+    // Returns true if an asynchronous map request has not completed yet.
+    bool IsMapPending() const { return m_pMapSyncPoint && !m_pMapSyncPoint->IsTriggered(); }
+
+    void Unmap();
+    void MapAsync();
+
+    WGPUBuffer GetWGPUBuffer() const { return m_wgpuBuffer.Get(); }
+    size_t     GetSize() const { return m_Size; }
+
+private:
+    WebGPUBufferWrapper                m_wgpuBuffer;
+    RefCntAutoPtr<SyncPointWebGPUImpl> m_pMapSyncPoint;
+    Uint8*                             m_pMappedData = nullptr;
+    size_t                             m_Size        = 0;
+};
+
+} // namespace Diligent
@@ -39,6 +39,7 @@
 #include "UploadMemoryManagerWebGPU.hpp"
 #include "DynamicMemoryManagerWebGPU.hpp"
 #include "GenerateMipsHelperWebGPU.hpp"
+#include "BindGroupCacheWebGPU.hpp"
 
 namespace Diligent
 {
@@ -175,6 +176,9 @@ public:
                                                          RESOURCE_STATE    InitialState,
                                                          IBuffer**         ppBuffer) override final;
 
+    /// Implementation of IRenderDeviceWebGPU::GetBindGroupCacheStats() in WebGPU backend.
+    void DILIGENT_CALL_TYPE GetBindGroupCacheStats(BindGroupCacheStatsWebGPU& Stats) const override final;
+
 public:
     void CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
                                          IPipelineResourceSignature**         ppSignature,
@@ -220,6 +224,11 @@ public:
         return *m_pDynamicMemoryManager;
     }
 
+    BindGroupCacheWebGPU& GetBindGroupCache() const
+    {
+        return *m_pBindGroupCache;
+    }
+
     void DeviceTick();
 
 private:
@@ -235,6 +244,7 @@ private:
 
     std::unique_ptr<UploadMemoryManagerWebGPU>  m_pUploadMemoryManager;
     std::unique_ptr<DynamicMemoryManagerWebGPU> m_pDynamicMemoryManager;
+    std::unique_ptr<BindGroupCacheWebGPU>       m_pBindGroupCache;
 
     std::unique_ptr<AttachmentCleanerWebGPU>  m_pAttachmentCleaner;
     std::unique_ptr<GenerateMipsHelperWebGPU> m_pMipsGenerator;
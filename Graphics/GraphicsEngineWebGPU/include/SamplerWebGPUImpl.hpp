@@ -49,6 +49,8 @@ public:
     // Special constructor for serialization
     SamplerWebGPUImpl(IReferenceCounters* pRefCounters, const SamplerDesc& SamplerDesc) noexcept;
 
+    ~SamplerWebGPUImpl();
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_SamplerWebGPU, TSamplerBase)
 
     /// Implementation of ISamplerWebGPU::GetWebGPUSampler().
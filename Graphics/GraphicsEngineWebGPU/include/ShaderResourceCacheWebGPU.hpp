@@ -43,6 +43,7 @@ namespace Diligent
 
 struct IMemoryAllocator;
 class DeviceContextWebGPUImpl;
+class BindGroupCacheWebGPU;
 
 class ShaderResourceCacheWebGPU : public ShaderResourceCacheBase
 {
@@ -178,7 +179,9 @@ public:
 
     ResourceCacheContentType GetContentType() const { return static_cast<ResourceCacheContentType>(m_ContentType); }
 
-    WGPUBindGroup UpdateBindGroup(WGPUDevice wgpuDevice, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout);
+    // Returns the bind group for the given group index. If any resource in the group has changed,
+    // the bind group is requested from the device-wide bind group cache.
+    WGPUBindGroup UpdateBindGroup(BindGroupCacheWebGPU& BindGroupCache, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout);
 
     // Returns true if any dynamic offset has changed
     bool GetDynamicBufferOffsets(const DeviceContextWebGPUImpl* pCtx,
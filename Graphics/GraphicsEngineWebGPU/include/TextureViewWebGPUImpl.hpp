@@ -54,6 +54,8 @@ public:
                           bool                                    bIsDefaultView,
                           bool                                    bIsDeviceInternal);
 
+    ~TextureViewWebGPUImpl();
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_TextureViewWebGPU, TTextureViewBase)
 
     /// Implementation of ITextureViewWebGPU::GetWebGPUTextureView() in WebGPU backend.
@@ -34,6 +34,7 @@
 #include <atomic>
 
 #include "WebGPUObjectWrappers.hpp"
+#include "MappedStagingBufferWebGPU.hpp"
 #include "BasicTypes.h"
 
 namespace Diligent
@@ -44,8 +45,9 @@ namespace Diligent
 // - UpdateTexture
 // - MapTextureSubresource
 //
-// The data is first written to the upload memory and the copy command is added to the command list.
-// Upload data is flushed to the GPU memory before the command list is submitted to the queue.
+// Every page is a mapped staging buffer, so the data is written directly to the memory the GPU copies from,
+// and the copy command is added to the command list. The page is unmapped before the command list is submitted
+// to the queue and is mapped again asynchronously after that. The page is reused once the mapping completes.
 class UploadMemoryManagerWebGPU
 {
 public:
@@ -78,18 +80,24 @@ public:
 
         Allocation Allocate(size_t Size, size_t Alignment = 16);
 
-        void FlushWrites(WGPUQueue wgpuQueue);
+        // Unmaps the page. Must be called before the command buffer that uses the page is submitted.
+        // All allocations from the page must no longer be written to by the time this method is called.
+        void FlushWrites();
+
+        // Requests the page to be mapped again and returns it to the manager.
+        // Must be called after the command buffer that uses the page is submitted.
         void Recycle();
 
         size_t GetSize() const
         {
-            return m_Data.size();
+            return m_StagingBuffer.GetSize();
         }
 
     private:
+        friend UploadMemoryManagerWebGPU;
+
         UploadMemoryManagerWebGPU* m_pMgr = nullptr;
-        WebGPUBufferWrapper        m_wgpuBuffer;
-        std::vector<Uint8>         m_Data;
+        MappedStagingBufferWebGPU  m_StagingBuffer;
         size_t                     m_CurrOffset = 0;
     };
 
@@ -35,6 +35,34 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceWebGPU =
     {0xBB1F1488, 0xC10D, 0x493F, {0x81, 0x39, 0x3B, 0x90, 0x10, 0x59, 0x8B, 0x16}};
 
+/// Statistics of the bind group cache of a WebGPU device.
+
+/// When the resources of a shader resource binding change, the device looks up the bind group
+/// with the same layout and resources in the cache before creating a new one,
+/// see EngineWebGPUCreateInfo::BindGroupCacheSize.
+struct BindGroupCacheStatsWebGPU
+{
+    /// The number of bind group requests that were served from the cache.
+    Uint64 Hits DEFAULT_INITIALIZER(0);
+
+    /// The number of bind group requests that required creating a new bind group.
+    Uint64 Misses DEFAULT_INITIALIZER(0);
+
+    /// The number of least recently used bind groups removed from the cache because it was full.
+    Uint64 Evictions DEFAULT_INITIALIZER(0);
+
+    /// The number of bind groups removed from the cache because a buffer, a texture view,
+    /// a sampler or a bind group layout they use was destroyed.
+    Uint64 Invalidations DEFAULT_INITIALIZER(0);
+
+    /// The number of bind groups currently in the cache.
+    Uint32 NumEntries DEFAULT_INITIALIZER(0);
+
+    /// The maximum number of bind groups in the cache.
+    Uint32 MaxEntries DEFAULT_INITIALIZER(0);
+};
+typedef struct BindGroupCacheStatsWebGPU BindGroupCacheStatsWebGPU;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceWebGPU
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -95,6 +123,10 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceWebGPU, IRenderDevice)
                                                       const BufferDesc REF BuffDesc,
                                                       RESOURCE_STATE       InitialState,
                                                       IBuffer**            ppBuffer) PURE;
+
+    /// Returns the statistics of the bind group cache, see Diligent::BindGroupCacheStatsWebGPU.
+    VIRTUAL void METHOD(GetBindGroupCacheStats)(THIS_
+                                                BindGroupCacheStatsWebGPU REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -109,6 +141,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceWebGPU_GetWebGPUDevice(This)                      CALL_IFACE_METHOD(RenderDeviceWebGPU, GetWebGPUDevice,                This)
 #    define IRenderDeviceWebGPU_CreateTextureFromWebGPUTexture(This, ...)  CALL_IFACE_METHOD(RenderDeviceWebGPU, CreateTextureFromWebGPUTexture, This, __VA_ARGS__)
 #    define IRenderDeviceWebGPU_CreateBufferFromWebGPUBuffer(This, ...)    CALL_IFACE_METHOD(RenderDeviceWebGPU, CreateBufferFromWebGPUBuffer,   This, __VA_ARGS__)
+#    define IRenderDeviceWebGPU_GetBindGroupCacheStats(This, ...)          CALL_IFACE_METHOD(RenderDeviceWebGPU, GetBindGroupCacheStats,         This, __VA_ARGS__)
 
 // clang-format on
 
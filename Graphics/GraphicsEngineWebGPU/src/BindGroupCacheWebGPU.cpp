@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "BindGroupCacheWebGPU.hpp"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+template <typename HandlerType>
+void BindGroupCacheWebGPU::ProcessKeyObjects(const Key& K, HandlerType&& Handler)
+{
+    Handler(static_cast<const void*>(K.wgpuLayout));
+    for (const WGPUBindGroupEntry& Entry : K.Entries)
+    {
+        if (Entry.buffer != nullptr)
+            Handler(static_cast<const void*>(Entry.buffer));
+        if (Entry.sampler != nullptr)
+            Handler(static_cast<const void*>(Entry.sampler));
+        if (Entry.textureView != nullptr)
+            Handler(static_cast<const void*>(Entry.textureView));
+    }
+}
+
+bool BindGroupCacheWebGPU::Key::operator==(const Key& Rhs) const
+{
+    if (Hash != Rhs.Hash || wgpuLayout != Rhs.wgpuLayout || Entries.size() != Rhs.Entries.size())
+        return false;
+
+    for (size_t i = 0; i < Entries.size(); ++i)
+    {
+        const WGPUBindGroupEntry& L = Entries[i];
+        const WGPUBindGroupEntry& R = Rhs.Entries[i];
+        // clang-format off
+        if (L.nextInChain != R.nextInChain ||
+            L.binding     != R.binding     ||
+            L.buffer      != R.buffer      ||
+            L.offset      != R.offset      ||
+            L.size        != R.size        ||
+            L.sampler     != R.sampler     ||
+            L.textureView != R.textureView)
+            return false;
+        // clang-format on
+    }
+
+    return true;
+}
+
+BindGroupCacheWebGPU::BindGroupCacheWebGPU(WGPUDevice wgpuDevice, Uint32 MaxSize) :
+    m_wgpuDevice{wgpuDevice},
+    m_MaxSize{MaxSize}
+{
+}
+
+BindGroupCacheWebGPU::~BindGroupCacheWebGPU()
+{
+    LOG_INFO_MESSAGE("Bind group cache stats: hits: ", m_Stats.Hits, "; misses: ", m_Stats.Misses,
+                     "; evictions: ", m_Stats.Evictions, "; invalidations: ", m_Stats.Invalidations);
+}
+
+WebGPUBindGroupWrapper BindGroupCacheWebGPU::GetBindGroup(WGPUBindGroupLayout       wgpuLayout,
+                                                          const WGPUBindGroupEntry* pEntries,
+                                                          Uint32                    NumEntries)
+{
+    WGPUBindGroupDescriptor wgpuBindGroupDesc{};
+    wgpuBindGroupDesc.layout     = wgpuLayout;
+    wgpuBindGroupDesc.entryCount = NumEntries;
+    wgpuBindGroupDesc.entries    = pEntries;
+
+    // Chained structures (e.g. external textures) are only referenced by pointers,
+    // so there is no way to tell whether two entries that use them are the same.
+    const bool HasChainedEntries = std::any_of(pEntries, pEntries + NumEntries,
+                                               [](const WGPUBindGroupEntry& Entry) { return Entry.nextInChain != nullptr; });
+    if (m_MaxSize == 0 || HasChainedEntries)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        ++m_Stats.Misses;
+        return WebGPUBindGroupWrapper{wgpuDeviceCreateBindGroup(m_wgpuDevice, &wgpuBindGroupDesc)};
+    }
+
+    size_t Hash = ComputeHash(wgpuLayout, NumEntries);
+    for (Uint32 i = 0; i < NumEntries; ++i)
+    {
+        const WGPUBindGroupEntry& Entry = pEntries[i];
+        HashCombine(Hash, Entry.binding, Entry.buffer, Entry.offset, Entry.size, Entry.sampler, Entry.textureView);
+    }
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    // The scratch key keeps its capacity, so looking up an existing bind group does not allocate
+    m_ScratchKey.wgpuLayout = wgpuLayout;
+    m_ScratchKey.Entries.assign(pEntries, pEntries + NumEntries);
+    m_ScratchKey.Hash = Hash;
+
+    auto It = m_Cache.find(m_ScratchKey);
+    if (It != m_Cache.end())
+    {
+        ++m_Stats.Hits;
+        // Move the entry to the front of the LRU list
+        m_LRU.splice(m_LRU.begin(), m_LRU, It->second.LRUIt);
+    }
+    else
+    {
+        ++m_Stats.Misses;
+
+        WebGPUBindGroupWrapper wgpuBindGroup{wgpuDeviceCreateBindGroup(m_wgpuDevice, &wgpuBindGroupDesc)};
+        if (!wgpuBindGroup)
+        {
+            LOG_ERROR_MESSAGE("Failed to create WebGPU bind group");
+            return {};
+        }
+
+        if (m_Cache.size() >= m_MaxSize)
+        {
+            VERIFY_EXPR(!m_LRU.empty());
+            RemoveEntry(m_Cache.find(*m_LRU.back()));
+            ++m_Stats.Evictions;
+        }
+
+        It = m_Cache.emplace(m_ScratchKey, CacheEntry{std::move(wgpuBindGroup), {}}).first;
+
+        // Pointers to the elements of an unordered_map remain valid when the map is rehashed
+        const Key* pKey  = &It->first;
+        It->second.LRUIt = m_LRU.insert(m_LRU.begin(), pKey);
+        ProcessKeyObjects(*pKey, [&](const void* wgpuObject) {
+            m_ObjectToKeys.emplace(wgpuObject, pKey);
+        });
+    }
+
+    WGPUBindGroup wgpuBindGroup = It->second.wgpuBindGroup;
+    wgpuBindGroupAddRef(wgpuBindGroup);
+    return WebGPUBindGroupWrapper{wgpuBindGroup};
+}
+
+void BindGroupCacheWebGPU::RemoveEntry(CacheMapType::iterator It)
+{
+    VERIFY_EXPR(It != m_Cache.end());
+    const Key* pKey = &It->first;
+    ProcessKeyObjects(*pKey, [&](const void* wgpuObject) {
+        auto Range = m_ObjectToKeys.equal_range(wgpuObject);
+        for (auto ObjIt = Range.first; ObjIt != Range.second; ++ObjIt)
+        {
+            if (ObjIt->second == pKey)
+            {
+                m_ObjectToKeys.erase(ObjIt);
+                break;
+            }
+        }
+    });
+    m_LRU.erase(It->second.LRUIt);
+    m_Cache.erase(It);
+}
+
+void BindGroupCacheWebGPU::OnDestroyObject(const void* wgpuObject)
+{
+    if (wgpuObject == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    // Removing an entry modifies m_ObjectToKeys, so look up the next key every time
+    for (auto ObjIt = m_ObjectToKeys.find(wgpuObject); ObjIt != m_ObjectToKeys.end(); ObjIt = m_ObjectToKeys.find(wgpuObject))
+    {
+        RemoveEntry(m_Cache.find(*ObjIt->second));
+        ++m_Stats.Invalidations;
+    }
+}
+
+void BindGroupCacheWebGPU::Clear()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_ObjectToKeys.clear();
+    m_LRU.clear();
+    m_Cache.clear();
+}
+
+BindGroupCacheStatsWebGPU BindGroupCacheWebGPU::GetStatistics() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    BindGroupCacheStatsWebGPU   Stats = m_Stats;
+    Stats.NumEntries                  = static_cast<Uint32>(m_Cache.size());
+    Stats.MaxEntries                  = m_MaxSize;
+    return Stats;
+}
+
+} // namespace Diligent
@@ -165,6 +165,13 @@ BufferWebGPUImpl::BufferWebGPUImpl(IReferenceCounters*        pRefCounters,
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
 }
 
+BufferWebGPUImpl::~BufferWebGPUImpl()
+{
+    // Release cached bind groups that reference the buffer
+    if (m_wgpuBuffer)
+        GetDevice()->GetBindGroupCache().OnDestroyObject(m_wgpuBuffer.Get());
+}
+
 Uint64 BufferWebGPUImpl::GetNativeHandle()
 {
     return BitCast<Uint64>(GetWebGPUBuffer());
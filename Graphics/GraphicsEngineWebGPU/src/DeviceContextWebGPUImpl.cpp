@@ -184,7 +184,7 @@ void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*
     ResourceCache.DbgVerifyDynamicBuffersCounter();
 #endif
 
-    const WGPUDevice wgpuDevice = m_pDevice->GetWebGPUDevice();
+    BindGroupCacheWebGPU& BindGroupCache = m_pDevice->GetBindGroupCache();
 
     const Uint32                         SRBIndex   = pResBindingWebGPU->GetBindingIndex();
     PipelineResourceSignatureWebGPUImpl* pSignature = pResBindingWebGPU->GetSignature();
@@ -197,7 +197,7 @@ void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*
         WebGPUResourceBindInfo::BindGroupInfo& BindGroup = m_BindInfo.BindGroups[SRBIndex][BindGroupId];
         if (pSignature->HasBindGroup(BindGroupId))
         {
-            BindGroup.wgpuBindGroup = ResourceCache.UpdateBindGroup(wgpuDevice, BGIndex, pSignature->GetWGPUBindGroupLayout(BindGroupId));
+            BindGroup.wgpuBindGroup = ResourceCache.UpdateBindGroup(BindGroupCache, BGIndex, pSignature->GetWGPUBindGroupLayout(BindGroupId));
             ++BGIndex;
         }
         else
@@ -755,6 +755,13 @@ void DeviceContextWebGPUImpl::MapBuffer(IBuffer*  pBuffer,
                     return;
                 }
 
+                if (DynAllocation.pData == nullptr)
+                {
+                    LOG_ERROR("Dynamic buffer '", BuffDesc.Name, "' cannot be mapped with MAP_FLAG_NO_OVERWRITE flag after the context has been flushed "
+                                                                 "because the staging memory of the previous allocation is no longer mapped. Map the buffer with MAP_FLAG_DISCARD flag first.");
+                    return;
+                }
+
                 pMappedData = DynAllocation.pData;
             }
         }
@@ -1460,21 +1467,29 @@ void DeviceContextWebGPUImpl::Flush()
     }
     m_PendingStagingWrites.clear();
 
-    for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+    // Dynamic memory copies are recorded into a separate command buffer that is submitted
+    // before the main one, so that the data is in place before any command reads it.
+    WebGPUCommandBufferWrapper wgpuUploadCmdBuffer;
+    if (!m_DynamicMemPages.empty())
     {
-        MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
+        WGPUCommandEncoderDescriptor wgpuCmdEncoderDesc{};
+        WebGPUCommandEncoderWrapper  wgpuUploadCmdEncoder{wgpuDeviceCreateCommandEncoder(m_pDevice->GetWebGPUDevice(), &wgpuCmdEncoderDesc)};
+        DEV_CHECK_ERR(wgpuUploadCmdEncoder != nullptr, "Failed to create dynamic memory upload command encoder");
+
+        for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+            MemPage.FlushWrites(wgpuUploadCmdEncoder);
+
+        WGPUCommandBufferDescriptor wgpuCmdBufferDesc{};
+        wgpuUploadCmdBuffer.Reset(wgpuCommandEncoderFinish(wgpuUploadCmdEncoder, &wgpuCmdBufferDesc));
+        DEV_CHECK_ERR(wgpuUploadCmdBuffer != nullptr, "Failed to finish dynamic memory upload command encoder");
     }
-    m_DynamicMemPages.clear();
 
+    // Upload pages are unmapped below, so the memory of a texture that is still mapped would become invalid
+    DEV_CHECK_ERR(m_MappedTextures.empty(), "There are mapped textures in the device context when flushing the context. All dynamic textures must be unmapped before Flush() is called.");
     for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
-    {
-        MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
-    }
-    m_UploadMemPages.clear();
+        MemPage.FlushWrites();
 
-    if (m_wgpuCommandEncoder || !m_SignaledFences.empty())
+    if (m_wgpuCommandEncoder || !m_SignaledFences.empty() || wgpuUploadCmdBuffer)
     {
         auto WorkDoneCallback = [](WGPUQueueWorkDoneStatus Status, void* pUserData) {
             VERIFY_EXPR(pUserData != nullptr);
@@ -1502,7 +1517,13 @@ void DeviceContextWebGPUImpl::Flush()
         WebGPUCommandBufferWrapper  wgpuCmdBuffer{wgpuCommandEncoderFinish(GetCommandEncoder(), &wgpuCmdBufferDesc)};
         DEV_CHECK_ERR(wgpuCmdBuffer != nullptr, "Failed to finish command encoder");
 
-        wgpuQueueSubmit(m_wgpuQueue, 1, &wgpuCmdBuffer.Get());
+        WGPUCommandBuffer wgpuCmdBuffers[2] = {};
+        size_t            NumCmdBuffers     = 0;
+        if (wgpuUploadCmdBuffer)
+            wgpuCmdBuffers[NumCmdBuffers++] = wgpuUploadCmdBuffer;
+        wgpuCmdBuffers[NumCmdBuffers++] = wgpuCmdBuffer;
+
+        wgpuQueueSubmit(m_wgpuQueue, NumCmdBuffers, wgpuCmdBuffers);
         wgpuQueueOnSubmittedWorkDone(m_wgpuQueue, WorkDoneCallback, pWorkDoneSyncPoint.Detach());
         m_wgpuCommandEncoder.Reset(nullptr);
 
@@ -1513,6 +1534,20 @@ void DeviceContextWebGPUImpl::Flush()
         m_PendingStagingReads.clear();
     }
 
+    // Staging memory can only be mapped again after the command buffers that read it have been submitted
+    for (DynamicMemoryManagerWebGPU::Page& MemPage : m_DynamicMemPages)
+        MemPage.Recycle();
+    m_DynamicMemPages.clear();
+
+    for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
+        MemPage.Recycle();
+    m_UploadMemPages.clear();
+
+    // The memory of the dynamic allocations is not mapped anymore. The allocations themselves
+    // remain valid until the end of the frame as the data is now in the dynamic buffer.
+    for (MappedBuffer& MappedBuff : m_MappedBuffers)
+        MappedBuff.Allocation.pData = nullptr;
+
     // Without DeviceTick(), the work done callback is never called
     m_pDevice->DeviceTick();
 }
@@ -44,12 +44,16 @@ DynamicMemoryManagerWebGPU::Page::Page(DynamicMemoryManagerWebGPU* _pMgr, size_t
 DynamicMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     //clang-format off
     m_pMgr{RHS.m_pMgr},
+    m_StagingBuffer{std::move(RHS.m_StagingBuffer)},
     m_Size{RHS.m_Size},
     m_CurrOffset{RHS.m_CurrOffset},
     m_BufferOffset{RHS.m_BufferOffset}
 // clang-format on
 {
-    RHS = Page{};
+    RHS.m_pMgr         = nullptr;
+    RHS.m_Size         = 0;
+    RHS.m_CurrOffset   = 0;
+    RHS.m_BufferOffset = 0;
 }
 
 DynamicMemoryManagerWebGPU::Page& DynamicMemoryManagerWebGPU::Page::operator=(Page&& RHS) noexcept
@@ -57,10 +61,11 @@ DynamicMemoryManagerWebGPU::Page& DynamicMemoryManagerWebGPU::Page::operator=(Pa
     if (&RHS == this)
         return *this;
 
-    m_pMgr         = RHS.m_pMgr;
-    m_Size         = RHS.m_Size;
-    m_CurrOffset   = RHS.m_CurrOffset;
-    m_BufferOffset = RHS.m_BufferOffset;
+    m_pMgr          = RHS.m_pMgr;
+    m_StagingBuffer = std::move(RHS.m_StagingBuffer);
+    m_Size          = RHS.m_Size;
+    m_CurrOffset    = RHS.m_CurrOffset;
+    m_BufferOffset  = RHS.m_BufferOffset;
 
     RHS.m_pMgr         = nullptr;
     RHS.m_Size         = 0;
@@ -79,15 +84,15 @@ DynamicMemoryManagerWebGPU::Allocation DynamicMemoryManagerWebGPU::Page::Allocat
 {
     VERIFY(IsPowerOfTwo(Alignment), "Alignment size must be a power of two");
 
-    size_t Offset    = AlignUp(m_CurrOffset, Alignment);
-    size_t AllocSize = AlignUp(Size, Alignment);
-    if (Offset + AllocSize <= m_Size)
+    size_t Offset      = AlignUp(m_CurrOffset, Alignment);
+    size_t AllocSize   = AlignUp(Size, Alignment);
+    Uint8* pMappedData = m_StagingBuffer.GetMappedData();
+    if (pMappedData != nullptr && Offset + AllocSize <= m_Size)
     {
-        size_t     MemoryOffset = m_BufferOffset + Offset;
         Allocation Alloc;
         Alloc.wgpuBuffer = m_pMgr->m_wgpuBuffer;
-        Alloc.pData      = &m_pMgr->m_MappedData[MemoryOffset];
-        Alloc.Offset     = MemoryOffset;
+        Alloc.pData      = pMappedData + Offset;
+        Alloc.Offset     = m_BufferOffset + Offset;
         Alloc.Size       = AllocSize;
 
         m_CurrOffset = Offset + AllocSize;
@@ -96,12 +101,17 @@ DynamicMemoryManagerWebGPU::Allocation DynamicMemoryManagerWebGPU::Page::Allocat
     return Allocation{};
 }
 
-void DynamicMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
+void DynamicMemoryManagerWebGPU::Page::FlushWrites(WGPUCommandEncoder wgpuCmdEncoder)
 {
     if (m_CurrOffset > 0)
     {
         VERIFY_EXPR(m_pMgr != nullptr);
-        wgpuQueueWriteBuffer(wgpuQueue, m_pMgr->m_wgpuBuffer, m_BufferOffset, &m_pMgr->m_MappedData[m_BufferOffset], m_CurrOffset);
+        // Copy size must be a multiple of 4
+        const size_t CopySize = AlignUp(m_CurrOffset, size_t{4});
+        VERIFY_EXPR(CopySize <= m_Size);
+
+        m_StagingBuffer.Unmap();
+        wgpuCommandEncoderCopyBufferToBuffer(wgpuCmdEncoder, m_StagingBuffer.GetWGPUBuffer(), 0, m_pMgr->m_wgpuBuffer, m_BufferOffset, CopySize);
     }
 }
 
@@ -112,14 +122,21 @@ void DynamicMemoryManagerWebGPU::Page::Recycle()
         UNEXPECTED("The page is empty.");
         return;
     }
-    m_CurrOffset = 0;
+
+    // Staging buffers that have not been written to remain mapped and are reused as is
+    if (m_CurrOffset > 0)
+    {
+        m_StagingBuffer.MapAsync();
+        m_CurrOffset = 0;
+    }
     m_pMgr->RecyclePage(std::move(*this));
 }
 
 DynamicMemoryManagerWebGPU::DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, size_t BufferSize) :
     m_PageSize{PageSize},
     m_BufferSize{BufferSize},
-    m_CurrentOffset{0}
+    m_CurrentOffset{0},
+    m_wgpuDevice{wgpuDevice}
 {
     WGPUBufferDescriptor wgpuBufferDesc{};
     wgpuBufferDesc.label = GetWGPUStringView("Dynamic buffer");
@@ -133,7 +150,6 @@ DynamicMemoryManagerWebGPU::DynamicMemoryManagerWebGPU(WGPUDevice wgpuDevice, si
         WGPUBufferUsage_Index |
         WGPUBufferUsage_Indirect;
     m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(wgpuDevice, &wgpuBufferDesc));
-    m_MappedData.resize(BufferSize);
 
     LOG_INFO_MESSAGE("Created dynamic buffer: ", BufferSize >> 10, " KB");
 }
@@ -160,7 +176,8 @@ DynamicMemoryManagerWebGPU::Page DynamicMemoryManagerWebGPU::GetPage(size_t Size
     {
         if (PageSize <= Iter->GetSize())
         {
-            auto Result = std::move(*Iter);
+            auto Result            = std::move(*Iter);
+            Result.m_StagingBuffer = GetStagingBuffer(Result.GetSize());
             m_AvailablePages.erase(Iter);
             return Result;
         }
@@ -176,12 +193,47 @@ DynamicMemoryManagerWebGPU::Page DynamicMemoryManagerWebGPU::GetPage(size_t Size
     size_t Offset = m_CurrentOffset;
     m_CurrentOffset += PageSize;
 
-    return Page{this, PageSize, Offset};
+    Page NewPage{this, PageSize, Offset};
+    NewPage.m_StagingBuffer = GetStagingBuffer(PageSize);
+    return NewPage;
+}
+
+MappedStagingBufferWebGPU DynamicMemoryManagerWebGPU::GetStagingBuffer(size_t Size)
+{
+    auto Iter = m_StagingBuffers.begin();
+    while (Iter != m_StagingBuffers.end())
+    {
+        if (Iter->IsMapPending())
+        {
+            // The GPU may still be reading from the buffer
+            ++Iter;
+            continue;
+        }
+
+        if (!Iter->IsMapped())
+        {
+            // The map request has failed (e.g. the device has been lost)
+            Iter = m_StagingBuffers.erase(Iter);
+            continue;
+        }
+
+        if (Iter->GetSize() == Size)
+        {
+            MappedStagingBufferWebGPU Result = std::move(*Iter);
+            m_StagingBuffers.erase(Iter);
+            return Result;
+        }
+        ++Iter;
+    }
+
+    return MappedStagingBufferWebGPU{m_wgpuDevice, Size, "Dynamic memory staging buffer"};
 }
 
 void DynamicMemoryManagerWebGPU::RecyclePage(Page&& Item)
 {
     std::lock_guard Lock{m_AvailablePagesMtx};
+    if (Item.m_StagingBuffer)
+        m_StagingBuffers.emplace_back(std::move(Item.m_StagingBuffer));
     m_AvailablePages.emplace_back(std::move(Item));
 }
 
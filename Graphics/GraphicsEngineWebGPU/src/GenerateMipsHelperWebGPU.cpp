@@ -709,12 +709,9 @@ void GenerateMipsHelperWebGPU::GenerateMips(WGPUCommandEncoder wgpuCmdEncoder, D
             wgpuBindGroupEntries[1].binding = 1;
             wgpuBindGroupEntries[1].sampler = ClassPtrCast<SamplerWebGPUImpl>(m_pSampler.RawPtr())->GetWebGPUSampler();
 
-            WGPUBindGroupDescriptor wgpuBindGroupDesc{};
-            wgpuBindGroupDesc.layout     = LayoutGroup.Get();
-            wgpuBindGroupDesc.entryCount = _countof(wgpuBindGroupEntries);
-            wgpuBindGroupDesc.entries    = wgpuBindGroupEntries;
-
-            WebGPUBindGroupWrapper wgpuBindGroup{wgpuDeviceCreateBindGroup(m_DeviceWebGPU.GetWebGPUDevice(), &wgpuBindGroupDesc)};
+            // Mip views are owned by the texture view, so the same bind groups are used every time
+            // mips are generated for the view
+            WebGPUBindGroupWrapper wgpuBindGroup = m_DeviceWebGPU.GetBindGroupCache().GetBindGroup(LayoutGroup.Get(), wgpuBindGroupEntries, _countof(wgpuBindGroupEntries));
             wgpuRenderPassEncoderSetPipeline(wgpuRenderPassEncoder, Pipeline.Get());
             wgpuRenderPassEncoderSetBindGroup(wgpuRenderPassEncoder, 0, wgpuBindGroup.Get(), 0, nullptr);
             wgpuRenderPassEncoderDraw(wgpuRenderPassEncoder, 3, 1, 0, 0);
@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "MappedStagingBufferWebGPU.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+MappedStagingBufferWebGPU::MappedStagingBufferWebGPU(WGPUDevice wgpuDevice, size_t Size, const char* Name) :
+    m_Size{Size}
+{
+    VERIFY(Size % 4 == 0, "Mapped buffer size must be a multiple of 4");
+
+    WGPUBufferDescriptor wgpuBufferDesc{};
+    wgpuBufferDesc.label            = GetWGPUStringView(Name);
+    wgpuBufferDesc.size             = Size;
+    wgpuBufferDesc.usage            = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+    wgpuBufferDesc.mappedAtCreation = true;
+    m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(wgpuDevice, &wgpuBufferDesc));
+    if (!m_wgpuBuffer)
+    {
+        LOG_ERROR("Failed to create WebGPU buffer '", Name, '\'');
+        m_Size = 0;
+        return;
+    }
+
+    // Do NOT use WGPU_WHOLE_MAP_SIZE due to https://github.com/emscripten-core/emscripten/issues/20538
+    m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, m_Size));
+    VERIFY(m_pMappedData != nullptr, "Mapped range is null");
+}
+
+MappedStagingBufferWebGPU::MappedStagingBufferWebGPU(MappedStagingBufferWebGPU&& RHS) noexcept :
+    //clang-format off
+    m_wgpuBuffer{std::move(RHS.m_wgpuBuffer)},
+    m_pMapSyncPoint{std::move(RHS.m_pMapSyncPoint)},
+    m_pMappedData{RHS.m_pMappedData},
+    m_Size{RHS.m_Size}
+// clang-format on
+{
+    RHS.m_pMappedData = nullptr;
+    RHS.m_Size        = 0;
+}
+
+MappedStagingBufferWebGPU& MappedStagingBufferWebGPU::operator=(MappedStagingBufferWebGPU&& RHS) noexcept
+{
+    if (&RHS == this)
+        return *this;
+
+    m_wgpuBuffer    = std::move(RHS.m_wgpuBuffer);
+    m_pMapSyncPoint = std::move(RHS.m_pMapSyncPoint);
+    m_pMappedData   = RHS.m_pMappedData;
+    m_Size          = RHS.m_Size;
+
+    RHS.m_pMappedData = nullptr;
+    RHS.m_Size        = 0;
+
+    return *this;
+}
+
+Uint8* MappedStagingBufferWebGPU::GetMappedData()
+{
+    if (m_pMappedData != nullptr)
+        return m_pMappedData;
+
+    if (m_pMapSyncPoint && m_pMapSyncPoint->IsTriggered())
+    {
+        m_pMapSyncPoint.Release();
+        // The sync point is also triggered when the map request fails
+        if (wgpuBufferGetMapState(m_wgpuBuffer) == WGPUBufferMapState_Mapped)
+        {
+            m_pMappedData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, m_Size));
+            VERIFY(m_pMappedData != nullptr, "Mapped range is null");
+        }
+    }
+
+    return m_pMappedData;
+}
+
+void MappedStagingBufferWebGPU::Unmap()
+{
+    if (m_pMappedData == nullptr)
+    {
+        UNEXPECTED("The buffer is not mapped");
+        return;
+    }
+
+    wgpuBufferUnmap(m_wgpuBuffer);
+    m_pMappedData = nullptr;
+}
+
+void MappedStagingBufferWebGPU::MapAsync()
+{
+    VERIFY(m_pMappedData == nullptr, "The buffer is already mapped");
+    VERIFY(!m_pMapSyncPoint, "The buffer already has a pending map request");
+
+    auto MapAsyncCallback = [](WGPUBufferMapAsyncStatus MapStatus, void* pUserData) {
+        VERIFY_EXPR(pUserData != nullptr);
+        SyncPointWebGPUImpl* pSyncPoint = static_cast<SyncPointWebGPUImpl*>(pUserData);
+        pSyncPoint->Trigger();
+        pSyncPoint->Release();
+    };
+
+    m_pMapSyncPoint = MakeNewRCObj<SyncPointWebGPUImpl>()();
+
+    // The callback owns a reference to the sync point, so it remains valid if the buffer
+    // object is moved or destroyed before the request completes.
+    SyncPointWebGPUImpl* pSyncPoint = m_pMapSyncPoint;
+    pSyncPoint->AddRef();
+    wgpuBufferMapAsync(m_wgpuBuffer, WGPUMapMode_Write, 0, m_Size, MapAsyncCallback, pSyncPoint);
+}
+
+} // namespace Diligent
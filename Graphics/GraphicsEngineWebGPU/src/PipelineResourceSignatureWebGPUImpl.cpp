@@ -698,6 +698,13 @@ WGPUBindGroupLayout PipelineResourceSignatureWebGPUImpl::GetWGPUBindGroupLayout(
 
 PipelineResourceSignatureWebGPUImpl::~PipelineResourceSignatureWebGPUImpl()
 {
+    // Release cached bind groups that use the layouts
+    for (const WebGPUBindGroupLayoutWrapper& wgpuBindGroupLayout : m_wgpuBindGroupLayouts)
+    {
+        if (wgpuBindGroupLayout)
+            GetDevice()->GetBindGroupCache().OnDestroyObject(wgpuBindGroupLayout.Get());
+    }
+
     Destruct();
 }
 
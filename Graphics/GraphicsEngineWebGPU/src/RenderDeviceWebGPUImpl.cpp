@@ -110,6 +110,7 @@ RenderDeviceWebGPUImpl::RenderDeviceWebGPUImpl(IReferenceCounters* pRefCounters,
 
     m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize);
     m_pDynamicMemoryManager = std::make_unique<DynamicMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.DynamicHeapPageSize, EngineCI.DynamicHeapSize);
+    m_pBindGroupCache       = std::make_unique<BindGroupCacheWebGPU>(m_wgpuDevice, EngineCI.BindGroupCacheSize);
     m_pAttachmentCleaner    = std::make_unique<AttachmentCleanerWebGPU>(*this);
     m_pMipsGenerator        = std::make_unique<GenerateMipsHelperWebGPU>(*this);
     m_pQueryManager         = std::make_unique<QueryManagerWebGPU>(this, EngineCI.QueryPoolSizes);
@@ -326,6 +327,11 @@ void RenderDeviceWebGPUImpl::CreateBufferFromWebGPUBuffer(WGPUBuffer        wgpu
     CreateBufferImpl(ppBuffer, BuffDesc, InitialState, wgpuBuffer, false);
 }
 
+void RenderDeviceWebGPUImpl::GetBindGroupCacheStats(BindGroupCacheStatsWebGPU& Stats) const
+{
+    Stats = m_pBindGroupCache->GetStatistics();
+}
+
 void RenderDeviceWebGPUImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc&               Desc,
                                                              const PipelineResourceSignatureInternalDataWebGPU& InternalData,
                                                              IPipelineResourceSignature**                       ppSignature)
@@ -82,6 +82,13 @@ SamplerWebGPUImpl::SamplerWebGPUImpl(IReferenceCounters* pRefCounters,
     // Since WebGPU does not support multithreading, we cannot create WebGPU sampler here.
 }
 
+SamplerWebGPUImpl::~SamplerWebGPUImpl()
+{
+    // Release cached bind groups that reference the sampler
+    if (m_wgpuSampler)
+        GetDevice()->GetBindGroupCache().OnDestroyObject(m_wgpuSampler.Get());
+}
+
 WGPUSampler SamplerWebGPUImpl::GetWebGPUSampler() const
 {
     if (!m_wgpuSampler)
@@ -33,6 +33,7 @@
 #include "TextureWebGPUImpl.hpp"
 #include "SamplerWebGPUImpl.hpp"
 #include "DeviceContextWebGPUImpl.hpp"
+#include "BindGroupCacheWebGPU.hpp"
 
 namespace Diligent
 {
@@ -457,20 +458,13 @@ void ShaderResourceCacheWebGPU::SetDynamicBufferOffset(Uint32 BindGroupIndex,
     DstRes.BufferDynamicOffset = DynamicBufferOffset;
 }
 
-WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(WGPUDevice wgpuDevice, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout)
+WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(BindGroupCacheWebGPU& BindGroupCache, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout)
 {
     BindGroup& Group = GetBindGroup(GroupIndex);
     if (!Group.m_wgpuBindGroup || Group.m_IsDirty)
     {
-        WGPUBindGroupDescriptor wgpuBindGroupDescriptor{};
-        wgpuBindGroupDescriptor.nextInChain = nullptr;
-        wgpuBindGroupDescriptor.label       = {};
-        wgpuBindGroupDescriptor.layout      = wgpuGroupLayout;
-        wgpuBindGroupDescriptor.entryCount  = Group.m_NumResources;
-        wgpuBindGroupDescriptor.entries     = Group.m_wgpuEntries;
-
-        Group.m_wgpuBindGroup.Reset(wgpuDeviceCreateBindGroup(wgpuDevice, &wgpuBindGroupDescriptor));
-        Group.m_IsDirty = false;
+        Group.m_wgpuBindGroup = BindGroupCache.GetBindGroup(wgpuGroupLayout, Group.m_wgpuEntries, Group.m_NumResources);
+        Group.m_IsDirty       = false;
     }
 
     return Group.m_wgpuBindGroup;
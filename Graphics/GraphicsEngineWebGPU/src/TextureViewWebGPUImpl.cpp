@@ -58,6 +58,17 @@ TextureViewWebGPUImpl::TextureViewWebGPUImpl(IReferenceCounters*
 {
 }
 
+TextureViewWebGPUImpl::~TextureViewWebGPUImpl()
+{
+    // Release cached bind groups that reference the view or any of its mip level views
+    BindGroupCacheWebGPU& BindGroupCache = GetDevice()->GetBindGroupCache();
+    BindGroupCache.OnDestroyObject(m_wgpuTextureView.Get());
+    for (const WebGPUTextureViewWrapper& wgpuMipView : m_wgpuTextureMipSRVs)
+        BindGroupCache.OnDestroyObject(wgpuMipView.Get());
+    for (const WebGPUTextureViewWrapper& wgpuMipView : m_wgpuTextureMipUAVs)
+        BindGroupCache.OnDestroyObject(wgpuMipView.Get());
+}
+
 WGPUTextureView TextureViewWebGPUImpl::GetWebGPUTextureView() const
 {
     return m_wgpuTextureView.Get();
@@ -36,32 +36,20 @@ namespace Diligent
 
 UploadMemoryManagerWebGPU::Page::Page(UploadMemoryManagerWebGPU& Mgr, size_t Size) :
     m_pMgr{&Mgr},
-    m_Data(Size)
+    m_StagingBuffer{Mgr.m_wgpuDevice, Size, "Upload memory page"}
 {
-    WGPUBufferDescriptor wgpuBufferDesc{};
-    wgpuBufferDesc.label = GetWGPUStringView("Upload memory page");
-    wgpuBufferDesc.size  = Size;
-    wgpuBufferDesc.usage =
-        WGPUBufferUsage_CopyDst |
-        WGPUBufferUsage_CopySrc |
-        WGPUBufferUsage_Uniform |
-        WGPUBufferUsage_Storage |
-        WGPUBufferUsage_Vertex |
-        WGPUBufferUsage_Index |
-        WGPUBufferUsage_Indirect;
-    m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(m_pMgr->m_wgpuDevice, &wgpuBufferDesc));
     LOG_INFO_MESSAGE("Created a new upload memory page, size: ", FormatMemorySize(Size));
 }
 
 UploadMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     //clang-format off
     m_pMgr{RHS.m_pMgr},
-    m_wgpuBuffer{std::move(RHS.m_wgpuBuffer)},
-    m_Data{std::move(RHS.m_Data)},
+    m_StagingBuffer{std::move(RHS.m_StagingBuffer)},
     m_CurrOffset{RHS.m_CurrOffset}
 // clang-format on
 {
-    RHS = Page{};
+    RHS.m_pMgr       = nullptr;
+    RHS.m_CurrOffset = 0;
 }
 
 UploadMemoryManagerWebGPU::Page& UploadMemoryManagerWebGPU::Page::operator=(Page&& RHS) noexcept
@@ -69,10 +57,9 @@ UploadMemoryManagerWebGPU::Page& UploadMemoryManagerWebGPU::Page::operator=(Page
     if (&RHS == this)
         return *this;
 
-    m_pMgr       = RHS.m_pMgr;
-    m_wgpuBuffer = std::move(RHS.m_wgpuBuffer);
-    m_Data       = std::move(RHS.m_Data);
-    m_CurrOffset = RHS.m_CurrOffset;
+    m_pMgr          = RHS.m_pMgr;
+    m_StagingBuffer = std::move(RHS.m_StagingBuffer);
+    m_CurrOffset    = RHS.m_CurrOffset;
 
     RHS.m_pMgr       = nullptr;
     RHS.m_CurrOffset = 0;
@@ -89,23 +76,25 @@ UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(
 {
     VERIFY(IsPowerOfTwo(Alignment), "Alignment size must be a power of two");
     Allocation Alloc;
-    Alloc.Offset = AlignUp(m_CurrOffset, Alignment);
-    Alloc.Size   = AlignUp(Size, Alignment);
-    if (Alloc.Offset + Alloc.Size <= m_Data.size())
+    Alloc.Offset       = AlignUp(m_CurrOffset, Alignment);
+    Alloc.Size         = AlignUp(Size, Alignment);
+    Uint8* pMappedData = m_StagingBuffer.GetMappedData();
+    if (pMappedData != nullptr && Alloc.Offset + Alloc.Size <= m_StagingBuffer.GetSize())
     {
-        Alloc.wgpuBuffer = m_wgpuBuffer;
-        Alloc.pData      = &m_Data[Alloc.Offset];
+        Alloc.wgpuBuffer = m_StagingBuffer.GetWGPUBuffer();
+        Alloc.pData      = pMappedData + Alloc.Offset;
         m_CurrOffset     = Alloc.Offset + Alloc.Size;
         return Alloc;
     }
     return Allocation{};
 }
 
-void UploadMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
+void UploadMemoryManagerWebGPU::Page::FlushWrites()
 {
+    // Pages that have not been written to remain mapped and are recycled as is
     if (m_CurrOffset > 0)
     {
-        wgpuQueueWriteBuffer(wgpuQueue, m_wgpuBuffer, 0, m_Data.data(), m_CurrOffset);
+        m_StagingBuffer.Unmap();
     }
 }
 
@@ -117,7 +106,11 @@ void UploadMemoryManagerWebGPU::Page::Recycle()
         return;
     }
 
-    m_CurrOffset = 0;
+    if (m_CurrOffset > 0)
+    {
+        m_StagingBuffer.MapAsync();
+        m_CurrOffset = 0;
+    }
     m_pMgr->RecyclePage(std::move(*this));
 }
 
@@ -151,6 +144,24 @@ UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
         auto Iter = m_AvailablePages.begin();
         while (Iter != m_AvailablePages.end())
         {
+            MappedStagingBufferWebGPU& StagingBuffer = Iter->m_StagingBuffer;
+            if (StagingBuffer.IsMapPending())
+            {
+                // The GPU may still be using the page
+                ++Iter;
+                continue;
+            }
+
+            if (!StagingBuffer.IsMapped())
+            {
+                // The map request has failed (e.g. the device has been lost)
+                Iter = m_AvailablePages.erase(Iter);
+#if DILIGENT_DEBUG
+                m_DbgPageCounter.fetch_sub(1);
+#endif
+                continue;
+            }
+
             if (PageSize <= Iter->GetSize())
             {
                 Page Result = std::move(*Iter);
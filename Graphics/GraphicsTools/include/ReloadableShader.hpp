@@ -29,14 +29,61 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <string>
+#include <vector>
+#include <unordered_map>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
+#include "XXH128Hasher.hpp"
 
 namespace Diligent
 {
 
 class RenderStateCacheImpl;
 
+/// Caches the hashes of shader source files. Within a single reload, files shared by many
+/// shaders (e.g. common headers) are checked only once. Between reloads, the file is not read
+/// again if its modification time and size have not changed.
+class ShaderSourceHashCache
+{
+public:
+    /// Starts a new reload: every file will be checked again on the first request.
+    void BeginReload();
+
+    /// Returns the hash of the file contents. If the file can't be read, returns zero hash.
+    const XXH128Hash& GetFileHash(IShaderSourceInputStreamFactory* pFactory, const std::string& FilePath);
+
+    /// Returns the number of files checked since the last BeginReload() call.
+    size_t GetNumFiles() const { return m_NumFiles; }
+
+    /// Returns the number of files read and hashed since the last BeginReload() call.
+    size_t GetNumFilesRead() const { return m_NumFilesRead; }
+
+private:
+    struct FileInfo
+    {
+        XXH128Hash Hash;
+        // Modification time is only known for memory-mapped files. Zero means that it is unknown
+        // and the file has to be read to check whether it has changed.
+        Uint64 ModificationTime = 0;
+        size_t Size             = 0;
+        Uint32 ReloadVersion    = 0;
+    };
+
+    struct FactoryFiles
+    {
+        // Keep the factory alive so that its address can't be reused by another factory
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+        std::unordered_map<std::string, FileInfo>      Files;
+    };
+    std::unordered_map<IShaderSourceInputStreamFactory*, FactoryFiles> m_Factories;
+
+    Uint32 m_ReloadVersion = 0;
+    size_t m_NumFiles      = 0;
+    size_t m_NumFilesRead  = 0;
+};
+
 /// Reloadable shader implements the IShader interface and delegates all
 /// calls to the internal shader object, which can be replaced at run-time.
 class ReloadableShader final : public ObjectBase<IShader>
@@ -51,7 +98,8 @@ public:
     ReloadableShader(IReferenceCounters*     pRefCounters,
                      RenderStateCacheImpl*   pStateCache,
                      IShader*                pShader,
-                     const ShaderCreateInfo& CreateInfo);
+                     const ShaderCreateInfo& CreateInfo,
+                     const ShaderCreateInfo& ReloadCreateInfo);
 
     ~ReloadableShader();
 
@@ -104,17 +152,42 @@ public:
         return m_pShader->GetStatus(WaitForCompletion);
     }
 
+    /// \param [in] CreateInfo       - Create info the shader was created with.
+    /// \param [in] ReloadCreateInfo - Create info to use when reloading the shader.
     static void Create(RenderStateCacheImpl*   pStateCache,
                        IShader*                pShader,
                        const ShaderCreateInfo& CreateInfo,
+                       const ShaderCreateInfo& ReloadCreateInfo,
                        IShader**               ppReloadableShader);
 
-    bool Reload();
+    /// Returns true if any of the source files the shader was created from
+    /// (the main file and all files it includes) has changed, or if these files are not known
+    /// because the includes could not be processed.
+    bool HasSourceChanged(ShaderSourceHashCache& HashCache) const;
+
+    /// Re-creates the internal shader object.
+    /// Returns false if the shader could not be re-created, in which case the internal object is not changed.
+    /// \param [out] FoundInCache - Whether the new shader was found in the render state cache.
+    bool Reload(bool& FoundInCache);
+
+private:
+    void UpdateSourceDependencies(const ShaderCreateInfo& CreateInfo);
 
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
     ShaderCreateInfoWrapper             m_CreateInfo;
+
+    struct SourceDependency
+    {
+        std::string FilePath;
+        XXH128Hash  Hash;
+    };
+    // Source files the current internal shader was created from
+    std::vector<SourceDependency> m_Dependencies;
+    // Whether the includes of the last create info could not be processed, in which case
+    // m_Dependencies may be incomplete and the shader is always considered changed.
+    bool m_DependenciesUnknown = false;
 };
 
 } // namespace Diligent
@@ -38,6 +38,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "ReloadableShader.hpp"
 
 namespace Diligent
 {
@@ -110,6 +111,12 @@ public:
         return m_ReloadVersion;
     }
 
+    virtual void DILIGENT_CALL_TYPE GetLastReloadStats(RenderStateCacheReloadStats& Stats) const override final
+    {
+        std::lock_guard<std::mutex> Guard{m_LastReloadStatsMtx};
+        Stats = m_LastReloadStats;
+    }
+
     bool CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
                               IShader**               ppShader);
 
@@ -149,6 +156,8 @@ private:
 
     std::mutex                                                   m_ReloadableShadersMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IShader>> m_ReloadableShaders;
+    // Hashes of the reloadable shader source files, protected by m_ReloadableShadersMtx
+    ShaderSourceHashCache m_SourceHashes;
 
     std::mutex                                                    m_PipelinesMtx;
     std::unordered_map<XXH128Hash, RefCntWeakPtr<IPipelineState>> m_Pipelines;
@@ -157,6 +166,9 @@ private:
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
     Uint32 m_ReloadVersion = 0;
+
+    mutable std::mutex          m_LastReloadStatsMtx;
+    RenderStateCacheReloadStats m_LastReloadStats;
 };
 
 } // namespace Diligent
@@ -0,0 +1,300 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ThreadArenaAllocationsManager class
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "DebugUtilities.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+/// Distributes small allocations between arenas selected by the calling thread.
+
+/// Every arena reserves large chunks from the parent allocator through the user-provided
+/// callback and suballocates from these chunks under its own lock. Since a thread always
+/// uses the same arena, the arena lock is normally uncontended and the parent allocator
+/// lock is only taken when a chunk is reserved or released. The arena lock is still
+/// required because allocations may be released by any thread.
+class ThreadArenaAllocationsManager
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using Region     = VariableSizeAllocationsManager::Allocation;
+
+    /// Reserves the region of the specified size and alignment in the parent allocator.
+    /// Returns an invalid region if there is not enough space.
+    using ReserveChunkCallbackType = std::function<Region(OffsetType Size, OffsetType Alignment)>;
+
+    /// Returns the region reserved by ReserveChunkCallbackType to the parent allocator.
+    using ReleaseChunkCallbackType = std::function<void(Region&& ChunkRegion)>;
+
+    struct CreateInfo
+    {
+        /// Chunk size.
+        OffsetType ChunkSize = 0;
+
+        /// Chunk alignment. Allocations with larger alignment are not handled by the arenas.
+        OffsetType ChunkAlignment = 1;
+
+        /// The number of arenas. If zero, the number of hardware threads is used.
+        Uint32 NumArenas = 0;
+
+        bool DisableDebugValidation = false;
+
+        ReserveChunkCallbackType ReserveChunk;
+        ReleaseChunkCallbackType ReleaseChunk;
+    };
+
+    class Chunk
+    {
+    public:
+        Chunk(Region&& _ParentRegion, OffsetType ChunkSize, OffsetType ChunkAlignment, Uint32 _ArenaIndex, bool DisableDebugValidation) :
+            // clang-format off
+            ParentRegion{std::move(_ParentRegion)},
+            Offset      {AlignUp(ParentRegion.UnalignedOffset, ChunkAlignment)},
+            ArenaIndex  {_ArenaIndex},
+            Mgr
+            {
+                VariableSizeAllocationsManager::CreateInfo
+                {
+                    DefaultRawMemoryAllocator::GetAllocator(),
+                    ChunkSize,
+                    DisableDebugValidation,
+                }
+            }
+        // clang-format on
+        {
+            VERIFY_EXPR(ParentRegion.IsValid() && Offset + ChunkSize <= ParentRegion.UnalignedOffset + ParentRegion.Size);
+        }
+
+        // Region allocated from the parent allocator
+        Region ParentRegion;
+
+        // Aligned chunk offset in the parent allocator
+        const OffsetType Offset;
+
+        const Uint32 ArenaIndex;
+
+        VariableSizeAllocationsManager Mgr;
+
+        Uint32 NumAllocations = 0;
+    };
+
+    struct Allocation
+    {
+        Chunk* pChunk = nullptr;
+
+        // Region within the chunk
+        Region ChunkRegion;
+
+        bool IsValid() const
+        {
+            return pChunk != nullptr;
+        }
+
+        /// Returns the unaligned offset of the allocation in the parent allocator.
+        OffsetType GetUnalignedOffset() const
+        {
+            VERIFY_EXPR(IsValid());
+            return pChunk->Offset + ChunkRegion.UnalignedOffset;
+        }
+
+        Uint32 GetArenaIndex() const
+        {
+            VERIFY_EXPR(IsValid());
+            return pChunk->ArenaIndex;
+        }
+    };
+
+    explicit ThreadArenaAllocationsManager(const CreateInfo& CI) :
+        // clang-format off
+        m_ChunkSize             {CI.ChunkSize},
+        m_ChunkAlignment        {CI.ChunkAlignment},
+        m_NumArenas             {CI.NumArenas != 0 ? CI.NumArenas : std::max(std::thread::hardware_concurrency(), 1u)},
+        m_DisableDebugValidation{CI.DisableDebugValidation},
+        m_ReserveChunk          {CI.ReserveChunk},
+        m_ReleaseChunk          {CI.ReleaseChunk},
+        m_Arenas                {new Arena[m_NumArenas]}
+    // clang-format on
+    {
+        VERIFY_EXPR(m_ChunkSize > 0);
+        VERIFY(IsPowerOfTwo(m_ChunkAlignment), "Chunk alignment (", m_ChunkAlignment, ") must be a power of two");
+        VERIFY_EXPR(m_ReserveChunk && m_ReleaseChunk);
+    }
+
+    // clang-format off
+    ThreadArenaAllocationsManager           (const ThreadArenaAllocationsManager&)  = delete;
+    ThreadArenaAllocationsManager           (      ThreadArenaAllocationsManager&&) = delete;
+    ThreadArenaAllocationsManager& operator=(const ThreadArenaAllocationsManager&)  = delete;
+    ThreadArenaAllocationsManager& operator=(      ThreadArenaAllocationsManager&&) = delete;
+    // clang-format on
+
+    ~ThreadArenaAllocationsManager()
+    {
+        for (Uint32 i = 0; i < m_NumArenas; ++i)
+        {
+            for (auto& pChunk : m_Arenas[i].Chunks)
+            {
+                VERIFY(pChunk->NumAllocations == 0, "Destroying arena chunk that has ", pChunk->NumAllocations, " outstanding allocation(s)");
+                m_ReleaseChunk(std::move(pChunk->ParentRegion));
+            }
+        }
+    }
+
+    /// Checks if the allocation of the given size and alignment should be handled by the arenas.
+    /// Only allocations that are much smaller than the chunk size are suballocated from the arenas.
+    bool IsArenaAllocation(OffsetType Size, OffsetType Alignment) const
+    {
+        return Alignment <= m_ChunkAlignment && AlignUp(Size, Alignment) <= m_ChunkSize / 4;
+    }
+
+    /// Allocates space from the arena of the calling thread.
+    /// Returns an invalid allocation if a new chunk could not be reserved.
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(IsArenaAllocation(Size, Alignment));
+
+        const Uint32 ArenaIdx = GetCurrentThreadArenaIndex();
+        Arena&       Arena    = m_Arenas[ArenaIdx];
+
+        std::lock_guard<std::mutex> Lock{Arena.Mtx};
+
+        Allocation Alloc;
+        // Start with the most recently reserved chunk as it is most likely to have space
+        for (auto it = Arena.Chunks.rbegin(); it != Arena.Chunks.rend() && !Alloc.IsValid(); ++it)
+        {
+            Alloc.ChunkRegion = (*it)->Mgr.Allocate(Size, Alignment);
+            if (Alloc.ChunkRegion.IsValid())
+                Alloc.pChunk = it->get();
+        }
+
+        if (!Alloc.IsValid())
+        {
+            Region ParentRegion = m_ReserveChunk(m_ChunkSize, m_ChunkAlignment);
+            if (!ParentRegion.IsValid())
+                return {};
+
+            Arena.Chunks.emplace_back(std::make_unique<Chunk>(std::move(ParentRegion), m_ChunkSize, m_ChunkAlignment, ArenaIdx, m_DisableDebugValidation));
+            m_ReservedSize.fetch_add(m_ChunkSize);
+
+            Alloc.pChunk      = Arena.Chunks.back().get();
+            Alloc.ChunkRegion = Alloc.pChunk->Mgr.Allocate(Size, Alignment);
+            VERIFY_EXPR(Alloc.ChunkRegion.IsValid());
+        }
+
+        ++Alloc.pChunk->NumAllocations;
+        m_UsedSize.fetch_add(Alloc.ChunkRegion.Size);
+
+        return Alloc;
+    }
+
+    /// Releases the allocation. The method may be called by any thread.
+    void Free(Allocation&& Alloc)
+    {
+        VERIFY_EXPR(Alloc.IsValid());
+
+        Chunk* const pChunk = Alloc.pChunk;
+        Arena&       Arena  = m_Arenas[pChunk->ArenaIndex];
+
+        std::lock_guard<std::mutex> Lock{Arena.Mtx};
+
+        m_UsedSize.fetch_sub(Alloc.ChunkRegion.Size);
+        pChunk->Mgr.Free(std::move(Alloc.ChunkRegion));
+        VERIFY_EXPR(pChunk->NumAllocations > 0);
+        --pChunk->NumAllocations;
+        Alloc = {};
+
+        // Keep the last chunk in the arena to avoid reserving it again on the next allocation
+        if (pChunk->NumAllocations == 0 && Arena.Chunks.size() > 1)
+        {
+            auto it = std::find_if(Arena.Chunks.begin(), Arena.Chunks.end(), [pChunk](const std::unique_ptr<Chunk>& p) { return p.get() == pChunk; });
+            VERIFY_EXPR(it != Arena.Chunks.end());
+            m_ReleaseChunk(std::move(pChunk->ParentRegion));
+            m_ReservedSize.fetch_sub(m_ChunkSize);
+            Arena.Chunks.erase(it);
+        }
+    }
+
+    Uint32 GetCurrentThreadArenaIndex() const
+    {
+        static std::atomic<Uint32> NextThreadSlot{0};
+        thread_local const Uint32  ThreadSlot = NextThreadSlot.fetch_add(1);
+        return ThreadSlot % m_NumArenas;
+    }
+
+    Uint32 GetNumArenas() const
+    {
+        return m_NumArenas;
+    }
+
+    /// Returns the total size of all chunks reserved by the arenas.
+    OffsetType GetReservedSize() const
+    {
+        return m_ReservedSize.load();
+    }
+
+    /// Returns the total size of all allocations in the arenas.
+    OffsetType GetUsedSize() const
+    {
+        return m_UsedSize.load();
+    }
+
+private:
+    struct Arena
+    {
+        std::mutex                          Mtx;
+        std::vector<std::unique_ptr<Chunk>> Chunks;
+    };
+
+    const OffsetType m_ChunkSize;
+    const OffsetType m_ChunkAlignment;
+    const Uint32     m_NumArenas;
+    const bool       m_DisableDebugValidation;
+
+    const ReserveChunkCallbackType m_ReserveChunk;
+    const ReleaseChunkCallbackType m_ReleaseChunk;
+
+    std::unique_ptr<Arena[]> m_Arenas;
+
+    std::atomic<OffsetType> m_ReservedSize{0};
+    std::atomic<OffsetType> m_UsedSize{0};
+};
+
+} // namespace Diligent
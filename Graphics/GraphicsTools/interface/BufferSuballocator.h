@@ -102,6 +102,10 @@ struct BufferSuballocatorUsageStats
     /// The maximum size of the continuous free chunk in the buffer, in bytes.
     Uint64 MaxFreeChunkSize = 0;
 
+    /// The total size of memory reserved by per-thread arenas that is not
+    /// used by any allocation, in bytes (see BufferSuballocatorCreateInfo::ThreadArenaChunkSize).
+    Uint64 ArenaFreeSize = 0;
+
     /// The current number of allocations.
     Uint32 AllocationCount = 0;
 
@@ -110,6 +114,7 @@ struct BufferSuballocatorUsageStats
         CommittedSize += rhs.CommittedSize;
         UsedSize += rhs.UsedSize;
         MaxFreeChunkSize = (std::max)(MaxFreeChunkSize, rhs.MaxFreeChunkSize);
+        ArenaFreeSize += rhs.ArenaFreeSize;
         AllocationCount += rhs.AllocationCount;
         return *this;
     }
@@ -179,6 +184,21 @@ struct BufferSuballocatorCreateInfo
     /// \remarks    If MaxSize is zero, the buffer will not be expanded beyond the initial size.
     Uint64 MaxSize = 0;
 
+    /// The size of the chunk that every thread reserves in the buffer, in bytes.
+
+    /// When non-zero, every thread reserves chunks of this size from the buffer
+    /// and suballocates small allocations (up to 1/4 of the chunk size) from its
+    /// own chunks without taking the global allocator lock. Empty chunks, except
+    /// for the last one, are returned to the buffer.
+    /// If zero, all allocations are performed from the buffer directly.
+    Uint32 ThreadArenaChunkSize = 0;
+
+    /// The number of per-thread arenas. If zero, the number of hardware threads is used.
+    /// Threads are distributed between arenas in a round-robin fashion.
+    ///
+    /// \remarks   The member is ignored if ThreadArenaChunkSize is zero.
+    Uint32 NumThreadArenas = 0;
+
     /// Whether to disable debug validation of the internal buffer structure.
 
     /// \remarks    By default, internal buffer structure is validated in debug
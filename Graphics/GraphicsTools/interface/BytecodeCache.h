@@ -35,6 +35,17 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// Whether Load() may reference the data of memory-mapped cache files instead of copying it.
+
+    /// \remarks    The data is only referenced if the blob passed to Load() is the data blob of
+    ///             a memory-mapped file stream (see Diligent::MappedFileStream::GetDataBlob()).
+    ///             The loaded byte code keeps the mapping alive, and the file must not be
+    ///             truncated or overwritten in place while the cache uses it, as accessing
+    ///             the mapping would then fail. In particular, the cache must not be stored
+    ///             back into the same file without writing to a new file first.
+    ///             All other blobs are always copied.
+    Bool ReferenceMappedData DEFAULT_INITIALIZER(False);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
@@ -59,6 +70,10 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     ///
     /// \param [in] pData - A pointer to the cache data.
     /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The data is copied, and the blob does not need to outlive the call, unless
+    ///             BytecodeCacheCreateInfo::ReferenceMappedData is enabled and the blob references
+    ///             a memory-mapped file.
     VIRTUAL bool METHOD(Load)(THIS_
                               IDataBlob* pData) PURE;
 
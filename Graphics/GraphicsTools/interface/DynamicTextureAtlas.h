@@ -111,6 +111,23 @@ struct DynamicTextureAtlasUsageStats
     /// Used area is always equal to or larger than the
     /// allocated area due to alignment requirements.
     Uint64 UsedArea = 0;
+
+    /// The total number of allocation requests, including failed ones.
+    Uint64 AllocationRequestCount = 0;
+
+    /// The total number of slices that were locked and probed
+    /// by all allocation requests.
+    Uint64 SliceProbeCount = 0;
+
+    /// The total number of slices that were skipped without locking
+    /// because their free space summary indicated that the region
+    /// would not fit.
+    Uint64 SkippedSliceCount = 0;
+
+    /// The total number of probes that found the slice locked by
+    /// another thread. Such slices are revisited after all other
+    /// candidate slices have been probed.
+    Uint64 ContendedProbeCount = 0;
 };
 
 
@@ -158,6 +175,24 @@ struct IDynamicTextureAtlas : public IObject
                           ITextureAtlasSuballocation** ppSuballocation) = 0;
 
 
+    /// Performs multiple suballocations from the atlas.
+
+    /// \param[in]  NumRegions       - The number of regions to allocate.
+    /// \param[in]  pSizes           - Array of NumRegions region sizes.
+    /// \param[out] ppSuballocations - Array of NumRegions memory locations where pointers to the
+    ///                                new suballocations will be stored. If a region can't be
+    ///                                allocated, the corresponding element is left unchanged.
+    ///
+    /// \remarks    The method is thread-safe and can be called from multiple threads simultaneously.
+    ///
+    ///             Regions are placed in order of decreasing size, and every region first tries
+    ///             the slice where the previous region was placed, which reduces the number of
+    ///             slices that need to be probed compared to allocating the regions one by one.
+    virtual void AllocateBatch(Uint32                       NumRegions,
+                               const uint2*                 pSizes,
+                               ITextureAtlasSuballocation** ppSuballocations) = 0;
+
+
     /// Returns the texture atlas description
     virtual const TextureDesc& GetAtlasDesc() const = 0;
 
@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GPUProfiler class
+
+#include <vector>
+#include <deque>
+#include <string>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Timer.hpp"
+
+namespace Diligent
+{
+
+/// GPU profiler create information.
+struct GPUProfilerCreateInfo
+{
+    /// The number of timestamp queries to create upfront.
+    /// Every zone uses two queries.
+    Uint32 NumQueriesToReserve = 256;
+
+    /// The expected number of frames that have not been resolved yet.
+    /// When the number of pending frames exceeds this value, a warning is logged.
+    Uint32 ExpectedFrameLatency = 5;
+
+    /// The maximum number of resolved frames to keep.
+    Uint32 MaxResolvedFrames = 64;
+
+    /// Whether to disable GPU timing even if timestamp queries are supported.
+    bool CPUOnly = false;
+};
+
+/// Hierarchical GPU/CPU profiler.
+
+/// The profiler records nested zones and measures their CPU time with Diligent::Timer and,
+/// if the device supports timestamp queries, their GPU time. Timestamp queries are taken from
+/// a pool owned by the profiler and are read back asynchronously when the GPU completes the
+/// frame, typically several frames later. Resolved frames can be exported in Chrome trace format.
+///
+/// On devices without timestamp queries (or when the device is null) the profiler only
+/// measures CPU time.
+///
+/// \remarks    One profiler instance must be used with one device context.
+///             The class is not thread-safe.
+class GPUProfiler
+{
+public:
+    using CreateInfo = GPUProfilerCreateInfo;
+
+    /// Profiling zone data.
+    struct ZoneData
+    {
+        /// Zone name.
+        std::string Name;
+
+        /// Zone nesting depth. Top-level zones have depth 0.
+        Uint32 Depth = 0;
+
+        /// Index of the parent zone in the frame, or ~0u for top-level zones.
+        Uint32 Parent = ~0u;
+
+        /// CPU time, in seconds since the profiler was created, when the zone began.
+        double CPUStart = 0;
+
+        /// CPU time, in seconds since the profiler was created, when the zone ended.
+        double CPUEnd = 0;
+
+        /// GPU time, in seconds, when the zone began.
+        /// GPU timestamps are rebased onto the CPU timeline so that the first
+        /// zone with GPU data in the frame starts at the same time on the CPU and GPU.
+        double GPUStart = 0;
+
+        /// GPU time, in seconds, when the zone ended.
+        double GPUEnd = 0;
+
+        /// Whether GPUStart and GPUEnd are valid.
+        bool HasGPUData = false;
+    };
+
+    /// Profiling data of one frame.
+    struct FrameData
+    {
+        /// Frame number, starting with 0.
+        Uint64 FrameNumber = 0;
+
+        /// CPU time, in seconds since the profiler was created, when the frame began.
+        double CPUStart = 0;
+
+        /// CPU time, in seconds since the profiler was created, when the frame ended.
+        double CPUEnd = 0;
+
+        /// Frame zones in the order in which they were begun.
+        std::vector<ZoneData> Zones;
+    };
+
+    /// Helper class that begins a zone in the constructor and ends it in the destructor.
+    class ScopedZone
+    {
+    public:
+        ScopedZone() noexcept {}
+
+        ScopedZone(GPUProfiler&    Profiler,
+                   IDeviceContext* pContext,
+                   const Char*     Name) :
+            m_pProfiler{&Profiler},
+            m_pContext{pContext}
+        {
+            Profiler.BeginZone(pContext, Name);
+        }
+
+        ~ScopedZone()
+        {
+            if (m_pProfiler != nullptr)
+            {
+                m_pProfiler->EndZone(m_pContext);
+            }
+        }
+
+        // clang-format off
+        ScopedZone           (const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+        ScopedZone& operator=(ScopedZone&&)      = delete;
+        // clang-format on
+
+        ScopedZone(ScopedZone&& rhs) noexcept :
+            m_pProfiler{rhs.m_pProfiler},
+            m_pContext{rhs.m_pContext}
+        {
+            rhs.m_pProfiler = nullptr;
+            rhs.m_pContext  = nullptr;
+        }
+
+    private:
+        GPUProfiler*    m_pProfiler = nullptr;
+        IDeviceContext* m_pContext  = nullptr;
+    };
+
+    /// Creates the profiler.
+
+    /// \param [in] pDevice - Render device that will be used to create timestamp queries.
+    ///                       If the device is null or does not support timestamp queries,
+    ///                       the profiler only measures CPU time.
+    /// \param [in] CI      - Profiler create info.
+    GPUProfiler(IRenderDevice* pDevice, const CreateInfo& CI = CreateInfo{});
+
+    // clang-format off
+    GPUProfiler           (const GPUProfiler&) = delete;
+    GPUProfiler& operator=(const GPUProfiler&) = delete;
+    GPUProfiler           (GPUProfiler&&)      = delete;
+    GPUProfiler& operator=(GPUProfiler&&)      = delete;
+    // clang-format on
+
+    ~GPUProfiler();
+
+
+    /// Begins a new zone.
+
+    /// \param [in] pCtx - Context to record the timestamp query command.
+    ///                    May be null if GPU timing is disabled.
+    /// \param [in] Name - Zone name.
+    ///
+    /// \remarks    Zones may be nested. There must be exactly one matching EndZone()
+    ///             for every BeginZone() call within the frame.
+    void BeginZone(IDeviceContext* pCtx, const Char* Name);
+
+
+    /// Ends the most recently begun zone.
+
+    /// \param [in] pCtx - Context to record the timestamp query command.
+    ///                    May be null if GPU timing is disabled.
+    void EndZone(IDeviceContext* pCtx);
+
+
+    /// Ends the current frame and resolves the pending frames whose GPU data are available.
+
+    /// \param [in] pCtx - Context that was used to record the frame zones.
+    ///                    May be null if GPU timing is disabled.
+    ///
+    /// \remarks    The method does not wait for the GPU. Frames are resolved in order,
+    ///             and a frame becomes available through GetResolvedFrames() only after
+    ///             the GPU data of all its zones have been read back.
+    void EndFrame(IDeviceContext* pCtx);
+
+
+    /// Returns true if the profiler measures GPU time.
+    bool IsGPUTimingEnabled() const
+    {
+        return m_pDevice != nullptr;
+    }
+
+    /// Returns the resolved frames, from the oldest to the most recent one.
+    const std::deque<FrameData>& GetResolvedFrames() const
+    {
+        return m_ResolvedFrames;
+    }
+
+    /// Removes all resolved frames.
+    void ClearResolvedFrames();
+
+    /// Returns the number of frames that have ended, but have not been resolved yet.
+    size_t GetPendingFrameCount() const
+    {
+        return m_PendingFrames.size();
+    }
+
+    /// Returns the total number of timestamp queries created by the profiler.
+    Uint32 GetQueryPoolSize() const
+    {
+        return m_QueryPoolSize;
+    }
+
+    /// Writes the resolved frames in Chrome trace event format.
+
+    /// \return     JSON string that can be loaded into chrome://tracing or Perfetto.
+    ///
+    /// \remarks    CPU zones are written to thread 1, GPU zones are written to thread 2.
+    std::string GetChromeTrace() const;
+
+private:
+    RefCntAutoPtr<IQuery> AllocateQuery();
+
+    struct PendingFrame;
+    bool TryResolveFrame(PendingFrame& Frame);
+    void AddResolvedFrame(FrameData&& Frame);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const CreateInfo m_CI;
+
+    Timer m_Timer;
+
+    struct PendingFrame
+    {
+        FrameData Data;
+
+        // Start and end timestamp queries of every zone (2 per zone).
+        // Null queries indicate that the zone has no GPU data.
+        std::vector<RefCntAutoPtr<IQuery>> Queries;
+
+        // Index of the last ended query
+        size_t LastQueryIdx = ~size_t{0};
+    };
+    PendingFrame m_CurrentFrame;
+
+    // Indices of the zones that have been begun, but not ended yet
+    std::vector<Uint32> m_OpenZones;
+
+    std::deque<PendingFrame>           m_PendingFrames;
+    std::vector<RefCntAutoPtr<IQuery>> m_AvailableQueries;
+    Uint32                             m_QueryPoolSize = 0;
+
+    std::deque<FrameData> m_ResolvedFrames;
+};
+
+} // namespace Diligent
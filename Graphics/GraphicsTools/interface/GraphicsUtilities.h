@@ -34,6 +34,7 @@
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../../Common/interface/GeometryPrimitives.h"
+#include "../../../Common/interface/ThreadPool.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
@@ -58,6 +59,21 @@ void DILIGENT_GLOBAL_FUNCTION(GenerateCheckerBoardPattern)(Uint32         Width,
 
 // clang-format off
 
+/// Block compression quality.
+DILIGENT_TYPED_ENUM(BC_COMPRESSION_QUALITY, Uint8)
+{
+    /// Endpoints are taken from the principal axis of the block colors
+    /// and are not refined.
+    BC_COMPRESSION_QUALITY_FAST = 0,
+
+    /// Endpoints are refined with one least-squares pass.
+    BC_COMPRESSION_QUALITY_NORMAL,
+
+    /// Endpoints are refined with several least-squares passes, and
+    /// alternative BC4 modes and BC7 p-bit combinations are evaluated.
+    BC_COMPRESSION_QUALITY_HIGH
+};
+
 /// Coarse mip filter type
 DILIGENT_TYPED_ENUM(MIP_FILTER_TYPE, Uint8)
 {
@@ -109,6 +125,27 @@ struct ComputeMipLevelAttribs
     ///         A_new = max(A_old; 1/3 * A_old + 2/3 * AlphaCutoff)
     float AlphaCutoff          DEFAULT_INITIALIZER(0);
 
+    /// Block-compressed format of the coarse mip level, see CompressBC.
+    ///
+    /// \remarks
+    ///     When CompressedFormat is not TEX_FORMAT_UNKNOWN, the coarse mip level is
+    ///     additionally compressed into pCompressedCoarseMipData. Calling ComputeMipLevel
+    ///     for every level and keeping the uncompressed levels as the source for the next
+    ///     one produces a compressed mip chain without accumulating compression errors.
+    TEXTURE_FORMAT CompressedFormat DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// Pointer to the compressed coarse mip level data.
+    void* pCompressedCoarseMipData  DEFAULT_INITIALIZER(nullptr);
+
+    /// Compressed coarse mip level stride (the size of one row of blocks), in bytes.
+    size_t CompressedCoarseMipStride DEFAULT_INITIALIZER(0);
+
+    /// Compression quality.
+    BC_COMPRESSION_QUALITY CompressionQuality DEFAULT_INITIALIZER(BC_COMPRESSION_QUALITY_NORMAL);
+
+    /// Optional thread pool used to compress the coarse mip level.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr ComputeMipLevelAttribs() noexcept {}
 
@@ -136,7 +173,102 @@ struct ComputeMipLevelAttribs
 typedef struct ComputeMipLevelAttribs ComputeMipLevelAttribs;
 // clang-format on
 
-void DILIGENT_GLOBAL_FUNCTION(ComputeMipLevel)(const ComputeMipLevelAttribs REF Attribs);
+/// Computes the coarse mip level from the fine one and optionally compresses it.
+///
+/// \return    false if the coarse level could not be compressed into
+///            ComputeMipLevelAttribs::CompressedFormat (see CompressBC).
+///            Otherwise, true.
+Bool DILIGENT_GLOBAL_FUNCTION(ComputeMipLevel)(const ComputeMipLevelAttribs REF Attribs);
+
+
+// clang-format off
+
+/// CompressBC function attributes
+struct CompressBCAttribs
+{
+    /// Compressed format: BC1, BC3, BC4, BC5 or BC7 UNORM or UNORM_SRGB format.
+    TEXTURE_FORMAT DstFormat   DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// Source data format: TEX_FORMAT_RGBA8_UNORM(_SRGB), TEX_FORMAT_RG8_UNORM or TEX_FORMAT_R8_UNORM.
+    /// Missing green and blue channels are read as 0, missing alpha as 255.
+    TEXTURE_FORMAT SrcFormat   DEFAULT_INITIALIZER(TEX_FORMAT_RGBA8_UNORM);
+
+    /// Texture width.
+    Uint32 Width               DEFAULT_INITIALIZER(0);
+
+    /// Texture height.
+    Uint32 Height              DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the source data.
+    const void* pSrcData       DEFAULT_INITIALIZER(nullptr);
+
+    /// Source data stride, in bytes.
+    size_t SrcStride           DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the compressed data.
+    void* pDstData             DEFAULT_INITIALIZER(nullptr);
+
+    /// Compressed data stride (the size of one row of 4x4 blocks), in bytes.
+    size_t DstStride           DEFAULT_INITIALIZER(0);
+
+    /// Compression quality.
+    BC_COMPRESSION_QUALITY Quality DEFAULT_INITIALIZER(BC_COMPRESSION_QUALITY_NORMAL);
+
+    /// Optional thread pool. When not null, rows of blocks are
+    /// compressed in parallel by the pool threads and the calling thread.
+    IThreadPool* pThreadPool   DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct CompressBCAttribs CompressBCAttribs;
+
+/// DecompressBC function attributes
+struct DecompressBCAttribs
+{
+    /// Compressed format: BC1, BC3, BC4, BC5 or BC7 UNORM or UNORM_SRGB format.
+    TEXTURE_FORMAT SrcFormat   DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// Texture width.
+    Uint32 Width               DEFAULT_INITIALIZER(0);
+
+    /// Texture height.
+    Uint32 Height              DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the compressed data.
+    const void* pSrcData       DEFAULT_INITIALIZER(nullptr);
+
+    /// Compressed data stride (the size of one row of 4x4 blocks), in bytes.
+    size_t SrcStride           DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the decompressed RGBA8 data.
+    void* pDstData             DEFAULT_INITIALIZER(nullptr);
+
+    /// Decompressed data stride, in bytes.
+    size_t DstStride           DEFAULT_INITIALIZER(0);
+};
+typedef struct DecompressBCAttribs DecompressBCAttribs;
+// clang-format on
+
+/// Returns true if the format is supported by CompressBC and DecompressBC.
+Bool DILIGENT_GLOBAL_FUNCTION(IsBCCompressionSupported)(TEXTURE_FORMAT Format);
+
+/// Compresses RGBA8, RG8 or R8 data into one of the BC formats on the CPU.
+///
+/// \remarks   BC1 blocks that contain pixels with alpha below 128 use the
+///            punch-through alpha mode. BC7 blocks are encoded in mode 6.
+///            Partial blocks at the right and bottom edges are padded by
+///            replicating the last column and row.
+///
+/// \return    false if the destination or the source format is not supported
+///            (see IsBCCompressionSupported() and CompressBCAttribs::SrcFormat),
+///            in which case nothing is written. Otherwise, true.
+Bool DILIGENT_GLOBAL_FUNCTION(CompressBC)(const CompressBCAttribs REF Attribs);
+
+/// Decompresses BC data into RGBA8 data on the CPU.
+///
+/// \return    false if the format is not supported, in which case nothing is written,
+///            or if the data contains BC7 blocks in modes other than 6, which is the
+///            only mode produced by CompressBC. Such blocks are decompressed to
+///            transparent black. Otherwise, true.
+Bool DILIGENT_GLOBAL_FUNCTION(DecompressBC)(const DecompressBCAttribs REF Attribs);
 
 
 /// Creates a sparse texture in Metal backend.
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// CPU meshlet builder for mesh shader pipelines
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/BasicMath.hpp"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadPool.h"
+#include "BufferSuballocator.h"
+
+namespace Diligent
+{
+
+/// Meshlet description.
+
+/// The layout matches the structure that is read by the mesh shader.
+struct Meshlet
+{
+    /// Offset of the first vertex in the MeshletData::Vertices array.
+    Uint32 VertexOffset = 0;
+
+    /// Offset of the first primitive in the MeshletData::Primitives array.
+    Uint32 PrimitiveOffset = 0;
+
+    /// The number of vertices in the meshlet.
+    Uint32 VertexCount = 0;
+
+    /// The number of triangles in the meshlet.
+    Uint32 PrimitiveCount = 0;
+};
+static_assert(sizeof(Meshlet) == 16, "Meshlet is expected to be 16 bytes");
+
+/// Meshlet culling data.
+struct MeshletBounds
+{
+    /// Bounding sphere center (xyz) and radius (w).
+    float4 Sphere;
+
+    /// Normal cone axis (xyz) and cutoff (w).
+
+    /// The meshlet is back-facing and can be culled if
+    ///
+    ///     dot(normalize(ConeApex - CameraPos), ConeAxis.xyz) >= ConeAxis.w
+    ///
+    /// When the normals of the meshlet triangles span more than a hemisphere,
+    /// the cutoff is 1 and the meshlet is practically never culled.
+    float4 ConeAxis;
+
+    /// Normal cone apex (xyz). The w component is unused.
+    float4 ConeApex;
+};
+static_assert(sizeof(MeshletBounds) == 48, "MeshletBounds is expected to be 48 bytes");
+
+/// Range of the index buffer that is converted to meshlets independently.
+struct MeshletSubmesh
+{
+    /// Index of the first index in the index buffer.
+    Uint32 FirstIndex = 0;
+
+    /// The number of indices. Must be a multiple of 3.
+    Uint32 NumIndices = 0;
+};
+
+/// Range of meshlets produced for a submesh.
+struct MeshletRange
+{
+    /// Index of the first meshlet in the MeshletData::Meshlets array.
+    Uint32 FirstMeshlet = 0;
+
+    /// The number of meshlets.
+    Uint32 NumMeshlets = 0;
+};
+
+/// Output of BuildMeshlets.
+struct MeshletData
+{
+    /// Meshlets of all submeshes.
+    std::vector<Meshlet> Meshlets;
+
+    /// Culling data, one element for every meshlet.
+    std::vector<MeshletBounds> Bounds;
+
+    /// Indices of the meshlet vertices in the source vertex buffer.
+    std::vector<Uint32> Vertices;
+
+    /// Meshlet triangles. Every triangle is encoded as three 8-bit indices
+    /// into the meshlet vertices: i0 | (i1 << 8) | (i2 << 16).
+    std::vector<Uint32> Primitives;
+
+    /// Meshlet range for every submesh.
+    std::vector<MeshletRange> Submeshes;
+};
+
+/// BuildMeshlets function attributes.
+struct BuildMeshletsAttribs
+{
+    /// Pointer to the triangle list index data.
+    const void* pIndices = nullptr;
+
+    /// Index type, must be VT_UINT16 or VT_UINT32.
+    VALUE_TYPE IndexType = VT_UINT32;
+
+    /// The number of indices. Must be a multiple of 3.
+    Uint32 NumIndices = 0;
+
+    /// Pointer to the first vertex position. Positions are three 32-bit floats.
+    const void* pPositions = nullptr;
+
+    /// Position stride, in bytes. If zero, the positions are assumed to be tightly packed.
+    Uint32 PositionStride = 0;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Optional submeshes. If null, the entire index buffer is treated as a single submesh.
+    const MeshletSubmesh* pSubmeshes = nullptr;
+
+    /// The number of elements in the pSubmeshes array.
+    Uint32 NumSubmeshes = 0;
+
+    /// The maximum number of vertices in a meshlet, must be in range [3, 256].
+    Uint32 MaxVertices = 64;
+
+    /// The maximum number of triangles in a meshlet, must be in range [1, 512].
+    Uint32 MaxPrimitives = 124;
+
+    /// Optional thread pool. When not null, submeshes are processed
+    /// in parallel by the pool threads and the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Splits indexed triangle geometry into meshlets and computes their culling data.
+
+/// \remarks   Triangles are added to a meshlet greedily: the triangle that requires the fewest new
+///            vertices is picked among the triangles adjacent to the meshlet. Ties are resolved by the
+///            distance to the meshlet center, which keeps meshlets compact, and then in the index buffer
+///            order, so that meshlets inherit the locality of a vertex cache optimized index buffer.
+///
+///            Degenerate triangles are skipped. The result does not depend on whether a thread pool is used.
+void BuildMeshlets(const BuildMeshletsAttribs& Attribs, MeshletData& Data);
+
+
+/// Location of the meshlet data uploaded by UploadMeshlets.
+struct MeshletBufferRanges
+{
+    /// Suballocation that holds all meshlet data.
+    RefCntAutoPtr<IBufferSuballocation> pSuballocation;
+
+    /// Byte offsets of the MeshletData::Meshlets, Bounds, Vertices and Primitives arrays in the buffer.
+    /// All offsets are multiples of 16 bytes.
+    Uint32 MeshletsOffset   = 0;
+    Uint32 BoundsOffset     = 0;
+    Uint32 VerticesOffset   = 0;
+    Uint32 PrimitivesOffset = 0;
+};
+
+/// Allocates a range in the buffer suballocator and uploads the meshlet data to it.
+
+/// \param [in]  Data        - Meshlet data to upload.
+/// \param [in]  pDevice     - Render device used to resize the suballocator buffer, if necessary.
+/// \param [in]  pContext    - Device context used to update the buffer.
+/// \param [in]  pAllocator  - Buffer suballocator. The buffer must be bindable as a shader resource.
+/// \param [out] Ranges      - Location of the uploaded data.
+///
+/// \remarks    Meshlet::VertexOffset and Meshlet::PrimitiveOffset are relative to the
+///             beginning of the corresponding arrays: the shader needs to add
+///             Ranges.VerticesOffset / 4 and Ranges.PrimitivesOffset / 4, respectively,
+///             when the buffer is accessed as an array of 32-bit values.
+void UploadMeshlets(const MeshletData&   Data,
+                    IRenderDevice*       pDevice,
+                    IDeviceContext*      pContext,
+                    IBufferSuballocator* pAllocator,
+                    MeshletBufferRanges& Ranges);
+
+} // namespace Diligent
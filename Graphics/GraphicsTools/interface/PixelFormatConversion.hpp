@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// CPU conversion between common uncompressed texture formats
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../GraphicsEngine/interface/TextureView.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// ConvertPixels function attributes
+struct ConvertPixelsAttribs
+{
+    /// Source format, see IsPixelConversionSupported.
+    TEXTURE_FORMAT SrcFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Destination format, see IsPixelConversionSupported.
+    TEXTURE_FORMAT DstFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Image width.
+    Uint32 Width = 0;
+
+    /// Image height.
+    Uint32 Height = 0;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source row stride, in bytes.
+    size_t SrcStride = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination row stride, in bytes.
+    size_t DstStride = 0;
+
+    /// Component mapping applied to the source color before it is written to the destination.
+    /// For example, {B, G, R, A} swaps the red and blue channels.
+    TextureComponentMapping Swizzle = TextureComponentMapping::Identity();
+
+    /// Whether to multiply the color channels by alpha.
+    /// The multiplication is performed in linear space.
+    bool PremultiplyAlpha = false;
+
+    /// Whether to flip the image vertically, e.g. to convert
+    /// OpenGL readback data to top-down row order.
+    bool FlipVertically = false;
+
+    /// Optional thread pool. When not null, rows are converted
+    /// in parallel by the pool threads and the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Returns true if the format is supported by ConvertPixels.
+
+/// \remarks   The following formats are supported:
+///            - TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB
+///            - TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_BGRA8_UNORM_SRGB
+///            - TEX_FORMAT_RGBA16_FLOAT
+///            - TEX_FORMAT_R11G11B10_FLOAT
+///            - TEX_FORMAT_RGB10A2_UNORM
+///            - TEX_FORMAT_RGBA32_FLOAT
+bool IsPixelConversionSupported(TEXTURE_FORMAT Format);
+
+/// Converts pixels between two supported formats on the CPU.
+
+/// \remarks   sRGB formats are decoded to linear space and encoded back when the destination
+///            format is sRGB. Conversions between 8-bit formats with the same color space that
+///            do not require premultiplication are performed without going through floating point.
+///            Values that do not fit into the destination format are clamped, and channels
+///            that are missing in the source format are read as 0 for color and 1 for alpha.
+///
+///            Source and destination memory must not overlap.
+void ConvertPixels(const ConvertPixelsAttribs& Attribs);
+
+} // namespace Diligent
@@ -96,6 +96,42 @@ struct RenderStateCacheCreateInfo
 };
 typedef struct RenderStateCacheCreateInfo RenderStateCacheCreateInfo;
 
+/// Statistics of the last IRenderStateCache::Reload call.
+struct RenderStateCacheReloadStats
+{
+    /// The number of shader source files checked for changes.
+    Uint32 NumSourceFiles DEFAULT_INITIALIZER(0);
+
+    /// The number of shader source files that were read and hashed.
+    /// Memory-mapped files whose modification time and size have not changed are not read.
+    Uint32 NumSourceFilesRead DEFAULT_INITIALIZER(0);
+
+    /// The number of reloadable shaders in the cache.
+    Uint32 NumShaders DEFAULT_INITIALIZER(0);
+
+    /// The number of shaders that were re-created.
+    Uint32 NumShadersReloaded DEFAULT_INITIALIZER(0);
+
+    /// The number of shaders whose sources have changed, but that failed to reload.
+    Uint32 NumShadersFailed DEFAULT_INITIALIZER(0);
+
+    /// The number of reloadable pipelines in the cache.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// The number of pipelines that were re-created.
+    Uint32 NumPipelinesReloaded DEFAULT_INITIALIZER(0);
+
+    /// The number of new render states created, same as the value returned by IRenderStateCache::Reload.
+    Uint32 NumStatesCreated DEFAULT_INITIALIZER(0);
+
+    /// Time, in seconds, spent checking the sources and re-creating the shaders.
+    double ShaderReloadTime DEFAULT_INITIALIZER(0);
+
+    /// Time, in seconds, spent re-creating the pipelines.
+    double PipelineReloadTime DEFAULT_INITIALIZER(0);
+};
+typedef struct RenderStateCacheReloadStats RenderStateCacheReloadStats;
+
 #include "../../../Primitives/interface/DefineRefMacro.h"
 
 /// Type of the callback function called by the IRenderStateCache::Reload method.
@@ -239,10 +275,17 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///                                       pipeline.
     /// \param [in]  pUserData              - A pointer to the user-specific data to pass to ReloadGraphicsPipeline callback.
     ///
-    /// \return     The total number of render states (shaders and pipelines) that were reloaded.
+    /// \return     The total number of new render states (shaders and pipelines) created by the reload.
+    ///             States that failed to reload or were found in the cache are not counted.
     ///
     /// \remars     Reloading is only enabled if the cache was created with the EnableHotReload member of
     ///             RenderStateCacheCreateInfo member set to true.
+    ///
+    ///             Only shaders whose source files (the main file and all files it includes, directly or
+    ///             indirectly) have changed are reloaded, followed by the pipelines that use these shaders.
+    ///             If ReloadGraphicsPipeline callback is provided, all graphics pipelines are reloaded.
+    ///             Memory-mapped source files whose modification time and size have not changed since
+    ///             the previous reload are not read again.
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
@@ -255,6 +298,11 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     /// Returns the reload version of the cache data.
     /// The reload version is incremented every time the cache is reloaded.
     VIRTUAL Uint32 METHOD(GetReloadVersion)(THIS) CONST PURE;
+
+
+    /// Returns the statistics of the last reload, see Diligent::RenderStateCacheReloadStats.
+    VIRTUAL void METHOD(GetLastReloadStats)(THIS_
+                                            RenderStateCacheReloadStats REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -275,6 +323,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
 #    define IRenderStateCache_GetReloadVersion(This)                   CALL_IFACE_METHOD(RenderStateCache, GetReloadVersion,             This)
+#    define IRenderStateCache_GetLastReloadStats(This, ...)            CALL_IFACE_METHOD(RenderStateCache, GetLastReloadStats,           This, __VA_ARGS__)
 // clang-format on
 
 #endif
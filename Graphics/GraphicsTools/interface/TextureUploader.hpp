@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 
@@ -47,10 +49,12 @@ struct UploadBufferDesc
 
     bool operator == (const UploadBufferDesc &rhs) const
     {
-        return Width  == rhs.Width  &&
-                Height == rhs.Height &&
-                Depth  == rhs.Depth  &&
-                Format == rhs.Format;
+        return Width     == rhs.Width     &&
+               Height    == rhs.Height    &&
+               Depth     == rhs.Depth     &&
+               MipLevels == rhs.MipLevels &&
+               ArraySize == rhs.ArraySize &&
+               Format    == rhs.Format;
     }
 };
 // clang-format on
@@ -58,7 +62,18 @@ struct UploadBufferDesc
 class IUploadBuffer : public IObject
 {
 public:
-    virtual void                     WaitForCopyScheduled()                  = 0;
+    /// Blocks until the GPU copy from this buffer has been scheduled.
+    virtual void WaitForCopyScheduled() = 0;
+
+    /// Blocks until the buffer has been mapped and its data can be written.
+    virtual void WaitForMap() = 0;
+
+    /// Returns true if the buffer has been mapped. The method never blocks.
+    virtual bool IsMapCompleted() = 0;
+
+    /// Returns true if the GPU copy from this buffer has been scheduled. The method never blocks.
+    virtual bool IsCopyScheduled() = 0;
+
     virtual MappedTextureSubresource GetMappedData(Uint32 Mip, Uint32 Slice) = 0;
     virtual const UploadBufferDesc&  GetDesc() const                         = 0;
 };
@@ -66,13 +81,65 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// Staging memory budget, in bytes.
+
+    /// When the total size of the upload buffers owned by the uploader exceeds the budget,
+    /// recycled buffers are released instead of being kept for reuse, so that the staging
+    /// memory retained between uploads does not grow past this value. Allocations are never
+    /// blocked by the budget. Zero means no limit.
+    Uint64 StagingMemoryBudget = 0;
 };
 
 
 /// Texture uploader statistics.
 struct TextureUploaderStats
 {
+    /// The number of operations waiting for the next ITextureUploader::RenderThreadUpdate call.
     Uint32 NumPendingOperations = 0;
+
+    /// The total number of bytes copied from upload buffers to destination textures.
+    Uint64 TotalBytesUploaded = 0;
+
+    /// Upload bandwidth, in bytes per second, measured between
+    /// ITextureUploader::GetStats calls at least half a second apart.
+    Uint64 UploadBandwidth = 0;
+
+    /// The total size of upload buffers allocated by the uploader, in bytes.
+    Uint64 StagingMemorySize = 0;
+};
+
+/// Attributes of the ITextureUploader::ScheduleGPUCopy operation.
+struct ScheduleGPUCopyAttribs
+{
+    /// Destination texture for copy operation.
+    ITexture* pDstTexture = nullptr;
+
+    /// Destination array slice. When multiple slices are copied, the starting slice.
+    Uint32 ArraySlice = 0;
+
+    /// Destination mip level. When multiple mip levels are copied, the starting mip level.
+    Uint32 MipLevel = 0;
+
+    /// Horizontal offset of the copied region in the destination mip level.
+
+    /// Offsets allow a mip level to be uploaded in tiles through an upload buffer that is
+    /// smaller than the mip level itself. When the upload buffer contains multiple mip levels,
+    /// the offset is shifted right by the mip index for every subsequent level.
+    /// For compressed formats, the offset must be a multiple of the block width.
+    Uint32 DstX = 0;
+
+    /// Vertical offset of the copied region in the destination mip level, see DstX.
+    Uint32 DstY = 0;
+
+    /// Upload buffer to copy data from.
+    IUploadBuffer* pUploadBuffer = nullptr;
+
+    /// An optional callback that is called when the copy has been scheduled on the GPU.
+
+    /// The callback is called by the thread that executes the copy, which is the render thread
+    /// calling ScheduleGPUCopy or RenderThreadUpdate with a non-null device context.
+    /// The upload buffer may be recycled from the callback.
+    std::function<void()> OnCopyScheduled = nullptr;
 };
 
 /// Asynchronous texture uploader
@@ -80,6 +147,11 @@ class ITextureUploader : public IObject
 {
 public:
     /// Executes pending render-thread operations
+
+    /// \remarks  In Direct3D12 and Vulkan, pContext may be an immediate context of
+    ///           a transfer queue, in which case uploads do not occupy the graphics queue.
+    ///           Deferred contexts are not supported: the uploader maps staging resources
+    ///           and, in Direct3D12 and Vulkan, signals a fence after the copies are recorded.
     virtual void RenderThreadUpdate(IDeviceContext* pContext) = 0;
 
 
@@ -108,6 +180,20 @@ public:
                                       IUploadBuffer**         ppBuffer) = 0;
 
 
+    /// Allocates upload buffer without waiting for it to be mapped.
+
+    /// \param [in]  Desc       - Buffer description, see Diligent::UploadBufferDesc.
+    /// \param [out] ppBuffer   - Memory address where pointer to the created upload buffer
+    ///                           object will be written to.
+    ///
+    /// \remarks  The method never blocks and can be called from any thread, including the
+    ///           render thread. The buffer is mapped by the next RenderThreadUpdate call.
+    ///           Use IUploadBuffer::IsMapCompleted to poll the buffer state, or
+    ///           IUploadBuffer::WaitForMap to wait for it, before writing the data.
+    virtual void AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                           IUploadBuffer**         ppBuffer) = 0;
+
+
     /// Schedules a GPU copy or executes the copy immediately.
 
     /// \param [in] pContext      - Pointer to the device context when the method is executed by
@@ -134,6 +220,18 @@ public:
                                  IUploadBuffer*  pUploadBuffer) = 0;
 
 
+    /// Schedules a GPU copy of the upload buffer to a region of the destination texture
+    /// or executes the copy immediately.
+
+    /// \param [in] pContext - Pointer to the device context when the method is executed by
+    ///                        render thread, or null when it is called from a worker thread.
+    /// \param [in] Attribs  - Copy attributes, see Diligent::ScheduleGPUCopyAttribs.
+    ///
+    /// \remarks  The same threading rules as for the ScheduleGPUCopy overload above apply.
+    virtual void ScheduleGPUCopy(IDeviceContext*               pContext,
+                                 const ScheduleGPUCopyAttribs& Attribs) = 0;
+
+
     /// Recycles upload buffer to make it available for future operations.
 
     /// \param [in] pUploadBuffer - Upload buffer to recycle.
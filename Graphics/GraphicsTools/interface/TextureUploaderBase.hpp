@@ -28,11 +28,23 @@
 #pragma once
 
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
 
 #include "TextureUploader.hpp"
+#include "../../GraphicsAccessories/interface/GraphicsAccessories.hpp"
 #include "../../../Common/interface/ObjectBase.hpp"
 #include "../../../Common/interface/HashUtils.hpp"
 #include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadSignal.hpp"
+#include "../../../Common/interface/Timer.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
 
 namespace std
 {
@@ -42,7 +54,7 @@ struct hash<Diligent::UploadBufferDesc>
 {
     size_t operator()(const Diligent::UploadBufferDesc& Desc) const
     {
-        return Diligent::ComputeHash(Desc.Width, Desc.Height, Desc.Depth, static_cast<Diligent::Int32>(Desc.Format));
+        return Diligent::ComputeHash(Desc.Width, Desc.Height, Desc.Depth, Desc.MipLevels, Desc.ArraySize, static_cast<Diligent::Int32>(Desc.Format));
     }
 };
 
@@ -57,11 +69,100 @@ public:
         // clang-format off
         ObjectBase<IUploadBuffer>{pRefCounters},
         m_Desc                   {Desc},
-        m_MappedData             (size_t{m_Desc.ArraySize} * size_t{m_Desc.MipLevels})
+        m_MappedData             (size_t{m_Desc.ArraySize} * size_t{m_Desc.MipLevels}),
+        m_DataSize               {ComputeDataSize(Desc)}
     // clang-format on
     {
     }
 
+    ~UploadBufferBase()
+    {
+        if (m_pStagingMemorySize)
+        {
+            VERIFY_EXPR(m_pStagingMemorySize->load() >= m_DataSize);
+            m_pStagingMemorySize->fetch_sub(m_DataSize);
+        }
+    }
+
+    // Adds the buffer size to the staging memory size of the uploader. The size is subtracted when
+    // the buffer is destroyed, which may happen after the uploader is released.
+    void TrackStagingMemory(std::shared_ptr<std::atomic<Uint64>> pStagingMemorySize)
+    {
+        VERIFY(!m_pStagingMemorySize, "Staging memory of this buffer is already tracked");
+        m_pStagingMemorySize = std::move(pStagingMemorySize);
+        m_pStagingMemorySize->fetch_add(m_DataSize);
+    }
+
+    virtual void WaitForCopyScheduled() override final
+    {
+        m_CopyScheduledSignal.Wait();
+    }
+
+    virtual void WaitForMap() override final
+    {
+        m_BufferMappedSignal.Wait();
+    }
+
+    virtual bool IsMapCompleted() override final
+    {
+        return m_BufferMappedSignal.IsTriggered();
+    }
+
+    virtual bool IsCopyScheduled() override final
+    {
+        return m_CopyScheduledSignal.IsTriggered();
+    }
+
+    void SignalMapped()
+    {
+        m_BufferMappedSignal.Trigger();
+    }
+
+    void SetCopyScheduledCallback(std::function<void()> Callback)
+    {
+        m_CopyScheduledCallback = std::move(Callback);
+    }
+
+    void SignalCopyScheduled()
+    {
+        // The buffer may be recycled and reused by another thread as soon as the signal is triggered,
+        // so take the callback first.
+        auto Callback           = std::move(m_CopyScheduledCallback);
+        m_CopyScheduledCallback = nullptr;
+        m_CopyScheduledSignal.Trigger();
+        if (Callback)
+            Callback();
+    }
+
+    bool DbgIsMapped() const
+    {
+        return m_BufferMappedSignal.IsTriggered();
+    }
+
+    bool DbgIsCopyScheduled() const
+    {
+        return m_CopyScheduledSignal.IsTriggered();
+    }
+
+    /// Returns the size of the texture data stored in the buffer, not including any padding.
+    Uint64 GetDataSize() const { return m_DataSize; }
+
+    static Uint64 ComputeDataSize(const UploadBufferDesc& Desc)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Type      = Desc.ArraySize == 1 ? RESOURCE_DIM_TEX_2D : RESOURCE_DIM_TEX_2D_ARRAY;
+        TexDesc.Width     = Desc.Width;
+        TexDesc.Height    = Desc.Height;
+        TexDesc.Format    = Desc.Format;
+        TexDesc.MipLevels = Desc.MipLevels;
+        TexDesc.ArraySize = Desc.ArraySize;
+
+        Uint64 SliceSize = 0;
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            SliceSize += GetMipLevelProperties(TexDesc, Mip).MipSize;
+        return SliceSize * Desc.ArraySize;
+    }
+
     virtual MappedTextureSubresource GetMappedData(Uint32 Mip, Uint32 Slice) override final
     {
         VERIFY_EXPR(Mip < m_Desc.MipLevels && Slice < m_Desc.ArraySize);
@@ -83,6 +184,9 @@ public:
 
     void Reset()
     {
+        m_BufferMappedSignal.Reset();
+        m_CopyScheduledSignal.Reset();
+        m_CopyScheduledCallback = nullptr;
         for (auto& MappedData : m_MappedData)
             MappedData = MappedTextureSubresource{};
     }
@@ -90,6 +194,14 @@ public:
 protected:
     const UploadBufferDesc                m_Desc;
     std::vector<MappedTextureSubresource> m_MappedData;
+    const Uint64                          m_DataSize;
+
+    Threading::Signal m_BufferMappedSignal;
+    Threading::Signal m_CopyScheduledSignal;
+
+    std::function<void()> m_CopyScheduledCallback;
+
+    std::shared_ptr<std::atomic<Uint64>> m_pStagingMemorySize;
 };
 
 class TextureUploaderBase : public ObjectBase<ITextureUploader>
@@ -97,11 +209,158 @@ class TextureUploaderBase : public ObjectBase<ITextureUploader>
 public:
     TextureUploaderBase(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
         ObjectBase<ITextureUploader>{pRefCounters},
-        m_pDevice{pDevice}
+        m_pDevice{pDevice},
+        m_StagingMemoryBudget{Desc.StagingMemoryBudget},
+        m_pStagingMemorySize{std::make_shared<std::atomic<Uint64>>(0)}
     {}
 
+    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
+                                 ITexture*       pDstTexture,
+                                 Uint32          ArraySlice,
+                                 Uint32          MipLevel,
+                                 IUploadBuffer*  pUploadBuffer) override final
+    {
+        ScheduleGPUCopyAttribs Attribs;
+        Attribs.pDstTexture   = pDstTexture;
+        Attribs.ArraySlice    = ArraySlice;
+        Attribs.MipLevel      = MipLevel;
+        Attribs.pUploadBuffer = pUploadBuffer;
+        ScheduleGPUCopy(pContext, Attribs);
+    }
+
+    using ITextureUploader::ScheduleGPUCopy;
+
+protected:
+    // Region of an upload buffer mip level and its position in the destination texture.
+    struct CopyRegion
+    {
+        Box    SrcBox;
+        Uint32 DstX = 0;
+        Uint32 DstY = 0;
+    };
+
+    // Computes the region of the upload buffer mip level that is copied to the destination mip level
+    // DstMip + Mip at the offset scaled down for this level. The region is clipped to the destination
+    // mip level and, for compressed formats, extended to the block boundary at the mip level edge.
+    // Returns false if the region is empty.
+    static bool GetCopyRegion(const UploadBufferDesc& SrcDesc,
+                              const TextureDesc&      DstDesc,
+                              Uint32                  DstMip,
+                              Uint32                  DstX,
+                              Uint32                  DstY,
+                              Uint32                  Mip,
+                              CopyRegion&             Region)
+    {
+        const auto DstMipProps = GetMipLevelProperties(DstDesc, DstMip + Mip);
+
+        Region.DstX = DstX >> Mip;
+        Region.DstY = DstY >> Mip;
+        if (Region.DstX >= DstMipProps.LogicalWidth || Region.DstY >= DstMipProps.LogicalHeight)
+            return false;
+
+        Uint32 Width  = std::min(std::max(SrcDesc.Width >> Mip, 1u), DstMipProps.LogicalWidth - Region.DstX);
+        Uint32 Height = std::min(std::max(SrcDesc.Height >> Mip, 1u), DstMipProps.LogicalHeight - Region.DstY);
+
+        const auto& FmtAttribs = GetTextureFormatAttribs(DstDesc.Format);
+        if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+        {
+            Width  = AlignUp(Width, Uint32{FmtAttribs.BlockWidth});
+            Height = AlignUp(Height, Uint32{FmtAttribs.BlockHeight});
+        }
+
+        Region.SrcBox = Box{0, Width, 0, Height};
+        return true;
+    }
+
+    // Validates the copy attributes and sets the callback to call when the copy is scheduled.
+    void PrepareGPUCopy(IDeviceContext* pContext, UploadBufferBase& Buffer, const ScheduleGPUCopyAttribs& Attribs)
+    {
+        DEV_CHECK_ERR(pContext == nullptr || !pContext->GetDesc().IsDeferred, "Texture uploader does not support deferred contexts");
+        DEV_CHECK_ERR(Attribs.pDstTexture != nullptr, "Destination texture must not be null");
+#ifdef DILIGENT_DEVELOPMENT
+        {
+            const auto& SrcDesc    = Buffer.GetDesc();
+            const auto& FmtAttribs = GetTextureFormatAttribs(SrcDesc.Format);
+            if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+            {
+                for (Uint32 Mip = 0; Mip < SrcDesc.MipLevels; ++Mip)
+                {
+                    DEV_CHECK_ERR((Attribs.DstX >> Mip) % FmtAttribs.BlockWidth == 0 && (Attribs.DstY >> Mip) % FmtAttribs.BlockHeight == 0,
+                                  "Destination offset (", Attribs.DstX, ", ", Attribs.DstY, ") scaled down for mip level ", Mip, " of the upload buffer is not a multiple of the ",
+                                  Uint32{FmtAttribs.BlockWidth}, "x", Uint32{FmtAttribs.BlockHeight}, " block size of the ", FmtAttribs.Name, " format.");
+                }
+            }
+        }
+#endif
+        Buffer.SetCopyScheduledCallback(Attribs.OnCopyScheduled);
+    }
+
+    void OnUploadBufferCreated(UploadBufferBase& Buffer)
+    {
+        Buffer.TrackStagingMemory(m_pStagingMemorySize);
+    }
+
+    void OnCopyExecuted(const UploadBufferBase& Buffer)
+    {
+        m_TotalBytesUploaded.fetch_add(Buffer.GetDataSize());
+    }
+
+    bool IsStagingMemoryBudgetExceeded() const
+    {
+        return m_StagingMemoryBudget != 0 && m_pStagingMemorySize->load() > m_StagingMemoryBudget;
+    }
+
+    // Releases cached upload buffers until the staging memory size fits into the budget.
+    // Every buffer subtracts its size when it is destroyed. The cache mutex must be locked by the caller.
+    template <typename UploadBufferType>
+    void TrimUploadBufferCache(std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadBufferType>>>& Cache)
+    {
+        for (auto it = Cache.begin(); it != Cache.end() && IsStagingMemoryBudgetExceeded();)
+        {
+            auto& Deque = it->second;
+            while (!Deque.empty() && IsStagingMemoryBudgetExceeded())
+                Deque.pop_front();
+
+            if (Deque.empty())
+                it = Cache.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    void GetUploadStats(TextureUploaderStats& Stats)
+    {
+        Stats.TotalBytesUploaded = m_TotalBytesUploaded.load();
+        Stats.StagingMemorySize  = m_pStagingMemorySize->load();
+
+        std::lock_guard<std::mutex> Lock{m_BandwidthMtx};
+
+        const auto CurrTime = m_BandwidthTimer.GetElapsedTime();
+        const auto Period   = CurrTime - m_BandwidthPeriodStartTime;
+        if (Period >= 0.5)
+        {
+            const auto PeriodBytes      = Stats.TotalBytesUploaded - m_BandwidthPeriodStartBytes;
+            m_UploadBandwidth           = static_cast<Uint64>(static_cast<double>(PeriodBytes) / Period);
+            m_BandwidthPeriodStartTime  = CurrTime;
+            m_BandwidthPeriodStartBytes = Stats.TotalBytesUploaded;
+        }
+        Stats.UploadBandwidth = m_UploadBandwidth;
+    }
+
 protected:
     RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint64 m_StagingMemoryBudget;
+
+    // Shared with the upload buffers as they may outlive the uploader
+    std::shared_ptr<std::atomic<Uint64>> m_pStagingMemorySize;
+    std::atomic<Uint64>                  m_TotalBytesUploaded{0};
+
+    std::mutex m_BandwidthMtx;
+    Timer      m_BandwidthTimer;
+    double     m_BandwidthPeriodStartTime  = 0;
+    Uint64     m_BandwidthPeriodStartBytes = 0;
+    Uint64     m_UploadBandwidth           = 0;
 };
 
 } // namespace Diligent
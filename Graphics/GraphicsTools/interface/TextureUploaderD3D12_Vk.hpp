@@ -46,17 +46,24 @@ public:
                                       const UploadBufferDesc& Desc,
                                       IUploadBuffer**         ppBuffer) override final;
 
-    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
-                                 ITexture*       pDstTexture,
-                                 Uint32          ArraySlice,
-                                 Uint32          MipLevel,
-                                 IUploadBuffer*  pUploadBuffer) override final;
+    virtual void AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                           IUploadBuffer**         ppBuffer) override final;
+
+    using TextureUploaderBase::ScheduleGPUCopy;
+
+    virtual void ScheduleGPUCopy(IDeviceContext*               pContext,
+                                 const ScheduleGPUCopyAttribs& Attribs) override final;
 
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final;
 
     virtual TextureUploaderStats GetStats() override final;
 
 private:
+    void AllocateUploadBufferImpl(IDeviceContext*         pContext,
+                                  const UploadBufferDesc& Desc,
+                                  IUploadBuffer**         ppBuffer,
+                                  bool                    WaitForMap);
+
     struct InternalData;
     std::unique_ptr<InternalData> m_pInternalData;
 };
@@ -102,6 +102,10 @@ struct VertexPoolUsageStats
     /// The total memory size used by all allocations, in bytes.
     Uint64 UsedMemorySize = 0;
 
+    /// The number of vertices reserved by per-thread arenas that are not
+    /// allocated (see VertexPoolCreateInfo::ThreadArenaVertexCount).
+    Uint64 ArenaFreeVertexCount = 0;
+
     /// The number of allocations.
     Uint32 AllocationCount = 0;
 
@@ -111,6 +115,7 @@ struct VertexPoolUsageStats
         AllocatedVertexCount += RHS.AllocatedVertexCount;
         CommittedMemorySize += RHS.CommittedMemorySize;
         UsedMemorySize += RHS.UsedMemorySize;
+        ArenaFreeVertexCount += RHS.ArenaFreeVertexCount;
         AllocationCount += RHS.AllocationCount;
         return *this;
     }
@@ -279,6 +284,21 @@ struct VertexPoolCreateInfo
     /// If zero, the number of vertices is unlimited.
     Uint32 MaxVertexCount = 0;
 
+    /// The number of vertices that every thread reserves in the pool.
+
+    /// When non-zero, every thread reserves ranges of this many vertices from the pool
+    /// and suballocates small allocations (up to 1/4 of the range) from its own ranges
+    /// without taking the global pool lock. Empty ranges, except for the last one, are
+    /// returned to the pool.
+    /// If zero, all allocations are performed from the pool directly.
+    Uint32 ThreadArenaVertexCount = 0;
+
+    /// The number of per-thread arenas. If zero, the number of hardware threads is used.
+    /// Threads are distributed between arenas in a round-robin fashion.
+    ///
+    /// \remarks   The member is ignored if ThreadArenaVertexCount is zero.
+    Uint32 NumThreadArenas = 0;
+
     /// Whether to disable debug validation of the internal pool structure.
 
     /// \remarks    By default, internal pool structure is validated in debug
@@ -294,6 +314,8 @@ struct VertexPoolCreateInfo
         return Desc == RHS.Desc &&
             ExtraVertexCount == RHS.ExtraVertexCount &&
             MaxVertexCount == RHS.MaxVertexCount &&
+            ThreadArenaVertexCount == RHS.ThreadArenaVertexCount &&
+            NumThreadArenas == RHS.NumThreadArenas &&
             DisableDebugValidation == RHS.DisableDebugValidation;
     }
 
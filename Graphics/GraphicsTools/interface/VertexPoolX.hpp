@@ -182,6 +182,18 @@ struct VertexPoolCreateInfoX : private _VertexPoolCreateInfo, public VertexPoolD
         return *this;
     }
 
+    VertexPoolCreateInfoX& SetThreadArenaVertexCount(Uint32 _ThreadArenaVertexCount)
+    {
+        m_PrivateCI.ThreadArenaVertexCount = _ThreadArenaVertexCount;
+        return *this;
+    }
+
+    VertexPoolCreateInfoX& SetNumThreadArenas(Uint32 _NumThreadArenas)
+    {
+        m_PrivateCI.NumThreadArenas = _NumThreadArenas;
+        return *this;
+    }
+
     VertexPoolCreateInfoX& SetDisableDebugValidation(bool _DisableDebugValidation)
     {
         m_PrivateCI.DisableDebugValidation = _DisableDebugValidation;
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cstring>
+#include <memory>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Graphics/GraphicsEngine/interface/Shader.h"
@@ -49,6 +50,13 @@ struct XXH128Hash
     }
 };
 
+/// XXH3 128-bit hasher.
+
+/// The data passed to Update() methods is appended to a canonical byte buffer
+/// (strings are inlined, pointers are resolved to the data they point to),
+/// and the buffer is hashed in a single XXH3 call by Digest().
+/// Large inputs are streamed to the XXH3 state in big blocks. The result is the same as
+/// streaming every field to XXH3 separately, but is much faster for small fields.
 struct XXH128State final
 {
     XXH128State();
@@ -59,15 +67,19 @@ struct XXH128State final
     XXH128State& operator=(const XXH128State& RHS) = delete;
 
     XXH128State(XXH128State&& RHS) noexcept :
+        m_Buffer{std::move(RHS.m_Buffer)},
+        m_BufferSize{RHS.m_BufferSize},
         m_State{RHS.m_State}
     {
-        RHS.m_State = nullptr;
+        RHS.m_BufferSize = 0;
+        RHS.m_State      = nullptr;
     }
 
     XXH128State& operator=(XXH128State&& RHS) noexcept
     {
-        this->m_State = RHS.m_State;
-        RHS.m_State   = nullptr;
+        std::swap(m_Buffer, RHS.m_Buffer);
+        std::swap(m_BufferSize, RHS.m_BufferSize);
+        std::swap(m_State, RHS.m_State);
 
         return *this;
     }
@@ -100,7 +112,20 @@ struct XXH128State final
         Update(RestArgs...);
     }
 
-    void UpdateRaw(const void* pData, uint64_t Size) noexcept;
+    void UpdateRaw(const void* pData, uint64_t Size) noexcept
+    {
+        VERIFY_EXPR(pData != nullptr);
+        VERIFY_EXPR(Size != 0);
+        if (Size <= MaxBufferSize - m_BufferSize)
+        {
+            std::memcpy(&m_Buffer[m_BufferSize], pData, static_cast<size_t>(Size));
+            m_BufferSize += static_cast<size_t>(Size);
+        }
+        else
+        {
+            UpdateLarge(pData, Size);
+        }
+    }
 
     template <typename T>
     typename std::enable_if<(std::is_same<typename std::remove_cv<T>::type, char>::value ||
@@ -166,7 +191,22 @@ struct XXH128State final
 
     XXH128Hash Digest() noexcept;
 
+    /// Resets the hasher to the initial state while keeping the allocated memory,
+    /// so that the same object can be efficiently reused to compute multiple hashes.
+    void Reset() noexcept;
+
 private:
+    void UpdateLarge(const void* pData, uint64_t Size) noexcept;
+    void FlushBuffer() noexcept;
+
+    // The size of the buffer after which the data is streamed to the XXH3 state
+    static constexpr size_t MaxBufferSize = 16384;
+
+    // The buffer is allocated once by the constructor, so updating the hash never allocates memory
+    std::unique_ptr<Uint8[]> m_Buffer;
+    size_t                   m_BufferSize = 0;
+
+    // Streaming state, only created when the data does not fit into the buffer
     XXH3_state_s* m_State = nullptr;
 };
 
@@ -0,0 +1,1125 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// All encoders work on 4x4 blocks of 16-bit RGBA pixels. Channels that do not
+// participate in the encoding are zeroed in both the pixels and the palette, so that
+// the same palette search is used for all formats.
+struct alignas(16) BlockPixels
+{
+    Int16 p[16][4];
+};
+
+struct alignas(16) BlockPalette
+{
+    Int16 p[16][4];
+};
+
+// Finds the closest palette entry for every block pixel (squared Euclidean
+// distance over all four channels) and returns the total error.
+// Ties are resolved in favor of the lower index.
+Uint32 FindClosestEntries(const BlockPixels& Pixels, const BlockPalette& Palette, Uint32 NumEntries, Uint8 Indices[], Uint32 Errors[] = nullptr)
+{
+    VERIFY_EXPR(NumEntries > 0 && NumEntries <= 16);
+
+#if DILIGENT_SSE2_ENABLED
+    __m128i Px[8];
+    for (Uint32 i = 0; i < 8; ++i)
+        Px[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(Pixels.p[i * 2]));
+
+    __m128i BestDist[4];
+    __m128i BestIdx[4];
+    for (Uint32 g = 0; g < 4; ++g)
+    {
+        BestDist[g] = _mm_set1_epi32(0x7FFFFFFF);
+        BestIdx[g]  = _mm_setzero_si128();
+    }
+
+    for (Uint32 e = 0; e < NumEntries; ++e)
+    {
+        __m128i Entry = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Palette.p[e]));
+        Entry         = _mm_unpacklo_epi64(Entry, Entry);
+
+        const __m128i EntryIdx = _mm_set1_epi32(static_cast<int>(e));
+        for (Uint32 g = 0; g < 4; ++g)
+        {
+            // Every madd produces the (R,G) and (B,A) partial distances of two pixels
+            const __m128i Diff0 = _mm_sub_epi16(Px[g * 2 + 0], Entry);
+            const __m128i Diff1 = _mm_sub_epi16(Px[g * 2 + 1], Entry);
+            const __m128  Dist0 = _mm_castsi128_ps(_mm_madd_epi16(Diff0, Diff0));
+            const __m128  Dist1 = _mm_castsi128_ps(_mm_madd_epi16(Diff1, Diff1));
+
+            const __m128i RG   = _mm_castps_si128(_mm_shuffle_ps(Dist0, Dist1, _MM_SHUFFLE(2, 0, 2, 0)));
+            const __m128i BA   = _mm_castps_si128(_mm_shuffle_ps(Dist0, Dist1, _MM_SHUFFLE(3, 1, 3, 1)));
+            const __m128i Dist = _mm_add_epi32(RG, BA);
+
+            const __m128i Less = _mm_cmplt_epi32(Dist, BestDist[g]);
+            BestDist[g]        = _mm_or_si128(_mm_and_si128(Less, Dist), _mm_andnot_si128(Less, BestDist[g]));
+            BestIdx[g]         = _mm_or_si128(_mm_and_si128(Less, EntryIdx), _mm_andnot_si128(Less, BestIdx[g]));
+        }
+    }
+
+    alignas(16) Uint32 Dist[16];
+    alignas(16) Uint32 Idx[16];
+    for (Uint32 g = 0; g < 4; ++g)
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(Dist + g * 4), BestDist[g]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Idx + g * 4), BestIdx[g]);
+    }
+
+    Uint32 TotalError = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        Indices[i] = static_cast<Uint8>(Idx[i]);
+        TotalError += Dist[i];
+        if (Errors != nullptr)
+            Errors[i] = Dist[i];
+    }
+    return TotalError;
+#else
+    Uint32 TotalError = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        Uint32 BestDist = ~Uint32{0};
+        Uint32 BestIdx  = 0;
+        for (Uint32 e = 0; e < NumEntries; ++e)
+        {
+            Uint32 Dist = 0;
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                const Int32 d = Int32{Pixels.p[i][c]} - Int32{Palette.p[e][c]};
+                Dist += static_cast<Uint32>(d * d);
+            }
+            if (Dist < BestDist)
+            {
+                BestDist = Dist;
+                BestIdx  = e;
+            }
+        }
+        Indices[i] = static_cast<Uint8>(BestIdx);
+        TotalError += BestDist;
+        if (Errors != nullptr)
+            Errors[i] = BestDist;
+    }
+    return TotalError;
+#endif
+}
+
+template <typename T>
+T Clamp(T Val, T Min, T Max)
+{
+    return std::min(std::max(Val, Min), Max);
+}
+
+// Computes the mean and the unit-length principal axis of the first NumChannels
+// channels of the pixels selected by the mask using power iteration.
+void ComputePrincipalAxis(const BlockPixels& Pixels,
+                          Uint32             PixelMask,
+                          Uint32             NumChannels,
+                          Uint32             NumIterations,
+                          float              Mean[4],
+                          float              Axis[4])
+{
+    float  Min[4] = {255, 255, 255, 255};
+    float  Max[4] = {0, 0, 0, 0};
+    Uint32 Count  = 0;
+    for (Uint32 c = 0; c < 4; ++c)
+        Mean[c] = Axis[c] = 0;
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((PixelMask & (1u << i)) == 0)
+            continue;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            const float v = Pixels.p[i][c];
+            Mean[c] += v;
+            Min[c] = std::min(Min[c], v);
+            Max[c] = std::max(Max[c], v);
+        }
+        ++Count;
+    }
+    if (Count == 0)
+        return;
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Mean[c] /= static_cast<float>(Count);
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((PixelMask & (1u << i)) == 0)
+            continue;
+        float d[4];
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            d[c] = Pixels.p[i][c] - Mean[c];
+        for (Uint32 r = 0; r < NumChannels; ++r)
+        {
+            for (Uint32 c = r; c < NumChannels; ++c)
+                Cov[r][c] += d[r] * d[c];
+        }
+    }
+    for (Uint32 r = 0; r < NumChannels; ++r)
+    {
+        for (Uint32 c = 0; c < r; ++c)
+            Cov[r][c] = Cov[c][r];
+    }
+
+    // Start from the bounding box diagonal, which is a good approximation of the axis
+    float v[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        v[c] = Max[c] - Min[c];
+
+    for (Uint32 it = 0; it < NumIterations; ++it)
+    {
+        float w[4]   = {};
+        float MaxAbs = 0;
+        for (Uint32 r = 0; r < NumChannels; ++r)
+        {
+            for (Uint32 c = 0; c < NumChannels; ++c)
+                w[r] += Cov[r][c] * v[c];
+            MaxAbs = std::max(MaxAbs, std::abs(w[r]));
+        }
+        if (MaxAbs == 0)
+            break;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            v[c] = w[c] / MaxAbs;
+    }
+
+    float LenSq = 0;
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        LenSq += v[c] * v[c];
+    if (LenSq > 0)
+    {
+        const float InvLen = 1.f / std::sqrt(LenSq);
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Axis[c] = v[c] * InvLen;
+    }
+}
+
+// Computes the endpoints as the extreme projections of the selected pixels onto the principal axis.
+// Endpoint 0 is the one with the larger projection.
+void ComputeAxisEndpoints(const BlockPixels& Pixels,
+                          Uint32             PixelMask,
+                          Uint32             NumChannels,
+                          Uint32             NumIterations,
+                          float              E0[4],
+                          float              E1[4])
+{
+    float Mean[4], Axis[4];
+    ComputePrincipalAxis(Pixels, PixelMask, NumChannels, NumIterations, Mean, Axis);
+
+    float MinT = 0, MaxT = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((PixelMask & (1u << i)) == 0)
+            continue;
+        float t = 0;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            t += (Pixels.p[i][c] - Mean[c]) * Axis[c];
+        MinT = std::min(MinT, t);
+        MaxT = std::max(MaxT, t);
+    }
+
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        E0[c] = c < NumChannels ? Clamp(Mean[c] + Axis[c] * MaxT, 0.f, 255.f) : 0;
+        E1[c] = c < NumChannels ? Clamp(Mean[c] + Axis[c] * MinT, 0.f, 255.f) : 0;
+    }
+}
+
+// Solves the least-squares problem for the endpoints, given the weight of endpoint 0 for every pixel:
+//      min Sum |W0[i] * E0 + (1 - W0[i]) * E1 - P[i]|^2
+// Returns false if the system is degenerate (e.g. all pixels use the same weight).
+bool SolveEndpoints(const BlockPixels& Pixels,
+                    Uint32             PixelMask,
+                    Uint32             NumChannels,
+                    const float        W0[16],
+                    float              E0[4],
+                    float              E1[4])
+{
+    float AA = 0, AB = 0, BB = 0;
+    float AP[4] = {};
+    float BP[4] = {};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((PixelMask & (1u << i)) == 0)
+            continue;
+        const float a = W0[i];
+        const float b = 1.f - a;
+        AA += a * a;
+        AB += a * b;
+        BB += b * b;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            AP[c] += a * Pixels.p[i][c];
+            BP[c] += b * Pixels.p[i][c];
+        }
+    }
+
+    const float Det = AA * BB - AB * AB;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    const float InvDet = 1.f / Det;
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        E0[c] = c < NumChannels ? Clamp((AP[c] * BB - BP[c] * AB) * InvDet, 0.f, 255.f) : 0;
+        E1[c] = c < NumChannels ? Clamp((BP[c] * AA - AP[c] * AB) * InvDet, 0.f, 255.f) : 0;
+    }
+    return true;
+}
+
+Uint32 GetNumRefinementPasses(BC_COMPRESSION_QUALITY Quality)
+{
+    switch (Quality)
+    {
+        case BC_COMPRESSION_QUALITY_FAST: return 0;
+        case BC_COMPRESSION_QUALITY_NORMAL: return 1;
+        default: return 3;
+    }
+}
+
+Uint32 GetNumAxisIterations(BC_COMPRESSION_QUALITY Quality)
+{
+    return Quality == BC_COMPRESSION_QUALITY_FAST ? 2 : 6;
+}
+
+void WriteUint16(Uint8* pDst, Uint32 Val)
+{
+    pDst[0] = static_cast<Uint8>(Val & 0xFF);
+    pDst[1] = static_cast<Uint8>((Val >> 8) & 0xFF);
+}
+
+Uint32 ReadUint16(const Uint8* pSrc)
+{
+    return Uint32{pSrc[0]} | (Uint32{pSrc[1]} << 8);
+}
+
+Uint64 ReadUint64(const Uint8* pSrc)
+{
+    Uint64 Val = 0;
+    for (Uint32 i = 0; i < 8; ++i)
+        Val |= Uint64{pSrc[i]} << (i * 8);
+    return Val;
+}
+
+void WriteUint64(Uint8* pDst, Uint64 Val)
+{
+    for (Uint32 i = 0; i < 8; ++i)
+        pDst[i] = static_cast<Uint8>((Val >> (i * 8)) & 0xFF);
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC1
+
+Uint32 PackRGB565(const float Color[4])
+{
+    const Uint32 R = static_cast<Uint32>(Color[0] * (31.f / 255.f) + 0.5f);
+    const Uint32 G = static_cast<Uint32>(Color[1] * (63.f / 255.f) + 0.5f);
+    const Uint32 B = static_cast<Uint32>(Color[2] * (31.f / 255.f) + 0.5f);
+    return (std::min(R, 31u) << 11) | (std::min(G, 63u) << 5) | std::min(B, 31u);
+}
+
+void UnpackRGB565(Uint32 Color, Int16 RGB[4])
+{
+    const Uint32 R = (Color >> 11) & 31;
+    const Uint32 G = (Color >> 5) & 63;
+    const Uint32 B = Color & 31;
+
+    RGB[0] = static_cast<Int16>((R << 3) | (R >> 2));
+    RGB[1] = static_cast<Int16>((G << 2) | (G >> 4));
+    RGB[2] = static_cast<Int16>((B << 3) | (B >> 2));
+    RGB[3] = 0;
+}
+
+// Builds the BC1 palette. The four-color mode is used when Color0 > Color1, and the
+// three-color mode with transparent black as entry 3 otherwise.
+void BuildBC1Palette(Uint32 Color0, Uint32 Color1, bool ForceFourColors, BlockPalette& Palette)
+{
+    UnpackRGB565(Color0, Palette.p[0]);
+    UnpackRGB565(Color1, Palette.p[1]);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        const Int32 c0 = Palette.p[0][c];
+        const Int32 c1 = Palette.p[1][c];
+        if (Color0 > Color1 || ForceFourColors)
+        {
+            Palette.p[2][c] = static_cast<Int16>((2 * c0 + c1 + 1) / 3);
+            Palette.p[3][c] = static_cast<Int16>((c0 + 2 * c1 + 1) / 3);
+        }
+        else
+        {
+            Palette.p[2][c] = static_cast<Int16>((c0 + c1 + 1) / 2);
+            Palette.p[3][c] = 0;
+        }
+    }
+    Palette.p[2][3] = Palette.p[3][3] = 0;
+}
+
+struct BC1Block
+{
+    Uint32 Color0      = 0;
+    Uint32 Color1      = 0;
+    Uint8  Indices[16] = {};
+    Uint32 Error       = ~Uint32{0};
+};
+
+// Evaluates the endpoints and puts them in the order required by the mode:
+// Color0 > Color1 for four colors, Color0 <= Color1 for three colors with transparency.
+BC1Block EvaluateBC1Endpoints(const BlockPixels& Pixels, Uint32 OpaqueMask, bool ThreeColorMode, Uint32 Color0, Uint32 Color1)
+{
+    BC1Block Block;
+    if (ThreeColorMode ? Color0 > Color1 : Color0 < Color1)
+        std::swap(Color0, Color1);
+    Block.Color0 = Color0;
+    Block.Color1 = Color1;
+
+    BlockPalette Palette;
+    BuildBC1Palette(Color0, Color1, !ThreeColorMode, Palette);
+
+    if (!ThreeColorMode && Color0 == Color1)
+    {
+        // The decoder will use the three-color mode, but all pixels map to Color0
+        Block.Error = FindClosestEntries(Pixels, Palette, 1, Block.Indices);
+        return Block;
+    }
+
+    Uint32 Errors[16];
+    Block.Error = FindClosestEntries(Pixels, Palette, ThreeColorMode ? 3 : 4, Block.Indices, Errors);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if ((OpaqueMask & (1u << i)) == 0)
+        {
+            Block.Indices[i] = 3;
+            Block.Error -= Errors[i];
+        }
+    }
+    return Block;
+}
+
+// Encodes the color part of a BC1, BC2 or BC3 block. Alpha of the pixels is ignored
+// unless AllowTransparency is true, in which case pixels with alpha below 128 are
+// encoded as transparent using the three-color mode.
+void EncodeBC1Block(const BlockPixels& SrcPixels, BC_COMPRESSION_QUALITY Quality, bool AllowTransparency, Uint8* pDst)
+{
+    BlockPixels Pixels     = SrcPixels;
+    Uint32      OpaqueMask = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        if (!AllowTransparency || Pixels.p[i][3] >= 128)
+            OpaqueMask |= 1u << i;
+        Pixels.p[i][3] = 0;
+    }
+    const bool ThreeColorMode = OpaqueMask != 0xFFFF;
+
+    if (OpaqueMask == 0)
+    {
+        WriteUint16(pDst + 0, 0);
+        WriteUint16(pDst + 2, 0);
+        std::memset(pDst + 4, 0xFF, 4);
+        return;
+    }
+
+    float E0[4], E1[4];
+    ComputeAxisEndpoints(Pixels, OpaqueMask, 3, GetNumAxisIterations(Quality), E0, E1);
+
+    BC1Block Best = EvaluateBC1Endpoints(Pixels, OpaqueMask, ThreeColorMode, PackRGB565(E0), PackRGB565(E1));
+
+    const Uint32 NumPasses = GetNumRefinementPasses(Quality);
+    for (Uint32 Pass = 0; Pass < NumPasses && Best.Error > 0; ++Pass)
+    {
+        static constexpr float FourColorWeights[]  = {1.f, 0.f, 2.f / 3.f, 1.f / 3.f};
+        static constexpr float ThreeColorWeights[] = {1.f, 0.f, 0.5f, 0.f};
+
+        float W0[16];
+        for (Uint32 i = 0; i < 16; ++i)
+            W0[i] = ThreeColorMode ? ThreeColorWeights[Best.Indices[i]] : FourColorWeights[Best.Indices[i]];
+        if (!SolveEndpoints(Pixels, OpaqueMask, 3, W0, E0, E1))
+            break;
+
+        const auto Candidate = EvaluateBC1Endpoints(Pixels, OpaqueMask, ThreeColorMode, PackRGB565(E0), PackRGB565(E1));
+        if (Candidate.Error >= Best.Error)
+            break;
+        Best = Candidate;
+    }
+
+    Uint32 IndexBits = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+        IndexBits |= Uint32{Best.Indices[i]} << (i * 2);
+
+    WriteUint16(pDst + 0, Best.Color0);
+    WriteUint16(pDst + 2, Best.Color1);
+    WriteUint16(pDst + 4, IndexBits & 0xFFFF);
+    WriteUint16(pDst + 6, IndexBits >> 16);
+}
+
+void DecodeBC1Block(const Uint8* pSrc, bool ForceFourColors, Uint8 Pixels[16][4])
+{
+    const Uint32 Color0 = ReadUint16(pSrc + 0);
+    const Uint32 Color1 = ReadUint16(pSrc + 2);
+    const Uint32 Bits   = ReadUint16(pSrc + 4) | (ReadUint16(pSrc + 6) << 16);
+
+    BlockPalette Palette;
+    BuildBC1Palette(Color0, Color1, ForceFourColors, Palette);
+    const bool HasTransparency = !ForceFourColors && Color0 <= Color1;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 Idx = (Bits >> (i * 2)) & 3;
+        for (Uint32 c = 0; c < 3; ++c)
+            Pixels[i][c] = static_cast<Uint8>(Palette.p[Idx][c]);
+        Pixels[i][3] = (HasTransparency && Idx == 3) ? 0 : 255;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC4
+
+// Builds the BC4 palette. The eight-value mode is used when Value0 > Value1,
+// and the six-value mode with explicit 0 and 255 otherwise.
+void BuildBC4Palette(Uint32 Value0, Uint32 Value1, BlockPalette& Palette)
+{
+    std::memset(&Palette, 0, sizeof(Palette));
+    const Int32 v0 = static_cast<Int32>(Value0);
+    const Int32 v1 = static_cast<Int32>(Value1);
+
+    Palette.p[0][0] = static_cast<Int16>(v0);
+    Palette.p[1][0] = static_cast<Int16>(v1);
+    if (v0 > v1)
+    {
+        for (Int32 i = 2; i < 8; ++i)
+            Palette.p[i][0] = static_cast<Int16>(((8 - i) * v0 + (i - 1) * v1 + 3) / 7);
+    }
+    else
+    {
+        for (Int32 i = 2; i < 6; ++i)
+            Palette.p[i][0] = static_cast<Int16>(((6 - i) * v0 + (i - 1) * v1 + 2) / 5);
+        Palette.p[6][0] = 0;
+        Palette.p[7][0] = 255;
+    }
+}
+
+struct BC4Block
+{
+    Uint32 Value0      = 0;
+    Uint32 Value1      = 0;
+    Uint8  Indices[16] = {};
+    Uint32 Error       = ~Uint32{0};
+};
+
+BC4Block EvaluateBC4Endpoints(const BlockPixels& Pixels, Uint32 Value0, Uint32 Value1)
+{
+    BC4Block Block;
+    Block.Value0 = Value0;
+    Block.Value1 = Value1;
+
+    BlockPalette Palette;
+    BuildBC4Palette(Value0, Value1, Palette);
+    Block.Error = FindClosestEntries(Pixels, Palette, 8, Block.Indices);
+    return Block;
+}
+
+// Encodes a single channel of the block pixels into a BC4 block.
+// This is also the alpha block of BC3 and each half of BC5.
+void EncodeBC4Block(const BlockPixels& SrcPixels, Uint32 Channel, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    BlockPixels Pixels;
+    std::memset(&Pixels, 0, sizeof(Pixels));
+
+    Int32 MinVal = 255, MaxVal = 0;
+    Int32 MinInner = 255, MaxInner = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Int32 v  = SrcPixels.p[i][Channel];
+        Pixels.p[i][0] = static_cast<Int16>(v);
+        MinVal         = std::min(MinVal, v);
+        MaxVal         = std::max(MaxVal, v);
+        if (v != 0 && v != 255)
+        {
+            MinInner = std::min(MinInner, v);
+            MaxInner = std::max(MaxInner, v);
+        }
+    }
+
+    BC4Block Best;
+    if (MinVal == MaxVal)
+    {
+        Best = EvaluateBC4Endpoints(Pixels, static_cast<Uint32>(MinVal), static_cast<Uint32>(MaxVal));
+    }
+    else
+    {
+        Best = EvaluateBC4Endpoints(Pixels, static_cast<Uint32>(MaxVal), static_cast<Uint32>(MinVal));
+
+        const Uint32 NumPasses = GetNumRefinementPasses(Quality);
+        for (Uint32 Pass = 0; Pass < NumPasses && Best.Error > 0; ++Pass)
+        {
+            float W0[16];
+            for (Uint32 i = 0; i < 16; ++i)
+            {
+                const Uint32 Idx = Best.Indices[i];
+                W0[i]            = Idx == 0 ? 1.f : (Idx == 1 ? 0.f : static_cast<float>(8 - Idx) / 7.f);
+            }
+
+            float E0[4], E1[4];
+            if (!SolveEndpoints(Pixels, 0xFFFF, 1, W0, E0, E1))
+                break;
+
+            const Uint32 Value0 = static_cast<Uint32>(E0[0] + 0.5f);
+            const Uint32 Value1 = static_cast<Uint32>(E1[0] + 0.5f);
+            if (Value0 <= Value1)
+                break;
+
+            const auto Candidate = EvaluateBC4Endpoints(Pixels, Value0, Value1);
+            if (Candidate.Error >= Best.Error)
+                break;
+            Best = Candidate;
+        }
+
+        if (Quality == BC_COMPRESSION_QUALITY_HIGH && Best.Error > 0)
+        {
+            // Six-value mode encodes 0 and 255 exactly and spends the interpolated values on the rest
+            if (MinInner <= MaxInner)
+            {
+                const auto Candidate = EvaluateBC4Endpoints(Pixels, static_cast<Uint32>(MinInner), static_cast<Uint32>(MaxInner));
+                if (Candidate.Error < Best.Error)
+                    Best = Candidate;
+            }
+
+            // Small search around the best endpoints
+            const Int32 BaseValue0 = static_cast<Int32>(Best.Value0);
+            const Int32 BaseValue1 = static_cast<Int32>(Best.Value1);
+            for (Int32 d0 = -1; d0 <= 1; ++d0)
+            {
+                for (Int32 d1 = -1; d1 <= 1; ++d1)
+                {
+                    const Int32 Value0 = BaseValue0 + d0;
+                    const Int32 Value1 = BaseValue1 + d1;
+                    if ((d0 == 0 && d1 == 0) || Value0 < 0 || Value0 > 255 || Value1 < 0 || Value1 > 255)
+                        continue;
+                    // Keep the mode of the best block
+                    if ((Value0 > Value1) != (BaseValue0 > BaseValue1))
+                        continue;
+
+                    const auto Candidate = EvaluateBC4Endpoints(Pixels, static_cast<Uint32>(Value0), static_cast<Uint32>(Value1));
+                    if (Candidate.Error < Best.Error)
+                        Best = Candidate;
+                }
+            }
+        }
+    }
+
+    Uint64 Bits = Uint64{Best.Value0} | (Uint64{Best.Value1} << 8);
+    for (Uint32 i = 0; i < 16; ++i)
+        Bits |= Uint64{Best.Indices[i]} << (16 + i * 3);
+    WriteUint64(pDst, Bits);
+}
+
+void DecodeBC4Block(const Uint8* pSrc, Uint32 Channel, Uint8 Pixels[16][4])
+{
+    const Uint64 Bits = ReadUint64(pSrc);
+
+    BlockPalette Palette;
+    BuildBC4Palette(static_cast<Uint32>(Bits & 0xFF), static_cast<Uint32>((Bits >> 8) & 0xFF), Palette);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const auto Idx     = static_cast<Uint32>((Bits >> (16 + i * 3)) & 7);
+        Pixels[i][Channel] = static_cast<Uint8>(Palette.p[Idx][0]);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC7 (mode 6: one subset, 7.7.7.7 endpoints with unique p-bits, 4-bit indices)
+
+static constexpr Int32 BC7Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+class BitWriter
+{
+public:
+    explicit BitWriter(Uint8* pDst) :
+        m_pDst{pDst}
+    {
+        std::memset(m_pDst, 0, 16);
+    }
+
+    void Write(Uint32 Val, Uint32 NumBits)
+    {
+        for (Uint32 b = 0; b < NumBits; ++b, ++m_Pos)
+        {
+            if ((Val >> b) & 1)
+                m_pDst[m_Pos >> 3] |= static_cast<Uint8>(1u << (m_Pos & 7));
+        }
+    }
+
+private:
+    Uint8* const m_pDst;
+    Uint32       m_Pos = 0;
+};
+
+class BitReader
+{
+public:
+    explicit BitReader(const Uint8* pSrc) :
+        m_pSrc{pSrc}
+    {}
+
+    Uint32 Read(Uint32 NumBits)
+    {
+        Uint32 Val = 0;
+        for (Uint32 b = 0; b < NumBits; ++b, ++m_Pos)
+            Val |= Uint32{(m_pSrc[m_Pos >> 3] >> (m_Pos & 7)) & 1u} << b;
+        return Val;
+    }
+
+private:
+    const Uint8* const m_pSrc;
+    Uint32             m_Pos = 0;
+};
+
+struct BC7Mode6Endpoint
+{
+    Uint32 Q[4] = {}; // 7-bit channel values
+    Uint32 P    = 0;  // p-bit
+
+    Int32 Value(Uint32 c) const { return static_cast<Int32>((Q[c] << 1) | P); }
+};
+
+BC7Mode6Endpoint QuantizeBC7Mode6Endpoint(const float Color[4], Uint32 PBit)
+{
+    BC7Mode6Endpoint Endpoint;
+    Endpoint.P = PBit;
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        const Int32 q = static_cast<Int32>((Color[c] - static_cast<float>(PBit)) * 0.5f + 0.5f);
+        Endpoint.Q[c] = static_cast<Uint32>(Clamp(q, 0, 127));
+    }
+    return Endpoint;
+}
+
+float GetBC7QuantizationError(const BC7Mode6Endpoint& Endpoint, const float Color[4])
+{
+    float Error = 0;
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        const float d = static_cast<float>(Endpoint.Value(c)) - Color[c];
+        Error += d * d;
+    }
+    return Error;
+}
+
+void BuildBC7Mode6Palette(const BC7Mode6Endpoint& E0, const BC7Mode6Endpoint& E1, BlockPalette& Palette)
+{
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Int32 w = BC7Weights4[i];
+        for (Uint32 c = 0; c < 4; ++c)
+            Palette.p[i][c] = static_cast<Int16>(((64 - w) * E0.Value(c) + w * E1.Value(c) + 32) >> 6);
+    }
+}
+
+struct BC7Mode6Block
+{
+    BC7Mode6Endpoint E0;
+    BC7Mode6Endpoint E1;
+    Uint8            Indices[16] = {};
+    Uint32           Error       = ~Uint32{0};
+};
+
+BC7Mode6Block EvaluateBC7Mode6Endpoints(const BlockPixels& Pixels, const BC7Mode6Endpoint& E0, const BC7Mode6Endpoint& E1)
+{
+    BC7Mode6Block Block;
+    Block.E0 = E0;
+    Block.E1 = E1;
+
+    BlockPalette Palette;
+    BuildBC7Mode6Palette(E0, E1, Palette);
+    Block.Error = FindClosestEntries(Pixels, Palette, 16, Block.Indices);
+    return Block;
+}
+
+BC7Mode6Block EncodeBC7Mode6Endpoints(const BlockPixels& Pixels, const float E0[4], const float E1[4], BC_COMPRESSION_QUALITY Quality)
+{
+    if (Quality == BC_COMPRESSION_QUALITY_FAST)
+    {
+        // Select every p-bit by the endpoint quantization error only
+        BC7Mode6Endpoint Q0[2] = {QuantizeBC7Mode6Endpoint(E0, 0), QuantizeBC7Mode6Endpoint(E0, 1)};
+        BC7Mode6Endpoint Q1[2] = {QuantizeBC7Mode6Endpoint(E1, 0), QuantizeBC7Mode6Endpoint(E1, 1)};
+        const auto&      Best0 = GetBC7QuantizationError(Q0[1], E0) < GetBC7QuantizationError(Q0[0], E0) ? Q0[1] : Q0[0];
+        const auto&      Best1 = GetBC7QuantizationError(Q1[1], E1) < GetBC7QuantizationError(Q1[0], E1) ? Q1[1] : Q1[0];
+        return EvaluateBC7Mode6Endpoints(Pixels, Best0, Best1);
+    }
+
+    BC7Mode6Block Best;
+    for (Uint32 p = 0; p < 4; ++p)
+    {
+        const auto Candidate = EvaluateBC7Mode6Endpoints(Pixels, QuantizeBC7Mode6Endpoint(E0, p & 1), QuantizeBC7Mode6Endpoint(E1, p >> 1));
+        if (Candidate.Error < Best.Error)
+            Best = Candidate;
+    }
+    return Best;
+}
+
+void EncodeBC7Block(const BlockPixels& Pixels, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    float E0[4], E1[4];
+    ComputeAxisEndpoints(Pixels, 0xFFFF, 4, GetNumAxisIterations(Quality), E0, E1);
+
+    BC7Mode6Block Best = EncodeBC7Mode6Endpoints(Pixels, E0, E1, Quality);
+
+    const Uint32 NumPasses = GetNumRefinementPasses(Quality);
+    for (Uint32 Pass = 0; Pass < NumPasses && Best.Error > 0; ++Pass)
+    {
+        float W0[16];
+        for (Uint32 i = 0; i < 16; ++i)
+            W0[i] = static_cast<float>(64 - BC7Weights4[Best.Indices[i]]) / 64.f;
+        if (!SolveEndpoints(Pixels, 0xFFFF, 4, W0, E0, E1))
+            break;
+
+        const auto Candidate = EncodeBC7Mode6Endpoints(Pixels, E0, E1, Quality);
+        if (Candidate.Error >= Best.Error)
+            break;
+        Best = Candidate;
+    }
+
+    // The most significant bit of the first index is implicitly zero
+    if (Best.Indices[0] >= 8)
+    {
+        std::swap(Best.E0, Best.E1);
+        for (Uint32 i = 0; i < 16; ++i)
+            Best.Indices[i] = static_cast<Uint8>(15 - Best.Indices[i]);
+    }
+
+    BitWriter Writer{pDst};
+    Writer.Write(1u << 6, 7);
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        Writer.Write(Best.E0.Q[c], 7);
+        Writer.Write(Best.E1.Q[c], 7);
+    }
+    Writer.Write(Best.E0.P, 1);
+    Writer.Write(Best.E1.P, 1);
+    Writer.Write(Best.Indices[0], 3);
+    for (Uint32 i = 1; i < 16; ++i)
+        Writer.Write(Best.Indices[i], 4);
+}
+
+bool DecodeBC7Block(const Uint8* pSrc, Uint8 Pixels[16][4])
+{
+    // Mode 6 is indicated by six zero bits followed by a one
+    if ((pSrc[0] & 0x7F) != (1u << 6))
+    {
+        std::memset(Pixels, 0, 16 * 4);
+        return false;
+    }
+
+    BitReader Reader{pSrc};
+    Reader.Read(7);
+
+    BC7Mode6Endpoint E0, E1;
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        E0.Q[c] = Reader.Read(7);
+        E1.Q[c] = Reader.Read(7);
+    }
+    E0.P = Reader.Read(1);
+    E1.P = Reader.Read(1);
+
+    BlockPalette Palette;
+    BuildBC7Mode6Palette(E0, E1, Palette);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 Idx = Reader.Read(i == 0 ? 3 : 4);
+        for (Uint32 c = 0; c < 4; ++c)
+            Pixels[i][c] = static_cast<Uint8>(Palette.p[Idx][c]);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+enum BC_FORMAT_KIND
+{
+    BC_FORMAT_KIND_UNSUPPORTED,
+    BC_FORMAT_KIND_BC1,
+    BC_FORMAT_KIND_BC3,
+    BC_FORMAT_KIND_BC4,
+    BC_FORMAT_KIND_BC5,
+    BC_FORMAT_KIND_BC7
+};
+
+BC_FORMAT_KIND GetBCFormatKind(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            return BC_FORMAT_KIND_BC1;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            return BC_FORMAT_KIND_BC3;
+
+        case TEX_FORMAT_BC4_UNORM:
+            return BC_FORMAT_KIND_BC4;
+
+        case TEX_FORMAT_BC5_UNORM:
+            return BC_FORMAT_KIND_BC5;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return BC_FORMAT_KIND_BC7;
+
+        default:
+            return BC_FORMAT_KIND_UNSUPPORTED;
+    }
+}
+
+Uint32 GetBlockSize(BC_FORMAT_KIND Kind)
+{
+    return (Kind == BC_FORMAT_KIND_BC1 || Kind == BC_FORMAT_KIND_BC4) ? 8 : 16;
+}
+
+Uint32 GetNumSrcChannels(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_RGBA8_UNORM:
+        case TEX_FORMAT_RGBA8_UNORM_SRGB:
+            return 4;
+
+        case TEX_FORMAT_RG8_UNORM:
+            return 2;
+
+        case TEX_FORMAT_R8_UNORM:
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+void LoadBlock(const CompressBCAttribs& Attribs, Uint32 NumChannels, Uint32 BlockX, Uint32 BlockY, BlockPixels& Pixels)
+{
+    for (Uint32 y = 0; y < 4; ++y)
+    {
+        const Uint32 SrcY    = std::min(BlockY * 4 + y, Attribs.Height - 1);
+        const auto*  pSrcRow = static_cast<const Uint8*>(Attribs.pSrcData) + SrcY * Attribs.SrcStride;
+        for (Uint32 x = 0; x < 4; ++x)
+        {
+            const Uint32 SrcX = std::min(BlockX * 4 + x, Attribs.Width - 1);
+            const auto*  pSrc = pSrcRow + SrcX * NumChannels;
+            auto&        Dst  = Pixels.p[y * 4 + x];
+
+            Dst[0] = pSrc[0];
+            Dst[1] = NumChannels > 1 ? pSrc[1] : 0;
+            Dst[2] = NumChannels > 2 ? pSrc[2] : 0;
+            Dst[3] = NumChannels > 3 ? pSrc[3] : 255;
+        }
+    }
+}
+
+} // namespace
+
+Bool IsBCCompressionSupported(TEXTURE_FORMAT Format)
+{
+    return GetBCFormatKind(Format) != BC_FORMAT_KIND_UNSUPPORTED;
+}
+
+Bool CompressBC(const CompressBCAttribs& Attribs)
+{
+    const auto Kind = GetBCFormatKind(Attribs.DstFormat);
+    if (Kind == BC_FORMAT_KIND_UNSUPPORTED)
+    {
+        LOG_ERROR_MESSAGE("Format ", GetTextureFormatAttribs(Attribs.DstFormat).Name, " is not supported by the BC encoder");
+        return false;
+    }
+
+    const Uint32 NumChannels = GetNumSrcChannels(Attribs.SrcFormat);
+    if (NumChannels == 0)
+    {
+        LOG_ERROR_MESSAGE("Source format ", GetTextureFormatAttribs(Attribs.SrcFormat).Name,
+                          " is not supported by the BC encoder. Only RGBA8_UNORM(_SRGB), RG8_UNORM and R8_UNORM formats are supported.");
+        return false;
+    }
+
+    DEV_CHECK_ERR(Attribs.Width != 0 && Attribs.Height != 0, "Texture dimensions must not be zero");
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+    if (Attribs.Width == 0 || Attribs.Height == 0 || Attribs.pSrcData == nullptr || Attribs.pDstData == nullptr)
+        return false;
+
+    const Uint32 NumBlocksX = (Attribs.Width + 3) / 4;
+    const Uint32 NumBlocksY = (Attribs.Height + 3) / 4;
+    const Uint32 BlockSize  = GetBlockSize(Kind);
+    DEV_CHECK_ERR(Attribs.Height <= 1 || Attribs.SrcStride >= size_t{Attribs.Width} * NumChannels, "Source stride is too small");
+    DEV_CHECK_ERR(NumBlocksY <= 1 || Attribs.DstStride >= size_t{NumBlocksX} * BlockSize, "Destination stride is too small");
+
+    ParallelFor(Attribs.pThreadPool, NumBlocksY, [&](Uint32 BlockY) {
+        auto* pDstRow = static_cast<Uint8*>(Attribs.pDstData) + BlockY * Attribs.DstStride;
+
+        BlockPixels Pixels;
+        for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+        {
+            LoadBlock(Attribs, NumChannels, BlockX, BlockY, Pixels);
+
+            auto* pDst = pDstRow + BlockX * BlockSize;
+            switch (Kind)
+            {
+                case BC_FORMAT_KIND_BC1:
+                    EncodeBC1Block(Pixels, Attribs.Quality, true /*AllowTransparency*/, pDst);
+                    break;
+
+                case BC_FORMAT_KIND_BC3:
+                    EncodeBC4Block(Pixels, 3, Attribs.Quality, pDst);
+                    EncodeBC1Block(Pixels, Attribs.Quality, false /*AllowTransparency*/, pDst + 8);
+                    break;
+
+                case BC_FORMAT_KIND_BC4:
+                    EncodeBC4Block(Pixels, 0, Attribs.Quality, pDst);
+                    break;
+
+                case BC_FORMAT_KIND_BC5:
+                    EncodeBC4Block(Pixels, 0, Attribs.Quality, pDst);
+                    EncodeBC4Block(Pixels, 1, Attribs.Quality, pDst + 8);
+                    break;
+
+                case BC_FORMAT_KIND_BC7:
+                    EncodeBC7Block(Pixels, Attribs.Quality, pDst);
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected format kind");
+            }
+        }
+    });
+
+    return true;
+}
+
+Bool DecompressBC(const DecompressBCAttribs& Attribs)
+{
+    const auto Kind = GetBCFormatKind(Attribs.SrcFormat);
+    if (Kind == BC_FORMAT_KIND_UNSUPPORTED)
+    {
+        LOG_ERROR_MESSAGE("Format ", GetTextureFormatAttribs(Attribs.SrcFormat).Name, " is not supported by the BC decoder");
+        return false;
+    }
+
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+    if (Attribs.pSrcData == nullptr || Attribs.pDstData == nullptr)
+        return false;
+
+    const Uint32 NumBlocksX = (Attribs.Width + 3) / 4;
+    const Uint32 NumBlocksY = (Attribs.Height + 3) / 4;
+    const Uint32 BlockSize  = GetBlockSize(Kind);
+
+    bool AllBlocksDecoded = true;
+    for (Uint32 BlockY = 0; BlockY < NumBlocksY; ++BlockY)
+    {
+        for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+        {
+            const auto* pSrc = static_cast<const Uint8*>(Attribs.pSrcData) + BlockY * Attribs.SrcStride + BlockX * BlockSize;
+
+            Uint8 Pixels[16][4] = {};
+            switch (Kind)
+            {
+                case BC_FORMAT_KIND_BC1:
+                    DecodeBC1Block(pSrc, false /*ForceFourColors*/, Pixels);
+                    break;
+
+                case BC_FORMAT_KIND_BC3:
+                    DecodeBC1Block(pSrc + 8, true /*ForceFourColors*/, Pixels);
+                    DecodeBC4Block(pSrc, 3, Pixels);
+                    break;
+
+                case BC_FORMAT_KIND_BC4:
+                    DecodeBC4Block(pSrc, 0, Pixels);
+                    for (auto& Pixel : Pixels)
+                        Pixel[3] = 255;
+                    break;
+
+                case BC_FORMAT_KIND_BC5:
+                    DecodeBC4Block(pSrc, 0, Pixels);
+                    DecodeBC4Block(pSrc + 8, 1, Pixels);
+                    for (auto& Pixel : Pixels)
+                        Pixel[3] = 255;
+                    break;
+
+                case BC_FORMAT_KIND_BC7:
+                    AllBlocksDecoded = DecodeBC7Block(pSrc, Pixels) && AllBlocksDecoded;
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected format kind");
+            }
+
+            for (Uint32 y = 0; y < 4 && BlockY * 4 + y < Attribs.Height; ++y)
+            {
+                auto* pDstRow = static_cast<Uint8*>(Attribs.pDstData) + (BlockY * 4 + y) * Attribs.DstStride;
+                for (Uint32 x = 0; x < 4 && BlockX * 4 + x < Attribs.Width; ++x)
+                    std::memcpy(pDstRow + (BlockX * 4 + x) * 4, Pixels[y * 4 + x], 4);
+            }
+        }
+    }
+
+    return AllBlocksDecoded;
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    Diligent::Bool Diligent_IsBCCompressionSupported(Diligent::TEXTURE_FORMAT Format)
+    {
+        return Diligent::IsBCCompressionSupported(Format);
+    }
+
+    Diligent::Bool Diligent_CompressBC(const Diligent::CompressBCAttribs& Attribs)
+    {
+        return Diligent::CompressBC(Attribs);
+    }
+
+    Diligent::Bool Diligent_DecompressBC(const Diligent::DecompressBCAttribs& Attribs)
+    {
+        return Diligent::DecompressBC(Attribs);
+    }
+}
@@ -29,6 +29,8 @@
 
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -38,6 +40,7 @@
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "ThreadArenaAllocationsManager.hpp"
 
 namespace Diligent
 {
@@ -65,6 +68,23 @@ public:
         VERIFY_EXPR(m_Subregion.IsValid());
     }
 
+    BufferSuballocationImpl(IReferenceCounters*                         pRefCounters,
+                            BufferSuballocatorImpl*                     pParentAllocator,
+                            Uint32                                      Offset,
+                            Uint32                                      Size,
+                            ThreadArenaAllocationsManager::Allocation&& ArenaSubregion) :
+        // clang-format off
+        TBase             {pRefCounters},
+        m_pParentAllocator{pParentAllocator},
+        m_ArenaSubregion  {std::move(ArenaSubregion)},
+        m_Offset          {Offset},
+        m_Size            {Size}
+    // clang-format on
+    {
+        VERIFY_EXPR(m_pParentAllocator);
+        VERIFY_EXPR(m_ArenaSubregion.IsValid());
+    }
+
     ~BufferSuballocationImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BufferSuballocation, TBase)
@@ -110,7 +130,9 @@ public:
 private:
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
+    // Only one of the two subregions is valid
     VariableSizeAllocationsManager::Allocation m_Subregion;
+    ThreadArenaAllocationsManager::Allocation  m_ArenaSubregion;
 
     const Uint32 m_Offset;
     const Uint32 m_Size;
@@ -166,6 +188,33 @@ public:
             1024u / Uint32{sizeof(BufferSuballocationImpl)} // Use 1 Kb pages.
         }
     {
+        if (CreateInfo.ThreadArenaChunkSize != 0)
+        {
+            ThreadArenaAllocationsManager::CreateInfo ArenasCI;
+            ArenasCI.ChunkSize              = CreateInfo.ThreadArenaChunkSize;
+            ArenasCI.ChunkAlignment         = ThreadArenaChunkAlignment;
+            ArenasCI.NumArenas              = CreateInfo.NumThreadArenas;
+            ArenasCI.DisableDebugValidation = CreateInfo.DisableDebugValidation;
+            ArenasCI.ReserveChunk           = [this](size_t Size, size_t Alignment) {
+                return AllocateRegion(Size, Alignment);
+            };
+            ArenasCI.ReleaseChunk = [this](VariableSizeAllocationsManager::Allocation&& ChunkRegion) {
+                FreeRegion(std::move(ChunkRegion));
+            };
+            m_pArenas = std::make_unique<ThreadArenaAllocationsManager>(ArenasCI);
+
+            // Every arena uses its own object pool, so that threads do not contend for it
+            m_ArenaObjAllocators.reserve(m_pArenas->GetNumArenas());
+            for (Uint32 i = 0; i < m_pArenas->GetNumArenas(); ++i)
+            {
+                m_ArenaObjAllocators.emplace_back(
+                    std::make_unique<FixedBlockMemoryAllocator>(
+                        DefaultRawMemoryAllocator::GetAllocator(),
+                        sizeof(BufferSuballocationImpl),
+                        4096u / Uint32{sizeof(BufferSuballocationImpl)} // Use 4 Kb pages.
+                        ));
+            }
+        }
     }
 
     ~BufferSuballocatorImpl()
@@ -217,43 +266,34 @@ public:
 
         DEV_CHECK_ERR(*ppSuballocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Subregion;
+        if (m_pArenas && m_pArenas->IsArenaAllocation(Size, Alignment))
         {
-            std::lock_guard<std::mutex> Lock{m_MgrMtx};
-
+            ThreadArenaAllocationsManager::Allocation ArenaSubregion = m_pArenas->Allocate(Size, Alignment);
+            if (ArenaSubregion.IsValid())
             {
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const auto BufferSize = m_BufferSize.load();
-                const auto MgrSize    = m_Mgr.GetMaxSize();
-                if (BufferSize > MgrSize)
-                {
-                    m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
-                }
+                const Uint32 ArenaIdx = ArenaSubregion.GetArenaIndex();
+                const Uint32 Offset   = AlignUp(static_cast<Uint32>(ArenaSubregion.GetUnalignedOffset()), Alignment);
+                // clang-format off
+                BufferSuballocationImpl* pSuballocation{
+                    NEW_RC_OBJ(*m_ArenaObjAllocators[ArenaIdx], "BufferSuballocationImpl instance", BufferSuballocationImpl)
+                    (
+                        this,
+                        Offset,
+                        Size,
+                        std::move(ArenaSubregion)
+                    )
+                };
+                // clang-format on
+
+                pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
+                m_AllocationCount.fetch_add(1);
+                return;
             }
-
-            Subregion = m_Mgr.Allocate(Size, Alignment);
-
-            while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
-            {
-                size_t ExtraSize = m_ExpansionSize != 0 ?
-                    std::max(m_ExpansionSize, AlignUp(Size, Alignment)) :
-                    m_Mgr.GetMaxSize();
-
-                if (m_MaxSize != 0)
-                    ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
-
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
-
-                Subregion = m_Mgr.Allocate(Size, Alignment);
-            }
-
-            UpdateUsageStats();
+            // The buffer may still have enough space for the allocation itself
+            // even if it could not fit the whole chunk.
         }
 
+        VariableSizeAllocationsManager::Allocation Subregion = AllocateRegion(Size, Alignment);
         if (Subregion.IsValid())
         {
             // clang-format off
@@ -275,10 +315,15 @@ public:
 
     void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
     {
-        std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Subregion));
+        FreeRegion(std::move(Subregion));
+        m_AllocationCount.fetch_add(-1);
+    }
+
+    void Free(ThreadArenaAllocationsManager::Allocation&& ArenaSubregion)
+    {
+        VERIFY_EXPR(m_pArenas);
+        m_pArenas->Free(std::move(ArenaSubregion));
         m_AllocationCount.fetch_add(-1);
-        UpdateUsageStats();
     }
 
     virtual Uint32 GetVersion() const override final
@@ -292,10 +337,68 @@ public:
         UsageStats.CommittedSize    = m_BufferSize.load();
         UsageStats.UsedSize         = m_UsedSize.load();
         UsageStats.MaxFreeChunkSize = m_MaxFreeBlockSize.load();
+        UsageStats.ArenaFreeSize    = 0;
         UsageStats.AllocationCount  = m_AllocationCount.load();
+
+        if (m_pArenas)
+        {
+            // Arena chunks are counted as used by the buffer allocations manager.
+            // Note that the values may be slightly out of sync as they are not read atomically.
+            const Uint64 ArenaReservedSize = m_pArenas->GetReservedSize();
+            const Uint64 ArenaUsedSize     = std::min(Uint64{m_pArenas->GetUsedSize()}, ArenaReservedSize);
+
+            UsageStats.UsedSize      = UsageStats.UsedSize - std::min(UsageStats.UsedSize, ArenaReservedSize) + ArenaUsedSize;
+            UsageStats.ArenaFreeSize = ArenaReservedSize - ArenaUsedSize;
+        }
     }
 
 private:
+    VariableSizeAllocationsManager::Allocation AllocateRegion(size_t Size, size_t Alignment)
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        {
+            // After the resize, the actual buffer size may be larger due to alignment
+            // requirements (for sparse buffers, the size is aligned by the memory page size).
+            const auto BufferSize = m_BufferSize.load();
+            const auto MgrSize    = m_Mgr.GetMaxSize();
+            if (BufferSize > MgrSize)
+            {
+                m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
+                VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
+                m_MgrSize.store(m_Mgr.GetMaxSize());
+            }
+        }
+
+        VariableSizeAllocationsManager::Allocation Subregion = m_Mgr.Allocate(Size, Alignment);
+
+        while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
+        {
+            size_t ExtraSize = m_ExpansionSize != 0 ?
+                std::max(size_t{m_ExpansionSize}, AlignUp(Size, Alignment)) :
+                m_Mgr.GetMaxSize();
+
+            if (m_MaxSize != 0)
+                ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
+
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+
+            Subregion = m_Mgr.Allocate(Size, Alignment);
+        }
+
+        UpdateUsageStats();
+
+        return Subregion;
+    }
+
+    void FreeRegion(VariableSizeAllocationsManager::Allocation&& Subregion)
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        m_Mgr.Free(std::move(Subregion));
+        UpdateUsageStats();
+    }
+
     void UpdateUsageStats()
     {
         m_UsedSize.store(m_Mgr.GetUsedSize());
@@ -319,12 +422,21 @@ private:
     std::atomic<Uint64> m_MaxFreeBlockSize{0};
 
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
+
+    static constexpr size_t ThreadArenaChunkAlignment = 256;
+
+    // Must be declared after m_Mgr so that it is destroyed first
+    std::unique_ptr<ThreadArenaAllocationsManager>          m_pArenas;
+    std::vector<std::unique_ptr<FixedBlockMemoryAllocator>> m_ArenaObjAllocators;
 };
 
 
 BufferSuballocationImpl::~BufferSuballocationImpl()
 {
-    m_pParentAllocator->Free(std::move(m_Subregion));
+    if (m_ArenaSubregion.IsValid())
+        m_pParentAllocator->Free(std::move(m_ArenaSubregion));
+    else
+        m_pParentAllocator->Free(std::move(m_Subregion));
 }
 
 IBufferSuballocator* BufferSuballocationImpl::GetAllocator()
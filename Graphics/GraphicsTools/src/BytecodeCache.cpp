@@ -28,6 +28,8 @@
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
+#include "MappedFileStream.hpp"
 #include "ObjectBase.hpp"
 #include "Serializer.hpp"
 #include "BytecodeCache.h"
@@ -76,7 +78,8 @@ public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_ReferenceMappedData{CreateInfo.ReferenceMappedData != False}
     {
     }
 
@@ -90,7 +93,19 @@ public:
             return false;
         }
 
-        Serializer<SerializerMode::Read> Stream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+        // The data of a memory-mapped file is owned by the file stream that the blob keeps alive,
+        // so the bytecode can point directly into it. Any other blob may reference memory that
+        // the caller releases after the call, so its data is always copied.
+        bool ReferenceData = false;
+        if (m_ReferenceMappedData)
+        {
+            if (RefCntAutoPtr<ProxyDataBlob> pProxyBlob{pDataBlob, ProxyDataBlob::IID_InternalImpl})
+                ReferenceData = RefCntAutoPtr<MappedFileStream>{pProxyBlob->GetDataContainer(), MappedFileStream::IID_InternalImpl} != nullptr;
+        }
+
+        // The serializer does not write to the data in read mode
+        void*                            pData = const_cast<void*>(pDataBlob->GetConstDataPtr());
+        Serializer<SerializerMode::Read> Stream{SerializedData{pData, pDataBlob->GetSize()}};
 
         BytecodeCacheHeader Header;
         Header.Serialize(Stream);
@@ -111,8 +126,25 @@ public:
             BytecodeCacheElementHeader ElementHeader;
             ElementHeader.Serialize(Stream);
 
-            auto pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
-            Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
+            if (ElementHeader.DataSize > Stream.GetRemainingSize())
+            {
+                LOG_ERROR_MESSAGE("Bytecode cache data is truncated");
+                return false;
+            }
+
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            // Bytecode formats (e.g. SPIR-V) may require aligned access, so only reference aligned elements
+            const void* pElementData = Stream.GetCurrentPtr();
+            if (ReferenceData && ElementHeader.DataSize > 0 && reinterpret_cast<size_t>(pElementData) % alignof(Uint64) == 0)
+            {
+                pBytecode = ProxyDataBlob::Create(pElementData, ElementHeader.DataSize, pDataBlob);
+                Stream.Skip(ElementHeader.DataSize);
+            }
+            else
+            {
+                pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
+                Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
+            }
             m_HashMap.emplace(ElementHeader.Hash, pBytecode);
         }
 
@@ -198,6 +230,7 @@ private:
 
 private:
     RENDER_DEVICE_TYPE m_DeviceType;
+    const bool         m_ReferenceMappedData;
 
     std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
 };
@@ -33,6 +33,8 @@
 #include <unordered_map>
 #include <map>
 #include <set>
+#include <vector>
+#include <numeric>
 
 #include "DynamicAtlasManager.hpp"
 #include "DynamicTextureArray.hpp"
@@ -144,7 +146,9 @@ class ThreadSafeAtlasManager
 {
 public:
     ThreadSafeAtlasManager(const uint2& Dim) noexcept :
-        Mgr{Dim.x, Dim.y}
+        Mgr{Dim.x, Dim.y},
+        MaxFreeWidth{Dim.x},
+        MaxFreeHeight{Dim.y}
     {}
 
     // clang-format off
@@ -198,12 +202,32 @@ public:
             return pAtlasMgr != nullptr;
         }
 
+        bool MayFit(Uint32 Width, Uint32 Height) const
+        {
+            VERIFY_EXPR(pAtlasMgr != nullptr);
+            return pAtlasMgr->MayFit(Width, Height);
+        }
+
         DynamicAtlasManager::Region Allocate(Uint32 Width, Uint32 Height)
         {
             VERIFY_EXPR(pAtlasMgr != nullptr);
             VERIFY_EXPR(pAtlasMgr->UseCount > 0);
             std::lock_guard<std::mutex> Guard{pAtlasMgr->Mtx};
-            return pAtlasMgr->Mgr.Allocate(Width, Height);
+            return pAtlasMgr->AllocateLocked(Width, Height);
+        }
+
+        // Tries to allocate a region without blocking.
+        // Returns false if the slice is currently locked by another thread.
+        bool TryAllocate(Uint32 Width, Uint32 Height, DynamicAtlasManager::Region& R)
+        {
+            VERIFY_EXPR(pAtlasMgr != nullptr);
+            VERIFY_EXPR(pAtlasMgr->UseCount > 0);
+            std::unique_lock<std::mutex> Guard{pAtlasMgr->Mtx, std::try_to_lock};
+            if (!Guard.owns_lock())
+                return false;
+
+            R = pAtlasMgr->AllocateLocked(Width, Height);
+            return true;
         }
 
         // Frees a region and returns true if the atlas is empty
@@ -213,6 +237,7 @@ public:
             VERIFY_EXPR(pAtlasMgr->UseCount > 0);
             std::lock_guard<std::mutex> Guard{pAtlasMgr->Mtx};
             pAtlasMgr->Mgr.Free(std::move(R));
+            pAtlasMgr->UpdateFreeSpaceSummary();
             return pAtlasMgr->Mgr.IsEmpty();
         }
 
@@ -246,9 +271,33 @@ public:
         return UseCount.load();
     }
 
+    // Checks if the region of the given size may fit into this slice.
+    // The check does not lock the mutex and uses the free-space summary
+    // that is updated after every allocation and release. A false result
+    // means that the region certainly does not fit (as of the last update).
+    bool MayFit(Uint32 Width, Uint32 Height) const
+    {
+        return (MaxFreeWidth.load(std::memory_order_relaxed) >= Width &&
+                MaxFreeHeight.load(std::memory_order_relaxed) >= Height);
+    }
+
 private:
     friend ManagerGuard;
 
+    DynamicAtlasManager::Region AllocateLocked(Uint32 Width, Uint32 Height)
+    {
+        auto R = Mgr.Allocate(Width, Height);
+        if (!R.IsEmpty())
+            UpdateFreeSpaceSummary();
+        return R;
+    }
+
+    void UpdateFreeSpaceSummary()
+    {
+        MaxFreeWidth.store(Mgr.GetMaxFreeRegionWidth(), std::memory_order_relaxed);
+        MaxFreeHeight.store(Mgr.GetMaxFreeRegionHeight(), std::memory_order_relaxed);
+    }
+
     int AddUse()
     {
         auto Uses = UseCount.fetch_add(1) + 1;
@@ -268,6 +317,11 @@ private:
     DynamicAtlasManager Mgr;
 
     std::atomic_int UseCount{0};
+
+    // Maximum free region width and height. A region that is wider or taller
+    // than the corresponding value can't be allocated from this slice.
+    std::atomic<Uint32> MaxFreeWidth{0};
+    std::atomic<Uint32> MaxFreeHeight{0};
 };
 
 
@@ -298,13 +352,21 @@ struct SliceBatch
         return it != m_Slices.end() ? it->second.Lock() : ThreadSafeAtlasManager::ManagerGuard{};
     }
 
-    ThreadSafeAtlasManager::ManagerGuard LockSliceAfter(Uint32& Slice)
+    // Locks the first slice with index >= Slice that may fit the region of the given size.
+    // Slices that certainly can't fit the region are skipped without locking their mutexes,
+    // and their number is added to NumSkipped.
+    ThreadSafeAtlasManager::ManagerGuard LockSliceAfter(Uint32& Slice, Uint32 Width, Uint32 Height, Uint32& NumSkipped)
     {
         std::lock_guard<std::mutex> Guard{m_Mtx};
 
-        auto it = m_Slices.lower_bound(Slice);
-        if (it != m_Slices.end())
+        for (auto it = m_Slices.lower_bound(Slice); it != m_Slices.end(); ++it)
         {
+            if (!it->second.MayFit(Width, Height))
+            {
+                ++NumSkipped;
+                continue;
+            }
+
             Slice = it->first;
             // NB: Lock() atomically increases the use count of the slice while we hold the mutex.
             return it->second.Lock();
@@ -491,15 +553,76 @@ public:
     virtual void Allocate(Uint32                       Width,
                           Uint32                       Height,
                           ITextureAtlasSuballocation** ppSuballocation) override final
+    {
+        Uint32 HintSlice = ~Uint32{0};
+        AllocateSuballocation(Width, Height, HintSlice, ppSuballocation);
+    }
+
+    virtual void AllocateBatch(Uint32                       NumRegions,
+                               const uint2*                 pSizes,
+                               ITextureAtlasSuballocation** ppSuballocations) override final
+    {
+        if (NumRegions == 0)
+            return;
+
+        DEV_CHECK_ERR(pSizes != nullptr, "pSizes must not be null");
+        DEV_CHECK_ERR(ppSuballocations != nullptr, "ppSuballocations must not be null");
+
+        // Place larger regions first and group regions with the same alignment together
+        // so that consecutive regions can reuse the slice of the previous one.
+        std::vector<Uint32> Order(NumRegions);
+        std::iota(Order.begin(), Order.end(), 0u);
+        std::sort(Order.begin(), Order.end(),
+                  [&](Uint32 i0, Uint32 i1) //
+                  {
+                      const auto& Size0 = pSizes[i0];
+                      const auto& Size1 = pSizes[i1];
+
+                      const auto Alignment0 = GetAllocationAlignment(Size0.x, Size0.y);
+                      const auto Alignment1 = GetAllocationAlignment(Size1.x, Size1.y);
+                      if (Alignment0 != Alignment1)
+                          return Alignment0 > Alignment1;
+
+                      const auto Area0 = Uint64{Size0.x} * Uint64{Size0.y};
+                      const auto Area1 = Uint64{Size1.x} * Uint64{Size1.y};
+                      if (Area0 != Area1)
+                          return Area0 > Area1;
+
+                      return i0 < i1;
+                  });
+
+        Uint32 HintSlice     = ~Uint32{0};
+        Uint32 HintAlignment = 0;
+        for (auto i : Order)
+        {
+            const auto& Size      = pSizes[i];
+            const auto  Alignment = GetAllocationAlignment(Size.x, Size.y);
+            if (Alignment != HintAlignment)
+            {
+                // Slices are not shared between alignments
+                HintSlice     = ~Uint32{0};
+                HintAlignment = Alignment;
+            }
+            AllocateSuballocation(Size.x, Size.y, HintSlice, &ppSuballocations[i]);
+        }
+    }
+
+    void AllocateSuballocation(Uint32                       Width,
+                               Uint32                       Height,
+                               Uint32&                      HintSlice,
+                               ITextureAtlasSuballocation** ppSuballocation)
     {
         if (Width == 0 || Height == 0)
         {
+            // Failed requests are counted too
+            m_AllocationRequestCount.fetch_add(1);
             UNEXPECTED("Subregion size must not be zero");
             return;
         }
 
         if (Width > m_Desc.Width || Height > m_Desc.Height)
         {
+            m_AllocationRequestCount.fetch_add(1);
             LOG_ERROR_MESSAGE("Requested region size ", Width, " x ", Height, " exceeds atlas dimensions ", m_Desc.Width, " x ", m_Desc.Height);
             return;
         }
@@ -511,42 +634,8 @@ public:
         auto* pBatch = GetSliceBatch(Alignment, m_Desc.Width / Alignment, m_Desc.Height / Alignment);
         VERIFY_EXPR(pBatch != nullptr);
 
-        DynamicAtlasManager::Region Subregion;
-
-        Uint32 Slice = 0;
-        while (Slice < m_MaxSliceCount)
-        {
-            // Lock the first available slice with index >= Slice
-            auto SliceMgr = pBatch->LockSliceAfter(Slice);
-            if (!SliceMgr)
-            {
-                const auto NewSlice = GetNextAvailableSlice();
-                if (NewSlice != ~Uint32{0})
-                {
-                    Slice    = NewSlice;
-                    SliceMgr = pBatch->AddSlice(Slice);
-                    VERIFY_EXPR(SliceMgr);
-                }
-                else
-                {
-                    // It is possible that another thread added a new slice while this thread failed
-                    SliceMgr = pBatch->LockSliceAfter(Slice);
-                    if (!SliceMgr)
-                        break;
-                }
-            }
-
-            if (SliceMgr)
-            {
-                Subregion = SliceMgr.Allocate(AlignedWidth / Alignment, AlignedHeight / Alignment);
-                if (!Subregion.IsEmpty())
-                    break;
-            }
-
-            // Failed to allocate the region - try the next slice
-            ++Slice;
-        }
-
+        Uint32 Slice     = HintSlice;
+        auto   Subregion = AllocateRegion(*pBatch, AlignedWidth / Alignment, AlignedHeight / Alignment, Slice);
         if (Subregion.IsEmpty())
         {
             if (!m_Silent)
@@ -555,6 +644,7 @@ public:
             }
             return;
         }
+        HintSlice = Slice;
 
         m_AllocatedArea.fetch_add(Int64{Width} * Int64{Height});
         m_UsedArea.fetch_add(Int64{AlignedWidth} * Int64{AlignedHeight});
@@ -576,6 +666,129 @@ public:
         pSuballocation->QueryInterface(IID_TextureAtlasSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
     }
 
+    // Allocates a region (in units of alignment) from one of the slices in the batch.
+    // On input, Slice may contain the index of the slice to try first; on output, it
+    // contains the index of the slice where the region was allocated.
+    DynamicAtlasManager::Region AllocateRegion(SliceBatch& Batch, Uint32 Width, Uint32 Height, Uint32& Slice)
+    {
+        const auto HintSlice = Slice;
+
+        Uint32 NumProbes    = 0;
+        Uint32 NumSkipped   = 0;
+        Uint32 NumContended = 0;
+
+        auto Subregion = [&]() {
+            DynamicAtlasManager::Region R;
+
+            if (HintSlice != ~Uint32{0})
+            {
+                if (auto SliceMgr = Batch.LockSlice(HintSlice))
+                {
+                    if (SliceMgr.MayFit(Width, Height))
+                    {
+                        ++NumProbes;
+                        R = SliceMgr.Allocate(Width, Height);
+                        if (!R.IsEmpty())
+                        {
+                            Slice = HintSlice;
+                            return R;
+                        }
+                    }
+                }
+            }
+
+            // Probe the slices that may fit the region without blocking.
+            // Slices that are locked by other threads are revisited later.
+            std::vector<Uint32> BusySlices;
+            for (Uint32 s = 0; s < m_MaxSliceCount; ++s)
+            {
+                // Lock the first slice with index >= s that may fit the region
+                auto SliceMgr = Batch.LockSliceAfter(s, Width, Height, NumSkipped);
+                if (!SliceMgr)
+                    break;
+                if (s == HintSlice)
+                    continue;
+
+                ++NumProbes;
+                if (SliceMgr.TryAllocate(Width, Height, R))
+                {
+                    if (!R.IsEmpty())
+                    {
+                        Slice = s;
+                        return R;
+                    }
+                }
+                else
+                {
+                    ++NumContended;
+                    BusySlices.push_back(s);
+                }
+            }
+
+            for (auto s : BusySlices)
+            {
+                if (auto SliceMgr = Batch.LockSlice(s))
+                {
+                    if (!SliceMgr.MayFit(Width, Height))
+                    {
+                        ++NumSkipped;
+                        continue;
+                    }
+
+                    ++NumProbes;
+                    R = SliceMgr.Allocate(Width, Height);
+                    if (!R.IsEmpty())
+                    {
+                        Slice = s;
+                        return R;
+                    }
+                }
+            }
+
+            // None of the existing slices fits the region - add a new one
+            for (auto NewSlice = GetNextAvailableSlice(); NewSlice != ~Uint32{0}; NewSlice = GetNextAvailableSlice())
+            {
+                auto SliceMgr = Batch.AddSlice(NewSlice);
+                VERIFY_EXPR(SliceMgr);
+
+                ++NumProbes;
+                R = SliceMgr.Allocate(Width, Height);
+                if (!R.IsEmpty())
+                {
+                    Slice = NewSlice;
+                    return R;
+                }
+                // Other threads have used up the new slice before this thread could allocate from it
+            }
+
+            // It is possible that other threads added new slices or released regions
+            // while this thread was probing. Do the final blocking pass.
+            for (Uint32 s = 0; s < m_MaxSliceCount; ++s)
+            {
+                auto SliceMgr = Batch.LockSliceAfter(s, Width, Height, NumSkipped);
+                if (!SliceMgr)
+                    break;
+
+                ++NumProbes;
+                R = SliceMgr.Allocate(Width, Height);
+                if (!R.IsEmpty())
+                {
+                    Slice = s;
+                    return R;
+                }
+            }
+
+            return R;
+        }();
+
+        m_AllocationRequestCount.fetch_add(1);
+        m_SliceProbeCount.fetch_add(NumProbes);
+        m_SkippedSliceCount.fetch_add(NumSkipped);
+        m_ContendedProbeCount.fetch_add(NumContended);
+
+        return Subregion;
+    }
+
     void Free(Uint32 Slice, Uint32 Alignment, DynamicAtlasManager::Region&& Subregion, Uint32 Width, Uint32 Height)
     {
         const auto AllocatedArea = Int64{Width} * Int64{Height};
@@ -672,6 +885,11 @@ public:
         Stats.AllocationCount = m_AllocationCount.load();
         Stats.AllocatedArea   = m_AllocatedArea.load();
         Stats.UsedArea        = m_UsedArea.load();
+
+        Stats.AllocationRequestCount = m_AllocationRequestCount.load();
+        Stats.SliceProbeCount        = m_SliceProbeCount.load();
+        Stats.SkippedSliceCount      = m_SkippedSliceCount.load();
+        Stats.ContendedProbeCount    = m_ContendedProbeCount.load();
     }
 
 private:
@@ -738,6 +956,11 @@ private:
     std::atomic<Int64> m_AllocatedArea{0};
     std::atomic<Int64> m_UsedArea{0};
 
+    std::atomic<Uint64> m_AllocationRequestCount{0};
+    std::atomic<Uint64> m_SliceProbeCount{0};
+    std::atomic<Uint64> m_SkippedSliceCount{0};
+    std::atomic<Uint64> m_ContendedProbeCount{0};
+
     std::mutex m_SliceBatchesByAlignmentMtx;
     // Alignment -> slice batch
     std::unordered_map<Uint32, SliceBatch> m_SliceBatchesByAlignment;
@@ -0,0 +1,328 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUProfiler.hpp"
+
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+GPUProfiler::GPUProfiler(IRenderDevice* pDevice, const CreateInfo& CI) :
+    m_CI{CI}
+{
+    if (pDevice != nullptr && !m_CI.CPUOnly)
+    {
+        if (pDevice->GetDeviceInfo().Features.TimestampQueries == DEVICE_FEATURE_STATE_ENABLED)
+            m_pDevice = pDevice;
+        else
+            LOG_INFO_MESSAGE("Timestamp queries are not supported by the device: GPU profiler will only measure CPU time");
+    }
+
+    if (m_pDevice)
+    {
+        m_AvailableQueries.reserve(m_CI.NumQueriesToReserve);
+        for (Uint32 i = 0; i < m_CI.NumQueriesToReserve; ++i)
+        {
+            if (auto pQuery = AllocateQuery())
+                m_AvailableQueries.emplace_back(std::move(pQuery));
+        }
+    }
+
+    m_CurrentFrame.Data.CPUStart = m_Timer.GetElapsedTime();
+}
+
+GPUProfiler::~GPUProfiler()
+{
+}
+
+RefCntAutoPtr<IQuery> GPUProfiler::AllocateQuery()
+{
+    VERIFY_EXPR(m_pDevice);
+    if (!m_AvailableQueries.empty())
+    {
+        auto pQuery = std::move(m_AvailableQueries.back());
+        m_AvailableQueries.pop_back();
+        return pQuery;
+    }
+
+    QueryDesc queryDesc{QUERY_TYPE_TIMESTAMP};
+    queryDesc.Name = "GPU profiler timestamp query";
+
+    RefCntAutoPtr<IQuery> pQuery;
+    m_pDevice->CreateQuery(queryDesc, &pQuery);
+    if (pQuery)
+        ++m_QueryPoolSize;
+    else
+        UNEXPECTED("Failed to create timestamp query");
+
+    return pQuery;
+}
+
+void GPUProfiler::BeginZone(IDeviceContext* pCtx, const Char* Name)
+{
+    auto& Frame = m_CurrentFrame;
+
+    const auto ZoneIdx = static_cast<Uint32>(Frame.Data.Zones.size());
+    Frame.Data.Zones.emplace_back();
+    auto& Zone  = Frame.Data.Zones.back();
+    Zone.Name   = Name != nullptr ? Name : "";
+    Zone.Depth  = static_cast<Uint32>(m_OpenZones.size());
+    Zone.Parent = !m_OpenZones.empty() ? m_OpenZones.back() : ~0u;
+    m_OpenZones.push_back(ZoneIdx);
+
+    if (m_pDevice)
+    {
+        DEV_CHECK_ERR(pCtx != nullptr, "Device context must not be null when GPU timing is enabled");
+
+        Frame.Queries.resize(size_t{ZoneIdx} * 2 + 2);
+        // Without a context the query could never be ended, so it is not allocated
+        // and the zone has no GPU time.
+        if (pCtx != nullptr)
+        {
+            auto& pStartQuery = Frame.Queries[size_t{ZoneIdx} * 2];
+            pStartQuery       = AllocateQuery();
+            if (pStartQuery)
+            {
+                pCtx->EndQuery(pStartQuery);
+                Frame.LastQueryIdx = size_t{ZoneIdx} * 2;
+            }
+        }
+    }
+
+    // Take the CPU time last to exclude the profiler overhead from the zone
+    Zone.CPUStart = m_Timer.GetElapsedTime();
+}
+
+void GPUProfiler::EndZone(IDeviceContext* pCtx)
+{
+    const auto CPUEnd = m_Timer.GetElapsedTime();
+
+    if (m_OpenZones.empty())
+    {
+        LOG_ERROR_MESSAGE("There are no open zones, which likely indicates inconsistent BeginZone()/EndZone() calls");
+        return;
+    }
+
+    auto& Frame   = m_CurrentFrame;
+    auto  ZoneIdx = m_OpenZones.back();
+    m_OpenZones.pop_back();
+
+    Frame.Data.Zones[ZoneIdx].CPUEnd = CPUEnd;
+
+    if (m_pDevice && Frame.Queries[size_t{ZoneIdx} * 2] && pCtx != nullptr)
+    {
+        auto& pEndQuery = Frame.Queries[size_t{ZoneIdx} * 2 + 1];
+        pEndQuery       = AllocateQuery();
+        if (pEndQuery)
+        {
+            pCtx->EndQuery(pEndQuery);
+            Frame.LastQueryIdx = size_t{ZoneIdx} * 2 + 1;
+        }
+    }
+}
+
+void GPUProfiler::EndFrame(IDeviceContext* pCtx)
+{
+    if (!m_OpenZones.empty())
+    {
+        LOG_ERROR_MESSAGE("There are ", m_OpenZones.size(), " open zones at the end of the frame, which likely indicates inconsistent BeginZone()/EndZone() calls");
+        while (!m_OpenZones.empty())
+            EndZone(pCtx);
+    }
+
+    const auto CurrTime        = m_Timer.GetElapsedTime();
+    const auto FrameNumber     = m_CurrentFrame.Data.FrameNumber;
+    m_CurrentFrame.Data.CPUEnd = CurrTime;
+
+    if (m_CurrentFrame.LastQueryIdx != ~size_t{0} || !m_PendingFrames.empty())
+    {
+        // Frames must be resolved in order, so a frame without GPU data
+        // still has to wait for the previous frames.
+        m_PendingFrames.emplace_back(std::move(m_CurrentFrame));
+    }
+    else
+    {
+        // No GPU data to wait for
+        for (auto& pQuery : m_CurrentFrame.Queries)
+        {
+            if (pQuery)
+                m_AvailableQueries.emplace_back(std::move(pQuery));
+        }
+        AddResolvedFrame(std::move(m_CurrentFrame.Data));
+    }
+
+    while (!m_PendingFrames.empty() && TryResolveFrame(m_PendingFrames.front()))
+    {
+        AddResolvedFrame(std::move(m_PendingFrames.front().Data));
+        m_PendingFrames.pop_front();
+    }
+
+    if (m_PendingFrames.size() > m_CI.ExpectedFrameLatency)
+    {
+        LOG_WARNING_MESSAGE("There are ", m_PendingFrames.size(), " pending profiler frames which exceeds the specified expected latency (", m_CI.ExpectedFrameLatency, ")");
+    }
+
+    m_CurrentFrame                  = {};
+    m_CurrentFrame.Data.FrameNumber = FrameNumber + 1;
+    m_CurrentFrame.Data.CPUStart    = CurrTime;
+}
+
+bool GPUProfiler::TryResolveFrame(PendingFrame& Frame)
+{
+    // Timestamps are written in order, so if the last query is not ready, none of the
+    // following ones is either. Do not invalidate the query until we read all the data.
+    if (Frame.LastQueryIdx != ~size_t{0})
+    {
+        VERIFY_EXPR(Frame.LastQueryIdx < Frame.Queries.size());
+        QueryDataTimestamp LastTimestamp;
+        if (!Frame.Queries[Frame.LastQueryIdx]->GetData(&LastTimestamp, sizeof(LastTimestamp), false))
+            return false;
+    }
+
+    bool   HasGPUOffset = false;
+    double GPUOffset    = 0;
+    VERIFY_EXPR(Frame.Queries.empty() || Frame.Queries.size() == Frame.Data.Zones.size() * 2);
+    for (size_t ZoneIdx = 0; ZoneIdx * 2 + 1 < Frame.Queries.size(); ++ZoneIdx)
+    {
+        auto& Zone = Frame.Data.Zones[ZoneIdx];
+
+        auto& pStartQuery = Frame.Queries[ZoneIdx * 2];
+        auto& pEndQuery   = Frame.Queries[ZoneIdx * 2 + 1];
+
+        QueryDataTimestamp StartTimestamp;
+        QueryDataTimestamp EndTimestamp;
+        if (pStartQuery && pEndQuery &&
+            pStartQuery->GetData(&StartTimestamp, sizeof(StartTimestamp)) &&
+            pEndQuery->GetData(&EndTimestamp, sizeof(EndTimestamp)) &&
+            StartTimestamp.Frequency != 0 && EndTimestamp.Frequency != 0)
+        {
+            Zone.GPUStart = static_cast<double>(StartTimestamp.Counter) / static_cast<double>(StartTimestamp.Frequency);
+            Zone.GPUEnd   = static_cast<double>(EndTimestamp.Counter) / static_cast<double>(EndTimestamp.Frequency);
+            if (!HasGPUOffset)
+            {
+                GPUOffset    = Zone.CPUStart - Zone.GPUStart;
+                HasGPUOffset = true;
+            }
+            Zone.GPUStart += GPUOffset;
+            Zone.GPUEnd += GPUOffset;
+            Zone.HasGPUData = true;
+        }
+
+        if (pStartQuery)
+            m_AvailableQueries.emplace_back(std::move(pStartQuery));
+        if (pEndQuery)
+            m_AvailableQueries.emplace_back(std::move(pEndQuery));
+    }
+    Frame.Queries.clear();
+
+    return true;
+}
+
+void GPUProfiler::AddResolvedFrame(FrameData&& Frame)
+{
+    m_ResolvedFrames.emplace_back(std::move(Frame));
+    while (m_ResolvedFrames.size() > std::max(m_CI.MaxResolvedFrames, 1u))
+        m_ResolvedFrames.pop_front();
+}
+
+void GPUProfiler::ClearResolvedFrames()
+{
+    m_ResolvedFrames.clear();
+}
+
+namespace
+{
+
+void WriteJSONString(std::ostream& Stream, const std::string& Str)
+{
+    Stream << '"';
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Stream << "\\\""; break;
+            case '\\': Stream << "\\\\"; break;
+            case '\n': Stream << "\\n"; break;
+            case '\r': Stream << "\\r"; break;
+            case '\t': Stream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    Stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    Stream << c;
+        }
+    }
+    Stream << '"';
+}
+
+enum TRACE_THREAD : int
+{
+    TRACE_THREAD_CPU = 1,
+    TRACE_THREAD_GPU = 2
+};
+
+void WriteCompleteEvent(std::ostream& Stream, const std::string& Name, const char* Category, TRACE_THREAD Thread, double Start, double End)
+{
+    // Chrome trace uses microseconds
+    Stream << ",\n{\"name\":";
+    WriteJSONString(Stream, Name);
+    Stream << ",\"cat\":\"" << Category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << static_cast<int>(Thread)
+           << ",\"ts\":" << Start * 1e+6 << ",\"dur\":" << std::max(End - Start, 0.0) * 1e+6 << '}';
+}
+
+} // namespace
+
+std::string GPUProfiler::GetChromeTrace() const
+{
+    std::ostringstream Stream;
+    Stream << std::fixed << std::setprecision(3);
+
+    Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << static_cast<int>(TRACE_THREAD_CPU) << ",\"args\":{\"name\":\"CPU\"}},\n"
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << static_cast<int>(TRACE_THREAD_GPU) << ",\"args\":{\"name\":\"GPU\"}}";
+
+    for (const auto& Frame : m_ResolvedFrames)
+    {
+        WriteCompleteEvent(Stream, "Frame " + std::to_string(Frame.FrameNumber), "Frame", TRACE_THREAD_CPU, Frame.CPUStart, Frame.CPUEnd);
+        for (const auto& Zone : Frame.Zones)
+        {
+            WriteCompleteEvent(Stream, Zone.Name, "CPU", TRACE_THREAD_CPU, Zone.CPUStart, Zone.CPUEnd);
+            if (Zone.HasGPUData)
+                WriteCompleteEvent(Stream, Zone.Name, "GPU", TRACE_THREAD_GPU, Zone.GPUStart, Zone.GPUEnd);
+        }
+    }
+
+    Stream << "\n]}\n";
+
+    return Stream.str();
+}
+
+} // namespace Diligent
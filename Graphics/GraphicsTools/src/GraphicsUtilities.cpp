@@ -402,7 +402,7 @@ void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
                                     MostFrequentSelector<ChannelType>);
 }
 
-void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
+Bool ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
 {
     DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
     DEV_CHECK_ERR(Attribs.FineMipWidth != 0, "Fine mip width must not be zero");
@@ -484,6 +484,28 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
         default:
             UNEXPECTED("Unsupported component type");
     }
+
+    if (Attribs.CompressedFormat != TEX_FORMAT_UNKNOWN)
+    {
+        DEV_CHECK_ERR(Attribs.pCompressedCoarseMipData != nullptr, "Compressed coarse level data must not be null");
+        DEV_CHECK_ERR(FmtAttribs.ComponentSize == 1 && FmtAttribs.ComponentType != COMPONENT_TYPE_COMPRESSED,
+                      "Only 8-bit uncompressed formats can be compressed");
+
+        CompressBCAttribs CompressAttribs;
+        CompressAttribs.DstFormat   = Attribs.CompressedFormat;
+        CompressAttribs.SrcFormat   = Attribs.Format;
+        CompressAttribs.Width       = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+        CompressAttribs.Height      = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
+        CompressAttribs.pSrcData    = Attribs.pCoarseMipData;
+        CompressAttribs.SrcStride   = Attribs.CoarseMipStride;
+        CompressAttribs.pDstData    = Attribs.pCompressedCoarseMipData;
+        CompressAttribs.DstStride   = Attribs.CompressedCoarseMipStride;
+        CompressAttribs.Quality     = Attribs.CompressionQuality;
+        CompressAttribs.pThreadPool = Attribs.pThreadPool;
+        return CompressBC(CompressAttribs);
+    }
+
+    return true;
 }
 
 #if !METAL_SUPPORTED
@@ -759,9 +781,9 @@ extern "C"
         Diligent::GenerateCheckerBoardPattern(Width, Height, Fmt, HorzCells, VertCells, pData, StrideInBytes);
     }
 
-    void Diligent_ComputeMipLevel(const Diligent::ComputeMipLevelAttribs& Attribs)
+    Diligent::Bool Diligent_ComputeMipLevel(const Diligent::ComputeMipLevelAttribs& Attribs)
     {
-        Diligent::ComputeMipLevel(Attribs);
+        return Diligent::ComputeMipLevel(Attribs);
     }
 
     void Diligent_CreateSparseTextureMtl(Diligent::IRenderDevice*     pDevice,
@@ -0,0 +1,598 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MeshletBuilder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+// Maps the source vertex indices to the local indices of the meshlet being built.
+class MeshletVertexMap
+{
+public:
+    MeshletVertexMap()
+    {
+        Clear();
+    }
+
+    void Clear()
+    {
+        m_Keys.fill(InvalidIndex);
+    }
+
+    // Returns the local index of the vertex, or -1 if the vertex is not in the meshlet
+    int Find(Uint32 Vertex) const
+    {
+        for (Uint32 Slot = Hash(Vertex);; Slot = (Slot + 1) & (TableSize - 1))
+        {
+            if (m_Keys[Slot] == Vertex)
+                return m_Values[Slot];
+            if (m_Keys[Slot] == InvalidIndex)
+                return -1;
+        }
+    }
+
+    void Insert(Uint32 Vertex, Uint8 LocalIndex)
+    {
+        Uint32 Slot = Hash(Vertex);
+        while (m_Keys[Slot] != InvalidIndex)
+            Slot = (Slot + 1) & (TableSize - 1);
+        m_Keys[Slot]   = Vertex;
+        m_Values[Slot] = LocalIndex;
+    }
+
+private:
+    // Twice the maximum number of vertices in a meshlet keeps the probe sequences short
+    static constexpr Uint32 TableSize = 512;
+
+    static Uint32 Hash(Uint32 Vertex)
+    {
+        return (Vertex * 2654435761u) >> (32 - 9);
+    }
+
+    std::array<Uint32, TableSize> m_Keys;
+    std::array<Uint8, TableSize>  m_Values;
+};
+
+class SubmeshMeshletBuilder
+{
+public:
+    SubmeshMeshletBuilder(const BuildMeshletsAttribs& Attribs, MeshletData& Data) :
+        m_Attribs{Attribs},
+        m_Data{Data},
+        m_pPositions{static_cast<const Uint8*>(Attribs.pPositions)},
+        m_PositionStride{Attribs.PositionStride != 0 ? Attribs.PositionStride : static_cast<Uint32>(sizeof(float3))}
+    {}
+
+    template <typename IndexType>
+    void Build(const IndexType* pIndices, Uint32 NumIndices);
+
+private:
+    const float3& GetPosition(Uint32 Vertex) const
+    {
+        return *reinterpret_cast<const float3*>(m_pPositions + size_t{Vertex} * m_PositionStride);
+    }
+
+    void AddTriangle(Uint32 Triangle);
+    void AddCandidates(Uint32 Vertex);
+    void FlushMeshlet();
+    void ComputeBounds(const Meshlet& M, MeshletBounds& Bounds) const;
+
+private:
+    const BuildMeshletsAttribs& m_Attribs;
+    MeshletData&                m_Data;
+    const Uint8* const          m_pPositions;
+    const Uint32                m_PositionStride;
+
+    // Triangle vertices, relative to m_BaseVertex
+    std::vector<Uint32> m_Triangles;
+    Uint32              m_BaseVertex = 0;
+
+    std::vector<float3> m_TriangleCenters;
+
+    // Triangles adjacent to every vertex
+    std::vector<Uint32> m_AdjacencyOffsets;
+    std::vector<Uint32> m_Adjacency;
+
+    // Whether the triangle has been added to a meshlet or skipped as degenerate
+    std::vector<bool> m_Emitted;
+
+    // Index of the meshlet for which the triangle is a candidate, and the number
+    // of its vertices that are not in that meshlet yet
+    std::vector<Uint32> m_CandidateMeshlet;
+    std::vector<Uint8>  m_MissingVertices;
+    std::vector<Uint32> m_Candidates;
+
+    MeshletVertexMap m_VertexMap;
+    Meshlet          m_Meshlet;
+    float3           m_PositionSum;
+    Uint32           m_MeshletIndex = 0;
+};
+
+template <typename IndexType>
+void SubmeshMeshletBuilder::Build(const IndexType* pIndices, Uint32 NumIndices)
+{
+    const Uint32 NumTriangles = NumIndices / 3;
+    if (NumTriangles == 0)
+        return;
+
+    Uint32 MinVertex = InvalidIndex;
+    Uint32 MaxVertex = 0;
+    for (Uint32 i = 0; i < NumIndices; ++i)
+    {
+        MinVertex = std::min(MinVertex, static_cast<Uint32>(pIndices[i]));
+        MaxVertex = std::max(MaxVertex, static_cast<Uint32>(pIndices[i]));
+    }
+    if (MaxVertex >= m_Attribs.NumVertices)
+    {
+        DEV_ERROR("Index ", MaxVertex, " is out of range: the number of vertices is ", m_Attribs.NumVertices);
+        return;
+    }
+    // Submeshes typically reference a contiguous range of vertices, so per-vertex data is
+    // allocated for this range only.
+    m_BaseVertex             = MinVertex;
+    const Uint32 NumVertices = MaxVertex - MinVertex + 1;
+
+    m_Triangles.resize(size_t{NumTriangles} * 3);
+    m_TriangleCenters.resize(NumTriangles);
+    m_Emitted.assign(NumTriangles, false);
+    m_AdjacencyOffsets.assign(size_t{NumVertices} + 1, 0);
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        const Uint32 v0 = static_cast<Uint32>(pIndices[t * 3 + 0]) - MinVertex;
+        const Uint32 v1 = static_cast<Uint32>(pIndices[t * 3 + 1]) - MinVertex;
+        const Uint32 v2 = static_cast<Uint32>(pIndices[t * 3 + 2]) - MinVertex;
+
+        m_Triangles[t * 3 + 0] = v0;
+        m_Triangles[t * 3 + 1] = v1;
+        m_Triangles[t * 3 + 2] = v2;
+
+        m_TriangleCenters[t] = (GetPosition(v0 + MinVertex) + GetPosition(v1 + MinVertex) + GetPosition(v2 + MinVertex)) * (1.f / 3.f);
+
+        if (v0 == v1 || v1 == v2 || v2 == v0)
+        {
+            m_Emitted[t] = true;
+            continue;
+        }
+        ++m_AdjacencyOffsets[v0 + 1];
+        ++m_AdjacencyOffsets[v1 + 1];
+        ++m_AdjacencyOffsets[v2 + 1];
+    }
+    for (Uint32 v = 0; v < NumVertices; ++v)
+        m_AdjacencyOffsets[v + 1] += m_AdjacencyOffsets[v];
+
+    m_Adjacency.resize(m_AdjacencyOffsets[NumVertices]);
+    {
+        std::vector<Uint32> Fill{m_AdjacencyOffsets.begin(), m_AdjacencyOffsets.end() - 1};
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            if (m_Emitted[t])
+                continue;
+            for (Uint32 i = 0; i < 3; ++i)
+                m_Adjacency[Fill[m_Triangles[t * 3 + i]]++] = t;
+        }
+    }
+
+    m_CandidateMeshlet.assign(NumTriangles, InvalidIndex);
+    m_MissingVertices.assign(NumTriangles, 0);
+    m_Candidates.clear();
+    m_VertexMap.Clear();
+    m_Meshlet      = {};
+    m_PositionSum  = {};
+    m_MeshletIndex = 0;
+
+    Uint32 NextSeed = 0;
+    for (;;)
+    {
+        // Pick the candidate that needs the fewest new vertices. Ties are resolved by the distance
+        // to the meshlet center, which keeps meshlets compact, and then by the index buffer order,
+        // which preserves the vertex cache locality of the source mesh.
+        const float3 Center       = m_Meshlet.VertexCount > 0 ? m_PositionSum / static_cast<float>(m_Meshlet.VertexCount) : float3{};
+        Uint32       BestTriangle = InvalidIndex;
+        Uint32       BestMissing  = 4;
+        float        BestDist     = 0;
+        for (size_t i = 0; i < m_Candidates.size();)
+        {
+            const Uint32 t = m_Candidates[i];
+            if (m_Emitted[t])
+            {
+                m_Candidates[i] = m_Candidates.back();
+                m_Candidates.pop_back();
+                continue;
+            }
+            ++i;
+
+            const Uint32 Missing = m_MissingVertices[t];
+            if (m_Meshlet.VertexCount + Missing > m_Attribs.MaxVertices)
+                continue;
+            if (Missing > BestMissing)
+                continue;
+
+            const float3 Offset = m_TriangleCenters[t] - Center;
+            const float  Dist   = dot(Offset, Offset);
+            if (Missing < BestMissing || Dist < BestDist || (Dist == BestDist && t < BestTriangle))
+            {
+                BestTriangle = t;
+                BestMissing  = Missing;
+                BestDist     = Dist;
+            }
+        }
+
+        if (BestTriangle == InvalidIndex)
+        {
+            if (m_Meshlet.PrimitiveCount > 0 && !m_Candidates.empty())
+            {
+                // The meshlet can't be grown without exceeding the vertex limit.
+                // Start the next meshlet next to it.
+                FlushMeshlet();
+                continue;
+            }
+
+            // The meshlet has no neighbors: continue with the next triangle in the index buffer order
+            while (NextSeed < NumTriangles && m_Emitted[NextSeed])
+                ++NextSeed;
+            if (NextSeed == NumTriangles)
+                break;
+
+            if (m_Meshlet.VertexCount + 3 > m_Attribs.MaxVertices)
+                FlushMeshlet();
+            BestTriangle = NextSeed;
+        }
+
+        AddTriangle(BestTriangle);
+        if (m_Meshlet.PrimitiveCount == m_Attribs.MaxPrimitives)
+            FlushMeshlet();
+    }
+
+    if (m_Meshlet.PrimitiveCount > 0)
+        FlushMeshlet();
+}
+
+void SubmeshMeshletBuilder::AddTriangle(Uint32 Triangle)
+{
+    VERIFY_EXPR(!m_Emitted[Triangle]);
+    m_Emitted[Triangle] = true;
+
+    if (m_Meshlet.PrimitiveCount == 0)
+    {
+        m_Meshlet.VertexOffset    = static_cast<Uint32>(m_Data.Vertices.size());
+        m_Meshlet.PrimitiveOffset = static_cast<Uint32>(m_Data.Primitives.size());
+    }
+
+    Uint32 Primitive = 0;
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const Uint32 Vertex     = m_Triangles[Triangle * 3 + i];
+        int          LocalIndex = m_VertexMap.Find(Vertex);
+        if (LocalIndex < 0)
+        {
+            VERIFY_EXPR(m_Meshlet.VertexCount < m_Attribs.MaxVertices);
+            LocalIndex = static_cast<int>(m_Meshlet.VertexCount++);
+            m_VertexMap.Insert(Vertex, static_cast<Uint8>(LocalIndex));
+            m_Data.Vertices.push_back(Vertex + m_BaseVertex);
+            m_PositionSum += GetPosition(Vertex + m_BaseVertex);
+            AddCandidates(Vertex);
+        }
+        Primitive |= static_cast<Uint32>(LocalIndex) << (i * 8);
+    }
+    m_Data.Primitives.push_back(Primitive);
+    ++m_Meshlet.PrimitiveCount;
+}
+
+void SubmeshMeshletBuilder::AddCandidates(Uint32 Vertex)
+{
+    // Called after the vertex has been added to the meshlet
+    for (Uint32 i = m_AdjacencyOffsets[Vertex]; i < m_AdjacencyOffsets[Vertex + 1]; ++i)
+    {
+        const Uint32 t = m_Adjacency[i];
+        if (m_Emitted[t])
+            continue;
+
+        if (m_CandidateMeshlet[t] == m_MeshletIndex)
+        {
+            VERIFY_EXPR(m_MissingVertices[t] > 0);
+            --m_MissingVertices[t];
+        }
+        else
+        {
+            Uint8 Missing = 0;
+            for (Uint32 j = 0; j < 3; ++j)
+                Missing += m_VertexMap.Find(m_Triangles[t * 3 + j]) < 0 ? 1 : 0;
+
+            m_CandidateMeshlet[t] = m_MeshletIndex;
+            m_MissingVertices[t]  = Missing;
+            m_Candidates.push_back(t);
+        }
+    }
+}
+
+void SubmeshMeshletBuilder::FlushMeshlet()
+{
+    VERIFY_EXPR(m_Meshlet.PrimitiveCount > 0);
+
+    m_Data.Meshlets.push_back(m_Meshlet);
+    m_Data.Bounds.emplace_back();
+    ComputeBounds(m_Meshlet, m_Data.Bounds.back());
+
+    m_Meshlet     = {};
+    m_PositionSum = {};
+    m_VertexMap.Clear();
+    ++m_MeshletIndex;
+
+    // Seed the next meshlet with the first remaining candidate in the index buffer order.
+    // The other candidates are dropped so that the list does not accumulate the borders
+    // of all previous meshlets.
+    Uint32 Seed = InvalidIndex;
+    for (Uint32 t : m_Candidates)
+    {
+        if (!m_Emitted[t])
+            Seed = std::min(Seed, t);
+    }
+    m_Candidates.clear();
+    if (Seed != InvalidIndex)
+    {
+        m_CandidateMeshlet[Seed] = m_MeshletIndex;
+        m_MissingVertices[Seed]  = 3;
+        m_Candidates.push_back(Seed);
+    }
+}
+
+void SubmeshMeshletBuilder::ComputeBounds(const Meshlet& M, MeshletBounds& Bounds) const
+{
+    const Uint32* pVertices   = &m_Data.Vertices[M.VertexOffset];
+    const Uint32* pPrimitives = &m_Data.Primitives[M.PrimitiveOffset];
+
+    float3 MinPos = GetPosition(pVertices[0]);
+    float3 MaxPos = MinPos;
+    for (Uint32 v = 1; v < M.VertexCount; ++v)
+    {
+        const float3& Pos = GetPosition(pVertices[v]);
+        MinPos            = std::min(MinPos, Pos);
+        MaxPos            = std::max(MaxPos, Pos);
+    }
+
+    const float3 Center  = (MinPos + MaxPos) * 0.5f;
+    float        Radius2 = 0;
+    for (Uint32 v = 0; v < M.VertexCount; ++v)
+    {
+        const float3 Offset = GetPosition(pVertices[v]) - Center;
+        Radius2             = std::max(Radius2, dot(Offset, Offset));
+    }
+    Bounds.Sphere = float4{Center, std::sqrt(Radius2)};
+
+    // Normal cone
+    std::array<float3, 3> Tri;
+    float3                NormalSum;
+    for (Uint32 p = 0; p < M.PrimitiveCount; ++p)
+    {
+        for (Uint32 i = 0; i < 3; ++i)
+            Tri[i] = GetPosition(pVertices[(pPrimitives[p] >> (i * 8)) & 0xFF]);
+
+        const float3 Normal = cross(Tri[1] - Tri[0], Tri[2] - Tri[0]);
+        const float  Length = length(Normal);
+        if (Length > 0)
+            NormalSum += Normal / Length;
+    }
+
+    const float SumLength = length(NormalSum);
+    if (SumLength == 0)
+    {
+        Bounds.ConeAxis = float4{0, 0, 1, 1};
+        Bounds.ConeApex = float4{Center, 0};
+        return;
+    }
+    const float3 Axis = NormalSum / SumLength;
+
+    float MinDot = 1;
+    float MaxT   = 0;
+    for (Uint32 p = 0; p < M.PrimitiveCount; ++p)
+    {
+        for (Uint32 i = 0; i < 3; ++i)
+            Tri[i] = GetPosition(pVertices[(pPrimitives[p] >> (i * 8)) & 0xFF]);
+
+        const float3 Normal = cross(Tri[1] - Tri[0], Tri[2] - Tri[0]);
+        const float  Length = length(Normal);
+        if (Length == 0)
+            continue;
+
+        const float3 N   = Normal / Length;
+        const float  Dot = dot(N, Axis);
+        MinDot           = std::min(MinDot, Dot);
+        if (Dot > 0)
+        {
+            // Distance along the axis from the center back to the triangle plane
+            MaxT = std::max(MaxT, dot(Center - Tri[0], N) / Dot);
+        }
+    }
+
+    if (MinDot <= 0)
+    {
+        // The normals span more than a hemisphere: the meshlet is never entirely back-facing
+        Bounds.ConeAxis = float4{Axis, 1};
+        Bounds.ConeApex = float4{Center, 0};
+        return;
+    }
+
+    // All triangles are back-facing when the view direction is within
+    // (90 - ConeAngle) degrees of the axis, where cos(ConeAngle) = MinDot.
+    Bounds.ConeAxis = float4{Axis, std::sqrt(1 - MinDot * MinDot)};
+    Bounds.ConeApex = float4{Center - Axis * MaxT, 0};
+}
+
+} // namespace
+
+void BuildMeshlets(const BuildMeshletsAttribs& Attribs, MeshletData& Data)
+{
+    Data = {};
+
+    DEV_CHECK_ERR(Attribs.pIndices != nullptr || Attribs.NumIndices == 0, "Index data must not be null");
+    DEV_CHECK_ERR(Attribs.IndexType == VT_UINT16 || Attribs.IndexType == VT_UINT32, "Index type must be VT_UINT16 or VT_UINT32");
+    DEV_CHECK_ERR(Attribs.NumIndices % 3 == 0, "The number of indices (", Attribs.NumIndices, ") must be a multiple of 3");
+    DEV_CHECK_ERR(Attribs.pPositions != nullptr || Attribs.NumVertices == 0, "Position data must not be null");
+    DEV_CHECK_ERR(Attribs.PositionStride == 0 || Attribs.PositionStride >= sizeof(float3), "Position stride (", Attribs.PositionStride, ") is too small");
+    DEV_CHECK_ERR(Attribs.pSubmeshes != nullptr || Attribs.NumSubmeshes == 0, "pSubmeshes must not be null");
+    DEV_CHECK_ERR(Attribs.MaxVertices >= 3 && Attribs.MaxVertices <= 256, "MaxVertices (", Attribs.MaxVertices, ") must be in range [3, 256]");
+    DEV_CHECK_ERR(Attribs.MaxPrimitives >= 1 && Attribs.MaxPrimitives <= 512, "MaxPrimitives (", Attribs.MaxPrimitives, ") must be in range [1, 512]");
+    if ((Attribs.IndexType != VT_UINT16 && Attribs.IndexType != VT_UINT32) ||
+        Attribs.MaxVertices < 3 || Attribs.MaxVertices > 256 ||
+        Attribs.MaxPrimitives < 1 || Attribs.MaxPrimitives > 512)
+        return;
+
+    const MeshletSubmesh  DefaultSubmesh{0, Attribs.NumIndices};
+    const MeshletSubmesh* pSubmeshes   = Attribs.pSubmeshes != nullptr ? Attribs.pSubmeshes : &DefaultSubmesh;
+    const Uint32          NumSubmeshes = Attribs.pSubmeshes != nullptr ? Attribs.NumSubmeshes : 1;
+
+    // Every submesh is built into its own data object, and the results are concatenated in the submesh order
+    std::vector<MeshletData> SubmeshData(NumSubmeshes);
+    ParallelFor(Attribs.pThreadPool, NumSubmeshes,
+                [&](Uint32 i) {
+                    const MeshletSubmesh& Submesh = pSubmeshes[i];
+                    DEV_CHECK_ERR(Submesh.NumIndices % 3 == 0, "The number of indices (", Submesh.NumIndices, ") in submesh ", i, " must be a multiple of 3");
+                    DEV_CHECK_ERR(Submesh.FirstIndex + Submesh.NumIndices <= Attribs.NumIndices, "Submesh ", i, " is out of the index buffer bounds");
+                    if (Submesh.FirstIndex + Submesh.NumIndices > Attribs.NumIndices)
+                        return;
+
+                    SubmeshMeshletBuilder Builder{Attribs, SubmeshData[i]};
+                    if (Attribs.IndexType == VT_UINT16)
+                        Builder.Build(static_cast<const Uint16*>(Attribs.pIndices) + Submesh.FirstIndex, Submesh.NumIndices);
+                    else
+                        Builder.Build(static_cast<const Uint32*>(Attribs.pIndices) + Submesh.FirstIndex, Submesh.NumIndices);
+                });
+
+    size_t NumMeshlets = 0, NumVertices = 0, NumPrimitives = 0;
+    for (const auto& Submesh : SubmeshData)
+    {
+        NumMeshlets += Submesh.Meshlets.size();
+        NumVertices += Submesh.Vertices.size();
+        NumPrimitives += Submesh.Primitives.size();
+    }
+    Data.Meshlets.reserve(NumMeshlets);
+    Data.Bounds.reserve(NumMeshlets);
+    Data.Vertices.reserve(NumVertices);
+    Data.Primitives.reserve(NumPrimitives);
+    Data.Submeshes.resize(NumSubmeshes);
+
+    for (Uint32 i = 0; i < NumSubmeshes; ++i)
+    {
+        const auto& Submesh = SubmeshData[i];
+
+        Data.Submeshes[i].FirstMeshlet = static_cast<Uint32>(Data.Meshlets.size());
+        Data.Submeshes[i].NumMeshlets  = static_cast<Uint32>(Submesh.Meshlets.size());
+
+        const Uint32 VertexOffset    = static_cast<Uint32>(Data.Vertices.size());
+        const Uint32 PrimitiveOffset = static_cast<Uint32>(Data.Primitives.size());
+        for (Meshlet M : Submesh.Meshlets)
+        {
+            M.VertexOffset += VertexOffset;
+            M.PrimitiveOffset += PrimitiveOffset;
+            Data.Meshlets.push_back(M);
+        }
+        Data.Bounds.insert(Data.Bounds.end(), Submesh.Bounds.begin(), Submesh.Bounds.end());
+        Data.Vertices.insert(Data.Vertices.end(), Submesh.Vertices.begin(), Submesh.Vertices.end());
+        Data.Primitives.insert(Data.Primitives.end(), Submesh.Primitives.begin(), Submesh.Primitives.end());
+    }
+}
+
+void UploadMeshlets(const MeshletData&   Data,
+                    IRenderDevice*       pDevice,
+                    IDeviceContext*      pContext,
+                    IBufferSuballocator* pAllocator,
+                    MeshletBufferRanges& Ranges)
+{
+    Ranges = {};
+
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(pAllocator != nullptr, "Buffer suballocator must not be null");
+    DEV_CHECK_ERR(Data.Bounds.size() == Data.Meshlets.size(), "The number of meshlet bounds does not match the number of meshlets");
+    if (pContext == nullptr || pAllocator == nullptr || Data.Meshlets.empty())
+        return;
+
+    constexpr Uint32 Alignment = 16;
+
+    const size_t MeshletsSize   = Data.Meshlets.size() * sizeof(Meshlet);
+    const size_t BoundsSize     = Data.Bounds.size() * sizeof(MeshletBounds);
+    const size_t VerticesSize   = Data.Vertices.size() * sizeof(Uint32);
+    const size_t PrimitivesSize = Data.Primitives.size() * sizeof(Uint32);
+
+    const size_t BoundsOffset     = AlignUp(MeshletsSize, Alignment);
+    const size_t VerticesOffset   = AlignUp(BoundsOffset + BoundsSize, Alignment);
+    const size_t PrimitivesOffset = AlignUp(VerticesOffset + VerticesSize, Alignment);
+    const size_t TotalSize        = PrimitivesOffset + PrimitivesSize;
+    if (TotalSize > std::numeric_limits<Uint32>::max())
+    {
+        LOG_ERROR_MESSAGE("Meshlet data size (", TotalSize, " bytes) exceeds the maximum suballocation size");
+        return;
+    }
+
+    pAllocator->Allocate(static_cast<Uint32>(TotalSize), Alignment, &Ranges.pSuballocation);
+    if (!Ranges.pSuballocation)
+    {
+        LOG_ERROR_MESSAGE("Failed to allocate ", TotalSize, " bytes for the meshlet data");
+        return;
+    }
+
+    IBuffer* pBuffer = pAllocator->Update(pDevice, pContext);
+    if (pBuffer == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to update the suballocator buffer");
+        Ranges = {};
+        return;
+    }
+
+    const Uint32 BaseOffset = Ranges.pSuballocation->GetOffset();
+
+    Ranges.MeshletsOffset   = BaseOffset;
+    Ranges.BoundsOffset     = BaseOffset + static_cast<Uint32>(BoundsOffset);
+    Ranges.VerticesOffset   = BaseOffset + static_cast<Uint32>(VerticesOffset);
+    Ranges.PrimitivesOffset = BaseOffset + static_cast<Uint32>(PrimitivesOffset);
+
+    auto UploadArray = [&](Uint32 Offset, const auto& Array) {
+        if (!Array.empty())
+            pContext->UpdateBuffer(pBuffer, Offset, static_cast<Uint64>(Array.size() * sizeof(Array[0])), Array.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    };
+    UploadArray(Ranges.MeshletsOffset, Data.Meshlets);
+    UploadArray(Ranges.BoundsOffset, Data.Bounds);
+    UploadArray(Ranges.VerticesOffset, Data.Vertices);
+    UploadArray(Ranges.PrimitivesOffset, Data.Primitives);
+}
+
+} // namespace Diligent
@@ -0,0 +1,577 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PixelFormatConversion.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "ColorConversion.h"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint32 AsUint(float f)
+{
+    Uint32 u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+float AsFloat(Uint32 u)
+{
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Converts a 32-bit float to a 16-bit float with round-to-nearest-even.
+// Out-of-range values are converted to infinity, NaNs are preserved.
+Uint16 FloatToHalf(float Val)
+{
+    Uint32       f    = AsUint(Val);
+    const Uint32 Sign = (f >> 16) & 0x8000u;
+    f &= 0x7FFFFFFFu;
+
+    Uint32 h = 0;
+    if (f >= ((127u + 16u) << 23u))
+    {
+        // Infinity, NaN or too large to be represented
+        h = f > 0x7F800000u ? 0x7E00u : 0x7C00u;
+    }
+    else if (f < ((127u - 14u) << 23u))
+    {
+        // Subnormal half or zero: let the FPU do the rounding by adding a value whose
+        // ULP matches the subnormal half ULP (2^-24).
+        constexpr Uint32 DenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23u;
+
+        h = AsUint(AsFloat(f) + AsFloat(DenormMagic)) - DenormMagic;
+    }
+    else
+    {
+        const Uint32 MantOdd = (f >> 13u) & 1u;
+        // Rebias the exponent and round
+        f += (static_cast<Uint32>(15 - 127) << 23u) + 0xFFFu + MantOdd;
+        h = f >> 13u;
+    }
+    return static_cast<Uint16>(h | Sign);
+}
+
+float HalfToFloat(Uint32 h)
+{
+    const Uint32 Sign = (h & 0x8000u) << 16u;
+    const Uint32 Exp  = (h >> 10u) & 0x1Fu;
+    const Uint32 Mant = h & 0x3FFu;
+
+    if (Exp == 0)
+    {
+        const float Val = static_cast<float>(Mant) * (1.f / 16777216.f);
+        return AsFloat(AsUint(Val) | Sign);
+    }
+    else if (Exp == 31)
+    {
+        return AsFloat(Sign | 0x7F800000u | (Mant << 13u));
+    }
+    else
+    {
+        return AsFloat(Sign | ((Exp + 112u) << 23u) | (Mant << 13u));
+    }
+}
+
+// Converts a 32-bit float to an unsigned float with 5-bit exponent and MantBits-bit mantissa
+// (R11G11B10 format channels) with round-to-nearest-even.
+// Negative values and NaNs are converted to zero, too large values are clamped to the
+// largest finite value.
+template <Uint32 MantBits>
+Uint32 FloatToUFloat(float Val)
+{
+    if (!(Val > 0))
+        return 0;
+
+    const Uint32 f = AsUint(Val);
+    if (f == 0x7F800000u)
+        return 31u << MantBits;
+
+    constexpr Uint32 Shift       = 23u - MantBits;
+    constexpr Uint32 MaxFinite   = (31u << MantBits) - 1u;
+    constexpr Uint32 DenormMagic = ((127u - 15u) + Shift + 1u) << 23u;
+
+    Uint32 u = 0;
+    if (f < ((127u - 14u) << 23u))
+    {
+        u = AsUint(AsFloat(f) + AsFloat(DenormMagic)) - DenormMagic;
+    }
+    else
+    {
+        const Uint32 MantOdd = (f >> Shift) & 1u;
+        u                    = (f + (static_cast<Uint32>(15 - 127) << 23u) + ((1u << (Shift - 1u)) - 1u) + MantOdd) >> Shift;
+    }
+    return std::min(u, MaxFinite);
+}
+
+template <Uint32 MantBits>
+float UFloatToFloat(Uint32 u)
+{
+    const Uint32 Exp  = (u >> MantBits) & 0x1Fu;
+    const Uint32 Mant = u & ((1u << MantBits) - 1u);
+
+    if (Exp == 0)
+        return static_cast<float>(Mant) * AsFloat((127u - 14u - MantBits) << 23u);
+    else if (Exp == 31)
+        return AsFloat(0x7F800000u | (Mant << (23u - MantBits)));
+    else
+        return AsFloat(((Exp + 112u) << 23u) | (Mant << (23u - MantBits)));
+}
+
+Uint32 FloatToUNorm(float Val, float Scale)
+{
+    // NaNs are converted to zero
+    const float Clamped = Val > 0 ? std::min(Val, 1.f) : 0.f;
+    return static_cast<Uint32>(Clamped * Scale + 0.5f);
+}
+
+// Number of pixels converted at once. Rows are processed in chunks so that
+// the intermediate floating-point data stays in the L1 cache.
+constexpr Uint32 ChunkSize = 64;
+
+struct alignas(16) PixelChunk
+{
+    float p[ChunkSize][4];
+};
+
+bool IsBGRA(TEXTURE_FORMAT Format)
+{
+    return Format == TEX_FORMAT_BGRA8_UNORM || Format == TEX_FORMAT_BGRA8_UNORM_SRGB;
+}
+
+bool IsSRGB(TEXTURE_FORMAT Format)
+{
+    return Format == TEX_FORMAT_RGBA8_UNORM_SRGB || Format == TEX_FORMAT_BGRA8_UNORM_SRGB;
+}
+
+bool Is8BitRGBA(TEXTURE_FORMAT Format)
+{
+    return (Format == TEX_FORMAT_RGBA8_UNORM || Format == TEX_FORMAT_RGBA8_UNORM_SRGB ||
+            Format == TEX_FORMAT_BGRA8_UNORM || Format == TEX_FORMAT_BGRA8_UNORM_SRGB);
+}
+
+// Decodes 8-bit UNORM pixels into floats in memory channel order
+void DecodeUNorm8(const Uint8* pSrc, PixelChunk& Chunk, Uint32 Count)
+{
+    Uint32 i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const __m128  Scale = _mm_set1_ps(1.f / 255.f);
+    const __m128i Zero  = _mm_setzero_si128();
+    for (; i + 4 <= Count; i += 4)
+    {
+        const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i * 4));
+        const __m128i Lo16  = _mm_unpacklo_epi8(Bytes, Zero);
+        const __m128i Hi16  = _mm_unpackhi_epi8(Bytes, Zero);
+        _mm_store_ps(Chunk.p[i + 0], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Lo16, Zero)), Scale));
+        _mm_store_ps(Chunk.p[i + 1], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Lo16, Zero)), Scale));
+        _mm_store_ps(Chunk.p[i + 2], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Hi16, Zero)), Scale));
+        _mm_store_ps(Chunk.p[i + 3], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Hi16, Zero)), Scale));
+    }
+#endif
+    for (; i < Count; ++i)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            Chunk.p[i][c] = static_cast<float>(pSrc[i * 4 + c]) * (1.f / 255.f);
+    }
+}
+
+// Encodes floats in memory channel order into 8-bit UNORM pixels
+void EncodeUNorm8(const PixelChunk& Chunk, Uint8* pDst, Uint32 Count)
+{
+    Uint32 i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const __m128 Scale = _mm_set1_ps(255.f);
+    const __m128 Half  = _mm_set1_ps(0.5f);
+    const __m128 Zero  = _mm_setzero_ps();
+    const __m128 One   = _mm_set1_ps(1.f);
+    for (; i + 4 <= Count; i += 4)
+    {
+        __m128i Ints[4];
+        for (Uint32 j = 0; j < 4; ++j)
+        {
+            // max(x, 0) returns 0 for NaN since it returns the second operand when either is NaN
+            const __m128 Clamped = _mm_min_ps(_mm_max_ps(_mm_load_ps(Chunk.p[i + j]), Zero), One);
+            Ints[j]              = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Clamped, Scale), Half));
+        }
+        const __m128i Lo16 = _mm_packs_epi32(Ints[0], Ints[1]);
+        const __m128i Hi16 = _mm_packs_epi32(Ints[2], Ints[3]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i * 4), _mm_packus_epi16(Lo16, Hi16));
+    }
+#endif
+    for (; i < Count; ++i)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            pDst[i * 4 + c] = static_cast<Uint8>(FloatToUNorm(Chunk.p[i][c], 255.f));
+    }
+}
+
+// Decodes Count source pixels into linear RGBA values
+void DecodePixels(TEXTURE_FORMAT Format, const Uint8* pSrc, PixelChunk& Chunk, Uint32 Count)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_RGBA8_UNORM:
+        case TEX_FORMAT_BGRA8_UNORM:
+            DecodeUNorm8(pSrc, Chunk, Count);
+            break;
+
+        case TEX_FORMAT_RGBA8_UNORM_SRGB:
+        case TEX_FORMAT_BGRA8_UNORM_SRGB:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                const Uint8* pPixel = pSrc + i * 4;
+                Chunk.p[i][0]       = GammaToLinear(pPixel[0]);
+                Chunk.p[i][1]       = GammaToLinear(pPixel[1]);
+                Chunk.p[i][2]       = GammaToLinear(pPixel[2]);
+                Chunk.p[i][3]       = static_cast<float>(pPixel[3]) * (1.f / 255.f);
+            }
+            break;
+
+        case TEX_FORMAT_RGBA16_FLOAT:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                for (Uint32 c = 0; c < 4; ++c)
+                {
+                    Uint16 h;
+                    std::memcpy(&h, pSrc + (i * 4 + c) * 2, sizeof(h));
+                    Chunk.p[i][c] = HalfToFloat(h);
+                }
+            }
+            break;
+
+        case TEX_FORMAT_R11G11B10_FLOAT:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                Uint32 Packed;
+                std::memcpy(&Packed, pSrc + i * 4, sizeof(Packed));
+                Chunk.p[i][0] = UFloatToFloat<6>(Packed & 0x7FFu);
+                Chunk.p[i][1] = UFloatToFloat<6>((Packed >> 11u) & 0x7FFu);
+                Chunk.p[i][2] = UFloatToFloat<5>(Packed >> 22u);
+                Chunk.p[i][3] = 1;
+            }
+            break;
+
+        case TEX_FORMAT_RGB10A2_UNORM:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                Uint32 Packed;
+                std::memcpy(&Packed, pSrc + i * 4, sizeof(Packed));
+                Chunk.p[i][0] = static_cast<float>(Packed & 0x3FFu) * (1.f / 1023.f);
+                Chunk.p[i][1] = static_cast<float>((Packed >> 10u) & 0x3FFu) * (1.f / 1023.f);
+                Chunk.p[i][2] = static_cast<float>((Packed >> 20u) & 0x3FFu) * (1.f / 1023.f);
+                Chunk.p[i][3] = static_cast<float>(Packed >> 30u) * (1.f / 3.f);
+            }
+            break;
+
+        case TEX_FORMAT_RGBA32_FLOAT:
+            std::memcpy(Chunk.p, pSrc, size_t{Count} * 16);
+            break;
+
+        default:
+            UNEXPECTED("Unsupported format");
+    }
+
+    if (IsBGRA(Format))
+    {
+        for (Uint32 i = 0; i < Count; ++i)
+            std::swap(Chunk.p[i][0], Chunk.p[i][2]);
+    }
+}
+
+// Encodes Count linear RGBA values into the destination format
+void EncodePixels(TEXTURE_FORMAT Format, PixelChunk& Chunk, Uint8* pDst, Uint32 Count)
+{
+    if (IsBGRA(Format))
+    {
+        for (Uint32 i = 0; i < Count; ++i)
+            std::swap(Chunk.p[i][0], Chunk.p[i][2]);
+    }
+
+    switch (Format)
+    {
+        case TEX_FORMAT_RGBA8_UNORM:
+        case TEX_FORMAT_BGRA8_UNORM:
+            EncodeUNorm8(Chunk, pDst, Count);
+            break;
+
+        case TEX_FORMAT_RGBA8_UNORM_SRGB:
+        case TEX_FORMAT_BGRA8_UNORM_SRGB:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                Uint8* pPixel = pDst + i * 4;
+                pPixel[0]     = LinearToGamma8(Chunk.p[i][0]);
+                pPixel[1]     = LinearToGamma8(Chunk.p[i][1]);
+                pPixel[2]     = LinearToGamma8(Chunk.p[i][2]);
+                pPixel[3]     = static_cast<Uint8>(FloatToUNorm(Chunk.p[i][3], 255.f));
+            }
+            break;
+
+        case TEX_FORMAT_RGBA16_FLOAT:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                for (Uint32 c = 0; c < 4; ++c)
+                {
+                    const Uint16 h = FloatToHalf(Chunk.p[i][c]);
+                    std::memcpy(pDst + (i * 4 + c) * 2, &h, sizeof(h));
+                }
+            }
+            break;
+
+        case TEX_FORMAT_R11G11B10_FLOAT:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                const Uint32 Packed =
+                    FloatToUFloat<6>(Chunk.p[i][0]) |
+                    (FloatToUFloat<6>(Chunk.p[i][1]) << 11u) |
+                    (FloatToUFloat<5>(Chunk.p[i][2]) << 22u);
+                std::memcpy(pDst + i * 4, &Packed, sizeof(Packed));
+            }
+            break;
+
+        case TEX_FORMAT_RGB10A2_UNORM:
+            for (Uint32 i = 0; i < Count; ++i)
+            {
+                const Uint32 Packed =
+                    FloatToUNorm(Chunk.p[i][0], 1023.f) |
+                    (FloatToUNorm(Chunk.p[i][1], 1023.f) << 10u) |
+                    (FloatToUNorm(Chunk.p[i][2], 1023.f) << 20u) |
+                    (FloatToUNorm(Chunk.p[i][3], 3.f) << 30u);
+                std::memcpy(pDst + i * 4, &Packed, sizeof(Packed));
+            }
+            break;
+
+        case TEX_FORMAT_RGBA32_FLOAT:
+            std::memcpy(pDst, Chunk.p, size_t{Count} * 16);
+            break;
+
+        default:
+            UNEXPECTED("Unsupported format");
+    }
+}
+
+// Special values of the channel map
+constexpr Uint8 ChannelZero = 4;
+constexpr Uint8 ChannelOne  = 5;
+
+// Returns the source channel index for every destination channel
+std::array<Uint8, 4> GetChannelMap(const TextureComponentMapping& Swizzle)
+{
+    std::array<Uint8, 4> Map{};
+    for (Uint8 c = 0; c < 4; ++c)
+    {
+        switch (Swizzle[c])
+        {
+            case TEXTURE_COMPONENT_SWIZZLE_IDENTITY: Map[c] = c; break;
+            case TEXTURE_COMPONENT_SWIZZLE_ZERO: Map[c] = ChannelZero; break;
+            case TEXTURE_COMPONENT_SWIZZLE_ONE: Map[c] = ChannelOne; break;
+            case TEXTURE_COMPONENT_SWIZZLE_R: Map[c] = 0; break;
+            case TEXTURE_COMPONENT_SWIZZLE_G: Map[c] = 1; break;
+            case TEXTURE_COMPONENT_SWIZZLE_B: Map[c] = 2; break;
+            case TEXTURE_COMPONENT_SWIZZLE_A: Map[c] = 3; break;
+            default:
+                UNEXPECTED("Unexpected swizzle");
+                Map[c] = c;
+        }
+    }
+    return Map;
+}
+
+void ApplySwizzle(PixelChunk& Chunk, Uint32 Count, const std::array<Uint8, 4>& Map)
+{
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const float Src[6] = {Chunk.p[i][0], Chunk.p[i][1], Chunk.p[i][2], Chunk.p[i][3], 0.f, 1.f};
+        for (Uint32 c = 0; c < 4; ++c)
+            Chunk.p[i][c] = Src[Map[c]];
+    }
+}
+
+void PremultiplyAlpha(PixelChunk& Chunk, Uint32 Count)
+{
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+#if DILIGENT_SSE2_ENABLED
+        const __m128 Pixel = _mm_load_ps(Chunk.p[i]);
+        // (1, a, a, a)
+        const __m128 Factor = _mm_move_ss(_mm_shuffle_ps(Pixel, Pixel, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set_ss(1.f));
+        // Multiply the pixel by (a, a, a, 1)
+        _mm_store_ps(Chunk.p[i], _mm_mul_ps(Pixel, _mm_shuffle_ps(Factor, Factor, _MM_SHUFFLE(0, 1, 1, 1))));
+#else
+        const float Alpha = Chunk.p[i][3];
+        Chunk.p[i][0] *= Alpha;
+        Chunk.p[i][1] *= Alpha;
+        Chunk.p[i][2] *= Alpha;
+#endif
+    }
+}
+
+// Returns the source byte index (or ChannelZero/ChannelOne) for every destination byte
+// of an 8-bit RGBA/BGRA to 8-bit RGBA/BGRA conversion.
+std::array<Uint8, 4> GetByteMap(TEXTURE_FORMAT SrcFormat, TEXTURE_FORMAT DstFormat, const std::array<Uint8, 4>& ChannelMap)
+{
+    static constexpr Uint8 RGBAOrder[] = {0, 1, 2, 3};
+    static constexpr Uint8 BGRAOrder[] = {2, 1, 0, 3};
+
+    const Uint8* SrcOrder = IsBGRA(SrcFormat) ? BGRAOrder : RGBAOrder;
+    const Uint8* DstOrder = IsBGRA(DstFormat) ? BGRAOrder : RGBAOrder;
+
+    std::array<Uint8, 4> ByteMap{};
+    for (Uint32 b = 0; b < 4; ++b)
+    {
+        // Destination byte b holds logical channel DstOrder[b]
+        const Uint8 SrcChannel = ChannelMap[DstOrder[b]];
+        ByteMap[b]             = SrcChannel < 4 ? SrcOrder[SrcChannel] : SrcChannel;
+    }
+    return ByteMap;
+}
+
+void SwapRedBlue8(const Uint8* pSrc, Uint8* pDst, Uint32 Count)
+{
+    Uint32 i = 0;
+#if DILIGENT_SSE2_ENABLED
+    const __m128i GAMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i RBMask = _mm_set1_epi32(0x000000FF);
+    for (; i + 4 <= Count; i += 4)
+    {
+        const __m128i Pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i * 4));
+
+        const __m128i GA = _mm_and_si128(Pixels, GAMask);
+        const __m128i R  = _mm_slli_epi32(_mm_and_si128(Pixels, RBMask), 16);
+        const __m128i B  = _mm_and_si128(_mm_srli_epi32(Pixels, 16), RBMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i * 4), _mm_or_si128(GA, _mm_or_si128(R, B)));
+    }
+#endif
+    for (; i < Count; ++i)
+    {
+        pDst[i * 4 + 0] = pSrc[i * 4 + 2];
+        pDst[i * 4 + 1] = pSrc[i * 4 + 1];
+        pDst[i * 4 + 2] = pSrc[i * 4 + 0];
+        pDst[i * 4 + 3] = pSrc[i * 4 + 3];
+    }
+}
+
+void RemapBytes8(const Uint8* pSrc, Uint8* pDst, Uint32 Count, const std::array<Uint8, 4>& ByteMap)
+{
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const Uint8 Src[6] = {pSrc[i * 4 + 0], pSrc[i * 4 + 1], pSrc[i * 4 + 2], pSrc[i * 4 + 3], 0, 255};
+        for (Uint32 b = 0; b < 4; ++b)
+            pDst[i * 4 + b] = Src[ByteMap[b]];
+    }
+}
+
+} // namespace
+
+bool IsPixelConversionSupported(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_RGBA8_UNORM:
+        case TEX_FORMAT_RGBA8_UNORM_SRGB:
+        case TEX_FORMAT_BGRA8_UNORM:
+        case TEX_FORMAT_BGRA8_UNORM_SRGB:
+        case TEX_FORMAT_RGBA16_FLOAT:
+        case TEX_FORMAT_R11G11B10_FLOAT:
+        case TEX_FORMAT_RGB10A2_UNORM:
+        case TEX_FORMAT_RGBA32_FLOAT:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void ConvertPixels(const ConvertPixelsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(IsPixelConversionSupported(Attribs.SrcFormat), "Source format ", GetTextureFormatAttribs(Attribs.SrcFormat).Name, " is not supported");
+    DEV_CHECK_ERR(IsPixelConversionSupported(Attribs.DstFormat), "Destination format ", GetTextureFormatAttribs(Attribs.DstFormat).Name, " is not supported");
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+    if (!IsPixelConversionSupported(Attribs.SrcFormat) || !IsPixelConversionSupported(Attribs.DstFormat))
+        return;
+
+    const Uint32 SrcPixelSize = GetTextureFormatAttribs(Attribs.SrcFormat).GetElementSize();
+    const Uint32 DstPixelSize = GetTextureFormatAttribs(Attribs.DstFormat).GetElementSize();
+    DEV_CHECK_ERR(Attribs.Height <= 1 || Attribs.SrcStride >= size_t{Attribs.Width} * SrcPixelSize, "Source stride is too small");
+    DEV_CHECK_ERR(Attribs.Height <= 1 || Attribs.DstStride >= size_t{Attribs.Width} * DstPixelSize, "Destination stride is too small");
+
+    const auto ChannelMap = GetChannelMap(Attribs.Swizzle);
+    const bool IsIdentity = ChannelMap == std::array<Uint8, 4>{0, 1, 2, 3};
+
+    // 8-bit conversions in the same color space only shuffle bytes
+    const bool UseByteMap =
+        Is8BitRGBA(Attribs.SrcFormat) && Is8BitRGBA(Attribs.DstFormat) &&
+        IsSRGB(Attribs.SrcFormat) == IsSRGB(Attribs.DstFormat) &&
+        !Attribs.PremultiplyAlpha;
+    const auto ByteMap = UseByteMap ? GetByteMap(Attribs.SrcFormat, Attribs.DstFormat, ChannelMap) : std::array<Uint8, 4>{};
+
+    ParallelFor(Attribs.pThreadPool, Attribs.Height, [&](Uint32 Row) {
+        const Uint32 DstRow = Attribs.FlipVertically ? Attribs.Height - 1 - Row : Row;
+
+        const auto* pSrcRow = static_cast<const Uint8*>(Attribs.pSrcData) + Row * Attribs.SrcStride;
+        auto*       pDstRow = static_cast<Uint8*>(Attribs.pDstData) + DstRow * Attribs.DstStride;
+
+        if (UseByteMap)
+        {
+            if (ByteMap == std::array<Uint8, 4>{0, 1, 2, 3})
+                std::memcpy(pDstRow, pSrcRow, size_t{Attribs.Width} * 4);
+            else if (ByteMap == std::array<Uint8, 4>{2, 1, 0, 3})
+                SwapRedBlue8(pSrcRow, pDstRow, Attribs.Width);
+            else
+                RemapBytes8(pSrcRow, pDstRow, Attribs.Width, ByteMap);
+            return;
+        }
+
+        PixelChunk Chunk;
+        for (Uint32 x = 0; x < Attribs.Width; x += ChunkSize)
+        {
+            const Uint32 Count = std::min(ChunkSize, Attribs.Width - x);
+
+            DecodePixels(Attribs.SrcFormat, pSrcRow + size_t{x} * SrcPixelSize, Chunk, Count);
+            if (!IsIdentity)
+                ApplySwizzle(Chunk, Count, ChannelMap);
+            if (Attribs.PremultiplyAlpha)
+                PremultiplyAlpha(Chunk, Count);
+            EncodePixels(Attribs.DstFormat, Chunk, pDstRow + size_t{x} * DstPixelSize, Count);
+        }
+    });
+}
+
+} // namespace Diligent
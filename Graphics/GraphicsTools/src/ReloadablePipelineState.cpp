@@ -38,6 +38,8 @@ constexpr INTERFACE_ID ReloadablePipelineState::IID_InternalImpl;
 struct ReloadablePipelineState::CreateInfoWrapperBase
 {
     virtual ~CreateInfoWrapperBase() {}
+
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const = 0;
 };
 
 template <typename CreateInfoType>
@@ -64,6 +66,16 @@ struct ReloadablePipelineState::CreateInfoWrapper : CreateInfoWrapperBase
         return m_CI;
     }
 
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const override final
+    {
+        bool UsesShader = false;
+        ProcessPipelineStateCreateInfoShaders(Get(), [&](const IShader* pShader) {
+            if (pShader != nullptr && Shaders.find(pShader) != Shaders.end())
+                UsesShader = true;
+        });
+        return UsesShader;
+    }
+
     operator const CreateInfoType&() const
     {
         return m_CI;
@@ -186,10 +198,16 @@ bool ReloadablePipelineState::Reload(ReloadGraphicsPipelineCallbackType ReloadGr
     {
         const auto* Name = CreateInfo.Get().PSODesc.Name;
         LOG_ERROR_MESSAGE("Failed to reload pipeline state '", (Name ? Name : "<unnamed>"), "'.");
+        return false;
     }
     return !FoundInCache;
 }
 
+bool ReloadablePipelineState::UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const
+{
+    return m_pCreateInfo && m_pCreateInfo->UsesAnyShader(Shaders);
+}
+
 void ReloadablePipelineState::CopyStaticResources()
 {
     const Uint32 SrcSignCount = m_pOldPipeline->GetResourceSignatureCount();
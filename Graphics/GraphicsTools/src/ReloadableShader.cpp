@@ -26,25 +26,148 @@
 
 #include "ReloadableShader.hpp"
 #include "RenderStateCacheImpl.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "MappedFileStream.hpp"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
 
 constexpr INTERFACE_ID ReloadableShader::IID_InternalImpl;
 
+void ShaderSourceHashCache::BeginReload()
+{
+    ++m_ReloadVersion;
+    m_NumFiles     = 0;
+    m_NumFilesRead = 0;
+}
+
+const XXH128Hash& ShaderSourceHashCache::GetFileHash(IShaderSourceInputStreamFactory* pFactory, const std::string& FilePath)
+{
+    FactoryFiles& Factory = m_Factories[pFactory];
+    if (!Factory.pFactory)
+        Factory.pFactory = pFactory;
+
+    FileInfo& Info = Factory.Files[FilePath];
+    if (Info.ReloadVersion == m_ReloadVersion && m_ReloadVersion != 0)
+        return Info.Hash;
+
+    Info.ReloadVersion = m_ReloadVersion;
+    ++m_NumFiles;
+
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(FilePath.c_str(), CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    if (!pStream)
+    {
+        // The file may have been removed. Zero hash will trigger the reload that will report the error.
+        Info.Hash             = {};
+        Info.ModificationTime = 0;
+        return Info.Hash;
+    }
+
+    RefCntAutoPtr<MappedFileStream> pMappedStream{pStream, MappedFileStream::IID_InternalImpl};
+
+    const Uint64 ModificationTime = pMappedStream ? pMappedStream->GetModificationTime() : 0;
+    const size_t Size             = pStream->GetSize();
+    if (ModificationTime != 0 && ModificationTime == Info.ModificationTime && Size == Info.Size)
+        return Info.Hash;
+
+    ++m_NumFilesRead;
+
+    XXH128State Hasher;
+    if (pMappedStream)
+    {
+        // Hash the mapped contents directly. The modification time and the contents
+        // come from the same mapping, so a later change will update the time.
+        if (Size > 0)
+            Hasher.UpdateRaw(pMappedStream->GetData(), Size);
+    }
+    else
+    {
+        RefCntAutoPtr<IDataBlob> pData = DataBlobImpl::Create();
+        pStream->ReadBlob(pData);
+        if (pData->GetSize() > 0)
+            Hasher.UpdateRaw(pData->GetConstDataPtr(), pData->GetSize());
+    }
+    Info.Hash             = Hasher.Digest();
+    Info.ModificationTime = ModificationTime;
+    Info.Size             = Size;
+
+    return Info.Hash;
+}
+
 ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
                                    RenderStateCacheImpl*   pStateCache,
                                    IShader*                pShader,
-                                   const ShaderCreateInfo& CreateInfo) :
+                                   const ShaderCreateInfo& CreateInfo,
+                                   const ShaderCreateInfo& ReloadCreateInfo) :
     TBase{pRefCounters},
     m_pStateCache{pStateCache},
     m_pShader{pShader},
-    m_CreateInfo{CreateInfo, GetRawAllocator()}
+    m_CreateInfo{ReloadCreateInfo, GetRawAllocator()}
 {
     if (!m_pShader)
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+
+    // Record the sources the shader was actually created from. Note that they may be different
+    // from the sources that the reload create info resolves to.
+    UpdateSourceDependencies(CreateInfo);
+}
+
+void ReloadableShader::UpdateSourceDependencies(const ShaderCreateInfo& CreateInfo)
+{
+    if (CreateInfo.pShaderSourceStreamFactory == nullptr)
+    {
+        m_Dependencies.clear();
+        m_DependenciesUnknown = false;
+        return;
+    }
+
+    std::vector<SourceDependency> Dependencies;
+
+    const bool Succeeded = ProcessShaderIncludes(CreateInfo, [&](const ShaderIncludePreprocessInfo& FileInfo) {
+        // Source provided in the create info can't change
+        if (FileInfo.FilePath.empty() || FileInfo.Source == CreateInfo.Source)
+            return;
+
+        XXH128State Hasher;
+        if (FileInfo.SourceLength > 0)
+            Hasher.UpdateRaw(FileInfo.Source, FileInfo.SourceLength);
+        Dependencies.push_back({FileInfo.FilePath, Hasher.Digest()});
+    });
+
+    if (!Succeeded)
+    {
+        // The list is incomplete, so a change to a file that is missing from it would go unnoticed.
+        // Keep the previous dependencies and treat the sources as changed until the includes are processed.
+        const char* Name = CreateInfo.Desc.Name;
+        LOG_WARNING_MESSAGE("Failed to process includes of shader '", (Name ? Name : "<unnamed>"),
+                            "'. The shader will be reloaded every time until its source dependencies are known.");
+        m_DependenciesUnknown = true;
+        return;
+    }
+
+    m_Dependencies        = std::move(Dependencies);
+    m_DependenciesUnknown = false;
+}
+
+bool ReloadableShader::HasSourceChanged(ShaderSourceHashCache& HashCache) const
+{
+    IShaderSourceInputStreamFactory* pFactory = m_CreateInfo.Get().pShaderSourceStreamFactory;
+    if (pFactory == nullptr)
+        return false;
+
+    if (m_DependenciesUnknown)
+        return true;
+
+    for (const SourceDependency& Dependency : m_Dependencies)
+    {
+        if (!(HashCache.GetFileHash(pFactory, Dependency.FilePath) == Dependency.Hash))
+            return true;
+    }
+    return false;
 }
 
 ReloadableShader::~ReloadableShader()
@@ -81,32 +204,33 @@ void ReloadableShader::QueryInterface(const INTERFACE_ID& IID, IObject** ppInter
     }
 }
 
-bool ReloadableShader::Reload()
+bool ReloadableShader::Reload(bool& FoundInCache)
 {
     RefCntAutoPtr<IShader> pNewShader;
 
-    const bool FoundInCache = m_pStateCache->CreateShaderInternal(m_CreateInfo, &pNewShader);
-    if (pNewShader)
-    {
-        m_pShader = pNewShader;
-    }
-    else
+    FoundInCache = m_pStateCache->CreateShaderInternal(m_CreateInfo, &pNewShader);
+    if (!pNewShader)
     {
         const char* Name = m_CreateInfo.Get().Desc.Name;
         LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'.");
+        return false;
     }
-    return !FoundInCache;
+
+    m_pShader = pNewShader;
+    UpdateSourceDependencies(m_CreateInfo.Get());
+    return true;
 }
 
 
 void ReloadableShader::Create(RenderStateCacheImpl*   pStateCache,
                               IShader*                pShader,
                               const ShaderCreateInfo& CreateInfo,
+                              const ShaderCreateInfo& ReloadCreateInfo,
                               IShader**               ppReloadableShader)
 {
     try
     {
-        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo)};
+        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo, ReloadCreateInfo)};
         *ppReloadableShader = pReloadableShader.Detach();
     }
     catch (...)
@@ -35,6 +35,7 @@
 #include <array>
 #include <mutex>
 #include <vector>
+#include <unordered_set>
 
 #include "Archiver.h"
 #include "Dearchiver.h"
@@ -48,6 +49,7 @@
 #include "CallbackWrapper.hpp"
 #include "GraphicsAccessories.hpp"
 #include "GraphicsUtilities.h"
+#include "Timer.hpp"
 #include "ShaderSourceFactoryUtils.hpp"
 
 namespace Diligent
@@ -293,7 +295,7 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                     _ShaderCI.pShaderSourceStreamFactory = m_pReloadSource;
                 }
             }
-            ReloadableShader::Create(this, pShader, _ShaderCI, ppShader);
+            ReloadableShader::Create(this, pShader, ShaderCI, _ShaderCI, ppShader);
 
             std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
             m_ReloadableShaders.emplace(pShader->GetUniqueID(), RefCntWeakPtr<IShader>{*ppShader});
@@ -895,11 +897,16 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         return 0;
     }
 
-    Uint32 NumStatesReloaded = 0;
+    Timer ReloadTimer;
 
-    // Reload all shaders first
+    RenderStateCacheReloadStats Stats;
+
+    // Reload shaders whose sources have changed first. Every source file is checked only once,
+    // and files whose modification time has not changed since the previous reload are not read.
+    std::unordered_set<const IShader*> ReloadedShaders;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
+        m_SourceHashes.BeginReload();
         for (auto shader_it : m_ReloadableShaders)
         {
             if (auto pShader = shader_it.second.Lock())
@@ -907,8 +914,24 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
                 RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
                 if (pReloadableShader)
                 {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
+                    ++Stats.NumShaders;
+                    if (!pReloadableShader->HasSourceChanged(m_SourceHashes))
+                        continue;
+
+                    // If the shader fails to reload, it keeps the old internal object and will be
+                    // reloaded again next time as its recorded sources still differ from the files.
+                    bool FoundInCache = false;
+                    if (!pReloadableShader->Reload(FoundInCache))
+                    {
+                        ++Stats.NumShadersFailed;
+                        continue;
+                    }
+
+                    // Even if the new shader is found in the cache, the internal shader object has
+                    // been replaced, so all pipelines that use this shader need to be re-created.
+                    ReloadedShaders.emplace(pShader.RawPtr());
+                    if (!FoundInCache)
+                        ++Stats.NumStatesCreated;
                 }
                 else
                 {
@@ -916,11 +939,16 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
                 }
             }
         }
+        Stats.NumSourceFiles     = static_cast<Uint32>(m_SourceHashes.GetNumFiles());
+        Stats.NumSourceFilesRead = static_cast<Uint32>(m_SourceHashes.GetNumFilesRead());
     }
+    Stats.NumShadersReloaded = static_cast<Uint32>(ReloadedShaders.size());
+    Stats.ShaderReloadTime   = ReloadTimer.GetElapsedTime();
 
-    // Reload pipelines.
+    // Reload pipelines that use the reloaded shaders.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    // Graphics pipelines are always re-created when the callback is provided as it may modify the pipeline description.
     {
         std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
         for (auto pso_it : m_ReloadablePipelines)
@@ -928,10 +956,16 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             if (auto pPSO = pso_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (pReloadablePSO)
                 {
+                    ++Stats.NumPipelines;
+                    const bool InvokeCallback = ReloadGraphicsPipeline != nullptr && pPSO->GetDesc().IsAnyGraphicsPipeline();
+                    if (!InvokeCallback && (ReloadedShaders.empty() || !pReloadablePSO->UsesAnyShader(ReloadedShaders)))
+                        continue;
+
+                    ++Stats.NumPipelinesReloaded;
                     if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
-                        ++NumStatesReloaded;
+                        ++Stats.NumStatesCreated;
                 }
                 else
                 {
@@ -940,10 +974,20 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             }
         }
     }
+    Stats.PipelineReloadTime = ReloadTimer.GetElapsedTime() - Stats.ShaderReloadTime;
 
     ++m_ReloadVersion;
 
-    return NumStatesReloaded;
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Reload ", m_ReloadVersion, ": checked ", Stats.NumSourceFiles, " source files (", Stats.NumSourceFilesRead, " read), re-created ",
+                           Stats.NumShadersReloaded, " of ", Stats.NumShaders, " shaders and ", Stats.NumPipelinesReloaded, " of ", Stats.NumPipelines, " pipelines (",
+                           Stats.NumStatesCreated, " new states) in ", static_cast<int>((Stats.ShaderReloadTime + Stats.PipelineReloadTime) * 1000), " ms.");
+
+    {
+        std::lock_guard<std::mutex> Guard{m_LastReloadStatsMtx};
+        m_LastReloadStats = Stats;
+    }
+
+    return Stats.NumStatesCreated;
 }
 
 static constexpr char RenderStateCacheFileExtension[] = ".diligentcache";
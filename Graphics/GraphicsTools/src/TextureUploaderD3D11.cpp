@@ -62,49 +62,9 @@ public:
     {
     }
 
-    // http://en.cppreference.com/w/cpp/thread/condition_variable
-    void WaitForMap()
-    {
-        m_BufferMappedSignal.Wait();
-    }
-
-    void SignalMapped()
-    {
-        m_BufferMappedSignal.Trigger();
-    }
-
-    void SignalCopyScheduled()
-    {
-        m_CopyScheduledSignal.Trigger();
-    }
-
-    virtual void WaitForCopyScheduled() override final
-    {
-        m_CopyScheduledSignal.Wait();
-    }
-
-    bool DbgIsCopyScheduled()
-    {
-        return m_CopyScheduledSignal.IsTriggered();
-    }
-
-    bool DbgIsMapped()
-    {
-        return m_BufferMappedSignal.IsTriggered();
-    }
-
-    void Reset()
-    {
-        m_BufferMappedSignal.Reset();
-        m_CopyScheduledSignal.Reset();
-        UploadBufferBase::Reset();
-    }
-
     ID3D11Texture2D* GetStagingTex() { return m_pStagingTexture; }
 
 private:
-    Threading::Signal        m_BufferMappedSignal;
-    Threading::Signal        m_CopyScheduledSignal;
     CComPtr<ID3D11Texture2D> m_pStagingTexture;
 };
 
@@ -121,23 +81,27 @@ struct TextureUploaderD3D11::InternalData
             Copy
         } operation;
         RefCntAutoPtr<UploadBufferD3D11> pUploadBuffer;
+        RefCntAutoPtr<ITexture>          pDstTexture;
         CComPtr<ID3D11Resource>          pd3d11NativeDstTexture;
-        Uint32                           DstMip       = 0;
-        Uint32                           DstSlice     = 0;
-        Uint32                           DstMipLevels = 0;
+        Uint32                           DstMip   = 0;
+        Uint32                           DstSlice = 0;
+        Uint32                           DstX     = 0;
+        Uint32                           DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels) :
-            operation             {op          },
-            pUploadBuffer         {pBuff       },
-            pd3d11NativeDstTexture{pd3d11DstTex},
-            DstMip                {Mip         },
-            DstSlice              {Slice       },
-            DstMipLevels          {MipLevels   }
+        PendingBufferOperation(Operation op, UploadBufferD3D11* pBuff, ID3D11Resource* pd3d11DstTex, const ScheduleGPUCopyAttribs& Attribs) :
+            operation             {op                 },
+            pUploadBuffer         {pBuff              },
+            pDstTexture           {Attribs.pDstTexture},
+            pd3d11NativeDstTexture{pd3d11DstTex       },
+            DstMip                {Attribs.MipLevel   },
+            DstSlice              {Attribs.ArraySlice },
+            DstX                  {Attribs.DstX       },
+            DstY                  {Attribs.DstY       }
         {}
         // clang-format on
     };
@@ -156,10 +120,10 @@ struct TextureUploaderD3D11::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferD3D11* pUploadBuffer, ID3D11Resource* pd3d11DstTex, Uint32 Mip, Uint32 Slice, Uint32 MipLevels)
+    void EnqueueCopy(UploadBufferD3D11* pUploadBuffer, ID3D11Resource* pd3d11DstTex, const ScheduleGPUCopyAttribs& Attribs)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pd3d11DstTex, Mip, Slice, MipLevels);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pd3d11DstTex, Attribs);
     }
 
     void EnqueueMap(UploadBufferD3D11* pUploadBuffer, PendingBufferOperation::Operation Op)
@@ -224,6 +188,8 @@ TextureUploaderD3D11::~TextureUploaderD3D11()
 
 void TextureUploaderD3D11::RenderThreadUpdate(IDeviceContext* pContext)
 {
+    DEV_CHECK_ERR(!pContext->GetDesc().IsDeferred, "Texture uploader does not support deferred contexts");
+
     m_pInternalData->SwapMapQueues();
     if (!m_pInternalData->m_InWorkOperations.empty())
     {
@@ -234,6 +200,8 @@ void TextureUploaderD3D11::RenderThreadUpdate(IDeviceContext* pContext)
         for (auto& Operation : m_pInternalData->m_InWorkOperations)
         {
             m_pInternalData->Execute(pd3d11NativeCtx, Operation, false /*ExecuteImmediately*/);
+            if (Operation.operation == InternalData::PendingBufferOperation::Copy)
+                OnCopyExecuted(*Operation.pUploadBuffer);
         }
 
         m_pInternalData->m_InWorkOperations.clear();
@@ -305,10 +273,15 @@ void TextureUploaderD3D11::InternalData::Execute(ID3D11DeviceContext*    pd3d11N
                 pd3d11NativeCtx->Unmap(pBuffer->GetStagingTex(), Subres);
             }
 
+            const auto& DstTexDesc = OperationInfo.pDstTexture->GetDesc();
             for (Uint32 Slice = 0; Slice < UploadBuffDesc.ArraySize; ++Slice)
             {
                 for (Uint32 Mip = 0; Mip < UploadBuffDesc.MipLevels; ++Mip)
                 {
+                    CopyRegion Region;
+                    if (!GetCopyRegion(UploadBuffDesc, DstTexDesc, OperationInfo.DstMip, OperationInfo.DstX, OperationInfo.DstY, Mip, Region))
+                        continue;
+
                     UINT SrcSubres = D3D11CalcSubresource(
                         static_cast<UINT>(Mip),
                         static_cast<UINT>(Slice),
@@ -316,13 +289,16 @@ void TextureUploaderD3D11::InternalData::Execute(ID3D11DeviceContext*    pd3d11N
                     UINT DstSubres = D3D11CalcSubresource(
                         static_cast<UINT>(OperationInfo.DstMip + Mip),
                         static_cast<UINT>(OperationInfo.DstSlice + Slice),
-                        static_cast<UINT>(OperationInfo.DstMipLevels));
+                        static_cast<UINT>(DstTexDesc.MipLevels));
+
+                    const D3D11_BOX SrcBox{Region.SrcBox.MinX, Region.SrcBox.MinY, Region.SrcBox.MinZ, Region.SrcBox.MaxX, Region.SrcBox.MaxY, Region.SrcBox.MaxZ};
                     pd3d11NativeCtx->CopySubresourceRegion(OperationInfo.pd3d11NativeDstTexture, DstSubres,
-                                                           0, 0, 0, // DstX, DstY, DstZ
+                                                           Region.DstX,
+                                                           Region.DstY,
+                                                           0, // DstZ
                                                            pBuffer->GetStagingTex(),
                                                            SrcSubres,
-                                                           nullptr // pSrcBox
-                    );
+                                                           &SrcBox);
                 }
             }
             pBuffer->SignalCopyScheduled();
@@ -334,6 +310,20 @@ void TextureUploaderD3D11::InternalData::Execute(ID3D11DeviceContext*    pd3d11N
 void TextureUploaderD3D11::AllocateUploadBuffer(IDeviceContext*         pContext,
                                                 const UploadBufferDesc& Desc,
                                                 IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(pContext, Desc, ppBuffer, true /*WaitForMap*/);
+}
+
+void TextureUploaderD3D11::AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                                     IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(nullptr, Desc, ppBuffer, false /*WaitForMap*/);
+}
+
+void TextureUploaderD3D11::AllocateUploadBufferImpl(IDeviceContext*         pContext,
+                                                    const UploadBufferDesc& Desc,
+                                                    IUploadBuffer**         ppBuffer,
+                                                    bool                    WaitForMap)
 {
     *ppBuffer = nullptr;
 
@@ -390,6 +380,7 @@ void TextureUploaderD3D11::AllocateUploadBuffer(IDeviceContext*         pContext
                          m_pDevice->GetTextureFormatInfo(Desc.Format).Name, " staging texture");
 
         pUploadBuffer = MakeNewRCObj<UploadBufferD3D11>()(Desc, pStagingTex);
+        OnUploadBufferCreated(*pUploadBuffer);
     }
 
     if (pUploadBuffer)
@@ -404,23 +395,21 @@ void TextureUploaderD3D11::AllocateUploadBuffer(IDeviceContext*         pContext
         {
             // Worker thread
             m_pInternalData->EnqueueMap(pUploadBuffer, InternalData::PendingBufferOperation::Map);
-            pUploadBuffer->WaitForMap();
+            if (WaitForMap)
+                pUploadBuffer->WaitForMap();
         }
     }
 
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext* pContext,
-                                           ITexture*       pDstTexture,
-                                           Uint32          ArraySlice,
-                                           Uint32          MipLevel,
-                                           IUploadBuffer*  pUploadBuffer)
+void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext*               pContext,
+                                           const ScheduleGPUCopyAttribs& Attribs)
 {
-    auto*                        pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(pUploadBuffer);
-    RefCntAutoPtr<ITextureD3D11> pDstTexD3D11(pDstTexture, IID_TextureD3D11);
+    auto*                        pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(Attribs.pUploadBuffer);
+    RefCntAutoPtr<ITextureD3D11> pDstTexD3D11(Attribs.pDstTexture, IID_TextureD3D11);
     auto*                        pd3d11NativeDstTex = pDstTexD3D11->GetD3D11Texture();
-    const auto&                  DstTexDesc         = pDstTexture->GetDesc();
+    PrepareGPUCopy(pContext, *pUploadBufferD3D11, Attribs);
     if (pContext != nullptr)
     {
         // Main thread
@@ -429,16 +418,15 @@ void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext* pContext,
                 InternalData::PendingBufferOperation::Copy,
                 pUploadBufferD3D11,
                 pd3d11NativeDstTex,
-                MipLevel,
-                ArraySlice,
-                DstTexDesc.MipLevels //
+                Attribs //
             };
         m_pInternalData->ExecuteImmediately(pContext, CopyOp);
+        OnCopyExecuted(*pUploadBufferD3D11);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferD3D11, pd3d11NativeDstTex, MipLevel, ArraySlice, DstTexDesc.MipLevels);
+        m_pInternalData->EnqueueCopy(pUploadBufferD3D11, pd3d11NativeDstTex, Attribs);
     }
 }
 
@@ -450,6 +438,7 @@ void TextureUploaderD3D11::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 
     std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
     m_pInternalData->m_UploadBufferCache[pUploadBufferD3D11->GetDesc()].emplace_back(pUploadBufferD3D11);
+    TrimUploadBufferCache(m_pInternalData->m_UploadBufferCache);
 }
 
 TextureUploaderStats TextureUploaderD3D11::GetStats()
@@ -457,6 +446,7 @@ TextureUploaderStats TextureUploaderD3D11::GetStats()
     TextureUploaderStats        Stats;
     std::lock_guard<std::mutex> QueueLock(m_pInternalData->m_PendingOperationsMtx);
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->m_PendingOperations.size());
+    GetUploadStats(Stats);
 
     return Stats;
 }
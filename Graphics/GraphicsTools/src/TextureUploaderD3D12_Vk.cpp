@@ -64,20 +64,10 @@ public:
         }
     }
 
-    void WaitForMap()
-    {
-        m_TextureMappedSignal.Wait();
-    }
-
-    void SignalMapped()
-    {
-        m_TextureMappedSignal.Trigger();
-    }
-
     void SignalCopyScheduled(Uint64 FenceValue)
     {
         m_CopyScheduledFenceValue = FenceValue;
-        m_CopyScheduledSignal.Trigger();
+        UploadBufferBase::SignalCopyScheduled();
     }
 
     void Unmap(IDeviceContext* pDeviceContext, Uint32 Mip, Uint32 Slice)
@@ -97,29 +87,12 @@ public:
 
     void Reset()
     {
-        m_CopyScheduledSignal.Reset();
-        m_TextureMappedSignal.Reset();
         m_CopyScheduledFenceValue = 0;
         UploadBufferBase::Reset();
     }
 
-    virtual void WaitForCopyScheduled() override final
-    {
-        m_CopyScheduledSignal.Wait();
-    }
-
     ITexture* GetStagingTexture() { return m_pStagingTexture; }
 
-    bool DbgIsCopyScheduled() const
-    {
-        return m_CopyScheduledSignal.IsTriggered();
-    }
-
-    bool DbgIsMapped()
-    {
-        return m_TextureMappedSignal.IsTriggered();
-    }
-
     Uint64 GetCopyScheduledFenceValue() const
     {
         VERIFY(m_CopyScheduledFenceValue != 0, "Fence value has not been initialized");
@@ -127,9 +100,6 @@ public:
     }
 
 private:
-    Threading::Signal m_CopyScheduledSignal;
-    Threading::Signal m_TextureMappedSignal;
-
     RefCntAutoPtr<ITexture> m_pStagingTexture;
     Uint64                  m_CopyScheduledFenceValue = 0;
 };
@@ -150,18 +120,22 @@ struct TextureUploaderD3D12_Vk::InternalData
         RefCntAutoPtr<ITexture>      pDstTexture;
         Uint32                       DstSlice = 0;
         Uint32                       DstMip   = 0;
+        Uint32                       DstX     = 0;
+        Uint32                       DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadTexture* pUploadTex) :
             operation     {op        },
             pUploadTexture{pUploadTex}
         {}
-        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
-            operation      {op        },
-            pUploadTexture {pUploadTex},
-            pDstTexture    {pDstTex   },
-            DstSlice       {dstSlice  },
-            DstMip         {dstMip    }
+        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, const ScheduleGPUCopyAttribs& Attribs) :
+            operation      {op                 },
+            pUploadTexture {pUploadTex         },
+            pDstTexture    {Attribs.pDstTexture},
+            DstSlice       {Attribs.ArraySlice },
+            DstMip         {Attribs.MipLevel   },
+            DstX           {Attribs.DstX       },
+            DstY           {Attribs.DstY       }
         {}
         // clang-format on
     };
@@ -195,10 +169,10 @@ struct TextureUploaderD3D12_Vk::InternalData
         return m_InWorkOperations;
     }
 
-    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadTexture* pUploadBuffer, const ScheduleGPUCopyAttribs& Attribs)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, Attribs);
     }
 
     void EnqueueMap(UploadTexture* pUploadBuffer)
@@ -246,11 +220,14 @@ struct TextureUploaderD3D12_Vk::InternalData
         return pUploadTexture;
     }
 
-    void RecycleUploadTexture(UploadTexture* pUploadTexture)
+    void RecycleUploadTexture(TextureUploaderD3D12_Vk& Uploader, UploadTexture* pUploadTexture)
     {
         std::lock_guard<std::mutex> CacheLock(m_UploadTexturesCacheMtx);
         auto&                       Deque = m_UploadTexturesCache[pUploadTexture->GetDesc()];
         Deque.emplace_back(pUploadTexture);
+        // Textures with pending copies may be released too: the engine defers
+        // the destruction of the staging texture until the GPU is done with it.
+        Uploader.TrimUploadBufferCache(m_UploadTexturesCache);
     }
 
     Uint32 GetNumPendingOperations()
@@ -294,6 +271,8 @@ TextureUploaderD3D12_Vk::~TextureUploaderD3D12_Vk()
 
 void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
 {
+    DEV_CHECK_ERR(!pContext->GetDesc().IsDeferred, "Texture uploader does not support deferred contexts");
+
     auto& InWorkOperations = m_pInternalData->SwapMapQueues();
     if (!InWorkOperations.empty())
     {
@@ -302,7 +281,10 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
         {
             m_pInternalData->Execute(pContext, OperationInfo);
             if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+            {
+                OnCopyExecuted(*OperationInfo.pUploadTexture);
                 ++NumCopyOperations;
+            }
         }
 
         if (NumCopyOperations > 0)
@@ -350,12 +332,17 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
         case InternalData::PendingBufferOperation::Copy:
         {
             VERIFY(pUploadTex->DbgIsMapped(), "Upload texture must be copied only after it has been mapped");
+            const auto& DstTexDesc = OperationInfo.pDstTexture->GetDesc();
             for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
             {
                 for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
                 {
                     pUploadTex->Unmap(pContext, Mip, Slice);
 
+                    CopyRegion Region;
+                    if (!GetCopyRegion(StagingTexDesc, DstTexDesc, OperationInfo.DstMip, OperationInfo.DstX, OperationInfo.DstY, Mip, Region))
+                        continue;
+
                     CopyTextureAttribs CopyInfo //
                         {
                             pUploadTex->GetStagingTexture(),
@@ -363,10 +350,13 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
                             OperationInfo.pDstTexture,
                             RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
                         };
+                    CopyInfo.pSrcBox     = &Region.SrcBox;
                     CopyInfo.SrcMipLevel = Mip;
                     CopyInfo.SrcSlice    = Slice;
                     CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
                     CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
+                    CopyInfo.DstX        = Region.DstX;
+                    CopyInfo.DstY        = Region.DstY;
                     pContext->CopyTexture(CopyInfo);
                 }
             }
@@ -378,6 +368,20 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
 void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pContext,
                                                    const UploadBufferDesc& Desc,
                                                    IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(pContext, Desc, ppBuffer, true /*WaitForMap*/);
+}
+
+void TextureUploaderD3D12_Vk::AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                                        IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(nullptr, Desc, ppBuffer, false /*WaitForMap*/);
+}
+
+void TextureUploaderD3D12_Vk::AllocateUploadBufferImpl(IDeviceContext*         pContext,
+                                                       const UploadBufferDesc& Desc,
+                                                       IUploadBuffer**         ppBuffer,
+                                                       bool                    WaitForMap)
 {
     RefCntAutoPtr<UploadTexture> pUploadTexture = m_pInternalData->FindCachedUploadTexture(Desc);
 
@@ -402,6 +406,7 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
                          GetTextureFormatAttribs(Desc.Format).Name, " staging texture");
 
         pUploadTexture = MakeNewRCObj<UploadTexture>()(Desc, pStagingTexture);
+        OnUploadBufferCreated(*pUploadTexture);
     }
 
     if (pContext != nullptr)
@@ -414,30 +419,23 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
     {
         // Worker thread
         m_pInternalData->EnqueueMap(pUploadTexture);
-        pUploadTexture->WaitForMap();
+        if (WaitForMap)
+            pUploadTexture->WaitForMap();
     }
     *ppBuffer = pUploadTexture.Detach();
 }
 
-void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
-                                              ITexture*       pDstTexture,
-                                              Uint32          ArraySlice,
-                                              Uint32          MipLevel,
-                                              IUploadBuffer*  pUploadBuffer)
+void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext*               pContext,
+                                              const ScheduleGPUCopyAttribs& Attribs)
 {
-    auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
+    auto* pUploadTexture = ClassPtrCast<UploadTexture>(Attribs.pUploadBuffer);
+    PrepareGPUCopy(pContext, *pUploadTexture, Attribs);
     if (pContext != nullptr)
     {
         // Render thread
-        InternalData::PendingBufferOperation CopyOp //
-            {
-                InternalData::PendingBufferOperation::Operation::Copy,
-                pUploadTexture,
-                pDstTexture,
-                ArraySlice,
-                MipLevel //
-            };
+        InternalData::PendingBufferOperation CopyOp{InternalData::PendingBufferOperation::Operation::Copy, pUploadTexture, Attribs};
         m_pInternalData->Execute(pContext, CopyOp);
+        OnCopyExecuted(*pUploadTexture);
 
         // The buffer may be recycled immediately after the copy scheduled is signaled,
         // so we must signal the fence first.
@@ -449,7 +447,7 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadTexture, Attribs);
     }
 }
 
@@ -458,13 +456,14 @@ void TextureUploaderD3D12_Vk::RecycleBuffer(IUploadBuffer* pUploadBuffer)
     auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
     VERIFY(pUploadTexture->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
 
-    m_pInternalData->RecycleUploadTexture(pUploadTexture);
+    m_pInternalData->RecycleUploadTexture(*this, pUploadTexture);
 }
 
 TextureUploaderStats TextureUploaderD3D12_Vk::GetStats()
 {
     TextureUploaderStats Stats;
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->GetNumPendingOperations());
+    GetUploadStats(Stats);
     return Stats;
 }
 
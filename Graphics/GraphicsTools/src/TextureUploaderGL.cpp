@@ -77,29 +77,6 @@ public:
         }
     }
 
-    // http://en.cppreference.com/w/cpp/thread/condition_variable
-    void WaitForMap()
-    {
-        m_BufferMappedSignal.Wait();
-    }
-
-    void SignalMapped()
-    {
-        m_BufferMappedSignal.Trigger();
-    }
-
-    void SignalCopyScheduled()
-    {
-        m_CopyScheduledSignal.Trigger();
-    }
-
-    virtual void WaitForCopyScheduled() override final
-    {
-        m_CopyScheduledSignal.Wait();
-    }
-
-    bool DbgIsCopyScheduled() const { return m_CopyScheduledSignal.IsTriggered(); }
-
     void SetDataPtr(Uint8* pBufferData)
     {
         for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
@@ -117,13 +94,6 @@ public:
         return m_SubresourceOffsets[size_t{m_Desc.MipLevels} * size_t{Slice} + size_t{Mip}];
     }
 
-    void Reset()
-    {
-        m_BufferMappedSignal.Reset();
-        m_CopyScheduledSignal.Reset();
-        UploadBufferBase::Reset();
-    }
-
     Uint32 GetTotalSize() const
     {
         return m_SubresourceOffsets.back();
@@ -137,8 +107,6 @@ private:
     }
 
     friend TextureUploaderGL;
-    Threading::Signal      m_BufferMappedSignal;
-    Threading::Signal      m_CopyScheduledSignal;
     RefCntAutoPtr<IBuffer> m_pStagingBuffer;
     std::vector<Uint32>    m_SubresourceOffsets;
     std::vector<Uint32>    m_SubresourceStrides;
@@ -155,10 +123,10 @@ struct TextureUploaderGL::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferGL* pUploadBuffer, ITexture* pDstTexture, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadBufferGL* pUploadBuffer, const ScheduleGPUCopyAttribs& Attribs)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, dstSlice, dstMip);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, Attribs);
     }
 
     void EnqueueMap(UploadBufferGL* pUploadBuffer)
@@ -179,18 +147,22 @@ struct TextureUploaderGL::InternalData
         RefCntAutoPtr<ITexture>       pDstTexture;
         Uint32                        DstSlice = 0;
         Uint32                        DstMip   = 0;
+        Uint32                        DstX     = 0;
+        Uint32                        DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferGL* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferGL* pBuff, ITexture *pDstTex, Uint32 dstSlice, Uint32 dstMip) :
-            operation    {op      },
-            pUploadBuffer{pBuff   },
-            pDstTexture  {pDstTex },
-            DstSlice     {dstSlice},
-            DstMip       {dstMip  }
+        PendingBufferOperation(Operation op, UploadBufferGL* pBuff, const ScheduleGPUCopyAttribs& Attribs) :
+            operation    {op                 },
+            pUploadBuffer{pBuff              },
+            pDstTexture  {Attribs.pDstTexture},
+            DstSlice     {Attribs.ArraySlice },
+            DstMip       {Attribs.MipLevel   },
+            DstX         {Attribs.DstX       },
+            DstY         {Attribs.DstY       }
         {}
         // clang-format on
     };
@@ -238,12 +210,16 @@ TextureUploaderGL::~TextureUploaderGL()
 
 void TextureUploaderGL::RenderThreadUpdate(IDeviceContext* pContext)
 {
+    DEV_CHECK_ERR(!pContext->GetDesc().IsDeferred, "Texture uploader does not support deferred contexts");
+
     m_pInternalData->SwapMapQueues();
     if (!m_pInternalData->m_InWorkOperations.empty())
     {
         for (auto& OperationInfo : m_pInternalData->m_InWorkOperations)
         {
             m_pInternalData->Execute(m_pDevice, pContext, OperationInfo);
+            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+                OnCopyExecuted(*OperationInfo.pUploadBuffer);
         }
         m_pInternalData->m_InWorkOperations.clear();
     }
@@ -292,10 +268,12 @@ void TextureUploaderGL::InternalData::Execute(IRenderDevice*          pDevice,
 
                     TextureSubResData SubResData(pBuffer->m_pStagingBuffer, SrcOffset, SrcStride);
 
-                    auto MipLevelProps = GetMipLevelProperties(TexDesc, OperationInfo.DstMip + Mip);
-                    Box  DstBox;
-                    DstBox.MaxX = MipLevelProps.LogicalWidth;
-                    DstBox.MaxY = MipLevelProps.LogicalHeight;
+                    // Copy the upload buffer mip to the region at the (scaled) offset, clipped to the destination mip
+                    CopyRegion Region;
+                    if (!GetCopyRegion(UploadBuffDesc, TexDesc, OperationInfo.DstMip, OperationInfo.DstX, OperationInfo.DstY, Mip, Region))
+                        continue;
+
+                    const Box DstBox{Region.DstX, Region.DstX + Region.SrcBox.Width(), Region.DstY, Region.DstY + Region.SrcBox.Height()};
                     pContext->UpdateTexture(OperationInfo.pDstTexture, OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox,
                                             SubResData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
                 }
@@ -309,6 +287,20 @@ void TextureUploaderGL::InternalData::Execute(IRenderDevice*          pDevice,
 void TextureUploaderGL::AllocateUploadBuffer(IDeviceContext*         pContext,
                                              const UploadBufferDesc& Desc,
                                              IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(pContext, Desc, ppBuffer, true /*WaitForMap*/);
+}
+
+void TextureUploaderGL::AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                                  IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(nullptr, Desc, ppBuffer, false /*WaitForMap*/);
+}
+
+void TextureUploaderGL::AllocateUploadBufferImpl(IDeviceContext*         pContext,
+                                                 const UploadBufferDesc& Desc,
+                                                 IUploadBuffer**         ppBuffer,
+                                                 bool                    WaitForMap)
 {
     *ppBuffer = nullptr;
     RefCntAutoPtr<UploadBufferGL> pUploadBuffer;
@@ -334,6 +326,7 @@ void TextureUploaderGL::AllocateUploadBuffer(IDeviceContext*         pContext,
     if (!pUploadBuffer)
     {
         pUploadBuffer = MakeNewRCObj<UploadBufferGL>()(Desc);
+        OnUploadBufferCreated(*pUploadBuffer);
         LOG_INFO_MESSAGE("TextureUploaderGL: created upload buffer for ", Desc.Width, 'x', Desc.Height, 'x',
                          Desc.Depth, ' ', Desc.MipLevels, "-mip ", Desc.ArraySize, "-slice ",
                          m_pDevice->GetTextureFormatInfo(Desc.Format).Name, " texture");
@@ -349,35 +342,28 @@ void TextureUploaderGL::AllocateUploadBuffer(IDeviceContext*         pContext,
     {
         // Worker thread
         m_pInternalData->EnqueueMap(pUploadBuffer);
-        pUploadBuffer->WaitForMap();
+        if (WaitForMap)
+            pUploadBuffer->WaitForMap();
     }
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderGL::ScheduleGPUCopy(IDeviceContext* pContext,
-                                        ITexture*       pDstTexture,
-                                        Uint32          ArraySlice,
-                                        Uint32          MipLevel,
-                                        IUploadBuffer*  pUploadBuffer)
+void TextureUploaderGL::ScheduleGPUCopy(IDeviceContext*               pContext,
+                                        const ScheduleGPUCopyAttribs& Attribs)
 {
-    auto* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(pUploadBuffer);
+    auto* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(Attribs.pUploadBuffer);
+    PrepareGPUCopy(pContext, *pUploadBufferGL, Attribs);
     if (pContext != nullptr)
     {
         // Render thread
-        InternalData::PendingBufferOperation CopyOp //
-            {
-                InternalData::PendingBufferOperation::Operation::Copy,
-                pUploadBufferGL,
-                pDstTexture,
-                ArraySlice,
-                MipLevel //
-            };
+        InternalData::PendingBufferOperation CopyOp{InternalData::PendingBufferOperation::Operation::Copy, pUploadBufferGL, Attribs};
         m_pInternalData->Execute(m_pDevice, pContext, CopyOp);
+        OnCopyExecuted(*pUploadBufferGL);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferGL, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadBufferGL, Attribs);
     }
 }
 
@@ -392,6 +378,7 @@ void TextureUploaderGL::RecycleBuffer(IUploadBuffer* pUploadBuffer)
     auto& Cache = m_pInternalData->m_UploadBufferCache;
     auto& Deque = Cache[pUploadBufferGL->GetDesc()];
     Deque.emplace_back(pUploadBufferGL);
+    TrimUploadBufferCache(Cache);
 }
 
 TextureUploaderStats TextureUploaderGL::GetStats()
@@ -399,6 +386,7 @@ TextureUploaderStats TextureUploaderGL::GetStats()
     TextureUploaderStats        Stats;
     std::lock_guard<std::mutex> QueueLock(m_pInternalData->m_PendingOperationsMtx);
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->m_PendingOperations.size());
+    GetUploadStats(Stats);
     return Stats;
 }
 
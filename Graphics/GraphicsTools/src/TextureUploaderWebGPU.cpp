@@ -27,6 +27,7 @@
 #include <mutex>
 #include <deque>
 #include <unordered_map>
+#include <algorithm>
 #include <webgpu/webgpu.h>
 
 #include "BufferWebGPU.h"
@@ -83,32 +84,6 @@ public:
         }
     }
 
-    // http://en.cppreference.com/w/cpp/thread/condition_variable
-    void WaitForMap()
-    {
-        m_BufferMappedSignal.Wait();
-    }
-
-    void SignalMapped()
-    {
-        m_BufferMappedSignal.Trigger();
-    }
-
-    void SignalCopyScheduled()
-    {
-        m_CopyScheduledSignal.Trigger();
-    }
-
-    virtual void WaitForCopyScheduled() override final
-    {
-        m_CopyScheduledSignal.Wait();
-    }
-
-    bool DbgIsCopyScheduled() const
-    {
-        return m_CopyScheduledSignal.IsTriggered();
-    }
-
     void SetDataPtr(Uint8* pBufferData)
     {
         for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
@@ -137,17 +112,8 @@ public:
         return m_SubresourceOffsets.back();
     }
 
-    void Reset()
-    {
-        m_BufferMappedSignal.Reset();
-        m_CopyScheduledSignal.Reset();
-        UploadBufferBase::Reset();
-    }
-
 private:
     friend TextureUploaderWebGPU;
-    Threading::Signal      m_BufferMappedSignal;
-    Threading::Signal      m_CopyScheduledSignal;
     RefCntAutoPtr<IBuffer> m_pStagingBuffer;
     std::vector<Uint32>    m_SubresourceOffsets;
     std::vector<Uint32>    m_SubresourceStrides;
@@ -169,19 +135,22 @@ struct TextureUploaderWebGPU::InternalData
         RefCntAutoPtr<ITexture>           pDstTexture;
         Uint32                            DstSlice = 0;
         Uint32                            DstMip   = 0;
+        Uint32                            DstX     = 0;
+        Uint32                            DstY     = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff) :
             operation    {op   },
             pUploadBuffer{pBuff}
         {}
-        PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff, ITexture* pDstTex, Uint32 Slice, Uint32 Mip) :
-            operation             {op          },
-            pUploadBuffer         {pBuff       },
-            pDstTexture           {pDstTex     },
-            DstSlice              {Slice       },
-            DstMip                {Mip         }
-          
+        PendingBufferOperation(Operation op, UploadBufferWebGPU* pBuff, const ScheduleGPUCopyAttribs& Attribs) :
+            operation    {op                 },
+            pUploadBuffer{pBuff              },
+            pDstTexture  {Attribs.pDstTexture},
+            DstSlice     {Attribs.ArraySlice },
+            DstMip       {Attribs.MipLevel   },
+            DstX         {Attribs.DstX       },
+            DstY         {Attribs.DstY       }
         {}
         // clang-format on
     };
@@ -199,10 +168,10 @@ struct TextureUploaderWebGPU::InternalData
         m_PendingOperations.swap(m_InWorkOperations);
     }
 
-    void EnqueueCopy(UploadBufferWebGPU* pUploadBuffer, ITexture* pDstTexture, Uint32 Slice, Uint32 MipLevel)
+    void EnqueueCopy(UploadBufferWebGPU* pUploadBuffer, const ScheduleGPUCopyAttribs& Attribs)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTexture, Slice, MipLevel);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, Attribs);
     }
 
     void EnqueueMap(UploadBufferWebGPU* pUploadBuffer)
@@ -257,10 +226,12 @@ struct TextureUploaderWebGPU::InternalData
 
                         TextureSubResData SubResData(pBuffer->m_pStagingBuffer, SrcOffset, SrcStride);
 
-                        auto MipLevelProps = GetMipLevelProperties(TexDesc, OperationInfo.DstMip + Mip);
-                        Box  DstBox;
-                        DstBox.MaxX = MipLevelProps.LogicalWidth;
-                        DstBox.MaxY = MipLevelProps.LogicalHeight;
+                        // Copy the upload buffer mip to the region at the (scaled) offset, clipped to the destination mip
+                        CopyRegion Region;
+                        if (!GetCopyRegion(UploadBuffDesc, TexDesc, OperationInfo.DstMip, OperationInfo.DstX, OperationInfo.DstY, Mip, Region))
+                            continue;
+
+                        const Box DstBox{Region.DstX, Region.DstX + Region.SrcBox.Width(), Region.DstY, Region.DstY + Region.SrcBox.Height()};
                         pContext->UpdateTexture(OperationInfo.pDstTexture, OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox,
                                                 SubResData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
                     }
@@ -302,11 +273,17 @@ TextureUploaderWebGPU::~TextureUploaderWebGPU()
 
 void TextureUploaderWebGPU::RenderThreadUpdate(IDeviceContext* pContext)
 {
+    DEV_CHECK_ERR(!pContext->GetDesc().IsDeferred, "Texture uploader does not support deferred contexts");
+
     m_pInternalData->SwapMapQueues();
     if (!m_pInternalData->m_InWorkOperations.empty())
     {
         for (auto& OperationInfo : m_pInternalData->m_InWorkOperations)
+        {
             m_pInternalData->Execute(pContext, OperationInfo);
+            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+                OnCopyExecuted(*OperationInfo.pUploadBuffer);
+        }
 
         m_pInternalData->m_InWorkOperations.clear();
     }
@@ -315,6 +292,20 @@ void TextureUploaderWebGPU::RenderThreadUpdate(IDeviceContext* pContext)
 void TextureUploaderWebGPU::AllocateUploadBuffer(IDeviceContext*         pContext,
                                                  const UploadBufferDesc& Desc,
                                                  IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(pContext, Desc, ppBuffer, true /*WaitForMap*/);
+}
+
+void TextureUploaderWebGPU::AllocateUploadBufferAsync(const UploadBufferDesc& Desc,
+                                                      IUploadBuffer**         ppBuffer)
+{
+    AllocateUploadBufferImpl(nullptr, Desc, ppBuffer, false /*WaitForMap*/);
+}
+
+void TextureUploaderWebGPU::AllocateUploadBufferImpl(IDeviceContext*         pContext,
+                                                     const UploadBufferDesc& Desc,
+                                                     IUploadBuffer**         ppBuffer,
+                                                     bool                    WaitForMap)
 {
     *ppBuffer = nullptr;
     RefCntAutoPtr<UploadBufferWebGPU> pUploadBuffer;
@@ -340,6 +331,7 @@ void TextureUploaderWebGPU::AllocateUploadBuffer(IDeviceContext*         pContex
     if (!pUploadBuffer)
     {
         pUploadBuffer = MakeNewRCObj<UploadBufferWebGPU>()(Desc);
+        OnUploadBufferCreated(*pUploadBuffer);
         LOG_INFO_MESSAGE("TextureUploaderWebGPU: created upload buffer for ", Desc.Width, 'x', Desc.Height, 'x',
                          Desc.Depth, ' ', Desc.MipLevels, "-mip ", Desc.ArraySize, "-slice ",
                          m_pDevice->GetTextureFormatInfo(Desc.Format).Name, " texture");
@@ -355,35 +347,28 @@ void TextureUploaderWebGPU::AllocateUploadBuffer(IDeviceContext*         pContex
     {
         // Worker thread
         m_pInternalData->EnqueueMap(pUploadBuffer);
-        pUploadBuffer->WaitForMap();
+        if (WaitForMap)
+            pUploadBuffer->WaitForMap();
     }
     *ppBuffer = pUploadBuffer.Detach();
 }
 
-void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext* pContext,
-                                            ITexture*       pDstTexture,
-                                            Uint32          ArraySlice,
-                                            Uint32          MipLevel,
-                                            IUploadBuffer*  pUploadBuffer)
+void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext*               pContext,
+                                            const ScheduleGPUCopyAttribs& Attribs)
 {
-    auto* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
+    auto* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(Attribs.pUploadBuffer);
+    PrepareGPUCopy(pContext, *pUploadBufferWebGPU, Attribs);
     if (pContext != nullptr)
     {
         // Render thread
-        InternalData::PendingBufferOperation CopyOp //
-            {
-                InternalData::PendingBufferOperation::Operation::Copy,
-                pUploadBufferWebGPU,
-                pDstTexture,
-                ArraySlice,
-                MipLevel //
-            };
+        InternalData::PendingBufferOperation CopyOp{InternalData::PendingBufferOperation::Operation::Copy, pUploadBufferWebGPU, Attribs};
         m_pInternalData->Execute(pContext, CopyOp);
+        OnCopyExecuted(*pUploadBufferWebGPU);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadBufferWebGPU, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadBufferWebGPU, Attribs);
     }
 }
 
@@ -398,6 +383,7 @@ void TextureUploaderWebGPU::RecycleBuffer(IUploadBuffer* pUploadBuffer)
     auto& Cache = m_pInternalData->m_UploadBufferCache;
     auto& Deque = Cache[pUploadBufferWebGPU->GetDesc()];
     Deque.emplace_back(pUploadBufferWebGPU);
+    TrimUploadBufferCache(Cache);
 }
 
 TextureUploaderStats TextureUploaderWebGPU::GetStats()
@@ -405,6 +391,7 @@ TextureUploaderStats TextureUploaderWebGPU::GetStats()
     TextureUploaderStats        Stats;
     std::lock_guard<std::mutex> QueueLock(m_pInternalData->m_PendingOperationsMtx);
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->m_PendingOperations.size());
+    GetUploadStats(Stats);
     return Stats;
 }
 
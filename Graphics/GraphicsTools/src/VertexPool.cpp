@@ -29,6 +29,7 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -38,6 +39,7 @@
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "ThreadArenaAllocationsManager.hpp"
 
 namespace Diligent
 {
@@ -65,6 +67,23 @@ public:
         VERIFY_EXPR(m_Region.IsValid());
     }
 
+    VertexPoolAllocationImpl(IReferenceCounters*                         pRefCounters,
+                             VertexPoolImpl*                             pParentPool,
+                             Uint32                                      StartVertex,
+                             Uint32                                      VertexCount,
+                             ThreadArenaAllocationsManager::Allocation&& ArenaRegion) :
+        // clang-format off
+        TBase        {pRefCounters},
+        m_pParentPool{pParentPool},
+        m_ArenaRegion{std::move(ArenaRegion)},
+        m_StartVertex{StartVertex},
+        m_VertexCount{VertexCount}
+    // clang-format on
+    {
+        VERIFY_EXPR(m_pParentPool);
+        VERIFY_EXPR(m_ArenaRegion.IsValid());
+    }
+
     ~VertexPoolAllocationImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_VertexPoolAllocation, TBase)
@@ -110,7 +129,9 @@ public:
 private:
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
+    // Only one of the two regions is valid
     VariableSizeAllocationsManager::Allocation m_Region;
+    ThreadArenaAllocationsManager::Allocation  m_ArenaRegion;
 
     const Uint32 m_StartVertex;
     const Uint32 m_VertexCount;
@@ -202,6 +223,33 @@ public:
             // NB: request the size from the buffer. It may be different from DynBuffCI.Desc.Size.
             m_BufferSizes[i].store(m_Buffers.back()->GetDesc().Size);
         }
+
+        if (CreateInfo.ThreadArenaVertexCount != 0)
+        {
+            ThreadArenaAllocationsManager::CreateInfo ArenasCI;
+            ArenasCI.ChunkSize              = CreateInfo.ThreadArenaVertexCount;
+            ArenasCI.NumArenas              = CreateInfo.NumThreadArenas;
+            ArenasCI.DisableDebugValidation = CreateInfo.DisableDebugValidation;
+            ArenasCI.ReserveChunk           = [this](size_t NumVertices, size_t /*Alignment*/) {
+                return AllocateRegion(StaticCast<Uint32>(NumVertices));
+            };
+            ArenasCI.ReleaseChunk = [this](VariableSizeAllocationsManager::Allocation&& ChunkRegion) {
+                FreeRegion(std::move(ChunkRegion));
+            };
+            m_pArenas = std::make_unique<ThreadArenaAllocationsManager>(ArenasCI);
+
+            // Every arena uses its own object pool, so that threads do not contend for it
+            m_ArenaObjAllocators.reserve(m_pArenas->GetNumArenas());
+            for (Uint32 i = 0; i < m_pArenas->GetNumArenas(); ++i)
+            {
+                m_ArenaObjAllocators.emplace_back(
+                    std::make_unique<FixedBlockMemoryAllocator>(
+                        DefaultRawMemoryAllocator::GetAllocator(),
+                        sizeof(VertexPoolAllocationImpl),
+                        4096u / Uint32{sizeof(VertexPoolAllocationImpl)} // Use 4 Kb pages.
+                        ));
+            }
+        }
     }
 
     ~VertexPoolImpl()
@@ -268,51 +316,34 @@ public:
 
         DEV_CHECK_ERR(*ppAllocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Region;
+        if (m_pArenas && m_pArenas->IsArenaAllocation(NumVertices, 1))
         {
-            std::lock_guard<std::mutex> Lock{m_MgrMtx};
-
+            ThreadArenaAllocationsManager::Allocation ArenaRegion = m_pArenas->Allocate(NumVertices, 1);
+            if (ArenaRegion.IsValid())
             {
-                Uint64 ActualCapacity = ~Uint64{0};
-                for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
-                {
-                    const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
-                    ActualCapacity            = std::min(ActualCapacity, BufferCapacity);
-                }
-
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const auto MgrSize = m_Mgr.GetMaxSize();
-                if (ActualCapacity > MgrSize)
-                {
-                    m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
-                    m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
-                }
+                const Uint32 ArenaIdx    = ArenaRegion.GetArenaIndex();
+                const Uint32 StartVertex = static_cast<Uint32>(ArenaRegion.GetUnalignedOffset());
+                // clang-format off
+                VertexPoolAllocationImpl* pSuballocation{
+                    NEW_RC_OBJ(*m_ArenaObjAllocators[ArenaIdx], "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
+                    (
+                        this,
+                        StartVertex,
+                        NumVertices,
+                        std::move(ArenaRegion)
+                    )
+                };
+                // clang-format on
+
+                pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
+                m_AllocationCount.fetch_add(1);
+                return;
             }
-
-            Region = m_Mgr.Allocate(NumVertices, 1);
-
-            while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
-            {
-                size_t ExtraSize = m_ExtraVertexCount != 0 ?
-                    std::max(m_ExtraVertexCount, NumVertices) :
-                    m_Mgr.GetMaxSize();
-
-                if (m_MaxVertexCount != 0)
-                    ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
-
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
-                m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
-
-                Region = m_Mgr.Allocate(NumVertices, 1);
-            }
-
-            UpdateUsageStats();
+            // The pool may still have enough space for the allocation itself
+            // even if it could not fit the whole arena range.
         }
 
+        VariableSizeAllocationsManager::Allocation Region = AllocateRegion(NumVertices);
         if (Region.IsValid())
         {
             // clang-format off
@@ -334,10 +365,15 @@ public:
 
     void Free(VariableSizeAllocationsManager::Allocation&& Region)
     {
-        std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Region));
+        FreeRegion(std::move(Region));
+        m_AllocationCount.fetch_add(-1);
+    }
+
+    void Free(ThreadArenaAllocationsManager::Allocation&& ArenaRegion)
+    {
+        VERIFY_EXPR(m_pArenas);
+        m_pArenas->Free(std::move(ArenaRegion));
         m_AllocationCount.fetch_add(-1);
-        UpdateUsageStats();
     }
 
     virtual Uint32 GetVersion() const override final
@@ -359,6 +395,18 @@ public:
         UsageStats.TotalVertexCount     = m_TotalVertexCount.load();
         UsageStats.AllocatedVertexCount = m_AllocatedVertexCount.load();
         UsageStats.CommittedMemorySize  = m_CommittedMemorySize.load();
+        UsageStats.ArenaFreeVertexCount = 0;
+
+        if (m_pArenas)
+        {
+            // Arena ranges are counted as allocated by the pool allocations manager.
+            // Note that the values may be slightly out of sync as they are not read atomically.
+            const Uint64 ArenaReservedCount = m_pArenas->GetReservedSize();
+            const Uint64 ArenaUsedCount     = std::min(Uint64{m_pArenas->GetUsedSize()}, ArenaReservedCount);
+
+            UsageStats.AllocatedVertexCount = UsageStats.AllocatedVertexCount - std::min(UsageStats.AllocatedVertexCount, ArenaReservedCount) + ArenaUsedCount;
+            UsageStats.ArenaFreeVertexCount = ArenaReservedCount - ArenaUsedCount;
+        }
 
         Uint64 VertexSize = 0;
         for (size_t Elem = 0; Elem < m_Desc.NumElements; ++Elem)
@@ -369,6 +417,60 @@ public:
     }
 
 private:
+    VariableSizeAllocationsManager::Allocation AllocateRegion(Uint32 NumVertices)
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        {
+            Uint64 ActualCapacity = ~Uint64{0};
+            for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+            {
+                const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
+                ActualCapacity            = std::min(ActualCapacity, BufferCapacity);
+            }
+
+            // After the resize, the actual buffer size may be larger due to alignment
+            // requirements (for sparse buffers, the size is aligned by the memory page size).
+            const auto MgrSize = m_Mgr.GetMaxSize();
+            if (ActualCapacity > MgrSize)
+            {
+                m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
+                VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
+                m_MgrSize.store(m_Mgr.GetMaxSize());
+                m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
+            }
+        }
+
+        VariableSizeAllocationsManager::Allocation Region = m_Mgr.Allocate(NumVertices, 1);
+
+        while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
+        {
+            size_t ExtraSize = m_ExtraVertexCount != 0 ?
+                std::max(m_ExtraVertexCount, NumVertices) :
+                m_Mgr.GetMaxSize();
+
+            if (m_MaxVertexCount != 0)
+                ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
+
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+            m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+
+            Region = m_Mgr.Allocate(NumVertices, 1);
+        }
+
+        UpdateUsageStats();
+
+        return Region;
+    }
+
+    void FreeRegion(VariableSizeAllocationsManager::Allocation&& Region)
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        m_Mgr.Free(std::move(Region));
+        UpdateUsageStats();
+    }
+
     void UpdateUsageStats()
     {
         m_AllocatedVertexCount.store(m_Mgr.GetUsedSize());
@@ -406,12 +508,19 @@ private:
     std::atomic<Uint64> m_TotalVertexCount{0};
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
+
+    // Must be declared after m_Mgr so that it is destroyed first
+    std::unique_ptr<ThreadArenaAllocationsManager>          m_pArenas;
+    std::vector<std::unique_ptr<FixedBlockMemoryAllocator>> m_ArenaObjAllocators;
 };
 
 
 VertexPoolAllocationImpl::~VertexPoolAllocationImpl()
 {
-    m_pParentPool->Free(std::move(m_Region));
+    if (m_ArenaRegion.IsValid())
+        m_pParentPool->Free(std::move(m_ArenaRegion));
+    else
+        m_pParentPool->Free(std::move(m_Region));
 }
 
 IVertexPool* VertexPoolAllocationImpl::GetPool()
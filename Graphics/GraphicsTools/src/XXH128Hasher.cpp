@@ -36,30 +36,67 @@ namespace Diligent
 {
 
 XXH128State::XXH128State() :
-    m_State{XXH3_createState()}
+    m_Buffer{new Uint8[MaxBufferSize]}
 {
-    VERIFY_EXPR(m_State != nullptr);
-    XXH3_128bits_reset(m_State);
 }
 
 XXH128State::~XXH128State()
 {
-    XXH3_freeState(m_State);
+    if (m_State != nullptr)
+        XXH3_freeState(m_State);
 }
 
-void XXH128State::UpdateRaw(const void* pData, uint64_t Size) noexcept
+void XXH128State::FlushBuffer() noexcept
 {
-    VERIFY_EXPR(pData != nullptr);
-    VERIFY_EXPR(Size != 0);
-    XXH3_128bits_update(m_State, pData, StaticCast<size_t>(Size));
+    if (m_State == nullptr)
+    {
+        m_State = XXH3_createState();
+        VERIFY_EXPR(m_State != nullptr);
+        XXH3_128bits_reset(m_State);
+    }
+
+    if (m_BufferSize > 0)
+    {
+        XXH3_128bits_update(m_State, m_Buffer.get(), m_BufferSize);
+        m_BufferSize = 0;
+    }
+}
+
+void XXH128State::UpdateLarge(const void* pData, uint64_t Size) noexcept
+{
+    FlushBuffer();
+    if (Size >= MaxBufferSize)
+    {
+        XXH3_128bits_update(m_State, pData, StaticCast<size_t>(Size));
+    }
+    else
+    {
+        std::memcpy(m_Buffer.get(), pData, static_cast<size_t>(Size));
+        m_BufferSize = static_cast<size_t>(Size);
+    }
 }
 
 XXH128Hash XXH128State::Digest() noexcept
 {
-    XXH128_hash_t Hash = XXH3_128bits_digest(m_State);
+    // The streaming and the single-shot versions of XXH3 produce the same hash
+    if (m_State == nullptr)
+    {
+        const XXH128_hash_t Hash = XXH3_128bits(m_Buffer.get(), m_BufferSize);
+        return {Hash.low64, Hash.high64};
+    }
+
+    FlushBuffer();
+    const XXH128_hash_t Hash = XXH3_128bits_digest(m_State);
     return {Hash.low64, Hash.high64};
 }
 
+void XXH128State::Reset() noexcept
+{
+    m_BufferSize = 0;
+    if (m_State != nullptr)
+        XXH3_128bits_reset(m_State);
+}
+
 void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
 {
     ASSERT_SIZEOF64(ShaderCI, 152, "Did you add new members to ShaderCreateInfo? Please handle them here.");
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 #include "Shader.h"
 #include "DataBlob.h"
 
@@ -73,6 +74,76 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
                                       IDataBlob**             ppCompilerOutput);
 
+
+/// Cumulative time, in seconds, spent in each stage of the glslang compilation.
+struct CompileStageTimings
+{
+    double Preprocess = 0;
+    double Parse      = 0;
+    double Link       = 0;
+    double SpirvEmit  = 0;
+    double Optimize   = 0;
+};
+
+/// Compile session statistics.
+struct CompileSessionStats
+{
+    CompileStageTimings Timings;
+
+    Uint32 NumCompilations          = 0;
+    Uint32 NumFailedCompilations    = 0;
+    Uint32 NumIncludeCacheHits      = 0;
+    Uint32 NumIncludeCacheMisses    = 0;
+    Uint32 NumPreprocessCacheHits   = 0;
+    Uint32 NumPreprocessCacheMisses = 0;
+};
+
+class CompileSessionImpl;
+
+/// Compile session caches the contents of source and include files as well as
+/// preprocessed sources for every unique macro set, so that compiling many
+/// permutations of the same shader does not re-read the includes, and compiling
+/// the same permutation again (e.g. for another SPIR-V version) skips preprocessing.
+///
+/// \remarks   All methods are thread-safe. Every compilation uses its own glslang
+///             shader and program objects, so multiple threads may compile
+///             through the same session concurrently.
+///             The session keeps strong references to all shader source stream
+///             factories it has seen until ClearCache() is called.
+class CompileSession
+{
+public:
+    CompileSession();
+    ~CompileSession();
+
+    // clang-format off
+    CompileSession           (const CompileSession&)  = delete;
+    CompileSession           (      CompileSession&&) = delete;
+    CompileSession& operator=(const CompileSession&)  = delete;
+    CompileSession& operator=(      CompileSession&&) = delete;
+    // clang-format on
+
+    /// Same as GLSLangUtils::HLSLtoSPIRV, but uses the session caches.
+    std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
+                                          SpirvVersion            Version,
+                                          const char*             ExtraDefinitions,
+                                          IDataBlob**             ppCompilerOutput);
+
+    /// Same as GLSLangUtils::GLSLtoSPIRV, but uses the session caches.
+    std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs);
+
+    /// Returns the statistics accumulated since the session was created or since the last call to ResetStats().
+    CompileSessionStats GetStats() const;
+
+    void ResetStats();
+
+    /// Releases all cached sources and preprocessed permutations.
+    void ClearCache();
+
+private:
+    std::unique_ptr<CompileSessionImpl> m_pImpl;
+};
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 #include <unordered_map>
 #include <memory>
 #include <array>
+#include <mutex>
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
 #    include <MoltenGLSLToSPIRVConverter/GLSLToSPIRVConverter.h>
@@ -47,6 +48,8 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "HashUtils.hpp"
+#include "Timer.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
 #endif
@@ -261,21 +264,26 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
                                                 size_t                        SourceCodeLen,
                                                 bool                          AssignBindings,
                                                 ::EProfile                    shProfile,
-                                                IDataBlob**                   ppCompilerOutput)
+                                                IDataBlob**                   ppCompilerOutput,
+                                                CompileStageTimings&          Timings)
 {
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
     TBuiltInResource Resources = InitResources();
 
+    Timer StageTimer;
+
     auto ParseResult = pIncluder != nullptr ?
         Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
         Shader.parse(&Resources, 100, shProfile, false, false, messages);
+    Timings.Parse += StageTimer.GetElapsedTime();
     if (!ParseResult)
     {
         LogCompilerError("Failed to parse shader source: \n", Shader.getInfoLog(), Shader.getInfoDebugLog(), ShaderSource, SourceCodeLen, ppCompilerOutput);
         return {};
     }
 
+    StageTimer.Restart();
     ::glslang::TProgram Program;
     Program.addShader(&Shader);
     if (!Program.link(messages))
@@ -287,72 +295,16 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
     // This step is essential to set bindings and descriptor sets
     if (AssignBindings)
         Program.mapIO();
+    Timings.Link += StageTimer.GetElapsedTime();
 
+    StageTimer.Restart();
     std::vector<unsigned int> spirv;
     ::glslang::GlslangToSpv(*Program.getIntermediate(Shader.getStage()), spirv);
+    Timings.SpirvEmit += StageTimer.GetElapsedTime();
 
     return spirv;
 }
 
-
-class IncluderImpl : public ::glslang::TShader::Includer
-{
-public:
-    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory) :
-        m_pInputStreamFactory(pInputStreamFactory)
-    {}
-
-    // For the "system" or <>-style includes; search the "system" paths.
-    virtual IncludeResult* includeSystem(const char* headerName,
-                                         const char* /*includerName*/,
-                                         size_t /*inclusionDepth*/)
-    {
-        DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
-        if (pSourceStream == nullptr)
-        {
-            LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
-            return nullptr;
-        }
-
-        auto pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
-        auto* pNewInclude =
-            new IncludeResult{
-                headerName,
-                pFileData->GetConstDataPtr<char>(),
-                pFileData->GetSize(),
-                nullptr};
-
-        m_IncludeRes.emplace(pNewInclude);
-        m_DataBlobs.emplace(pNewInclude, std::move(pFileData));
-        return pNewInclude;
-    }
-
-    // For the "local"-only aspect of a "" include. Should not search in the
-    // "system" paths, because on returning a failure, the parser will
-    // call includeSystem() to look in the "system" locations.
-    virtual IncludeResult* includeLocal(const char* headerName,
-                                        const char* includerName,
-                                        size_t      inclusionDepth)
-    {
-        return nullptr;
-    }
-
-    // Signals that the parser will no longer use the contents of the
-    // specified IncludeResult.
-    virtual void releaseInclude(IncludeResult* IncldRes)
-    {
-        m_DataBlobs.erase(IncldRes);
-    }
-
-private:
-    IShaderSourceInputStreamFactory* const                       m_pInputStreamFactory;
-    std::unordered_set<std::unique_ptr<IncludeResult>>           m_IncludeRes;
-    std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
-};
-
 void SetupWithSpirvVersion(::glslang::TShader&  Shader,
                            ::EProfile&          shProfile,
                            EShLanguage          ShLang,
@@ -403,6 +355,317 @@ void SetupWithSpirvVersion(::glslang::TShader&  Shader,
     }
 }
 
+struct CompileAttribs
+{
+    EShLanguage          ShLang   = EShLangCount;
+    ::glslang::EShSource ShSource = ::glslang::EShSourceGlsl;
+    SpirvVersion         Version  = SpirvVersion::Vk100;
+    EShMessages          Messages = EShMsgDefault;
+
+    // HLSL only
+    const char* EntryPoint = nullptr;
+
+    const char* Source       = nullptr;
+    size_t      SourceLength = 0;
+    const char* SourceName   = nullptr;
+    std::string Preamble;
+
+    IShaderSourceInputStreamFactory* pShaderSourceStreamFactory = nullptr;
+
+    bool        AssignBindings   = true;
+    IDataBlob** ppCompilerOutput = nullptr;
+};
+
+void SetupShader(::glslang::TShader& Shader, ::EProfile& shProfile, const CompileAttribs& Attribs)
+{
+    SetupWithSpirvVersion(Shader, shProfile, Attribs.ShLang, Attribs.Version, Attribs.ShSource);
+
+    if (Attribs.ShSource == ::glslang::EShSourceHlsl)
+    {
+        Shader.setHlslIoMapping(true);
+        Shader.setEntryPoint(Attribs.EntryPoint);
+        Shader.setEnvTargetHlslFunctionality1();
+
+        // By default, PSInput.SV_Position.w == 1 / VSOutput.SV_Position.w.
+        // Make the behavior consistent with DX:
+        Shader.setDxPositionW(true);
+    }
+}
+
+void SetShaderSource(::glslang::TShader& Shader, const char* Source, size_t SourceLength, const char* SourceName)
+{
+    const char* ShaderStrings[]       = {Source};
+    const int   ShaderStringLengths[] = {static_cast<int>(SourceLength)};
+    if (SourceName != nullptr)
+    {
+        const char* Names[] = {SourceName};
+        Shader.setStringsWithLengthsAndNames(ShaderStrings, ShaderStringLengths, Names, 1);
+    }
+    else
+    {
+        Shader.setStringsWithLengths(ShaderStrings, ShaderStringLengths, 1);
+    }
+}
+
+} // namespace
+
+class CompileSessionImpl
+{
+public:
+    RefCntAutoPtr<IDataBlob> ReadFile(IShaderSourceInputStreamFactory* pFactory, const char* Name, CompileSessionStats& Stats)
+    {
+        FileKey Key{RefCntAutoPtr<IShaderSourceInputStreamFactory>{pFactory}, Name};
+        {
+            std::lock_guard<std::mutex> Guard{m_FileCacheMtx};
+
+            auto it = m_FileCache.find(Key);
+            if (it != m_FileCache.end())
+            {
+                ++Stats.NumIncludeCacheHits;
+                return it->second;
+            }
+        }
+
+        ++Stats.NumIncludeCacheMisses;
+
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        pFactory->CreateInputStream(Name, &pSourceStream);
+        if (pSourceStream == nullptr)
+            return {};
+
+        RefCntAutoPtr<IDataBlob> pFileData{DataBlobImpl::Create()};
+        pSourceStream->ReadBlob(pFileData);
+
+        std::lock_guard<std::mutex> Guard{m_FileCacheMtx};
+        // Another thread may have loaded the same file in the meantime, so use the one in the cache.
+        return m_FileCache.emplace(std::move(Key), std::move(pFileData)).first->second;
+    }
+
+    ShaderSourceFileData ReadShaderSource(const ShaderCreateInfo& ShaderCI, CompileSessionStats& Stats) noexcept(false)
+    {
+        if (ShaderCI.Source == nullptr && ShaderCI.FilePath != nullptr && ShaderCI.pShaderSourceStreamFactory != nullptr)
+        {
+            if (RefCntAutoPtr<IDataBlob> pFileData = ReadFile(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, Stats))
+            {
+                ShaderSourceFileData SourceData;
+                SourceData.Source       = pFileData->GetConstDataPtr<char>();
+                SourceData.SourceLength = StaticCast<Uint32>(pFileData->GetSize());
+                SourceData.pFileData    = std::move(pFileData);
+                return SourceData;
+            }
+        }
+
+        // Let ReadShaderSourceFile handle all other cases and report errors
+        return ReadShaderSourceFile(ShaderCI);
+    }
+
+    std::shared_ptr<const std::string> Preprocess(const CompileAttribs& Attribs, CompileSessionStats& Stats);
+
+    void AddStats(const CompileSessionStats& Delta)
+    {
+        std::lock_guard<std::mutex> Guard{m_StatsMtx};
+
+        m_Stats.Timings.Preprocess += Delta.Timings.Preprocess;
+        m_Stats.Timings.Parse += Delta.Timings.Parse;
+        m_Stats.Timings.Link += Delta.Timings.Link;
+        m_Stats.Timings.SpirvEmit += Delta.Timings.SpirvEmit;
+        m_Stats.Timings.Optimize += Delta.Timings.Optimize;
+
+        m_Stats.NumCompilations += Delta.NumCompilations;
+        m_Stats.NumFailedCompilations += Delta.NumFailedCompilations;
+        m_Stats.NumIncludeCacheHits += Delta.NumIncludeCacheHits;
+        m_Stats.NumIncludeCacheMisses += Delta.NumIncludeCacheMisses;
+        m_Stats.NumPreprocessCacheHits += Delta.NumPreprocessCacheHits;
+        m_Stats.NumPreprocessCacheMisses += Delta.NumPreprocessCacheMisses;
+    }
+
+    CompileSessionStats GetStats() const
+    {
+        std::lock_guard<std::mutex> Guard{m_StatsMtx};
+        return m_Stats;
+    }
+
+    void ResetStats()
+    {
+        std::lock_guard<std::mutex> Guard{m_StatsMtx};
+        m_Stats = {};
+    }
+
+    void ClearCache()
+    {
+        {
+            std::lock_guard<std::mutex> Guard{m_FileCacheMtx};
+            m_FileCache.clear();
+        }
+        {
+            std::lock_guard<std::mutex> Guard{m_PreprocessCacheMtx};
+            m_PreprocessCache.clear();
+        }
+    }
+
+private:
+    struct FileKey
+    {
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+        std::string                                    Name;
+
+        bool operator==(const FileKey& Other) const
+        {
+            return pFactory == Other.pFactory && Name == Other.Name;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const FileKey& Key) const
+            {
+                return ComputeHash(Key.pFactory.RawPtr(), Key.Name);
+            }
+        };
+    };
+
+    // Preprocessed source only depends on the source text, the preamble (that contains all macros),
+    // the include files and the target environment.
+    struct PreprocessKey
+    {
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+
+        // The full source text is stored so that sources with colliding hashes
+        // never share the preprocessed output.
+        std::string          Source;
+        std::string          Preamble;
+        EShLanguage          ShLang   = EShLangCount;
+        ::glslang::EShSource ShSource = ::glslang::EShSourceGlsl;
+        SpirvVersion         Version  = SpirvVersion::Vk100;
+        EShMessages          Messages = EShMsgDefault;
+
+        size_t Hash = 0;
+
+        explicit PreprocessKey(const CompileAttribs& Attribs) :
+            pFactory{Attribs.pShaderSourceStreamFactory},
+            Source{Attribs.Source, Attribs.SourceLength},
+            Preamble{Attribs.Preamble},
+            ShLang{Attribs.ShLang},
+            ShSource{Attribs.ShSource},
+            Version{Attribs.Version},
+            Messages{Attribs.Messages},
+            Hash{ComputeHash(pFactory.RawPtr(), Source, Preamble, ShLang, ShSource, Version, Messages)}
+        {}
+
+        bool operator==(const PreprocessKey& Other) const
+        {
+            // clang-format off
+            return Hash         == Other.Hash         &&
+                   pFactory     == Other.pFactory     &&
+                   ShLang       == Other.ShLang       &&
+                   ShSource     == Other.ShSource     &&
+                   Version      == Other.Version      &&
+                   Messages     == Other.Messages     &&
+                   Source       == Other.Source       &&
+                   Preamble     == Other.Preamble;
+            // clang-format on
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const PreprocessKey& Key) const
+            {
+                return Key.Hash;
+            }
+        };
+    };
+
+    std::mutex                                                             m_FileCacheMtx;
+    std::unordered_map<FileKey, RefCntAutoPtr<IDataBlob>, FileKey::Hasher> m_FileCache;
+
+    std::mutex                                                                                   m_PreprocessCacheMtx;
+    std::unordered_map<PreprocessKey, std::shared_ptr<const std::string>, PreprocessKey::Hasher> m_PreprocessCache;
+
+    mutable std::mutex  m_StatsMtx;
+    CompileSessionStats m_Stats;
+};
+
+namespace
+{
+
+class IncluderImpl : public ::glslang::TShader::Includer
+{
+public:
+    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory,
+                 CompileSessionImpl*              pSession = nullptr,
+                 CompileSessionStats*             pStats   = nullptr) :
+        m_pInputStreamFactory{pInputStreamFactory},
+        m_pSession{pSession},
+        m_pStats{pStats}
+    {
+        VERIFY((m_pSession != nullptr) == (m_pStats != nullptr), "Session and stats must be provided together");
+    }
+
+    // For the "system" or <>-style includes; search the "system" paths.
+    virtual IncludeResult* includeSystem(const char* headerName,
+                                         const char* /*includerName*/,
+                                         size_t /*inclusionDepth*/)
+    {
+        DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
+        if (m_pInputStreamFactory == nullptr)
+            return nullptr;
+
+        RefCntAutoPtr<IDataBlob> pFileData;
+        if (m_pSession != nullptr)
+        {
+            pFileData = m_pSession->ReadFile(m_pInputStreamFactory, headerName, *m_pStats);
+        }
+        else
+        {
+            RefCntAutoPtr<IFileStream> pSourceStream;
+            m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
+            if (pSourceStream != nullptr)
+            {
+                pFileData = DataBlobImpl::Create();
+                pSourceStream->ReadBlob(pFileData);
+            }
+        }
+        if (pFileData == nullptr)
+        {
+            LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
+            return nullptr;
+        }
+        auto* pNewInclude =
+            new IncludeResult{
+                headerName,
+                pFileData->GetConstDataPtr<char>(),
+                pFileData->GetSize(),
+                nullptr};
+
+        m_IncludeRes.emplace(pNewInclude);
+        m_DataBlobs.emplace(pNewInclude, std::move(pFileData));
+        return pNewInclude;
+    }
+
+    // For the "local"-only aspect of a "" include. Should not search in the
+    // "system" paths, because on returning a failure, the parser will
+    // call includeSystem() to look in the "system" locations.
+    virtual IncludeResult* includeLocal(const char* headerName,
+                                        const char* includerName,
+                                        size_t      inclusionDepth)
+    {
+        return nullptr;
+    }
+
+    // Signals that the parser will no longer use the contents of the
+    // specified IncludeResult.
+    virtual void releaseInclude(IncludeResult* IncldRes)
+    {
+        m_DataBlobs.erase(IncldRes);
+    }
+
+private:
+    IShaderSourceInputStreamFactory* const                       m_pInputStreamFactory;
+    CompileSessionImpl* const                                    m_pSession;
+    CompileSessionStats* const                                   m_pStats;
+    std::unordered_set<std::unique_ptr<IncludeResult>>           m_IncludeRes;
+    std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
+};
+
 #ifdef USE_SPIRV_TOOLS
 spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 {
@@ -424,34 +687,65 @@ spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 }
 #endif
 
-} // namespace
-
-std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
-                                      SpirvVersion            Version,
-                                      const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+std::vector<unsigned int> CompileToSPIRV(const CompileAttribs& Attribs, CompileSessionImpl* pSession, CompileSessionStats& Stats)
 {
-    EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
-    ::glslang::TShader Shader{ShLang};
-    EShMessages        messages  = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
+    ::glslang::TShader Shader{Attribs.ShLang};
     ::EProfile         shProfile = EProfile::ENoProfile;
+    SetupShader(Shader, shProfile, Attribs);
+
+    if (pSession == nullptr)
+    {
+        Shader.setPreamble(Attribs.Preamble.c_str());
+        SetShaderSource(Shader, Attribs.Source, Attribs.SourceLength, Attribs.SourceName);
 
-    SetupWithSpirvVersion(Shader, shProfile, ShLang, Version, ::glslang::EShSourceHlsl);
+        IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
+        return CompileShaderInternal(Shader, Attribs.Messages, &Includer, Attribs.Source, Attribs.SourceLength, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput, Stats.Timings);
+    }
 
+    // The preprocessed source already contains the preamble and all includes.
+    std::shared_ptr<const std::string> pPreprocessedSource = pSession->Preprocess(Attribs, Stats);
+    if (!pPreprocessedSource)
+        return {};
+
+    SetShaderSource(Shader, pPreprocessedSource->c_str(), pPreprocessedSource->length(), Attribs.SourceName);
+    return CompileShaderInternal(Shader, Attribs.Messages, nullptr, Attribs.Source, Attribs.SourceLength, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput, Stats.Timings);
+}
+
+std::vector<unsigned int> HLSLtoSPIRVInternal(const ShaderCreateInfo& ShaderCI,
+                                              SpirvVersion            Version,
+                                              const char*             ExtraDefinitions,
+                                              IDataBlob**             ppCompilerOutput,
+                                              CompileSessionImpl*     pSession)
+{
     VERIFY_EXPR(ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL);
 
+    CompileAttribs Attribs;
+    Attribs.ShLang           = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
+    Attribs.ShSource         = ::glslang::EShSourceHlsl;
+    Attribs.Version          = Version;
+    Attribs.Messages         = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
+    Attribs.EntryPoint       = ShaderCI.EntryPoint;
+    Attribs.SourceName       = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+    Attribs.ppCompilerOutput = ppCompilerOutput;
+
+    Attribs.pShaderSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
+
+    const EShLanguage ShLang = Attribs.ShLang;
     VERIFY(ShLang != EShLangRayGen && ShLang != EShLangIntersect && ShLang != EShLangAnyHit && ShLang != EShLangClosestHit && ShLang != EShLangMiss && ShLang != EShLangCallable,
            "Ray tracing shaders are not supported, use DXCompiler to build SPIRV from HLSL");
     VERIFY(ShLang != EShLangTaskNV && ShLang != EShLangMeshNV,
            "Mesh shaders are not supported, use DXCompiler to build SPIRV from HLSL");
 
-    Shader.setHlslIoMapping(true);
-    Shader.setEntryPoint(ShaderCI.EntryPoint);
-    Shader.setEnvTargetHlslFunctionality1();
+    CompileSessionStats Stats;
+    Stats.NumCompilations = 1;
 
-    const auto SourceData = ReadShaderSourceFile(ShaderCI);
+    const auto SourceData = pSession != nullptr ?
+        pSession->ReadShaderSource(ShaderCI, Stats) :
+        ReadShaderSourceFile(ShaderCI);
+    Attribs.Source       = SourceData.Source;
+    Attribs.SourceLength = SourceData.SourceLength;
 
-    std::string Preamble;
+    std::string& Preamble = Attribs.Preamble;
     if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
         Preamble += "#pragma pack_matrix(row_major)\n\n";
     Preamble.append("#define GLSLANG\n\n");
@@ -467,86 +761,193 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
         AppendShaderMacros(Preamble, ShaderCI.Macros);
     }
 
-    Shader.setPreamble(Preamble.c_str());
-
-    const char* ShaderStrings[]       = {SourceData.Source};
-    const int   ShaderStringLengths[] = {static_cast<int>(SourceData.SourceLength)};
-    const char* Names[]               = {ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : ""};
-    Shader.setStringsWithLengthsAndNames(ShaderStrings, ShaderStringLengths, Names, 1);
-
-    // By default, PSInput.SV_Position.w == 1 / VSOutput.SV_Position.w.
-    // Make the behavior consistent with DX:
-    Shader.setDxPositionW(true);
-
-    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
-
-    auto SPIRV = CompileShaderInternal(Shader, messages, &Includer, SourceData.Source, SourceData.SourceLength, true, shProfile, ppCompilerOutput);
-    if (SPIRV.empty())
-        return SPIRV;
+    auto SPIRV = CompileToSPIRV(Attribs, pSession, Stats);
 
 #ifdef USE_SPIRV_TOOLS
-    // SPIR-V bytecode generated from HLSL must be legalized to
-    // turn it into a valid vulkan SPIR-V shader.
-    auto LegalizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
-    if (!LegalizedSPIRV.empty())
+    if (!SPIRV.empty())
     {
-        return LegalizedSPIRV;
+        // SPIR-V bytecode generated from HLSL must be legalized to
+        // turn it into a valid vulkan SPIR-V shader.
+        Timer OptimizeTimer;
+        auto  LegalizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+        Stats.Timings.Optimize += OptimizeTimer.GetElapsedTime();
+        if (!LegalizedSPIRV.empty())
+        {
+            SPIRV = std::move(LegalizedSPIRV);
+        }
+        else
+        {
+            LOG_ERROR("Failed to legalize SPIR-V shader generated by HLSL front-end. This may result in undefined behavior.");
+        }
     }
-    else
+#endif
+
+    if (pSession != nullptr)
     {
-        LOG_ERROR("Failed to legalize SPIR-V shader generated by HLSL front-end. This may result in undefined behavior.");
+        if (SPIRV.empty())
+            ++Stats.NumFailedCompilations;
+        pSession->AddStats(Stats);
     }
-#endif
+
     return SPIRV;
 }
 
-std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+std::vector<unsigned int> GLSLtoSPIRVInternal(const GLSLtoSPIRVAttribs& GLSLAttribs, CompileSessionImpl* pSession)
 {
-    VERIFY_EXPR(Attribs.ShaderSource != nullptr && Attribs.SourceCodeLen > 0);
-
-    const EShLanguage  ShLang = ShaderTypeToShLanguage(Attribs.ShaderType);
-    ::glslang::TShader Shader(ShLang);
-    ::EProfile         shProfile = EProfile::ENoProfile;
+    VERIFY_EXPR(GLSLAttribs.ShaderSource != nullptr && GLSLAttribs.SourceCodeLen > 0);
 
-    SetupWithSpirvVersion(Shader, shProfile, ShLang, Attribs.Version, ::glslang::EShSourceGlsl);
+    CompileAttribs Attribs;
+    Attribs.ShLang   = ShaderTypeToShLanguage(GLSLAttribs.ShaderType);
+    Attribs.ShSource = ::glslang::EShSourceGlsl;
+    Attribs.Version  = GLSLAttribs.Version;
 
-    EShMessages messages = EShMsgSpvRules;
+    Attribs.Messages = EShMsgSpvRules;
     static_assert(static_cast<int>(SpirvVersion::Count) == 6, "Did you add a new member to SpirvVersion? You may need to handle it here.");
-    if (Attribs.Version != SpirvVersion::GL && Attribs.Version != SpirvVersion::GLES)
-        messages = static_cast<EShMessages>(messages | EShMsgVulkanRules);
+    if (GLSLAttribs.Version != SpirvVersion::GL && GLSLAttribs.Version != SpirvVersion::GLES)
+        Attribs.Messages = static_cast<EShMessages>(Attribs.Messages | EShMsgVulkanRules);
 
-    const char* ShaderStrings[] = {Attribs.ShaderSource};
-    int         Lengths[]       = {Attribs.SourceCodeLen};
-    Shader.setStringsWithLengths(ShaderStrings, Lengths, 1);
+    Attribs.Source           = GLSLAttribs.ShaderSource;
+    Attribs.SourceLength     = static_cast<size_t>(GLSLAttribs.SourceCodeLen);
+    Attribs.AssignBindings   = GLSLAttribs.AssignBindings;
+    Attribs.ppCompilerOutput = GLSLAttribs.ppCompilerOutput;
 
-    std::string Preamble;
-    if (Attribs.UseRowMajorMatrices)
+    Attribs.pShaderSourceStreamFactory = GLSLAttribs.pShaderSourceStreamFactory;
+
+    std::string& Preamble = Attribs.Preamble;
+    if (GLSLAttribs.UseRowMajorMatrices)
         Preamble += "layout(row_major) uniform;\n\n";
     Preamble.append("#define GLSLANG\n\n");
-    if (Attribs.Macros)
-        AppendShaderMacros(Preamble, Attribs.Macros);
-    Shader.setPreamble(Preamble.c_str());
+    if (GLSLAttribs.Macros)
+        AppendShaderMacros(Preamble, GLSLAttribs.Macros);
 
-    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
+    CompileSessionStats Stats;
+    Stats.NumCompilations = 1;
 
-    auto SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput);
-    if (SPIRV.empty())
-        return SPIRV;
+    auto SPIRV = CompileToSPIRV(Attribs, pSession, Stats);
 
 #ifdef USE_SPIRV_TOOLS
-    auto OptimizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Attribs.Version), SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
-    if (!OptimizedSPIRV.empty())
+    if (!SPIRV.empty())
     {
-        return OptimizedSPIRV;
+        Timer OptimizeTimer;
+        auto  OptimizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(GLSLAttribs.Version), SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+        Stats.Timings.Optimize += OptimizeTimer.GetElapsedTime();
+        if (!OptimizedSPIRV.empty())
+        {
+            SPIRV = std::move(OptimizedSPIRV);
+        }
+        else
+        {
+            LOG_ERROR("Failed to optimize SPIR-V.");
+        }
     }
-    else
+#endif
+
+    if (pSession != nullptr)
     {
-        LOG_ERROR("Failed to optimize SPIR-V.");
+        if (SPIRV.empty())
+            ++Stats.NumFailedCompilations;
+        pSession->AddStats(Stats);
     }
-#endif
+
     return SPIRV;
 }
 
+} // namespace
+
+
+std::shared_ptr<const std::string> CompileSessionImpl::Preprocess(const CompileAttribs& Attribs, CompileSessionStats& Stats)
+{
+    PreprocessKey Key{Attribs};
+    {
+        std::lock_guard<std::mutex> Guard{m_PreprocessCacheMtx};
+
+        auto it = m_PreprocessCache.find(Key);
+        if (it != m_PreprocessCache.end())
+        {
+            ++Stats.NumPreprocessCacheHits;
+            return it->second;
+        }
+    }
+
+    ++Stats.NumPreprocessCacheMisses;
+
+    Timer PreprocessTimer;
+
+    ::glslang::TShader Shader{Attribs.ShLang};
+    ::EProfile         shProfile = EProfile::ENoProfile;
+    SetupShader(Shader, shProfile, Attribs);
+    Shader.setPreamble(Attribs.Preamble.c_str());
+    SetShaderSource(Shader, Attribs.Source, Attribs.SourceLength, Attribs.SourceName);
+
+    IncluderImpl     Includer{Attribs.pShaderSourceStreamFactory, this, &Stats};
+    TBuiltInResource Resources = InitResources();
+
+    std::string PreprocessedSource;
+    const bool  Result = Shader.preprocess(&Resources, 100, shProfile, false, false, Attribs.Messages, &PreprocessedSource, Includer);
+    Stats.Timings.Preprocess += PreprocessTimer.GetElapsedTime();
+    if (!Result)
+    {
+        LogCompilerError("Failed to preprocess shader source: \n", Shader.getInfoLog(), Shader.getInfoDebugLog(), Attribs.Source, Attribs.SourceLength, Attribs.ppCompilerOutput);
+        return {};
+    }
+
+    std::lock_guard<std::mutex> Guard{m_PreprocessCacheMtx};
+    // If another thread has preprocessed the same permutation in the meantime, the existing entry is returned.
+    return m_PreprocessCache.emplace(std::move(Key), std::make_shared<const std::string>(std::move(PreprocessedSource))).first->second;
+}
+
+
+std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
+                                      SpirvVersion            Version,
+                                      const char*             ExtraDefinitions,
+                                      IDataBlob**             ppCompilerOutput)
+{
+    return HLSLtoSPIRVInternal(ShaderCI, Version, ExtraDefinitions, ppCompilerOutput, nullptr);
+}
+
+std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+{
+    return GLSLtoSPIRVInternal(Attribs, nullptr);
+}
+
+
+CompileSession::CompileSession() :
+    m_pImpl{std::make_unique<CompileSessionImpl>()}
+{
+}
+
+CompileSession::~CompileSession()
+{
+}
+
+std::vector<unsigned int> CompileSession::HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
+                                                      SpirvVersion            Version,
+                                                      const char*             ExtraDefinitions,
+                                                      IDataBlob**             ppCompilerOutput)
+{
+    return HLSLtoSPIRVInternal(ShaderCI, Version, ExtraDefinitions, ppCompilerOutput, m_pImpl.get());
+}
+
+std::vector<unsigned int> CompileSession::GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+{
+    return GLSLtoSPIRVInternal(Attribs, m_pImpl.get());
+}
+
+CompileSessionStats CompileSession::GetStats() const
+{
+    return m_pImpl->GetStats();
+}
+
+void CompileSession::ResetStats()
+{
+    m_pImpl->ResetStats();
+}
+
+void CompileSession::ClearCache()
+{
+    m_pImpl->ClearCache();
+}
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
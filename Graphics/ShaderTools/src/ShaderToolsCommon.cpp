@@ -32,6 +32,7 @@
 #include "BasicFileSystem.hpp"
 #include "DebugUtilities.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
@@ -242,9 +243,18 @@ ShaderSourceFileData ReadShaderSourceFile(const char*                      Sourc
                 if (pSourceStream == nullptr)
                     LOG_ERROR_AND_THROW("Failed to load shader source file '", FilePath, '\'');
 
-                SourceData.pFileData = DataBlobImpl::Create();
-                pSourceStream->ReadBlob(SourceData.pFileData);
-                SourceData.Source       = SourceData.pFileData->GetConstDataPtr<char>();
+                if (RefCntAutoPtr<MappedFileStream> pMappedStream{pSourceStream, MappedFileStream::IID_InternalImpl})
+                {
+                    // Reference the mapped file contents directly instead of copying them
+                    pMappedStream->Advise(MappedFileAccessHint::Sequential);
+                    SourceData.pFileData = pMappedStream->GetDataBlob();
+                }
+                else
+                {
+                    SourceData.pFileData = DataBlobImpl::Create();
+                    pSourceStream->ReadBlob(SourceData.pFileData);
+                }
+                SourceData.Source       = SourceData.pFileData->GetSize() > 0 ? SourceData.pFileData->GetConstDataPtr<char>() : "";
                 SourceData.SourceLength = StaticCast<Uint32>(SourceData.pFileData->GetSize());
             }
             else
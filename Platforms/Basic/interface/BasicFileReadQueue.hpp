@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Result of FileReadQueue::Open()
+enum class EFileReadQueueOpenResult
+{
+    /// The file has been opened.
+    Success,
+
+    /// The file does not exist or can't be read.
+    Failed,
+
+    /// The process or the system has run out of file descriptors.
+    /// The file may be opened later, after other requests complete.
+    TooManyOpenFiles
+};
+
+/// Queue that keeps multiple whole-file reads in flight at the same time.
+
+/// The portable implementation does not support asynchronous reads: IsValid() always
+/// returns false, and the users are expected to fall back to synchronous file I/O.
+class BasicFileReadQueue
+{
+public:
+    explicit BasicFileReadQueue(Uint32 QueueDepth) {}
+
+    // clang-format off
+    BasicFileReadQueue           (const BasicFileReadQueue&)  = delete;
+    BasicFileReadQueue           (      BasicFileReadQueue&&) = delete;
+    BasicFileReadQueue& operator=(const BasicFileReadQueue&)  = delete;
+    BasicFileReadQueue& operator=(      BasicFileReadQueue&&) = delete;
+    // clang-format on
+
+    bool IsValid() const { return false; }
+
+    EFileReadQueueOpenResult Open(const Char* Path, Uint32& RequestId, size_t& Size) { return EFileReadQueueOpenResult::Failed; }
+
+    void Read(Uint32 RequestId, void* pDst) {}
+
+    bool WaitForCompletion(Uint32& RequestId, bool& Success) { return false; }
+};
+
+} // namespace Diligent
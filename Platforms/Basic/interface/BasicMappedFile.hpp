@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Memory access pattern hint for a mapped file
+enum class MappedFileAccessHint
+{
+    /// No special treatment
+    Normal,
+
+    /// The data will be accessed sequentially, so the pages can be read ahead
+    /// aggressively and released soon after they have been accessed
+    Sequential,
+
+    /// The data will be accessed in random order, so read-ahead is not useful
+    Random,
+
+    /// The data will be accessed soon
+    WillNeed
+};
+
+/// Read-only view of the entire file contents.
+
+/// This is the portable implementation that reads the file into memory.
+/// Platforms that support memory mapping provide their own implementation,
+/// see Diligent::MappedFile.
+class BasicMappedFile
+{
+public:
+    /// Whether the implementation maps the file into memory rather than reading it
+    static constexpr bool IsMemoryMapped = false;
+
+    explicit BasicMappedFile(const Char* Path);
+
+    // clang-format off
+    BasicMappedFile           (const BasicMappedFile&)  = delete;
+    BasicMappedFile           (      BasicMappedFile&&) = delete;
+    BasicMappedFile& operator=(const BasicMappedFile&)  = delete;
+    BasicMappedFile& operator=(      BasicMappedFile&&) = delete;
+    // clang-format on
+
+    bool IsValid() const { return m_IsValid; }
+
+    const void* GetData() const { return m_Data.data(); }
+    size_t      GetSize() const { return m_Data.size(); }
+
+    /// The portable implementation does not query the modification time and always returns zero.
+    Uint64 GetModificationTime() const { return 0; }
+
+    /// Gives a hint about how the data in the range [Offset, Offset + Size) will be accessed.
+    /// The portable implementation ignores the hint.
+    void Advise(MappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0}) const {}
+
+private:
+    std::vector<Uint8> m_Data;
+    bool               m_IsValid = false;
+};
+
+} // namespace Diligent
@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BasicMappedFile.hpp"
+
+#include <stdio.h>
+#include <errno.h>
+#include <cstring>
+
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+BasicMappedFile::BasicMappedFile(const Char* Path)
+{
+    VERIFY_EXPR(Path != nullptr);
+
+    FILE* pFile = fopen(Path, "rb");
+    if (pFile == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file ", Path, "\nThe following error occurred: ", strerror(errno));
+        return;
+    }
+
+    if (fseek(pFile, 0, SEEK_END) == 0)
+    {
+        const long Size = ftell(pFile);
+        if (Size >= 0 && fseek(pFile, 0, SEEK_SET) == 0)
+        {
+            m_Data.resize(static_cast<size_t>(Size));
+            m_IsValid = fread(m_Data.data(), 1, m_Data.size(), pFile) == m_Data.size();
+        }
+    }
+    fclose(pFile);
+
+    if (!m_IsValid)
+    {
+        LOG_ERROR_MESSAGE("Failed to read file ", Path);
+        m_Data.clear();
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <deque>
+
+#include "../../Basic/interface/BasicFileReadQueue.hpp"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace Diligent
+{
+
+/// Queue that keeps multiple whole-file reads in flight at the same time using io_uring.
+
+/// All reads queued with Read() are submitted to the kernel with a single system call, so
+/// the latency of the storage is paid once per batch rather than once per file. The queue
+/// is not thread-safe.
+///
+/// Typical usage:
+///
+///     LinuxFileReadQueue Queue{64};
+///     if (Queue.IsValid())
+///     {
+///         for (each file)
+///             if (Queue.Open(Path, RequestId, Size) == EFileReadQueueOpenResult::Success)
+///                 Queue.Read(RequestId, AllocateMemory(Size));
+///         while (Queue.WaitForCompletion(RequestId, Success))
+///             ProcessData(RequestId, Success);
+///     }
+///
+/// Every opened file holds a file descriptor until its request completes, so the users
+/// that read many files should limit the number of files that are open at the same time.
+class LinuxFileReadQueue
+{
+public:
+    /// Creates the io_uring instance that keeps up to QueueDepth reads in flight.
+    /// If io_uring or its read operation is not supported by the kernel, IsValid() returns false.
+    explicit LinuxFileReadQueue(Uint32 QueueDepth);
+    ~LinuxFileReadQueue();
+
+    // clang-format off
+    LinuxFileReadQueue           (const LinuxFileReadQueue&)  = delete;
+    LinuxFileReadQueue           (      LinuxFileReadQueue&&) = delete;
+    LinuxFileReadQueue& operator=(const LinuxFileReadQueue&)  = delete;
+    LinuxFileReadQueue& operator=(      LinuxFileReadQueue&&) = delete;
+    // clang-format on
+
+    bool IsValid() const { return m_RingFd >= 0; }
+
+    /// Opens the file for reading and returns its size.
+    EFileReadQueueOpenResult Open(const Char* Path, Uint32& RequestId, size_t& Size);
+
+    /// Queues reading the entire file opened by Open() into pDst.
+    /// The memory must be large enough to hold the file and must stay valid until the request completes.
+    void Read(Uint32 RequestId, void* pDst);
+
+    /// Submits the queued reads and waits until one of the requests completes.
+    /// The file of the completed request is closed.
+    /// Returns false if there are no outstanding requests.
+    ///
+    /// \remarks    If the ring becomes unusable, the function waits until the kernel is done with
+    ///             all reads it has accepted, and all outstanding requests complete with failure.
+    ///             The requests queued after that fail immediately.
+    bool WaitForCompletion(Uint32& RequestId, bool& Success);
+
+private:
+    Uint32        QueuePending();
+    bool          Enter(Uint32 ToSubmit, Uint32 MinComplete);
+    io_uring_cqe* PeekCompletion() const;
+    void          ProcessCompletion(const io_uring_cqe& CQE);
+    void          ResubmitRequest(Uint32 RequestId);
+    void          CompleteRequest(Uint32 RequestId, bool Success);
+    void          Abort();
+    void          Destroy();
+
+    struct RequestInfo
+    {
+        int    fd        = -1;
+        Uint8* pDst      = nullptr;
+        size_t Size      = 0;
+        size_t BytesRead = 0;
+    };
+    std::vector<RequestInfo> m_Requests;
+
+    // Requests whose next chunk has not been submitted yet
+    std::deque<Uint32> m_Pending;
+    // Requests that completed without going through the ring (e.g. empty files)
+    std::deque<std::pair<Uint32, bool>> m_Completed;
+
+    Uint32 m_NumInFlight = 0;
+
+    // The ring can't be used anymore (io_uring_enter failed)
+    bool m_Aborted = false;
+
+    int m_RingFd = -1;
+
+    void*  m_pSQRing    = nullptr;
+    size_t m_SQRingSize = 0;
+    void*  m_pCQRing    = nullptr;
+    size_t m_CQRingSize = 0;
+
+    io_uring_sqe* m_pSQEs     = nullptr;
+    size_t        m_SQEsSize  = 0;
+    Uint32        m_SQEntries = 0;
+
+    Uint32* m_pSQHead  = nullptr;
+    Uint32* m_pSQTail  = nullptr;
+    Uint32  m_SQMask   = 0;
+    Uint32* m_pSQArray = nullptr;
+
+    Uint32*       m_pCQHead = nullptr;
+    Uint32*       m_pCQTail = nullptr;
+    Uint32        m_CQMask  = 0;
+    io_uring_cqe* m_pCQEs   = nullptr;
+};
+
+} // namespace Diligent
@@ -0,0 +1,75 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include "../../Basic/interface/BasicMappedFile.hpp"
+
+namespace Diligent
+{
+
+/// Read-only memory mapping of the entire file.
+
+/// The file is mapped with mmap() and the pages are loaded on demand, so
+/// only the parts of the file that are actually accessed take physical memory.
+/// The mapping is private: the pages are never written back to the file.
+class LinuxMappedFile
+{
+public:
+    static constexpr bool IsMemoryMapped = true;
+
+    explicit LinuxMappedFile(const Char* Path);
+    ~LinuxMappedFile();
+
+    // clang-format off
+    LinuxMappedFile           (const LinuxMappedFile&)  = delete;
+    LinuxMappedFile           (      LinuxMappedFile&&) = delete;
+    LinuxMappedFile& operator=(const LinuxMappedFile&)  = delete;
+    LinuxMappedFile& operator=(      LinuxMappedFile&&) = delete;
+    // clang-format on
+
+    bool IsValid() const { return m_IsValid; }
+
+    /// Returns the pointer to the mapped data. For an empty file, returns null.
+    const void* GetData() const { return m_pData; }
+    size_t      GetSize() const { return m_Size; }
+
+    /// Returns the time of the last modification of the file, in nanoseconds since the epoch,
+    /// at the moment it was mapped.
+    Uint64 GetModificationTime() const { return m_ModificationTime; }
+
+    /// Passes the access pattern hint for the range [Offset, Offset + Size) to madvise().
+    void Advise(MappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0}) const;
+
+private:
+    void*  m_pData            = nullptr;
+    size_t m_Size             = 0;
+    Uint64 m_ModificationTime = 0;
+    bool   m_IsValid          = false;
+};
+
+} // namespace Diligent
@@ -0,0 +1,410 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../interface/LinuxFileReadQueue.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include <errno.h>
+#include <sched.h>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Maximum number of bytes read by a single request. Larger files are read in multiple chunks.
+constexpr size_t MaxReadChunkSize = size_t{1} << 30;
+
+bool IsReadOpSupported(int RingFd)
+{
+    // IORING_REGISTER_PROBE was added in the same kernel version (5.6) as IORING_OP_READ.
+    // On older kernels, the ring can be created, but the registration fails, and every
+    // read would complete with -EINVAL.
+    constexpr Uint32   NumOps = IORING_OP_READ + 1;
+    std::vector<Uint8> ProbeData(sizeof(io_uring_probe) + NumOps * sizeof(io_uring_probe_op));
+
+    io_uring_probe* pProbe = reinterpret_cast<io_uring_probe*>(ProbeData.data());
+    if (syscall(__NR_io_uring_register, RingFd, IORING_REGISTER_PROBE, pProbe, NumOps) < 0)
+        return false;
+
+    return pProbe->last_op >= IORING_OP_READ && (pProbe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+} // namespace
+
+LinuxFileReadQueue::LinuxFileReadQueue(Uint32 QueueDepth)
+{
+    io_uring_params Params{};
+
+    const int RingFd = static_cast<int>(syscall(__NR_io_uring_setup, std::max(QueueDepth, 1u), &Params));
+    if (RingFd < 0)
+    {
+        // io_uring may be unavailable (old kernel, seccomp filter, disabled by the administrator).
+        // This is not an error: the users fall back to synchronous I/O.
+        return;
+    }
+    m_RingFd = RingFd;
+
+    if (!IsReadOpSupported(RingFd))
+    {
+        Destroy();
+        return;
+    }
+
+    m_SQRingSize = Params.sq_off.array + Params.sq_entries * sizeof(Uint32);
+    m_CQRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+
+    const bool SingleMmap = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (SingleMmap)
+        m_SQRingSize = m_CQRingSize = std::max(m_SQRingSize, m_CQRingSize);
+
+    m_pSQRing = mmap(nullptr, m_SQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQ_RING);
+    if (m_pSQRing == MAP_FAILED)
+    {
+        m_pSQRing = nullptr;
+        LOG_ERROR_MESSAGE("Failed to map io_uring submission queue: ", strerror(errno));
+        Destroy();
+        return;
+    }
+
+    if (SingleMmap)
+    {
+        m_pCQRing = m_pSQRing;
+    }
+    else
+    {
+        m_pCQRing = mmap(nullptr, m_CQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_CQ_RING);
+        if (m_pCQRing == MAP_FAILED)
+        {
+            m_pCQRing = nullptr;
+            LOG_ERROR_MESSAGE("Failed to map io_uring completion queue: ", strerror(errno));
+            Destroy();
+            return;
+        }
+    }
+
+    m_SQEsSize = Params.sq_entries * sizeof(io_uring_sqe);
+
+    void* pSQEs = mmap(nullptr, m_SQEsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQES);
+    if (pSQEs == MAP_FAILED)
+    {
+        LOG_ERROR_MESSAGE("Failed to map io_uring submission queue entries: ", strerror(errno));
+        Destroy();
+        return;
+    }
+    m_pSQEs     = static_cast<io_uring_sqe*>(pSQEs);
+    m_SQEntries = Params.sq_entries;
+
+    auto* pSQ  = static_cast<Uint8*>(m_pSQRing);
+    m_pSQHead  = reinterpret_cast<Uint32*>(pSQ + Params.sq_off.head);
+    m_pSQTail  = reinterpret_cast<Uint32*>(pSQ + Params.sq_off.tail);
+    m_SQMask   = *reinterpret_cast<Uint32*>(pSQ + Params.sq_off.ring_mask);
+    m_pSQArray = reinterpret_cast<Uint32*>(pSQ + Params.sq_off.array);
+
+    auto* pCQ = static_cast<Uint8*>(m_pCQRing);
+    m_pCQHead = reinterpret_cast<Uint32*>(pCQ + Params.cq_off.head);
+    m_pCQTail = reinterpret_cast<Uint32*>(pCQ + Params.cq_off.tail);
+    m_CQMask  = *reinterpret_cast<Uint32*>(pCQ + Params.cq_off.ring_mask);
+    m_pCQEs   = reinterpret_cast<io_uring_cqe*>(pCQ + Params.cq_off.cqes);
+}
+
+LinuxFileReadQueue::~LinuxFileReadQueue()
+{
+    // The kernel may still be writing to the destination memory of the requests in flight
+    if (IsValid())
+        Abort();
+
+    for (auto& Request : m_Requests)
+    {
+        if (Request.fd >= 0)
+            close(Request.fd);
+    }
+
+    Destroy();
+}
+
+void LinuxFileReadQueue::Destroy()
+{
+    if (m_pSQEs != nullptr)
+        munmap(m_pSQEs, m_SQEsSize);
+    if (m_pCQRing != nullptr && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_CQRingSize);
+    if (m_pSQRing != nullptr)
+        munmap(m_pSQRing, m_SQRingSize);
+    if (m_RingFd >= 0)
+        close(m_RingFd);
+
+    m_pSQEs   = nullptr;
+    m_pCQRing = nullptr;
+    m_pSQRing = nullptr;
+    m_RingFd  = -1;
+}
+
+EFileReadQueueOpenResult LinuxFileReadQueue::Open(const Char* Path, Uint32& RequestId, size_t& Size)
+{
+    VERIFY_EXPR(Path != nullptr);
+    VERIFY(IsValid(), "The queue is not valid");
+
+    const int fd = open(Path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return (errno == EMFILE || errno == ENFILE) ?
+            EFileReadQueueOpenResult::TooManyOpenFiles :
+            EFileReadQueueOpenResult::Failed;
+    }
+
+    struct stat FileStat;
+    if (fstat(fd, &FileStat) != 0 || !S_ISREG(FileStat.st_mode))
+    {
+        close(fd);
+        return EFileReadQueueOpenResult::Failed;
+    }
+
+    RequestId = static_cast<Uint32>(m_Requests.size());
+    Size      = static_cast<size_t>(FileStat.st_size);
+
+    RequestInfo Request;
+    Request.fd   = fd;
+    Request.Size = Size;
+    m_Requests.emplace_back(Request);
+
+    return EFileReadQueueOpenResult::Success;
+}
+
+void LinuxFileReadQueue::Read(Uint32 RequestId, void* pDst)
+{
+    VERIFY_EXPR(RequestId < m_Requests.size());
+    auto& Request = m_Requests[RequestId];
+    VERIFY(Request.fd >= 0, "The file is not opened or has already been read");
+    VERIFY(pDst != nullptr || Request.Size == 0, "Destination memory must not be null");
+
+    Request.pDst = static_cast<Uint8*>(pDst);
+    if (Request.Size == 0)
+        CompleteRequest(RequestId, true);
+    else
+        ResubmitRequest(RequestId);
+}
+
+Uint32 LinuxFileReadQueue::QueuePending()
+{
+    // We are the only producer, so the tail can be read without synchronization
+    Uint32       Tail = *m_pSQTail;
+    const Uint32 Head = __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+
+    while (!m_Pending.empty() && m_NumInFlight < m_SQEntries && Tail - Head < m_SQEntries)
+    {
+        const Uint32 RequestId = m_Pending.front();
+        m_Pending.pop_front();
+
+        const auto&  Request = m_Requests[RequestId];
+        const Uint32 Index   = Tail & m_SQMask;
+
+        io_uring_sqe& SQE = m_pSQEs[Index];
+        memset(&SQE, 0, sizeof(SQE));
+        SQE.opcode    = IORING_OP_READ;
+        SQE.fd        = Request.fd;
+        SQE.addr      = reinterpret_cast<Uint64>(Request.pDst + Request.BytesRead);
+        SQE.len       = static_cast<Uint32>(std::min(Request.Size - Request.BytesRead, MaxReadChunkSize));
+        SQE.off       = Request.BytesRead;
+        SQE.user_data = RequestId;
+
+        m_pSQArray[Index] = Index;
+
+        ++Tail;
+        ++m_NumInFlight;
+    }
+    __atomic_store_n(m_pSQTail, Tail, __ATOMIC_RELEASE);
+
+    // Entries that have not been consumed by the kernel yet
+    return Tail - __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+}
+
+bool LinuxFileReadQueue::Enter(Uint32 ToSubmit, Uint32 MinComplete)
+{
+    const unsigned int Flags = MinComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (syscall(__NR_io_uring_enter, m_RingFd, ToSubmit, MinComplete, Flags, nullptr, 0) < 0)
+    {
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            LOG_ERROR_MESSAGE("io_uring_enter failed: ", strerror(errno));
+            return false;
+        }
+    }
+    return true;
+}
+
+io_uring_cqe* LinuxFileReadQueue::PeekCompletion() const
+{
+    const Uint32 Head = *m_pCQHead;
+    const Uint32 Tail = __atomic_load_n(m_pCQTail, __ATOMIC_ACQUIRE);
+    return Head != Tail ? &m_pCQEs[Head & m_CQMask] : nullptr;
+}
+
+void LinuxFileReadQueue::ProcessCompletion(const io_uring_cqe& CQE)
+{
+    VERIFY_EXPR(m_NumInFlight > 0);
+    --m_NumInFlight;
+
+    const Uint32 RequestId = static_cast<Uint32>(CQE.user_data);
+    VERIFY_EXPR(RequestId < m_Requests.size());
+    auto& Request = m_Requests[RequestId];
+
+    if (CQE.res < 0)
+    {
+        if (CQE.res == -EINTR || CQE.res == -EAGAIN)
+            ResubmitRequest(RequestId);
+        else
+            CompleteRequest(RequestId, false);
+    }
+    else if (CQE.res == 0)
+    {
+        // Unexpected end of file: the file was truncated after it had been opened
+        CompleteRequest(RequestId, false);
+    }
+    else
+    {
+        Request.BytesRead += static_cast<size_t>(CQE.res);
+        if (Request.BytesRead < Request.Size)
+            ResubmitRequest(RequestId); // Short read or a large file that is read in chunks
+        else
+            CompleteRequest(RequestId, true);
+    }
+}
+
+void LinuxFileReadQueue::ResubmitRequest(Uint32 RequestId)
+{
+    if (m_Aborted)
+        CompleteRequest(RequestId, false);
+    else
+        m_Pending.push_back(RequestId);
+}
+
+void LinuxFileReadQueue::CompleteRequest(Uint32 RequestId, bool Success)
+{
+    auto& Request = m_Requests[RequestId];
+    close(Request.fd);
+    Request.fd = -1;
+    m_Completed.emplace_back(RequestId, Success);
+}
+
+void LinuxFileReadQueue::Abort()
+{
+    m_Aborted = true;
+
+    // Without SQPOLL, the kernel only consumes submission entries inside io_uring_enter,
+    // so the entries it has not consumed yet can be safely taken back.
+    const Uint32 Head = __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+    const Uint32 Tail = *m_pSQTail;
+    for (Uint32 i = Head; i != Tail; ++i)
+    {
+        const io_uring_sqe& SQE = m_pSQEs[m_pSQArray[i & m_SQMask]];
+        VERIFY_EXPR(m_NumInFlight > 0);
+        --m_NumInFlight;
+        CompleteRequest(static_cast<Uint32>(SQE.user_data), false);
+    }
+    __atomic_store_n(m_pSQTail, Head, __ATOMIC_RELEASE);
+
+    while (!m_Pending.empty())
+    {
+        CompleteRequest(m_Pending.front(), false);
+        m_Pending.pop_front();
+    }
+
+    // The reads accepted by the kernel may still write to the destination memory, so we must
+    // wait until all of them complete. Completions are posted to the ring even if io_uring_enter
+    // can't be used to wait for them.
+    bool CanEnter = true;
+    while (m_NumInFlight > 0)
+    {
+        if (io_uring_cqe* pCQE = PeekCompletion())
+        {
+            ProcessCompletion(*pCQE);
+            __atomic_store_n(m_pCQHead, *m_pCQHead + 1, __ATOMIC_RELEASE);
+        }
+        else if (CanEnter)
+        {
+            CanEnter = Enter(0, 1);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+bool LinuxFileReadQueue::WaitForCompletion(Uint32& RequestId, bool& Success)
+{
+    VERIFY(IsValid(), "The queue is not valid");
+
+    while (m_Completed.empty())
+    {
+        const Uint32 ToSubmit = QueuePending();
+        if (m_NumInFlight == 0)
+        {
+            VERIFY_EXPR(m_Pending.empty());
+            return false;
+        }
+
+        io_uring_cqe* pCQE = PeekCompletion();
+        if (pCQE == nullptr || ToSubmit > 0)
+        {
+            if (!Enter(ToSubmit, pCQE == nullptr ? 1 : 0))
+            {
+                Abort();
+                break;
+            }
+        }
+
+        while ((pCQE = PeekCompletion()) != nullptr)
+        {
+            ProcessCompletion(*pCQE);
+            __atomic_store_n(m_pCQHead, *m_pCQHead + 1, __ATOMIC_RELEASE);
+        }
+    }
+
+    if (m_Completed.empty())
+        return false;
+
+    RequestId = m_Completed.front().first;
+    Success   = m_Completed.front().second;
+    m_Completed.pop_front();
+    return true;
+}
+
+} // namespace Diligent
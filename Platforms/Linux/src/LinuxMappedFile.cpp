@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../interface/LinuxMappedFile.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <cstring>
+
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+LinuxMappedFile::LinuxMappedFile(const Char* Path)
+{
+    VERIFY_EXPR(Path != nullptr);
+
+    const int fd = open(Path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file ", Path, "\nThe following error occurred: ", strerror(errno));
+        return;
+    }
+
+    struct stat FileStat;
+    if (fstat(fd, &FileStat) != 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to query the size of file ", Path, "\nThe following error occurred: ", strerror(errno));
+        close(fd);
+        return;
+    }
+
+    m_ModificationTime = static_cast<Uint64>(FileStat.st_mtim.tv_sec) * 1000000000ull + static_cast<Uint64>(FileStat.st_mtim.tv_nsec);
+    if (FileStat.st_size == 0)
+    {
+        // Zero-size mappings are not allowed
+        m_IsValid = true;
+    }
+    else
+    {
+        void* pData = mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (pData != MAP_FAILED)
+        {
+            m_pData   = pData;
+            m_Size    = static_cast<size_t>(FileStat.st_size);
+            m_IsValid = true;
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map file ", Path, "\nThe following error occurred: ", strerror(errno));
+        }
+    }
+
+    // The mapping remains valid after the file descriptor is closed
+    close(fd);
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    if (m_pData != nullptr)
+        munmap(m_pData, m_Size);
+}
+
+void LinuxMappedFile::Advise(MappedFileAccessHint Hint, size_t Offset, size_t Size) const
+{
+    if (m_pData == nullptr || Offset >= m_Size)
+        return;
+
+    // madvise() requires the address to be page-aligned
+    const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t Start    = Offset - Offset % PageSize;
+    const size_t End      = Size < m_Size - Offset ? Offset + Size : m_Size;
+
+    int Advice = MADV_NORMAL;
+    switch (Hint)
+    {
+        case MappedFileAccessHint::Normal: Advice = MADV_NORMAL; break;
+        case MappedFileAccessHint::Sequential: Advice = MADV_SEQUENTIAL; break;
+        case MappedFileAccessHint::Random: Advice = MADV_RANDOM; break;
+        case MappedFileAccessHint::WillNeed: Advice = MADV_WILLNEED; break;
+        default:
+            UNEXPECTED("Unexpected access hint");
+    }
+
+    if (madvise(static_cast<Uint8*>(m_pData) + Start, End - Start, Advice) != 0)
+        LOG_WARNING_MESSAGE("madvise failed: ", strerror(errno));
+}
+
+} // namespace Diligent
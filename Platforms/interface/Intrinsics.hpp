@@ -34,3 +34,13 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+// SSE2 is part of the x64 baseline
+#if DILIGENT_AVX2_SUPPORTED && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
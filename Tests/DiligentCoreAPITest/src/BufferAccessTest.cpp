@@ -25,9 +25,12 @@
  *  of the possibility of such damages.
  */
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -194,4 +197,87 @@ TEST(BufferAccessTest, CopyFromStaging)
     VerifyBufferData(pBuffer);
 }
 
+// Streams data to dynamic and default buffers over many frames to exercise
+// recycling of the upload memory and reports the achieved throughput.
+TEST(BufferAccessTest, UploadThroughput)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumBuffers = 8;
+    constexpr Uint32 NumFrames  = 64;
+    constexpr Uint32 BufferSize = 16 << 10;
+
+    static_assert(BufferSize % sizeof(TestBufferData) == 0, "Buffer size must be a multiple of the test data size");
+    std::vector<Uint8> RefData(BufferSize);
+    for (size_t Offset = 0; Offset < RefData.size(); Offset += sizeof(TestBufferData))
+        memcpy(&RefData[Offset], TestBufferData, sizeof(TestBufferData));
+
+    RefCntAutoPtr<IBuffer> pDynamicBuffers[NumBuffers];
+    RefCntAutoPtr<IBuffer> pDefaultBuffers[NumBuffers];
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Test dynamic buffer";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.Size           = BufferSize;
+        BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pDynamicBuffers[i]);
+        ASSERT_NE(pDynamicBuffers[i], nullptr) << "Buffer desc:\n"
+                                               << BuffDesc;
+
+        BuffDesc.Name           = "Test default buffer";
+        BuffDesc.Usage          = USAGE_DEFAULT;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_NONE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pDefaultBuffers[i]);
+        ASSERT_NE(pDefaultBuffers[i], nullptr) << "Buffer desc:\n"
+                                               << BuffDesc;
+    }
+
+    Timer        T;
+    const double StartTime = T.GetElapsedTime();
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        // Only the data written in the last frame is verified
+        const bool   IsLastFrame = frame + 1 == NumFrames;
+        const Uint8* pSrcData    = IsLastFrame ? RefData.data() : nullptr;
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+        {
+            void* pData = nullptr;
+            pContext->MapBuffer(pDynamicBuffers[i], MAP_WRITE, MAP_FLAG_DISCARD, pData);
+            ASSERT_NE(pData, nullptr);
+            if (pSrcData != nullptr)
+                memcpy(pData, pSrcData, BufferSize);
+            else
+                memset(pData, static_cast<int>(frame + i), BufferSize);
+            pContext->UnmapBuffer(pDynamicBuffers[i], MAP_WRITE);
+
+            pContext->UpdateBuffer(pDefaultBuffers[i], 0, BufferSize, RefData.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+
+        if (IsLastFrame)
+        {
+            // Dynamic buffer contents are only valid in the frame they were mapped in
+            for (Uint32 i = 0; i < NumBuffers; ++i)
+            {
+                VerifyBufferData(pDynamicBuffers[i]);
+                VerifyBufferData(pDefaultBuffers[i]);
+            }
+        }
+
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+    pContext->WaitForIdle();
+    const double ElapsedTime = T.GetElapsedTime() - StartTime;
+
+    const double TotalSizeMB = static_cast<double>(NumFrames) * NumBuffers * BufferSize * 2 / (1 << 20);
+    LOG_INFO_MESSAGE("Uploaded ", TotalSizeMB, " MB in ", NumFrames, " frames in ", ElapsedTime * 1000, " ms (",
+                     TotalSizeMB / std::max(ElapsedTime, 1e-6), " MB/s)");
+}
+
 } // namespace
@@ -39,6 +39,7 @@
 
 #if VULKAN_SUPPORTED
 #    include "Vulkan/CreateObjFromNativeResVK.hpp"
+#    include "RenderDeviceVk.h"
 #endif
 
 #if METAL_SUPPORTED
@@ -50,6 +51,7 @@
 #endif
 
 #include "GraphicsAccessories.hpp"
+#include "Timer.hpp"
 
 #include "GPUTestingEnvironment.hpp"
 
@@ -437,4 +439,135 @@ TEST_F(BufferCreationTest, CreateUnifiedBuffer)
     }
 }
 
+TEST_F(BufferCreationTest, CreateBuffers)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumBuffers = 10000;
+    constexpr Uint32 BufferSize = 4096;
+
+    std::vector<BufferDesc> Descs(NumBuffers);
+    for (BufferDesc& Desc : Descs)
+    {
+        Desc.Name      = "Batch test buffer";
+        Desc.Usage     = USAGE_DEFAULT;
+        Desc.Size      = BufferSize;
+        Desc.BindFlags = BIND_VERTEX_BUFFER | BIND_SHADER_RESOURCE;
+        Desc.Mode      = BUFFER_MODE_RAW;
+    }
+
+    const std::vector<Uint8> Data(BufferSize, 0xAB);
+    std::vector<BufferData>  InitData(NumBuffers);
+    for (Uint32 i = 0; i < NumBuffers; i += 2)
+    {
+        InitData[i].pData    = Data.data();
+        InitData[i].DataSize = BufferSize;
+    }
+
+    Timer T;
+
+    double SingleTime = 0;
+    {
+        std::vector<RefCntAutoPtr<IBuffer>> Buffers(NumBuffers);
+
+        const double StartTime = T.GetElapsedTime();
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+            pDevice->CreateBuffer(Descs[i], InitData[i].pData != nullptr ? &InitData[i] : nullptr, &Buffers[i]);
+        SingleTime = T.GetElapsedTime() - StartTime;
+
+        for (const auto& pBuffer : Buffers)
+            ASSERT_NE(pBuffer, nullptr);
+    }
+    pEnv->ReleaseResources();
+
+    double BatchTime = 0;
+    {
+        std::vector<IBuffer*> Buffers(NumBuffers);
+
+        const double StartTime = T.GetElapsedTime();
+        pDevice->CreateBuffers(NumBuffers, Descs.data(), InitData.data(), Buffers.data());
+        BatchTime = T.GetElapsedTime() - StartTime;
+
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+        {
+            ASSERT_NE(Buffers[i], nullptr);
+            EXPECT_EQ(Buffers[i]->GetDesc(), Descs[i]);
+        }
+        for (IBuffer* pBuffer : Buffers)
+            pBuffer->Release();
+    }
+
+    LOG_INFO_MESSAGE("Created ", NumBuffers, " buffers one by one in ", SingleTime * 1000, " ms, in one batch in ", BatchTime * 1000, " ms");
+
+#if VULKAN_SUPPORTED
+    if (RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk})
+    {
+        pEnv->ReleaseResources();
+
+        // Buffers without initial data do not allocate staging memory,
+        // so every buffer created one by one makes exactly one allocation.
+        MemoryPageStatsVk StartStats;
+        pDeviceVk->GetMemoryPageStats(StartStats);
+        {
+            std::vector<RefCntAutoPtr<IBuffer>> Buffers(NumBuffers);
+            for (Uint32 i = 0; i < NumBuffers; ++i)
+                pDevice->CreateBuffer(Descs[i], nullptr, &Buffers[i]);
+
+            MemoryPageStatsVk Stats;
+            pDeviceVk->GetMemoryPageStats(Stats);
+            EXPECT_EQ(Stats.NumAllocations - StartStats.NumAllocations, NumBuffers);
+        }
+        pEnv->ReleaseResources();
+
+        // All buffers in the batch have the same memory type and allocation flags,
+        // so they are packed into one allocation that creates at most one page.
+        pDeviceVk->GetMemoryPageStats(StartStats);
+        {
+            std::vector<IBuffer*> Buffers(NumBuffers);
+            pDevice->CreateBuffers(NumBuffers, Descs.data(), nullptr, Buffers.data());
+
+            MemoryPageStatsVk Stats;
+            pDeviceVk->GetMemoryPageStats(Stats);
+            EXPECT_EQ(Stats.NumAllocations - StartStats.NumAllocations, 1u);
+            EXPECT_LE(Stats.NumPagesCreated - StartStats.NumPagesCreated, 1u);
+
+            for (IBuffer* pBuffer : Buffers)
+            {
+                ASSERT_NE(pBuffer, nullptr);
+                pBuffer->Release();
+            }
+        }
+    }
+#endif
+}
+
+TEST_F(BufferCreationTest, CreateBuffersInvalidBatch)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferDesc Descs[3];
+    for (BufferDesc& Desc : Descs)
+    {
+        Desc.Name      = "Batch test buffer";
+        Desc.Usage     = USAGE_DEFAULT;
+        Desc.Size      = 256;
+        Desc.BindFlags = BIND_VERTEX_BUFFER;
+    }
+    Descs[2].Name  = "Invalid immutable buffer without data";
+    Descs[2].Usage = USAGE_IMMUTABLE;
+
+    IBuffer* Buffers[3] = {};
+
+    pEnv->SetErrorAllowance(2, "Errors below are expected: testing invalid buffer batch\n");
+    pDevice->CreateBuffers(_countof(Descs), Descs, nullptr, Buffers);
+    for (IBuffer* pBuffer : Buffers)
+        EXPECT_EQ(pBuffer, nullptr);
+}
+
 } // namespace
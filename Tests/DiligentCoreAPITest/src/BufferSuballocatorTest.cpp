@@ -153,4 +153,129 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+TEST(BufferSuballocatorTest, ThreadArenas)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    const Uint32 NumThreads = std::max(4u, std::thread::hardware_concurrency());
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name            = "Buffer Suballocator Thread Arenas Test";
+    CI.Desc.BindFlags       = BIND_VERTEX_BUFFER;
+    CI.Desc.Size            = 1024;
+    CI.ExpansionSize        = 4096;
+    CI.MaxSize              = 256u << 20u;
+    CI.ThreadArenaChunkSize = 2048;
+    CI.NumThreadArenas      = NumThreads;
+    // Validation is very expensive with many allocations
+    CI.DisableDebugValidation = true;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_TRUE(pAllocator);
+
+#ifdef DILIGENT_DEBUG
+    constexpr size_t NumIterations  = 4;
+    constexpr size_t NumAllocations = 256;
+#else
+    constexpr size_t NumIterations  = 16;
+    constexpr size_t NumAllocations = 1024;
+#endif
+
+    std::vector<std::vector<RefCntAutoPtr<IBufferSuballocation>>> pSubAllocations(NumThreads);
+    for (auto& Allocs : pSubAllocations)
+        Allocs.resize(NumAllocations);
+
+    for (size_t i = 0; i < NumIterations; ++i)
+    {
+        {
+            std::vector<std::thread> Threads(NumThreads);
+            for (size_t t = 0; t < Threads.size(); ++t)
+            {
+                Threads[t] = std::thread{
+                    [&](size_t thread_id) //
+                    {
+                        FastRandInt rnd{static_cast<unsigned int>(thread_id + i * NumThreads), 4, 1024};
+
+                        auto& Allocs = pSubAllocations[thread_id];
+                        for (size_t a = 0; a < Allocs.size(); ++a)
+                        {
+                            // Randomly release some allocations, so that chunks are reused
+                            if (a > 0 && (rnd() % 4) == 0)
+                                Allocs[rnd() % a].Release();
+
+                            const Uint32 size      = static_cast<Uint32>(rnd());
+                            const Uint32 alignment = 1u << (rnd() % 9); // 1 .. 256; large sizes bypass the arenas
+                            pAllocator->Allocate(size, alignment, &Allocs[a]);
+                            ASSERT_TRUE(Allocs[a]);
+                            EXPECT_EQ(Allocs[a]->GetSize(), size);
+                            EXPECT_EQ(Allocs[a]->GetOffset() % alignment, 0u);
+                        }
+                    },
+                    t //
+                };
+            }
+
+            for (auto& Thread : Threads)
+                Thread.join();
+        }
+
+        auto* pBuffer = pAllocator->Update(pDevice, pContext);
+        EXPECT_NE(pBuffer, nullptr);
+        EXPECT_EQ(pBuffer, pAllocator->GetBuffer());
+
+        // Verify that live allocations do not overlap
+        {
+            std::vector<std::pair<Uint32, Uint32>> Ranges;
+            for (const auto& Allocs : pSubAllocations)
+            {
+                for (const auto& Alloc : Allocs)
+                {
+                    if (Alloc)
+                        Ranges.emplace_back(Alloc->GetOffset(), Alloc->GetOffset() + Alloc->GetSize());
+                }
+            }
+            std::sort(Ranges.begin(), Ranges.end());
+            for (size_t r = 1; r < Ranges.size(); ++r)
+                ASSERT_LE(Ranges[r - 1].second, Ranges[r].first);
+
+            BufferSuballocatorUsageStats Stats;
+            pAllocator->GetUsageStats(Stats);
+            EXPECT_EQ(Stats.AllocationCount, Ranges.size());
+            EXPECT_LE(Stats.UsedSize + Stats.ArenaFreeSize, Stats.CommittedSize);
+        }
+
+        // Release allocations from threads other than the ones that created them
+        {
+            std::vector<std::thread> Threads(NumThreads);
+            for (size_t t = 0; t < Threads.size(); ++t)
+            {
+                Threads[t] = std::thread{
+                    [&](size_t thread_id) //
+                    {
+                        auto& Allocs = pSubAllocations[(thread_id + 1) % NumThreads];
+                        for (auto& Alloc : Allocs)
+                            Alloc.Release();
+                    },
+                    t //
+                };
+            }
+
+            for (auto& Thread : Threads)
+                Thread.join();
+        }
+
+        BufferSuballocatorUsageStats Stats;
+        pAllocator->GetUsageStats(Stats);
+        EXPECT_EQ(Stats.AllocationCount, 0u);
+        EXPECT_EQ(Stats.UsedSize, 0u);
+        // Every arena keeps at most one chunk
+        EXPECT_LE(Stats.ArenaFreeSize, Uint64{CI.ThreadArenaChunkSize} * NumThreads);
+    }
+}
+
 } // namespace
@@ -50,4 +50,47 @@ TEST(DeviceContextTest, DebugGroups)
     pCtx->EndDebugGroup();
 }
 
+TEST(DeviceContextTest, TransientHeapAllocations)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Deferred contexts make Flush() allocate the arrays for their command buffers
+    IDeviceContext* pDeferredCtx = pEnv->GetNumDeferredContexts() > 0 ? pEnv->GetDeferredContext(0) : nullptr;
+
+    auto RunFrame = [&]() {
+        constexpr Uint32 NumFlushes = 4;
+        for (Uint32 i = 0; i < NumFlushes; ++i)
+        {
+            if (pDeferredCtx != nullptr)
+            {
+                pDeferredCtx->Begin(0);
+                pDeferredCtx->InsertDebugLabel("Deferred context label");
+
+                RefCntAutoPtr<ICommandList> pCmdList;
+                pDeferredCtx->FinishCommandList(&pCmdList);
+                ASSERT_NE(pCmdList, nullptr);
+
+                ICommandList* pCmdLists[] = {pCmdList};
+                pCtx->ExecuteCommandLists(1, pCmdLists);
+                pDeferredCtx->FinishFrame();
+            }
+            pCtx->Flush();
+        }
+        pCtx->FinishFrame();
+    };
+
+    // Let the context reach its working size
+    for (Uint32 frame = 0; frame < 4; ++frame)
+        RunFrame();
+
+    pCtx->ClearStats();
+    for (Uint32 frame = 0; frame < 16; ++frame)
+        RunFrame();
+
+    EXPECT_EQ(pCtx->GetStats().TransientHeapAllocations, 0u);
+}
+
 } // namespace
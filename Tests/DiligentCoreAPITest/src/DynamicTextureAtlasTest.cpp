@@ -28,6 +28,7 @@
 #include "DynamicTextureAtlas.h"
 
 #include <thread>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
 #include "gtest/gtest.h"
@@ -254,6 +255,122 @@ TEST(DynamicTextureAtlas, Allocate)
                 Thread.join();
         }
     }
+
+    // Failed requests are counted too
+    {
+        DynamicTextureAtlasUsageStats StatsBefore;
+        pAtlas->GetUsageStats(StatsBefore);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"exceeds atlas dimensions"};
+
+        RefCntAutoPtr<ITextureAtlasSuballocation> pAlloc;
+        pAtlas->Allocate(CI.Desc.Width + 1, 16, &pAlloc);
+        EXPECT_FALSE(pAlloc);
+
+        DynamicTextureAtlasUsageStats Stats;
+        pAtlas->GetUsageStats(Stats);
+        EXPECT_EQ(Stats.AllocationRequestCount, StatsBefore.AllocationRequestCount + 1);
+    }
+}
+
+
+TEST(DynamicTextureAtlas, AllocateBatch)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    DynamicTextureAtlasCreateInfo CI;
+    CI.ExtraSliceCount = 2;
+    CI.MinAlignment    = 16;
+    CI.Desc.Format     = TEX_FORMAT_RGBA8_UNORM;
+    CI.Desc.Name       = "Dynamic Texture Atlas Batch Test";
+    CI.Desc.Type       = RESOURCE_DIM_TEX_2D_ARRAY;
+    CI.Desc.BindFlags  = BIND_SHADER_RESOURCE;
+    CI.Desc.Width      = 512;
+    CI.Desc.Height     = 512;
+    CI.Desc.ArraySize  = 1;
+
+    RefCntAutoPtr<IDynamicTextureAtlas> pAtlas;
+    CreateDynamicTextureAtlas(pDevice, CI, &pAtlas);
+
+    const size_t NumThreads     = std::max(4u, std::thread::hardware_concurrency());
+    const size_t NumAllocations = 256;
+
+    std::vector<std::vector<RefCntAutoPtr<ITextureAtlasSuballocation>>> pSubAllocations(NumThreads);
+    {
+        std::vector<std::thread> Threads(NumThreads);
+        for (size_t t = 0; t < Threads.size(); ++t)
+        {
+            Threads[t] = std::thread{
+                [&](size_t thread_id) //
+                {
+                    FastRandInt rnd{static_cast<unsigned int>(thread_id), 4, 64};
+
+                    std::vector<uint2> Sizes(NumAllocations);
+                    for (auto& Size : Sizes)
+                        Size = uint2{static_cast<Uint32>(rnd()), static_cast<Uint32>(rnd())};
+
+                    auto& Allocs = pSubAllocations[thread_id];
+                    Allocs.resize(NumAllocations);
+                    pAtlas->AllocateBatch(static_cast<Uint32>(NumAllocations), Sizes.data(), reinterpret_cast<ITextureAtlasSuballocation**>(Allocs.data()));
+                    for (size_t i = 0; i < NumAllocations; ++i)
+                    {
+                        ASSERT_TRUE(Allocs[i]);
+                        EXPECT_EQ(Allocs[i]->GetSize(), Sizes[i]);
+                    }
+                },
+                t //
+            };
+        }
+
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    // Check that allocations do not overlap
+    std::vector<ITextureAtlasSuballocation*> AllAllocs;
+    for (const auto& Allocs : pSubAllocations)
+    {
+        for (const auto& pAlloc : Allocs)
+        {
+            if (pAlloc)
+                AllAllocs.push_back(pAlloc);
+        }
+    }
+    for (size_t i = 0; i < AllAllocs.size(); ++i)
+    {
+        for (size_t j = i + 1; j < AllAllocs.size(); ++j)
+        {
+            const auto* pAlloc0 = AllAllocs[i];
+            const auto* pAlloc1 = AllAllocs[j];
+            if (pAlloc0->GetSlice() != pAlloc1->GetSlice())
+                continue;
+
+            const auto Min0 = pAlloc0->GetOrigin();
+            const auto Min1 = pAlloc1->GetOrigin();
+            const auto Max0 = Min0 + pAlloc0->GetSize();
+            const auto Max1 = Min1 + pAlloc1->GetSize();
+            EXPECT_FALSE(Min0.x < Max1.x && Min1.x < Max0.x && Min0.y < Max1.y && Min1.y < Max0.y);
+        }
+    }
+
+    DynamicTextureAtlasUsageStats Stats;
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, AllAllocs.size());
+    EXPECT_EQ(Stats.AllocationRequestCount, NumThreads * NumAllocations);
+    EXPECT_GE(Stats.SliceProbeCount, Stats.AllocationRequestCount);
+    EXPECT_LE(Stats.ContendedProbeCount, Stats.SliceProbeCount);
+    LOG_INFO_MESSAGE("Dynamic texture atlas batch allocation: ", Stats.AllocationRequestCount, " requests, ",
+                     Stats.SliceProbeCount, " probes, ", Stats.SkippedSliceCount, " skipped slices, ",
+                     Stats.ContendedProbeCount, " contended probes");
+
+    auto* pTexture = pAtlas->Update(pDevice, pContext);
+    EXPECT_NE(pTexture, nullptr);
+
+    pSubAllocations.clear();
 }
 
 
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+
+#include "GL/TestingEnvironmentGL.hpp"
+
+#include "DeviceContextGL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const std::string ResourceBindingTestVS = R"(
+void main(in uint VertId : SV_VertexID, out float4 Pos : SV_Position)
+{
+    float2 UV = float2(float((VertId << 1u) & 2u), float(VertId & 2u));
+    Pos = float4(UV * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const std::string ResourceBindingTestPS = R"(
+Texture2D g_Tex0;
+Texture2D g_Tex1;
+Texture2D g_Tex2;
+Texture2D g_Tex3;
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    int3 Coord = int3(0, 0, 0);
+    return g_Tex0.Load(Coord) + g_Tex1.Load(Coord) + g_Tex2.Load(Coord) + g_Tex3.Load(Coord);
+}
+)";
+
+constexpr Uint32 NumTextures = 4;
+
+TEST(ResourceBindingTestGL, MultiBind)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<IDeviceContextGL> pContextGL{pContext, IID_DeviceContextGL};
+    if (!pContextGL)
+    {
+        GTEST_SKIP() << "This test requires GL device context";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    ShaderCI.Desc   = {"Resource binding test VS", SHADER_TYPE_VERTEX, true};
+    ShaderCI.Source = ResourceBindingTestVS.c_str();
+    pDevice->CreateShader(ShaderCI, &pVS);
+    ASSERT_NE(pVS, nullptr);
+
+    RefCntAutoPtr<IShader> pPS;
+    ShaderCI.Desc   = {"Resource binding test PS", SHADER_TYPE_PIXEL, true};
+    ShaderCI.Source = ResourceBindingTestPS.c_str();
+    pDevice->CreateShader(ShaderCI, &pPS);
+    ASSERT_NE(pPS, nullptr);
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                                  = "Resource binding test";
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType    = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.GraphicsPipeline.NumRenderTargets             = 1;
+    PSOCreateInfo.GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    PSOCreateInfo.GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    PSOCreateInfo.GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+    PSOCreateInfo.pVS                                           = pVS;
+    PSOCreateInfo.pPS                                           = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    // Two resource bindings that use different textures in the same units
+    std::array<RefCntAutoPtr<IShaderResourceBinding>, 2> pSRBs;
+    std::array<RefCntAutoPtr<ITexture>, NumTextures * 2> pTextures;
+    for (size_t srb = 0; srb < pSRBs.size(); ++srb)
+    {
+        pPSO->CreateShaderResourceBinding(&pSRBs[srb], true);
+        ASSERT_NE(pSRBs[srb], nullptr);
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            const Uint32 Data[4 * 4] = {};
+
+            RefCntAutoPtr<ITexture>& pTex = pTextures[srb * NumTextures + i];
+            pTex                          = pEnv->CreateTexture("Resource binding test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 4, 4, Data);
+            ASSERT_NE(pTex, nullptr);
+
+            const std::string Name = "g_Tex" + std::to_string(i);
+            pSRBs[srb]->GetVariableByName(SHADER_TYPE_PIXEL, Name.c_str())->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+        }
+    }
+
+    auto Draw = [&](IShaderResourceBinding* pSRB) {
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->SetPipelineState(pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    };
+
+    // Textures bound by other tests may use different targets, which requires unbinding them individually
+    Draw(pSRBs[0]);
+
+    ResourceBindingStatsGL Before;
+    pContextGL->GetResourceBindingStats(Before);
+
+    Draw(pSRBs[1]);
+    Draw(pSRBs[0]);
+
+    ResourceBindingStatsGL Stats;
+    pContextGL->GetResourceBindingStats(Stats);
+
+    const Uint64 NumGLCalls        = Stats.NumGLCalls - Before.NumGLCalls;
+    const Uint64 NumMultiBindCalls = Stats.NumMultiBindCalls - Before.NumMultiBindCalls;
+    const Uint64 NumBindings       = Stats.NumBindings - Before.NumBindings;
+
+    // Every draw changes all textures
+    EXPECT_GE(NumBindings, Uint64{NumTextures * 2});
+
+    const RenderDeviceInfo& DeviceInfo = pDevice->GetDeviceInfo();
+    if (DeviceInfo.Type == RENDER_DEVICE_TYPE_GL && DeviceInfo.APIVersion >= Version{4, 4})
+    {
+        // GL4.4 always supports GL_ARB_multi_bind
+        EXPECT_GT(NumMultiBindCalls, 0u);
+    }
+
+    if (NumMultiBindCalls > 0)
+    {
+        // The textures of every draw occupy contiguous units and are bound with one glBindTextures call
+        EXPECT_LT(NumGLCalls, NumBindings);
+    }
+    else
+    {
+        // Every binding is a separate GL call
+        EXPECT_GE(NumGLCalls, NumBindings);
+    }
+}
+
+} // namespace
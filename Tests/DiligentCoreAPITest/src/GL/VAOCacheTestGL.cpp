@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+
+#include "GL/TestingEnvironmentGL.hpp"
+
+#include "DeviceContextGL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const std::string VAOCacheTestVS = R"(
+struct VSInput
+{
+    float4 Pos : ATTRIB0;
+};
+
+void main(in VSInput VSIn, out float4 Pos : SV_Position)
+{
+    Pos = VSIn.Pos;
+}
+)";
+
+const std::string VAOCacheTestPS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+class VAOCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto* pEnv = GPUTestingEnvironment::GetInstance();
+
+        m_pContextGL = RefCntAutoPtr<IDeviceContextGL>{pEnv->GetDeviceContext(), IID_DeviceContextGL};
+        if (!m_pContextGL)
+        {
+            GTEST_SKIP() << "This test requires GL device context";
+        }
+
+        for (size_t i = 0; i < m_pVBs.size(); ++i)
+        {
+            const float Vertices[] = {0, 0, 0, 1, 1, 0, 0, 1, 0, 1, 0, 1};
+            m_pVBs[i]              = pEnv->CreateBuffer({"VAO cache test VB", sizeof(Vertices), BIND_VERTEX_BUFFER, USAGE_DEFAULT}, Vertices);
+            ASSERT_NE(m_pVBs[i], nullptr);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto& pVB : m_pVBs)
+            pVB.Release();
+        m_pContextGL.Release();
+    }
+
+    static RefCntAutoPtr<IPipelineState> CreatePSO()
+    {
+        auto* pEnv       = GPUTestingEnvironment::GetInstance();
+        auto* pDevice    = pEnv->GetDevice();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.EntryPoint     = "main";
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc   = {"VAO cache test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = VAOCacheTestVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc   = {"VAO cache test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = VAOCacheTestPS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+
+        if (!pVS || !pPS)
+            return {};
+
+        const LayoutElement Elems[] = {LayoutElement{0, 0, 4, VT_FLOAT32}};
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name = "VAO cache test";
+
+        auto& GraphicsPipeline                        = PSOCreateInfo.GraphicsPipeline;
+        GraphicsPipeline.NumRenderTargets             = 1;
+        GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+        GraphicsPipeline.InputLayout                  = {Elems, _countof(Elems)};
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        return pPSO;
+    }
+
+    VAOCacheStatsGL GetStats() const
+    {
+        VAOCacheStatsGL Stats;
+        m_pContextGL->GetVAOCacheStats(Stats);
+        return Stats;
+    }
+
+    // Every SetVertexBuffers call makes the next draw set up the vertex input
+    void Draw(IPipelineState* pPSO, IBuffer* pVB) const
+    {
+        auto* pEnv       = GPUTestingEnvironment::GetInstance();
+        auto* pContext   = pEnv->GetDeviceContext();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->SetPipelineState(pPSO);
+
+        IBuffer* pVBs[] = {pVB};
+        pContext->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+
+    RefCntAutoPtr<IDeviceContextGL>       m_pContextGL;
+    std::array<RefCntAutoPtr<IBuffer>, 2> m_pVBs;
+};
+
+TEST_F(VAOCacheTest, GLCalls)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreatePSO();
+    ASSERT_NE(pPSO, nullptr);
+
+    const VAOCacheStatsGL Before = GetStats();
+
+    Draw(pPSO, m_pVBs[0]);
+    Draw(pPSO, m_pVBs[1]);
+    Draw(pPSO, m_pVBs[0]);
+    Draw(pPSO, m_pVBs[0]);
+
+    const VAOCacheStatsGL Stats = GetStats();
+    EXPECT_EQ(Stats.NumRequests - Before.NumRequests, 4u);
+
+    const Uint32 NumVAOsCreated       = Stats.NumVAOsCreated - Before.NumVAOsCreated;
+    const Uint32 NumLayoutVAOsCreated = Stats.NumLayoutVAOsCreated - Before.NumLayoutVAOsCreated;
+    if (NumVAOsCreated == 0)
+    {
+        // One VAO for the layout. It may have been created by another test.
+        EXPECT_LE(NumLayoutVAOsCreated, 1u);
+
+        // Creating the VAO issues glGenVertexArrays, glBindVertexArray, glVertexAttribFormat,
+        // glVertexAttribBinding and glEnableVertexAttribArray. Every draw binds the VAO.
+        // glBindVertexBuffer is only called when the buffer changes, i.e. for the first three draws.
+        const Uint64 ExpectedGLCalls = NumLayoutVAOsCreated * 4 + 4 + 3;
+        EXPECT_EQ(Stats.NumGLCalls - Before.NumGLCalls, ExpectedGLCalls);
+    }
+    else
+    {
+        // One VAO for each buffer used with the new pipeline
+        EXPECT_EQ(NumVAOsCreated, 2u);
+        EXPECT_EQ(NumLayoutVAOsCreated, 0u);
+
+        // Creating a VAO issues glGenVertexArrays, glBindVertexArray, glBindBuffer,
+        // glVertexAttribPointer and glEnableVertexAttribArray. Every other draw binds the cached VAO.
+        const Uint64 ExpectedGLCalls = 2 * 5 + 2;
+        EXPECT_EQ(Stats.NumGLCalls - Before.NumGLCalls, ExpectedGLCalls);
+    }
+}
+
+TEST_F(VAOCacheTest, LayoutVAOIsShared)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IPipelineState> pPSO0 = CreatePSO();
+    RefCntAutoPtr<IPipelineState> pPSO1 = CreatePSO();
+    ASSERT_TRUE(pPSO0 && pPSO1);
+
+    Draw(pPSO0, m_pVBs[0]);
+
+    const VAOCacheStatsGL Before = GetStats();
+    if (Before.NumLayoutVAOsCreated == 0)
+    {
+        GTEST_SKIP() << "Separate attribute format and buffer bindings are not supported";
+    }
+
+    // The second pipeline has the same input layout and reuses the VAO
+    Draw(pPSO1, m_pVBs[1]);
+    Draw(pPSO0, m_pVBs[1]);
+
+    const VAOCacheStatsGL Stats = GetStats();
+    EXPECT_EQ(Stats.NumRequests - Before.NumRequests, 2u);
+    EXPECT_EQ(Stats.NumLayoutVAOsCreated, Before.NumLayoutVAOsCreated);
+    EXPECT_EQ(Stats.NumVAOsCreated, Before.NumVAOsCreated);
+    // glBindVertexArray for both draws and glBindVertexBuffer for the first one
+    EXPECT_EQ(Stats.NumGLCalls - Before.NumGLCalls, 3u);
+}
+
+} // namespace
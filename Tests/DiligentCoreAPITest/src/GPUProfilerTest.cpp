@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUProfiler.hpp"
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(GPUProfilerTest, GPUZones)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pRTV = pEnv->GetSwapChain()->GetCurrentBackBufferRTV();
+
+    GPUProfiler::CreateInfo CI;
+    CI.NumQueriesToReserve = 4;
+
+    GPUProfiler Profiler{pDevice, CI};
+    EXPECT_TRUE(Profiler.IsGPUTimingEnabled());
+
+    constexpr Uint32 NumFrames = 4;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        {
+            GPUProfiler::ScopedZone Frame{Profiler, pContext, "Frame"};
+            for (Uint32 i = 0; i < 8; ++i)
+            {
+                GPUProfiler::ScopedZone Clear{Profiler, pContext, "Clear"};
+
+                pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                const float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.f};
+                pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+        Profiler.EndFrame(pContext);
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+
+    pContext->WaitForIdle();
+    // Resolve the remaining frames
+    Profiler.EndFrame(pContext);
+    EXPECT_EQ(Profiler.GetPendingFrameCount(), size_t{0});
+
+    const auto& Frames = Profiler.GetResolvedFrames();
+    ASSERT_EQ(Frames.size(), size_t{NumFrames + 1});
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        const auto& Zones = Frames[frame].Zones;
+        ASSERT_EQ(Zones.size(), size_t{9});
+        for (const auto& Zone : Zones)
+        {
+            EXPECT_TRUE(Zone.HasGPUData);
+            EXPECT_LE(Zone.GPUStart, Zone.GPUEnd);
+        }
+        // Child zones must be enclosed by the parent on the GPU timeline
+        for (size_t i = 1; i < Zones.size(); ++i)
+        {
+            EXPECT_LE(Zones[0].GPUStart, Zones[i].GPUStart);
+            EXPECT_LE(Zones[i].GPUEnd, Zones[0].GPUEnd);
+        }
+    }
+
+    const auto Trace = Profiler.GetChromeTrace();
+    EXPECT_NE(Trace.find("\"cat\":\"GPU\""), std::string::npos);
+}
+
+} // namespace
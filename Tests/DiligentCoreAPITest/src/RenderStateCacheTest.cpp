@@ -24,12 +24,15 @@
  *  of the possibility of such damages.
  */
 
+#include <array>
+#include <cstring>
 #include <functional>
 
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
 #include "RenderStateCache.h"
 #include "RenderStateCache.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
 #include "FastRand.hpp"
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
@@ -1400,6 +1403,29 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
         if (!AsyncCompile)
             EXPECT_EQ(NumStatesReloaded, pass == 0 ? 3u : 0u);
         ASSERT_EQ(pPSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
+        {
+            RenderStateCacheReloadStats Stats;
+            pCache->GetLastReloadStats(Stats);
+            EXPECT_EQ(Stats.NumStatesCreated, NumStatesReloaded);
+            EXPECT_EQ(Stats.NumShaders, 2u);
+            EXPECT_EQ(Stats.NumShadersReloaded, 2u);
+            EXPECT_EQ(Stats.NumShadersFailed, 0u);
+            EXPECT_EQ(Stats.NumPipelinesReloaded, 1u);
+            EXPECT_GT(Stats.NumSourceFiles, 0u);
+            EXPECT_GE(Stats.ShaderReloadTime, 0.0);
+            EXPECT_GE(Stats.PipelineReloadTime, 0.0);
+        }
+
+        // Sources have not changed since the last reload, so nothing should be re-created
+        EXPECT_EQ(pCache->Reload(), 0u);
+        ASSERT_EQ(pPSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
+        {
+            RenderStateCacheReloadStats Stats;
+            pCache->GetLastReloadStats(Stats);
+            EXPECT_EQ(Stats.NumStatesCreated, 0u);
+            EXPECT_EQ(Stats.NumShadersReloaded, 0u);
+            EXPECT_EQ(Stats.NumPipelinesReloaded, 0u);
+        }
 
         if (!pSRB0)
         {
@@ -1610,6 +1636,89 @@ TEST(RenderStateCacheTest, Reload_Signatures2)
     }
 }
 
+TEST(RenderStateCacheTest, Reload_ChangedInclude)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    // The memory factory references the buffers, so the sources can be changed in place
+    char CommonA[64] = "#define VALUE_A 1\n";
+    char CommonB[64] = "#define VALUE_B 2\n";
+
+    constexpr char ShaderA[] = R"(
+#include "CommonA.fxh"
+RWBuffer<uint> g_Output;
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[0] = VALUE_A;
+}
+)";
+
+    constexpr char ShaderB[] = R"(
+#include "CommonB.fxh"
+RWBuffer<uint> g_Output;
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[0] = VALUE_B;
+}
+)";
+
+    auto pSourceFactory = CreateMemoryShaderSourceFactory({{"CommonA.fxh", CommonA}, {"CommonB.fxh", CommonB}, {"ShaderA.csh", ShaderA}, {"ShaderB.csh", ShaderB}});
+    ASSERT_TRUE(pSourceFactory);
+
+    constexpr bool HotReload = true;
+
+    auto pCache = CreateCache(pDevice, HotReload);
+    ASSERT_TRUE(pCache);
+
+    std::array<RefCntAutoPtr<IShader>, 2>        pShaders;
+    std::array<RefCntAutoPtr<IPipelineState>, 2> pPSOs;
+    for (size_t i = 0; i < pShaders.size(); ++i)
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.pShaderSourceStreamFactory = pSourceFactory;
+        ShaderCI.Desc                       = {i == 0 ? "Reload_ChangedInclude A" : "Reload_ChangedInclude B", SHADER_TYPE_COMPUTE, true};
+        ShaderCI.FilePath                   = i == 0 ? "ShaderA.csh" : "ShaderB.csh";
+        ShaderCI.EntryPoint                 = "main";
+        EXPECT_FALSE(pCache->CreateShader(ShaderCI, &pShaders[i]));
+        ASSERT_NE(pShaders[i], nullptr);
+
+        ComputePipelineStateCreateInfo PsoCI;
+        PsoCI.PSODesc.Name = ShaderCI.Desc.Name;
+        PsoCI.pCS          = pShaders[i];
+        EXPECT_FALSE(pCache->CreateComputePipelineState(PsoCI, &pPSOs[i]));
+        ASSERT_NE(pPSOs[i], nullptr);
+    }
+
+    EXPECT_EQ(pCache->Reload(), 0u);
+
+    // Only the shader that includes the changed file and its pipeline are re-created
+    strcpy(CommonA, "#define VALUE_A 3\n");
+    EXPECT_EQ(pCache->Reload(), 2u);
+    EXPECT_EQ(pCache->Reload(), 0u);
+
+    strcpy(CommonB, "#define VALUE_B 4\n");
+    EXPECT_EQ(pCache->Reload(), 2u);
+    EXPECT_EQ(pCache->Reload(), 0u);
+
+    // The shader that fails to compile is not counted, and its pipeline is not re-created
+    strcpy(CommonB, "#define VALUE_B (\n");
+    pEnv->SetErrorAllowance(6, "\n\nNo worries, testing broken shader...\n\n");
+    EXPECT_EQ(pCache->Reload(), 0u);
+    pEnv->SetErrorAllowance(0);
+
+    // Once the error is fixed, the shader is reloaded again
+    strcpy(CommonB, "#define VALUE_B 6\n");
+    EXPECT_EQ(pCache->Reload(), 2u);
+    EXPECT_EQ(pCache->Reload(), 0u);
+}
+
 TEST(RenderStateCacheTest, GLExtensions)
 {
     auto*       pEnv       = GPUTestingEnvironment::GetInstance();
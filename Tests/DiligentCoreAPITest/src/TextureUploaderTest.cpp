@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -220,4 +221,173 @@ TEST(TextureUploaderTest, WorkerThread)
     TextureUploaderTest(false);
 }
 
+TEST(TextureUploaderTest, AsyncTiles)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (pDevice->GetDeviceInfo().IsMetalDevice())
+    {
+        GTEST_SKIP() << "Texture uploader is not currently implemented in Metal";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 TileSize = 64;
+
+    UploadBufferDesc TileDesc;
+    TileDesc.Width  = TileSize;
+    TileDesc.Height = TileSize;
+    TileDesc.Format = TEX_FORMAT_RGBA8_UNORM;
+
+    // Budget for a single tile: recycled tiles must be released once the budget is exceeded
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.StagingMemoryBudget = Uint64{TileSize} * TileSize * 4;
+
+    RefCntAutoPtr<ITextureUploader> pTexUploader;
+    CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
+    ASSERT_TRUE(pTexUploader);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Tiled texture uploading dst texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = TileSize * 4;
+    TexDesc.Height    = TileSize * 2;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    RefCntAutoPtr<ITexture> pDstTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDstTexture);
+    ASSERT_TRUE(pDstTexture);
+
+    TexDesc.Name           = "Tiled texture uploading staging texture";
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    TexDesc.BindFlags      = BIND_NONE;
+    RefCntAutoPtr<ITexture> pStagingTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTexture);
+    ASSERT_TRUE(pStagingTexture);
+
+    const Uint32 NumTilesX = TexDesc.Width / TileSize;
+    const Uint32 NumTilesY = TexDesc.Height / TileSize;
+
+    std::vector<RefCntAutoPtr<IUploadBuffer>> Tiles(NumTilesX * NumTilesY);
+    for (auto& pTile : Tiles)
+    {
+        pTexUploader->AllocateUploadBufferAsync(TileDesc, &pTile);
+        ASSERT_TRUE(pTile);
+    }
+
+    // Asynchronous allocation must not map the buffers until the render thread update
+    for (auto& pTile : Tiles)
+        EXPECT_FALSE(pTile->IsMapCompleted());
+    pTexUploader->RenderThreadUpdate(pContext);
+
+    std::atomic<Uint32> NumCopiesScheduled{0};
+
+    Uint32 cnt = 0;
+    for (Uint32 ty = 0; ty < NumTilesY; ++ty)
+    {
+        for (Uint32 tx = 0; tx < NumTilesX; ++tx)
+        {
+            auto& pTile = Tiles[tx + ty * NumTilesX];
+            ASSERT_TRUE(pTile->IsMapCompleted());
+
+            auto MappedData = pTile->GetMappedData(0, 0);
+            WriteOrVerifyRGBAData(MappedData, TileDesc, 0, 0, cnt, false);
+
+            ScheduleGPUCopyAttribs CopyAttribs;
+            CopyAttribs.pDstTexture     = pDstTexture;
+            CopyAttribs.DstX            = tx * TileSize;
+            CopyAttribs.DstY            = ty * TileSize;
+            CopyAttribs.pUploadBuffer   = pTile;
+            CopyAttribs.OnCopyScheduled = [&NumCopiesScheduled]() {
+                ++NumCopiesScheduled;
+            };
+            pTexUploader->ScheduleGPUCopy(nullptr, CopyAttribs);
+        }
+    }
+
+    EXPECT_EQ(NumCopiesScheduled, 0u);
+    pTexUploader->RenderThreadUpdate(pContext);
+    EXPECT_EQ(NumCopiesScheduled, static_cast<Uint32>(Tiles.size()));
+    for (auto& pTile : Tiles)
+    {
+        EXPECT_TRUE(pTile->IsCopyScheduled());
+        pTexUploader->RecycleBuffer(pTile);
+    }
+    Tiles.clear();
+
+    const auto Stats = pTexUploader->GetStats();
+    EXPECT_EQ(Stats.NumPendingOperations, 0u);
+    EXPECT_EQ(Stats.TotalBytesUploaded, Uint64{TexDesc.Width} * TexDesc.Height * 4);
+    EXPECT_LE(Stats.StagingMemorySize, UploaderDesc.StagingMemoryBudget);
+
+    CopyTextureAttribs CopyAttribs{pDstTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    pContext->CopyTexture(CopyAttribs);
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    cnt = 0;
+    for (Uint32 ty = 0; ty < NumTilesY; ++ty)
+    {
+        for (Uint32 tx = 0; tx < NumTilesX; ++tx)
+        {
+            MappedTextureSubresource TileData = MappedData;
+            TileData.pData                    = static_cast<Uint8*>(MappedData.pData) + ty * TileSize * MappedData.Stride + tx * TileSize * 4;
+            WriteOrVerifyRGBAData(TileData, TileDesc, 0, 0, cnt, true);
+        }
+    }
+    pContext->UnmapTextureSubresource(pStagingTexture, 0, 0);
+
+    // A buffer that is not recycled must be subtracted from the staging memory size when it is released
+    {
+        UploadBufferDesc RowDesc = TileDesc;
+        RowDesc.Width            = TexDesc.Width;
+
+        RefCntAutoPtr<IUploadBuffer> pRow;
+        pTexUploader->AllocateUploadBufferAsync(RowDesc, &pRow);
+        ASSERT_TRUE(pRow);
+        EXPECT_EQ(pTexUploader->GetStats().StagingMemorySize, Stats.StagingMemorySize + Uint64{RowDesc.Width} * RowDesc.Height * 4);
+
+        pTexUploader->RenderThreadUpdate(pContext);
+        ASSERT_TRUE(pRow->IsMapCompleted());
+        MappedTextureSubresource RowData = pRow->GetMappedData(0, 0);
+        WriteOrVerifyRGBAData(RowData, RowDesc, 0, 0, cnt, false);
+
+        ScheduleGPUCopyAttribs CopyAttribs;
+        CopyAttribs.pDstTexture   = pDstTexture;
+        CopyAttribs.pUploadBuffer = pRow;
+        pTexUploader->ScheduleGPUCopy(nullptr, CopyAttribs);
+
+        // The uploader releases its reference when the copy is executed
+        pRow.Release();
+        pTexUploader->RenderThreadUpdate(pContext);
+        EXPECT_EQ(pTexUploader->GetStats().StagingMemorySize, Stats.StagingMemorySize);
+    }
+
+    // A tile that overhangs the texture corner must be clipped to the destination mip level
+    {
+        RefCntAutoPtr<IUploadBuffer> pTile;
+        pTexUploader->AllocateUploadBuffer(pContext, TileDesc, &pTile);
+        ASSERT_TRUE(pTile);
+        MappedTextureSubresource TileData = pTile->GetMappedData(0, 0);
+        WriteOrVerifyRGBAData(TileData, TileDesc, 0, 0, cnt, false);
+
+        ScheduleGPUCopyAttribs CopyAttribs;
+        CopyAttribs.pDstTexture     = pDstTexture;
+        CopyAttribs.DstX            = TexDesc.Width - TileSize / 2;
+        CopyAttribs.DstY            = TexDesc.Height - TileSize / 2;
+        CopyAttribs.pUploadBuffer   = pTile;
+        CopyAttribs.OnCopyScheduled = [&NumCopiesScheduled]() {
+            ++NumCopiesScheduled;
+        };
+        pTexUploader->ScheduleGPUCopy(pContext, CopyAttribs);
+        EXPECT_TRUE(pTile->IsCopyScheduled());
+        EXPECT_EQ(NumCopiesScheduled, static_cast<Uint32>(NumTilesX * NumTilesY + 1));
+        pTexUploader->RecycleBuffer(pTile);
+    }
+}
+
 } // namespace
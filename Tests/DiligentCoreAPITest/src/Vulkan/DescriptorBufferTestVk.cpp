@@ -0,0 +1,452 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "DeviceContextVk.h"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const std::string DescriptorBufferTestCS = R"(
+cbuffer cbStatic
+{
+    uint4 g_StaticData;
+}
+
+cbuffer cbDynamic
+{
+    uint4 g_DynamicData; // x - value, y - output index
+}
+
+Texture2D<float4>        g_Texture;
+SamplerState             g_Texture_sampler;
+RWStructuredBuffer<uint> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    uint TexValue = uint(round(g_Texture.SampleLevel(g_Texture_sampler, float2(0.5, 0.5), 0.0).r * 255.0));
+    g_Output[g_DynamicData.y] = g_StaticData.x + g_DynamicData.x + TexValue;
+}
+)";
+
+constexpr Uint32 NumOutputValues = 4;
+
+struct DynamicCBData
+{
+    Uint32 Value;
+    Uint32 OutputIndex;
+    Uint32 Padding[2];
+};
+
+void ReadBufferContents(IRenderDevice* pDevice, IDeviceContext* pContext, IBuffer* pBuffer, std::array<Uint32, NumOutputValues>& Values)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Descriptor buffer test staging buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    BuffDesc.Size           = sizeof(Values);
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BuffDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    memcpy(Values.data(), pData, sizeof(Values));
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
+void VerifyBufferContents(IBuffer* pBuffer, const std::array<Uint32, NumOutputValues>& RefValues)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+
+    std::array<Uint32, NumOutputValues> Values{};
+    ReadBufferContents(pEnv->GetDevice(), pEnv->GetDeviceContext(), pBuffer, Values);
+    for (Uint32 i = 0; i < NumOutputValues; ++i)
+        EXPECT_EQ(Values[i], RefValues[i]) << "i = " << i;
+}
+
+// Dispatches a compute shader that uses static, mutable and dynamic variables as well as an immutable sampler.
+// The mutable constant buffer is a USAGE_DYNAMIC buffer that is remapped before every dispatch, and
+// the dynamic output buffer is switched between dispatches.
+TEST(DescriptorBufferTest, StaticMutableDynamicResources)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    if (!pDeviceVk)
+    {
+        GTEST_SKIP() << "This test requires Vulkan device";
+    }
+
+    DeviceFeaturesVk FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+    if (FeaturesVk.DescriptorBuffer != DEVICE_FEATURE_STATE_ENABLED)
+    {
+        GTEST_SKIP() << "Descriptor buffers are not enabled on this device. Use --Features.DescriptorBuffer=On to enable them.";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"Descriptor buffer test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = DescriptorBufferTestCS.c_str();
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Descriptor buffer test";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    const ShaderResourceVariableDesc Variables[] =
+        {
+            {SHADER_TYPE_COMPUTE, "cbStatic", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_COMPUTE, "cbDynamic", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_Output", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+    const ImmutableSamplerDesc ImmutableSamplers[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_Texture", SamplerDesc{}},
+        };
+
+    PipelineResourceLayoutDesc& ResourceLayout = PSOCreateInfo.PSODesc.ResourceLayout;
+    ResourceLayout.Variables                   = Variables;
+    ResourceLayout.NumVariables                = _countof(Variables);
+    ResourceLayout.ImmutableSamplers           = ImmutableSamplers;
+    ResourceLayout.NumImmutableSamplers        = _countof(ImmutableSamplers);
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    constexpr Uint32 StaticValue = 100;
+
+    RefCntAutoPtr<IBuffer> pStaticCB;
+    {
+        const Uint32 StaticData[4] = {StaticValue, 0, 0, 0};
+        pStaticCB                  = pEnv->CreateBuffer({"Descriptor buffer test static CB", sizeof(StaticData), BIND_UNIFORM_BUFFER, USAGE_DEFAULT}, StaticData);
+        ASSERT_NE(pStaticCB, nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pDynamicCB;
+    {
+        BufferDesc BuffDesc{"Descriptor buffer test dynamic CB", sizeof(DynamicCBData), BIND_UNIFORM_BUFFER, USAGE_DYNAMIC, CPU_ACCESS_WRITE};
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pDynamicCB);
+        ASSERT_NE(pDynamicCB, nullptr);
+    }
+
+    constexpr Uint32 TexValue = 3;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    {
+        const Uint8 TexData[4] = {TexValue, 0, 0, 0};
+        pTexture               = pEnv->CreateTexture("Descriptor buffer test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 1, 1, TexData);
+        ASSERT_NE(pTexture, nullptr);
+    }
+
+    std::array<RefCntAutoPtr<IBuffer>, 2> pOutputBuffers;
+    for (size_t i = 0; i < pOutputBuffers.size(); ++i)
+    {
+        const std::array<Uint32, NumOutputValues> ZeroData{};
+
+        BufferDesc BuffDesc{"Descriptor buffer test output", sizeof(ZeroData), BIND_UNORDERED_ACCESS, USAGE_DEFAULT};
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+
+        BufferData InitData{ZeroData.data(), sizeof(ZeroData)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pOutputBuffers[i]);
+        ASSERT_NE(pOutputBuffers[i], nullptr);
+    }
+
+    pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbStatic")->Set(pStaticCB);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "cbDynamic")->Set(pDynamicCB);
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Texture")->Set(pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    IShaderResourceVariable* pOutputVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output");
+    ASSERT_NE(pOutputVar, nullptr);
+
+    pContext->SetPipelineState(pPSO);
+
+    // Values 0 and 1 are written to the first buffer, values 2 and 3 - to the second one
+    std::array<std::array<Uint32, NumOutputValues>, 2> RefValues{};
+    for (Uint32 i = 0; i < NumOutputValues; ++i)
+    {
+        const Uint32 BufferIdx = i / 2;
+        const Uint32 Value     = 10 * (i + 1);
+        {
+            MapHelper<DynamicCBData> DynamicData{pContext, pDynamicCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            DynamicData->Value       = Value;
+            DynamicData->OutputIndex = i;
+        }
+
+        pOutputVar->Set(pOutputBuffers[BufferIdx]->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+
+        RefValues[BufferIdx][i] = StaticValue + Value + TexValue;
+    }
+
+    for (size_t i = 0; i < pOutputBuffers.size(); ++i)
+        VerifyBufferContents(pOutputBuffers[i], RefValues[i]);
+}
+
+const std::string CommitStatsTestCS = R"(
+cbuffer cbStatic
+{
+    uint4 g_StaticData;
+}
+
+Texture2D<float4>        g_Texture;
+SamplerState             g_Texture_sampler;
+RWStructuredBuffer<uint> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    uint TexValue = uint(round(g_Texture.SampleLevel(g_Texture_sampler, float2(0.5, 0.5), 0.0).r * 255.0));
+    g_Output[g_StaticData.y] = g_StaticData.x + TexValue;
+}
+)";
+
+// Runs the same sequence of dispatches on either descriptor commit path. The dynamic set must be written
+// for every dispatch by both paths, while with descriptor buffers the static/mutable set must only be
+// written when one of its variables changes. Run the test with and without --Features.DescriptorBuffer=On
+// to compare the paths: Vulkan does not allow creating a second device in the same process.
+TEST(DescriptorBufferTest, CommitStats)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    if (!pDeviceVk)
+    {
+        GTEST_SKIP() << "This test requires Vulkan device";
+    }
+
+    DeviceFeaturesVk FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+    const bool UseDescriptorBuffer = FeaturesVk.DescriptorBuffer == DEVICE_FEATURE_STATE_ENABLED;
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"Descriptor commit stats test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = CommitStatsTestCS.c_str();
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Descriptor commit stats test";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    // The static/mutable set only contains resources whose descriptors do not change between dispatches
+    const ShaderResourceVariableDesc Variables[] =
+        {
+            {SHADER_TYPE_COMPUTE, "cbStatic", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_Output", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+    const ImmutableSamplerDesc ImmutableSamplers[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_Texture", SamplerDesc{}},
+        };
+
+    PipelineResourceLayoutDesc& ResourceLayout = PSOCreateInfo.PSODesc.ResourceLayout;
+    ResourceLayout.Variables                   = Variables;
+    ResourceLayout.NumVariables                = _countof(Variables);
+    ResourceLayout.ImmutableSamplers           = ImmutableSamplers;
+    ResourceLayout.NumImmutableSamplers        = _countof(ImmutableSamplers);
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    constexpr Uint32 StaticValue = 100;
+
+    std::array<RefCntAutoPtr<IBuffer>, NumOutputValues> pStaticCBs;
+    for (Uint32 i = 0; i < NumOutputValues; ++i)
+    {
+        const Uint32 StaticData[4] = {StaticValue * (i + 1), i, 0, 0};
+        BufferDesc   BuffDesc{"Descriptor commit stats test CB", sizeof(StaticData), BIND_UNIFORM_BUFFER, USAGE_DEFAULT};
+        BufferData   InitData{StaticData, sizeof(StaticData)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pStaticCBs[i]);
+        ASSERT_NE(pStaticCBs[i], nullptr);
+    }
+
+    std::array<RefCntAutoPtr<ITexture>, 2> pTextures;
+    for (Uint32 i = 0; i < pTextures.size(); ++i)
+    {
+        const Uint8 TexData[4] = {static_cast<Uint8>(3 + i), 0, 0, 0};
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Descriptor commit stats test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.Width     = 1;
+        TexDesc.Height    = 1;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+        TextureSubResData SubResData{TexData, sizeof(TexData)};
+        TextureData       InitData{&SubResData, 1};
+        pDevice->CreateTexture(TexDesc, &InitData, &pTextures[i]);
+        ASSERT_NE(pTextures[i], nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pOutputBuffer;
+    {
+        const std::array<Uint32, NumOutputValues> ZeroData{};
+
+        BufferDesc BuffDesc{"Descriptor commit stats test output", sizeof(ZeroData), BIND_UNORDERED_ACCESS, USAGE_DEFAULT};
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+
+        BufferData InitData{ZeroData.data(), sizeof(ZeroData)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pOutputBuffer);
+        ASSERT_NE(pOutputBuffer, nullptr);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Texture")->Set(pTextures[0]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutputBuffer->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+    IShaderResourceVariable* pStaticCBVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "cbStatic");
+
+    pContext->SetPipelineState(pPSO);
+
+    DescriptorCommitStatsVk StartStats;
+    pContextVk->GetDescriptorCommitStats(StartStats);
+
+    // Statistics after the first dispatch and before the mutable texture is changed
+    DescriptorCommitStatsVk FirstStats;
+    DescriptorCommitStatsVk BeforeChangeStats;
+
+    // Dispatches with the same SRB must not rewrite the static/mutable descriptors
+    constexpr Uint32 NumDispatchesPerOutput = 4;
+    constexpr Uint32 NumDispatches          = NumOutputValues * NumDispatchesPerOutput;
+    for (Uint32 i = 0; i < NumOutputValues; ++i)
+    {
+        if (i == NumOutputValues / 2)
+        {
+            pContextVk->GetDescriptorCommitStats(BeforeChangeStats);
+            pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Texture")->Set(pTextures[1]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+        }
+
+        pStaticCBVar->Set(pStaticCBs[i], SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+        for (Uint32 d = 0; d < NumDispatchesPerOutput; ++d)
+        {
+            pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+            if (i == 0 && d == 0)
+                pContextVk->GetDescriptorCommitStats(FirstStats);
+        }
+    }
+
+    DescriptorCommitStatsVk FinalStats;
+    pContextVk->GetDescriptorCommitStats(FinalStats);
+
+    std::array<Uint32, NumOutputValues> RefValues{};
+    for (Uint32 i = 0; i < NumOutputValues; ++i)
+        RefValues[i] = StaticValue * (i + 1) + (i < NumOutputValues / 2 ? 3 : 4);
+    VerifyBufferContents(pOutputBuffer, RefValues);
+
+    const auto Delta = [&StartStats](const DescriptorCommitStatsVk& Stats, Uint64 DescriptorCommitStatsVk::*Member) {
+        return Stats.*Member - StartStats.*Member;
+    };
+
+    EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::SkippedCommands), 0u);
+    if (UseDescriptorBuffer)
+    {
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorSetsAllocated), 0u);
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorSetWrites), 0u);
+
+        // Only the dynamic set is written for every dispatch: the same number of
+        // descriptors as the descriptor set path writes.
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorBufferWrites), NumDispatches);
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorBufferBinds), NumDispatches);
+
+        // The static/mutable set is written by the first dispatch that follows a change of any of its variables:
+        // once for every constant buffer, and the texture changes together with the third one.
+        const Uint64 PersistentSetWrites = Delta(FirstStats, &DescriptorCommitStatsVk::PersistentDescriptorBufferWrites);
+        EXPECT_GT(PersistentSetWrites, 0u);
+        EXPECT_EQ(Delta(BeforeChangeStats, &DescriptorCommitStatsVk::PersistentDescriptorBufferWrites), PersistentSetWrites * (NumOutputValues / 2));
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::PersistentDescriptorBufferWrites), PersistentSetWrites * NumOutputValues);
+    }
+    else
+    {
+        // A dynamic set with a single descriptor is allocated and written for every dispatch
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorSetsAllocated), NumDispatches);
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorSetWrites), NumDispatches);
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::DescriptorBufferWrites), 0u);
+        EXPECT_EQ(Delta(FinalStats, &DescriptorCommitStatsVk::PersistentDescriptorBufferWrites), 0u);
+    }
+}
+
+} // namespace
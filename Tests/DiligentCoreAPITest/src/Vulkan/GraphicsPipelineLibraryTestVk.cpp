@@ -0,0 +1,230 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "PipelineStateVk.h"
+#include "TestingSwapChainBase.hpp"
+#include "Timer.hpp"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+#include "gtest/gtest.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void DrawProceduralTriangles(IPipelineState* pPSO)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    const float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+
+    pSwapChain->Present();
+
+    pContext->Flush();
+    pContext->InvalidateState();
+}
+
+// Creates pipelines that share shaders but differ in states that do not affect the output,
+// so that every pipeline is linked from a mix of new and cached library parts.
+TEST(GraphicsPipelineLibraryTest, LinkedPipelines)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    if (!pDeviceVk)
+    {
+        GTEST_SKIP() << "This test requires Vulkan device";
+    }
+
+    DeviceFeaturesVk FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+    if (FeaturesVk.GraphicsPipelineLibrary != DEVICE_FEATURE_STATE_ENABLED)
+    {
+        GTEST_SKIP() << "Graphics pipeline library is not enabled on this device. Use --Features.GraphicsPipelineLibrary=On to enable it.";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc       = {"Graphics pipeline library test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc       = {"Graphics pipeline library test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    constexpr COMPARISON_FUNCTION DepthFuncs[]    = {COMPARISON_FUNC_LESS, COMPARISON_FUNC_GREATER, COMPARISON_FUNC_EQUAL, COMPARISON_FUNC_ALWAYS};
+    constexpr Int32               DepthBiases[]   = {0, 1, 2, 4};
+    constexpr BLEND_FACTOR        BlendFactors[]  = {BLEND_FACTOR_ONE, BLEND_FACTOR_SRC_ALPHA};
+    constexpr size_t              NumPermutations = _countof(DepthFuncs) * _countof(DepthBiases) * _countof(BlendFactors);
+
+    GraphicsPipelineLibraryStatsVk StartStats;
+    pDeviceVk->GetGraphicsPipelineLibraryStats(StartStats);
+
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs;
+    PSOs.reserve(NumPermutations);
+
+    Timer T;
+    for (COMPARISON_FUNCTION DepthFunc : DepthFuncs)
+    {
+        for (Int32 DepthBias : DepthBiases)
+        {
+            for (BLEND_FACTOR BlendFactor : BlendFactors)
+            {
+                GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+                PipelineStateDesc&    PSODesc          = PSOCreateInfo.PSODesc;
+                GraphicsPipelineDesc& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+                PSODesc.Name = "Graphics pipeline library test";
+
+                GraphicsPipeline.NumRenderTargets             = 1;
+                GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+                GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+                GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+                GraphicsPipeline.RasterizerDesc.DepthBias     = DepthBias;
+                GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+                GraphicsPipeline.DepthStencilDesc.DepthFunc   = DepthFunc;
+
+                RenderTargetBlendDesc& RT0 = GraphicsPipeline.BlendDesc.RenderTargets[0];
+                RT0.BlendEnable            = False;
+                RT0.SrcBlend               = BlendFactor;
+
+                PSOCreateInfo.pVS = pVS;
+                PSOCreateInfo.pPS = pPS;
+
+                RefCntAutoPtr<IPipelineState> pPSO;
+                pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+                ASSERT_NE(pPSO, nullptr);
+                PSOs.emplace_back(std::move(pPSO));
+            }
+        }
+    }
+    LOG_INFO_MESSAGE("Created ", PSOs.size(), " linked pipelines in ", T.GetElapsedTime() * 1000, " ms");
+
+    // Every pipeline requests four library parts. Only the parts that depend on the states that
+    // differ between the pipelines are compiled: one vertex input part, a pre-rasterization part per
+    // depth bias, a fragment shader part per depth function and a fragment output part per blend factor.
+    constexpr Uint64 NumUniqueLibraries = 1 + _countof(DepthBiases) + _countof(DepthFuncs) + _countof(BlendFactors);
+    {
+        GraphicsPipelineLibraryStatsVk Stats;
+        pDeviceVk->GetGraphicsPipelineLibraryStats(Stats);
+        EXPECT_EQ(Stats.Misses - StartStats.Misses, NumUniqueLibraries);
+        EXPECT_EQ(Stats.Hits - StartStats.Hits, NumPermutations * 4 - NumUniqueLibraries);
+        EXPECT_EQ(Stats.NumLibraries - StartStats.NumLibraries, NumUniqueLibraries);
+    }
+
+    std::vector<VkPipeline> FastLinkedPipelines;
+    for (IPipelineState* pPSO : PSOs)
+    {
+        FastLinkedPipelines.push_back(RefCntAutoPtr<IPipelineStateVk> { pPSO, IID_PipelineStateVk }->GetVkPipeline());
+        DrawProceduralTriangles(pPSO);
+    }
+
+    if (pDevice->GetShaderCompilationThreadPool() != nullptr)
+    {
+        // Wait until the pipelines are re-linked with link-time optimization and test them again.
+        for (size_t i = 0; i < PSOs.size(); ++i)
+        {
+            RefCntAutoPtr<IPipelineStateVk> pPSOVk{PSOs[i], IID_PipelineStateVk};
+
+            Timer WaitTimer;
+            while (pPSOVk->GetVkPipeline() == FastLinkedPipelines[i] && WaitTimer.GetElapsedTime() < 10.0)
+                std::this_thread::yield();
+
+            EXPECT_NE(pPSOVk->GetVkPipeline(), FastLinkedPipelines[i]) << "Optimized pipeline was not linked in time";
+            DrawProceduralTriangles(PSOs[i]);
+        }
+    }
+
+    // Library parts are evicted from the cache when the last pipeline that uses them is released
+    PSOs.resize(1);
+    {
+        GraphicsPipelineLibraryStatsVk Stats;
+        pDeviceVk->GetGraphicsPipelineLibraryStats(Stats);
+        EXPECT_EQ(Stats.Evictions - StartStats.Evictions, NumUniqueLibraries - 4);
+        EXPECT_EQ(Stats.NumLibraries - StartStats.NumLibraries, 4u);
+    }
+
+    PSOs.clear();
+    {
+        GraphicsPipelineLibraryStatsVk Stats;
+        pDeviceVk->GetGraphicsPipelineLibraryStats(Stats);
+        EXPECT_EQ(Stats.Evictions - StartStats.Evictions, NumUniqueLibraries);
+        EXPECT_EQ(Stats.NumLibraries, StartStats.NumLibraries);
+    }
+}
+
+} // namespace
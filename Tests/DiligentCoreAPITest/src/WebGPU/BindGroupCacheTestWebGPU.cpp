@@ -0,0 +1,257 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+
+#include "WebGPU/TestingEnvironmentWebGPU.hpp"
+
+#include "RenderDeviceWebGPU.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const std::string BindGroupCacheTestCS = R"(
+cbuffer cbData
+{
+    uint4 g_Data;
+}
+
+RWStructuredBuffer<uint> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[0] = g_Data.x;
+}
+)";
+
+// All variables are mutable, so every SRB uses a single bind group
+class BindGroupCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto* pEnv    = GPUTestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+
+        m_pDeviceWebGPU = RefCntAutoPtr<IRenderDeviceWebGPU>{pDevice, IID_RenderDeviceWebGPU};
+        if (!m_pDeviceWebGPU)
+        {
+            GTEST_SKIP() << "This test requires WebGPU device";
+        }
+
+        if (GetStats().MaxEntries == 0)
+        {
+            GTEST_SKIP() << "Bind group cache is disabled";
+        }
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.Desc           = {"Bind group cache test CS", SHADER_TYPE_COMPUTE, true};
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = BindGroupCacheTestCS.c_str();
+
+        RefCntAutoPtr<IShader> pCS;
+        pDevice->CreateShader(ShaderCI, &pCS);
+        ASSERT_NE(pCS, nullptr);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = "Bind group cache test";
+        PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        PSOCreateInfo.pCS                                        = pCS;
+
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &m_pPSO);
+        ASSERT_NE(m_pPSO, nullptr);
+
+        BufferDesc BuffDesc{"Bind group cache test output", sizeof(Uint32), BIND_UNORDERED_ACCESS, USAGE_DEFAULT};
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pOutput);
+        ASSERT_NE(m_pOutput, nullptr);
+    }
+
+    void TearDown() override
+    {
+        m_pPSO.Release();
+        m_pOutput.Release();
+        m_pDeviceWebGPU.Release();
+    }
+
+    BindGroupCacheStatsWebGPU GetStats() const
+    {
+        BindGroupCacheStatsWebGPU Stats;
+        m_pDeviceWebGPU->GetBindGroupCacheStats(Stats);
+        return Stats;
+    }
+
+    RefCntAutoPtr<IBuffer> CreateConstantBuffer(Uint32 Value) const
+    {
+        const Uint32 Data[4] = {Value, 0, 0, 0};
+        return GPUTestingEnvironment::GetInstance()->CreateBuffer({"Bind group cache test CB", sizeof(Data), BIND_UNIFORM_BUFFER, USAGE_DEFAULT}, Data);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> CreateSRB() const
+    {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        m_pPSO->CreateShaderResourceBinding(&pSRB, true);
+        if (pSRB)
+            pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(m_pOutput->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        return pSRB;
+    }
+
+    // Bind groups are requested from the cache when the resources are committed for the dispatch
+    void Dispatch(IShaderResourceBinding* pSRB, IBuffer* pCB) const
+    {
+        auto* pContext = GPUTestingEnvironment::GetInstance()->GetDeviceContext();
+
+        pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "cbData")->Set(pCB);
+        pContext->SetPipelineState(m_pPSO);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+    }
+
+    RefCntAutoPtr<IRenderDeviceWebGPU> m_pDeviceWebGPU;
+    RefCntAutoPtr<IPipelineState>      m_pPSO;
+    RefCntAutoPtr<IBuffer>             m_pOutput;
+};
+
+TEST_F(BindGroupCacheTest, HitsAndMisses)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IBuffer> pCB0 = CreateConstantBuffer(0);
+    RefCntAutoPtr<IBuffer> pCB1 = CreateConstantBuffer(1);
+    ASSERT_TRUE(pCB0 && pCB1);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB0 = CreateSRB();
+    RefCntAutoPtr<IShaderResourceBinding> pSRB1 = CreateSRB();
+    ASSERT_TRUE(pSRB0 && pSRB1);
+
+    const BindGroupCacheStatsWebGPU Before = GetStats();
+
+    Dispatch(pSRB0, pCB0);
+    Dispatch(pSRB0, pCB1);
+    {
+        const BindGroupCacheStatsWebGPU Stats = GetStats();
+        EXPECT_EQ(Stats.Misses - Before.Misses, 2u);
+        EXPECT_EQ(Stats.Hits - Before.Hits, 0u);
+    }
+
+    // The bind group created for the first dispatch is reused
+    Dispatch(pSRB0, pCB0);
+    {
+        const BindGroupCacheStatsWebGPU Stats = GetStats();
+        EXPECT_EQ(Stats.Misses - Before.Misses, 2u);
+        EXPECT_EQ(Stats.Hits - Before.Hits, 1u);
+    }
+
+    // Another SRB with the same resources also reuses it
+    Dispatch(pSRB1, pCB0);
+    {
+        const BindGroupCacheStatsWebGPU Stats = GetStats();
+        EXPECT_EQ(Stats.Misses - Before.Misses, 2u);
+        EXPECT_EQ(Stats.Hits - Before.Hits, 2u);
+    }
+}
+
+TEST_F(BindGroupCacheTest, Eviction)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB = CreateSRB();
+    ASSERT_NE(pSRB, nullptr);
+
+    const BindGroupCacheStatsWebGPU Before = GetStats();
+
+    // One bind group more than the cache can hold
+    std::vector<RefCntAutoPtr<IBuffer>> CBs(Before.MaxEntries + 1);
+    for (Uint32 i = 0; i < CBs.size(); ++i)
+    {
+        CBs[i] = CreateConstantBuffer(i);
+        ASSERT_NE(CBs[i], nullptr);
+        Dispatch(pSRB, CBs[i]);
+    }
+
+    const BindGroupCacheStatsWebGPU Stats = GetStats();
+    EXPECT_EQ(Stats.Misses - Before.Misses, CBs.size());
+    EXPECT_EQ(Stats.Evictions - Before.Evictions, Before.NumEntries + 1);
+    EXPECT_EQ(Stats.NumEntries, Stats.MaxEntries);
+}
+
+TEST_F(BindGroupCacheTest, Invalidation)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IBuffer> pCB0 = CreateConstantBuffer(0);
+    RefCntAutoPtr<IBuffer> pCB1 = CreateConstantBuffer(1);
+    ASSERT_TRUE(pCB0 && pCB1);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB = CreateSRB();
+    ASSERT_NE(pSRB, nullptr);
+
+    Dispatch(pSRB, pCB1);
+    Dispatch(pSRB, pCB0);
+
+    // The entry that uses the destroyed buffer is removed
+    {
+        const BindGroupCacheStatsWebGPU Before = GetStats();
+
+        pCB1.Release();
+        pEnv->ReleaseResources();
+
+        const BindGroupCacheStatsWebGPU Stats = GetStats();
+        EXPECT_EQ(Stats.Invalidations - Before.Invalidations, 1u);
+        EXPECT_EQ(Stats.NumEntries, Before.NumEntries - 1);
+    }
+
+    // The entry that uses the layout of the destroyed pipeline is removed,
+    // even though the buffers it references are still alive
+    {
+        const BindGroupCacheStatsWebGPU Before = GetStats();
+
+        pSRB.Release();
+        m_pPSO.Release();
+        pContext->InvalidateState();
+        pEnv->ReleaseResources();
+
+        const BindGroupCacheStatsWebGPU Stats = GetStats();
+        EXPECT_EQ(Stats.Invalidations - Before.Invalidations, 1u);
+        EXPECT_EQ(Stats.NumEntries, Before.NumEntries - 1);
+    }
+}
+
+} // namespace
@@ -111,6 +111,13 @@ int TestRenderDeviceCInterface_CreateBuffer(struct IRenderDevice* pRenderDevice)
     else
         ++num_errors;
 
+    pBuffer = NULL;
+    IRenderDevice_CreateBuffers(pRenderDevice, 1, &BuffDesc, &InitData, &pBuffer);
+    if (pBuffer != NULL)
+        IObject_Release(pBuffer);
+    else
+        ++num_errors;
+
     free(pData);
 
     return num_errors;
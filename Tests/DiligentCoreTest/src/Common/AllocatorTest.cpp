@@ -289,4 +289,43 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_DynamicLinearAllocator, Discard)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+    EXPECT_EQ(Allocator.GetBlockAllocationCount(), size_t{0});
+
+    // Simulate several frames that allocate the same amount of memory
+    size_t FirstFrameAllocationCount = 0;
+    for (Uint32 Frame = 0; Frame < 4; ++Frame)
+    {
+        for (size_t i = 0; i < 16; ++i)
+        {
+            auto* pData = Allocator.ConstructArray<Uint64>(8 + i, Uint64{i});
+            ASSERT_NE(pData, nullptr);
+            EXPECT_EQ(pData[0], Uint64{i});
+        }
+        Allocator.Discard();
+
+        // After the first frame, all memory must be reused
+        if (Frame == 0)
+        {
+            FirstFrameAllocationCount = Allocator.GetBlockAllocationCount();
+            EXPECT_GT(FirstFrameAllocationCount, size_t{1});
+        }
+        else
+        {
+            EXPECT_EQ(Allocator.GetBlockAllocationCount(), FirstFrameAllocationCount);
+        }
+    }
+
+    // Allocation that does not fit into any existing block
+    const size_t BlockCount = Allocator.GetBlockCount();
+    EXPECT_NE(Allocator.Allocate(1024, 16), nullptr);
+    EXPECT_EQ(Allocator.GetBlockAllocationCount(), BlockCount + 1);
+
+    Allocator.Free();
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{0});
+    EXPECT_EQ(Allocator.GetBlockAllocationCount(), BlockCount + 1);
+}
+
 } // namespace
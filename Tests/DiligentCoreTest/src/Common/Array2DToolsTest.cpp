@@ -27,10 +27,14 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 using namespace Diligent;
 
@@ -111,4 +115,238 @@ TEST(Common_Array2DTools, GetArray2DMinMaxValue)
     }
 }
 
+
+float HalfBitsToFloat(Uint16 h)
+{
+    const float Sign = (h & 0x8000u) != 0 ? -1.f : +1.f;
+    const int   Exp  = (h >> 10) & 0x1F;
+    const int   Mant = h & 0x3FF;
+    return Exp == 0 ?
+        Sign * std::ldexp(static_cast<float>(Mant), -24) :
+        Sign * std::ldexp(static_cast<float>(1024 + Mant), Exp - 25);
+}
+
+// Test 2D array with an element type of float, half or uint16
+struct TestArray2D
+{
+    TestArray2D(VALUE_TYPE Type, Uint32 Width, Uint32 Height, Uint32 StridePadding, FastRand::StateType Seed) :
+        Rnd{Seed}
+    {
+        Desc.ValueType = Type;
+        Desc.Width     = Width;
+        Desc.Height    = Height;
+        Desc.Stride    = (size_t{Width} + StridePadding) * (Type == VT_FLOAT32 ? 4 : 2);
+        Data.resize(Desc.Stride * Height / 2);
+        Desc.pData = Data.data();
+
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width; ++x)
+                Randomize(x, y);
+        }
+    }
+
+    void Randomize(Uint32 x, Uint32 y)
+    {
+        // FastRand generates 15-bit values
+        Uint16 Val = static_cast<Uint16>((Rnd() << 8) ^ Rnd());
+        if (Desc.ValueType == VT_FLOAT16)
+        {
+            // Avoid infinities and NaNs
+            if (((Val >> 10) & 0x1F) == 0x1F)
+                Val &= ~Uint16{0x400};
+        }
+        Set(x, y, Val);
+    }
+
+    void Set(Uint32 x, Uint32 y, Uint16 Val)
+    {
+        auto* pRow = reinterpret_cast<Uint8*>(Data.data()) + y * Desc.Stride;
+        if (Desc.ValueType == VT_FLOAT32)
+            reinterpret_cast<float*>(pRow)[x] = static_cast<float>(static_cast<Int16>(Val)) * 0.125f;
+        else
+            reinterpret_cast<Uint16*>(pRow)[x] = Val;
+    }
+
+    float Get(Uint32 x, Uint32 y) const
+    {
+        const auto* pRow = static_cast<const Uint8*>(Desc.pData) + y * Desc.Stride;
+        switch (Desc.ValueType)
+        {
+            case VT_FLOAT32: return reinterpret_cast<const float*>(pRow)[x];
+            case VT_FLOAT16: return HalfBitsToFloat(reinterpret_cast<const Uint16*>(pRow)[x]);
+            case VT_UINT16: return static_cast<float>(reinterpret_cast<const Uint16*>(pRow)[x]);
+            default: return 0;
+        }
+    }
+
+    void GetRefMinMax(Uint32 x0, Uint32 y0, Uint32 x1, Uint32 y1, float& Min, float& Max) const
+    {
+        Min = +INFINITY;
+        Max = -INFINITY;
+        for (Uint32 y = y0; y < std::min(y1, Desc.Height); ++y)
+        {
+            for (Uint32 x = x0; x < std::min(x1, Desc.Width); ++x)
+            {
+                const float Val = Get(x, y);
+                // Compare -0 and +0 as different values to match the bitwise ordering of halfs
+                if (Val < Min || (Val == Min && std::signbit(Val)))
+                    Min = Val;
+                if (Val > Max || (Val == Max && !std::signbit(Val)))
+                    Max = Val;
+            }
+        }
+    }
+
+    Array2DDesc         Desc;
+    std::vector<Uint16> Data;
+    FastRand            Rnd;
+};
+
+constexpr VALUE_TYPE TestValueTypes[] = {VT_FLOAT32, VT_FLOAT16, VT_UINT16};
+
+TEST(Common_Array2DTools, GetArray2DMinMaxValueTyped)
+{
+    for (auto ValueType : TestValueTypes)
+    {
+        for (Uint32 test = 0; test < 64; ++test)
+        {
+            const Uint32 Width  = 1 + test * 3;
+            const Uint32 Height = 1 + test % 7;
+
+            TestArray2D Array{ValueType, Width, Height, test % 3, test};
+
+            float RefMin, RefMax;
+            Array.GetRefMinMax(0, 0, Width, Height, RefMin, RefMax);
+
+            float Min, Max;
+            GetArray2DMinMaxValue(Array.Desc, Min, Max);
+            EXPECT_EQ(Min, RefMin) << GetValueTypeString(ValueType) << ' ' << Width << 'x' << Height;
+            EXPECT_EQ(Max, RefMax) << GetValueTypeString(ValueType) << ' ' << Width << 'x' << Height;
+        }
+    }
+}
+
+void VerifyPyramid(const Array2DMinMaxPyramid& Pyramid, const TestArray2D& Array, Uint32 TileSize)
+{
+    ASSERT_GT(Pyramid.GetLevelCount(), 0u);
+    EXPECT_EQ(Pyramid.GetLevelWidth(Pyramid.GetLevelCount() - 1), 1u);
+    EXPECT_EQ(Pyramid.GetLevelHeight(Pyramid.GetLevelCount() - 1), 1u);
+
+    for (Uint32 Level = 0; Level < Pyramid.GetLevelCount(); ++Level)
+    {
+        const Uint32 TexelSize = TileSize << Level;
+        for (Uint32 y = 0; y < Pyramid.GetLevelHeight(Level); ++y)
+        {
+            for (Uint32 x = 0; x < Pyramid.GetLevelWidth(Level); ++x)
+            {
+                float RefMin, RefMax;
+                Array.GetRefMinMax(x * TexelSize, y * TexelSize, (x + 1) * TexelSize, (y + 1) * TexelSize, RefMin, RefMax);
+                ASSERT_EQ(Pyramid.GetMin(Level, x, y), RefMin) << "Level " << Level << " (" << x << ", " << y << ')';
+                ASSERT_EQ(Pyramid.GetMax(Level, x, y), RefMax) << "Level " << Level << " (" << x << ", " << y << ')';
+            }
+        }
+    }
+}
+
+TEST(Common_Array2DTools, MinMaxPyramidBuild)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (auto ValueType : TestValueTypes)
+    {
+        for (Uint32 TileSize : {1, 3, 8})
+        {
+            for (Uint32 test = 0; test < 8; ++test)
+            {
+                const Uint32 Width  = 1 + test * 13;
+                const Uint32 Height = 1 + test * 9 + TileSize;
+
+                TestArray2D Array{ValueType, Width, Height, test % 2, test};
+
+                Array2DMinMaxPyramid Pyramid;
+                Pyramid.Build(Array.Desc, TileSize, test % 2 ? pThreadPool.RawPtr() : nullptr);
+                EXPECT_EQ(Pyramid.GetLevelWidth(0), (Width + TileSize - 1) / TileSize);
+                EXPECT_EQ(Pyramid.GetLevelHeight(0), (Height + TileSize - 1) / TileSize);
+                VerifyPyramid(Pyramid, Array, TileSize);
+            }
+        }
+    }
+}
+
+TEST(Common_Array2DTools, MinMaxPyramidUpdate)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (auto ValueType : TestValueTypes)
+    {
+        for (Uint32 TileSize : {1, 4})
+        {
+            constexpr Uint32 Width  = 67;
+            constexpr Uint32 Height = 45;
+
+            TestArray2D Array{ValueType, Width, Height, 0, TileSize};
+
+            Array2DMinMaxPyramid Pyramid;
+            Pyramid.Build(Array.Desc, TileSize);
+
+            FastRandInt Rnd{TileSize, 0, 1000};
+            for (Uint32 test = 0; test < 16; ++test)
+            {
+                const Uint32 Left   = Rnd() % Width;
+                const Uint32 Top    = Rnd() % Height;
+                const Uint32 Right  = std::min(Left + 1 + Rnd() % 20, Width);
+                const Uint32 Bottom = std::min(Top + 1 + Rnd() % 20, Height);
+                for (Uint32 y = Top; y < Bottom; ++y)
+                {
+                    for (Uint32 x = Left; x < Right; ++x)
+                        Array.Randomize(x, y);
+                }
+
+                Pyramid.Update(Array.Desc, Left, Top, Right, Bottom, test % 2 ? pThreadPool.RawPtr() : nullptr);
+                VerifyPyramid(Pyramid, Array, TileSize);
+            }
+        }
+    }
+}
+
+TEST(Common_Array2DTools, DISABLED_MinMaxPyramidPerformance)
+{
+    constexpr Uint32 Width  = 4096;
+    constexpr Uint32 Height = 4096;
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 1u)});
+    for (auto ValueType : {VT_FLOAT32, VT_FLOAT16})
+    {
+        TestArray2D Array{ValueType, Width, Height, 0, 0};
+
+        Array2DMinMaxPyramid Pyramid;
+        for (auto* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            Timer T;
+            Pyramid.Build(Array.Desc, 1, pPool);
+            const auto BuildTime = T.GetElapsedTime();
+
+            T.Restart();
+            constexpr Uint32 NumUpdates = 1000;
+            for (Uint32 i = 0; i < NumUpdates; ++i)
+            {
+                const Uint32 x = (i * 997) % (Width - 64);
+                const Uint32 y = (i * 463) % (Height - 64);
+                Pyramid.Update(Array.Desc, x, y, x + 64, y + 64, pPool);
+            }
+            const auto UpdateTime = T.GetElapsedTime() / NumUpdates;
+
+            LOG_INFO_MESSAGE("Min/max pyramid ", GetValueTypeString(ValueType), ' ', Width, 'x', Height,
+                             (pPool != nullptr ? " (thread pool)" : ""), ": build ", BuildTime * 1000, " ms; 64x64 update ",
+                             UpdateTime * 1e6, " us");
+        }
+
+        float Min, Max;
+        Timer T;
+        GetArray2DMinMaxValue(Array.Desc, Min, Max);
+        LOG_INFO_MESSAGE("GetArray2DMinMaxValue ", GetValueTypeString(ValueType), ' ', Width, 'x', Height, ": ", T.GetElapsedTime() * 1000, " ms");
+        EXPECT_EQ(Min, Pyramid.GetMin(Pyramid.GetLevelCount() - 1, 0, 0));
+        EXPECT_EQ(Max, Pyramid.GetMax(Pyramid.GetLevelCount() - 1, 0, 0));
+    }
+}
+
 } // namespace
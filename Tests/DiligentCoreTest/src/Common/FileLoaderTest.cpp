@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FileLoader.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "TempDirectory.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+
+#if PLATFORM_LINUX
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/resource.h>
+#endif
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::vector<Uint8> MakeFileData(size_t Size, Uint32 Seed)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>((i * 13 + Seed * 101 + (i >> 10)) & 0xFF);
+    return Data;
+}
+
+class TestFileSet
+{
+public:
+    TestFileSet(const std::string& Dir, const std::vector<size_t>& Sizes)
+    {
+        for (size_t i = 0; i < Sizes.size(); ++i)
+        {
+            m_Paths.emplace_back(Dir + FileSystem::SlashSymbol + "File" + std::to_string(i) + ".bin");
+            m_Data.emplace_back(MakeFileData(Sizes[i], static_cast<Uint32>(i)));
+
+            FileWrapper File{m_Paths.back().c_str(), EFileAccessMode::Overwrite};
+            EXPECT_TRUE(File);
+            if (File && !m_Data.back().empty())
+                EXPECT_TRUE(File->Write(m_Data.back().data(), m_Data.back().size()));
+        }
+        // Missing file
+        m_Paths.emplace_back(Dir + FileSystem::SlashSymbol + "Missing.bin");
+
+        for (const auto& Path : m_Paths)
+            m_pPaths.push_back(Path.c_str());
+    }
+
+    Uint32             GetNumFiles() const { return static_cast<Uint32>(m_pPaths.size()); }
+    const Char* const* GetPaths() const { return m_pPaths.data(); }
+
+    void Verify(const std::vector<RefCntAutoPtr<IDataBlob>>& Blobs) const
+    {
+        ASSERT_EQ(Blobs.size(), m_Paths.size());
+        for (size_t i = 0; i < m_Data.size(); ++i)
+        {
+            ASSERT_NE(Blobs[i], nullptr) << m_Paths[i];
+            ASSERT_EQ(Blobs[i]->GetSize(), m_Data[i].size()) << m_Paths[i];
+            if (!m_Data[i].empty())
+                EXPECT_EQ(memcmp(Blobs[i]->GetConstDataPtr(), m_Data[i].data(), m_Data[i].size()), 0) << m_Paths[i];
+        }
+        EXPECT_EQ(Blobs.back(), nullptr);
+    }
+
+private:
+    std::vector<std::string>        m_Paths;
+    std::vector<const Char*>        m_pPaths;
+    std::vector<std::vector<Uint8>> m_Data;
+};
+
+TEST(Common_FileLoader, LoadFiles)
+{
+    TempDirectory TmpDir;
+    TestFileSet   Files{TmpDir.Get(), {0, 1, 100, 4096, 4097, 65536, 1 << 20, 3 << 20}};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (auto* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        // Small queue depth exercises resubmission of the pending requests
+        for (Uint32 QueueDepth : {1u, 64u})
+        {
+            std::vector<RefCntAutoPtr<IDataBlob>> Blobs(Files.GetNumFiles());
+            std::vector<int>                      CallCount(Files.GetNumFiles());
+            std::mutex                            Mtx;
+
+            LoadFilesAttribs Attribs;
+            Attribs.ppPaths     = Files.GetPaths();
+            Attribs.NumFiles    = Files.GetNumFiles();
+            Attribs.QueueDepth  = QueueDepth;
+            Attribs.pThreadPool = pPool;
+            Attribs.Callback    = [&](Uint32 FileIndex, IDataBlob* pData) {
+                std::lock_guard<std::mutex> Lock{Mtx};
+                Blobs[FileIndex] = pData;
+                ++CallCount[FileIndex];
+            };
+            LoadFiles(Attribs);
+
+            Files.Verify(Blobs);
+            for (int Count : CallCount)
+                EXPECT_EQ(Count, 1);
+        }
+    }
+}
+
+TEST(Common_FileLoader, LoadFilesAsync)
+{
+    TempDirectory TmpDir;
+    TestFileSet   Files{TmpDir.Get(), {10, 1000, 100000}};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+
+    std::vector<RefCntAutoPtr<IDataBlob>> Blobs(Files.GetNumFiles());
+    std::mutex                            Mtx;
+
+    RefCntAutoPtr<IAsyncTask> pTask;
+    {
+        // The paths are copied by LoadFilesAsync
+        std::vector<std::string> Paths{Files.GetPaths(), Files.GetPaths() + Files.GetNumFiles()};
+        std::vector<const Char*> pPaths;
+        for (const auto& Path : Paths)
+            pPaths.push_back(Path.c_str());
+
+        LoadFilesAttribs Attribs;
+        Attribs.ppPaths     = pPaths.data();
+        Attribs.NumFiles    = static_cast<Uint32>(pPaths.size());
+        Attribs.pThreadPool = pThreadPool;
+        Attribs.Callback    = [&](Uint32 FileIndex, IDataBlob* pData) {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            Blobs[FileIndex] = pData;
+        };
+        pTask = LoadFilesAsync(Attribs);
+        ASSERT_NE(pTask, nullptr);
+    }
+    pTask->WaitForCompletion();
+    EXPECT_EQ(pTask->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+
+    Files.Verify(Blobs);
+}
+
+#if PLATFORM_LINUX
+TEST(Common_FileLoader, LowDescriptorLimit)
+{
+    constexpr Uint32 NumFiles = 500;
+
+    TempDirectory TmpDir;
+    TestFileSet   Files{TmpDir.Get(), std::vector<size_t>(NumFiles, 100)};
+
+    // The lowest free descriptor approximates the number of descriptors in use
+    const int NullFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    ASSERT_GE(NullFd, 0);
+    close(NullFd);
+
+    rlimit OrigLimit{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &OrigLimit), 0);
+
+    // Allow fewer descriptors than the queue depth so that some opens fail with EMFILE
+    rlimit Limit   = OrigLimit;
+    Limit.rlim_cur = std::min(OrigLimit.rlim_cur, static_cast<rlim_t>(NullFd + 16));
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &Limit), 0);
+
+    std::vector<RefCntAutoPtr<IDataBlob>> Blobs(Files.GetNumFiles());
+
+    LoadFilesAttribs Attribs;
+    Attribs.ppPaths    = Files.GetPaths();
+    Attribs.NumFiles   = Files.GetNumFiles();
+    Attribs.QueueDepth = 64;
+    Attribs.Callback   = [&](Uint32 FileIndex, IDataBlob* pData) {
+        Blobs[FileIndex] = pData;
+    };
+    LoadFiles(Attribs);
+
+    EXPECT_EQ(setrlimit(RLIMIT_NOFILE, &OrigLimit), 0);
+
+    Files.Verify(Blobs);
+}
+#endif
+
+TEST(Common_FileLoader, DISABLED_Performance)
+{
+    constexpr Uint32 NumFiles = 4000;
+
+    TempDirectory TmpDir;
+    TestFileSet   Files{TmpDir.Get(), std::vector<size_t>(NumFiles, 8192)};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 1u)});
+
+    {
+        Timer  T;
+        size_t TotalSize = 0;
+        for (Uint32 i = 0; i < NumFiles; ++i)
+        {
+            FileWrapper File{Files.GetPaths()[i], EFileAccessMode::Read};
+            ASSERT_TRUE(File);
+            auto pData = DataBlobImpl::Create();
+            EXPECT_TRUE(File->Read(pData));
+            TotalSize += pData->GetSize();
+        }
+        LOG_INFO_MESSAGE("Read ", NumFiles, " files (", TotalSize >> 10, " KB) one at a time in ", T.GetElapsedTime() * 1000, " ms");
+    }
+
+    for (auto* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        std::atomic<size_t> TotalSize{0};
+
+        LoadFilesAttribs Attribs;
+        Attribs.ppPaths     = Files.GetPaths();
+        Attribs.NumFiles    = NumFiles;
+        Attribs.pThreadPool = pPool;
+        Attribs.Callback    = [&](Uint32 FileIndex, IDataBlob* pData) {
+            ASSERT_NE(pData, nullptr);
+            TotalSize.fetch_add(pData->GetSize());
+        };
+
+        Timer T;
+        LoadFiles(Attribs);
+        LOG_INFO_MESSAGE("Loaded ", NumFiles, " files (", TotalSize.load() >> 10, " KB) with LoadFiles",
+                         (IsAsyncFileReadSupported() ? " (asynchronous reads)" : ""), (pPool != nullptr ? " (thread pool)" : ""),
+                         " in ", T.GetElapsedTime() * 1000, " ms");
+    }
+}
+
+} // namespace
@@ -27,6 +27,14 @@
 
 #include "FilteringTools.hpp"
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+
 #include "gtest/gtest.h"
 
 using namespace Diligent;
@@ -292,4 +300,238 @@ TEST(Common_FilteringTools, FilterTexture2DBilinear)
     }
 }
 
+
+struct TestImage
+{
+    TestImage(VALUE_TYPE _Type, Uint32 _Width, Uint32 _Height, Uint32 _NumComponents) :
+        Type{_Type},
+        Width{_Width},
+        Height{_Height},
+        NumComponents{_NumComponents},
+        Stride{(size_t{Width} * NumComponents + 3) * (Type == VT_UINT8 ? 1 : sizeof(float))},
+        Data(Stride * Height / sizeof(float) + 1)
+    {}
+
+    void Randomize(FastRand::StateType Seed)
+    {
+        FastRandFloat Rnd{Seed, 0, 255};
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width * NumComponents; ++x)
+                Set(x, y, Rnd());
+        }
+    }
+
+    void Set(Uint32 i, Uint32 y, float Val)
+    {
+        auto* pRow = reinterpret_cast<Uint8*>(Data.data()) + y * Stride;
+        if (Type == VT_UINT8)
+            pRow[i] = static_cast<Uint8>(Val);
+        else
+            reinterpret_cast<float*>(pRow)[i] = Val;
+    }
+
+    float Get(Uint32 i, Uint32 y) const
+    {
+        const auto* pRow = reinterpret_cast<const Uint8*>(Data.data()) + y * Stride;
+        return Type == VT_UINT8 ? static_cast<float>(pRow[i]) : reinterpret_cast<const float*>(pRow)[i];
+    }
+
+    // Returns the source image component as a separate image that can be sampled by FilterTexture2DBilinear
+    std::vector<float> GetComponent(Uint32 c) const
+    {
+        std::vector<float> Component(size_t{Width} * Height);
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width; ++x)
+                Component[x + size_t{y} * Width] = Get(x * NumComponents + c, y);
+        }
+        return Component;
+    }
+
+    const VALUE_TYPE Type;
+    const Uint32     Width;
+    const Uint32     Height;
+    const Uint32     NumComponents;
+    const size_t     Stride;
+
+    std::vector<float> Data;
+};
+
+void Resample(const TestImage&     Src,
+              TestImage&           Dst,
+              RESAMPLE_FILTER      Filter,
+              TEXTURE_ADDRESS_MODE AddressModeU,
+              TEXTURE_ADDRESS_MODE AddressModeV,
+              IThreadPool*         pThreadPool = nullptr)
+{
+    ResampleImageAttribs Attribs;
+    Attribs.SrcWidth      = Src.Width;
+    Attribs.SrcHeight     = Src.Height;
+    Attribs.pSrcData      = Src.Data.data();
+    Attribs.SrcStride     = Src.Stride;
+    Attribs.DstWidth      = Dst.Width;
+    Attribs.DstHeight     = Dst.Height;
+    Attribs.pDstData      = Dst.Data.data();
+    Attribs.DstStride     = Dst.Stride;
+    Attribs.ComponentType = Src.Type;
+    Attribs.NumComponents = Src.NumComponents;
+    Attribs.Filter        = Filter;
+    Attribs.AddressModeU  = AddressModeU;
+    Attribs.AddressModeV  = AddressModeV;
+    Attribs.pThreadPool   = pThreadPool;
+    ResampleImage(Attribs);
+}
+
+template <TEXTURE_ADDRESS_MODE AddressModeU, TEXTURE_ADDRESS_MODE AddressModeV>
+void TestResampleBilinear(VALUE_TYPE Type, Uint32 NumComponents, Uint32 SrcWidth, Uint32 SrcHeight, Uint32 DstWidth, Uint32 DstHeight)
+{
+    TestImage Src{Type, SrcWidth, SrcHeight, NumComponents};
+    Src.Randomize(SrcWidth * SrcHeight + NumComponents);
+
+    TestImage Dst{Type, DstWidth, DstHeight, NumComponents};
+    Resample(Src, Dst, RESAMPLE_FILTER_BILINEAR, AddressModeU, AddressModeV);
+
+    for (Uint32 c = 0; c < NumComponents; ++c)
+    {
+        const auto Component = Src.GetComponent(c);
+        for (Uint32 y = 0; y < DstHeight; ++y)
+        {
+            for (Uint32 x = 0; x < DstWidth; ++x)
+            {
+                const float u = (static_cast<float>(x) + 0.5f) * (static_cast<float>(SrcWidth) / static_cast<float>(DstWidth));
+                const float v = (static_cast<float>(y) + 0.5f) * (static_cast<float>(SrcHeight) / static_cast<float>(DstHeight));
+
+                float Ref = FilterTexture2DBilinear<float, float, AddressModeU, AddressModeV, false>(SrcWidth, SrcHeight, Component.data(), SrcWidth, u, v);
+                if (Type == VT_UINT8)
+                    Ref = std::round(Ref);
+
+                ASSERT_NEAR(Dst.Get(x * NumComponents + c, y), Ref, Type == VT_UINT8 ? 1.f : 1e-3f)
+                    << "Src: " << SrcWidth << "x" << SrcHeight << " Dst: " << DstWidth << "x" << DstHeight
+                    << " x=" << x << " y=" << y << " c=" << c;
+            }
+        }
+    }
+}
+
+TEST(Common_FilteringTools, ResampleImageBilinear)
+{
+    for (auto Type : {VT_UINT8, VT_FLOAT32})
+    {
+        for (Uint32 NumComponents = 1; NumComponents <= 4; ++NumComponents)
+        {
+            TestResampleBilinear<TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP>(Type, NumComponents, 13, 7, 29, 17);
+            TestResampleBilinear<TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR>(Type, NumComponents, 13, 7, 29, 17);
+            TestResampleBilinear<TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_WRAP>(Type, NumComponents, 9, 11, 40, 11);
+            TestResampleBilinear<TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_WRAP>(Type, NumComponents, 16, 16, 16, 16);
+        }
+    }
+}
+
+TEST(Common_FilteringTools, ResampleImageBox)
+{
+    // 2x box downsampling averages 2x2 blocks
+    for (auto Type : {VT_UINT8, VT_FLOAT32})
+    {
+        for (Uint32 NumComponents = 1; NumComponents <= 4; ++NumComponents)
+        {
+            TestImage Src{Type, 34, 18, NumComponents};
+            Src.Randomize(NumComponents);
+
+            TestImage Dst{Type, 17, 9, NumComponents};
+            Resample(Src, Dst, RESAMPLE_FILTER_BOX, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP);
+            for (Uint32 y = 0; y < Dst.Height; ++y)
+            {
+                for (Uint32 i = 0; i < Dst.Width * NumComponents; ++i)
+                {
+                    const Uint32 x = i / NumComponents;
+                    const Uint32 c = i % NumComponents;
+
+                    float Ref = 0;
+                    for (Uint32 j = 0; j < 4; ++j)
+                        Ref += Src.Get((x * 2 + (j & 1)) * NumComponents + c, y * 2 + j / 2) * 0.25f;
+                    if (Type == VT_UINT8)
+                        Ref = std::round(Ref);
+
+                    ASSERT_NEAR(Dst.Get(i, y), Ref, Type == VT_UINT8 ? 1.f : 1e-3f) << "x=" << x << " y=" << y << " c=" << c;
+                }
+            }
+        }
+    }
+}
+
+TEST(Common_FilteringTools, ResampleImageConstant)
+{
+    // All filters must preserve a constant color with any scale and address mode
+    constexpr float Color[] = {10, 100, 200, 255};
+    for (auto Type : {VT_UINT8, VT_FLOAT32})
+    {
+        for (Uint32 Filter = 0; Filter < RESAMPLE_FILTER_COUNT; ++Filter)
+        {
+            for (auto AddressMode : {TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_CLAMP})
+            {
+                TestImage Src{Type, 37, 23, 4};
+                for (Uint32 y = 0; y < Src.Height; ++y)
+                {
+                    for (Uint32 i = 0; i < Src.Width * 4; ++i)
+                        Src.Set(i, y, Color[i % 4]);
+                }
+
+                for (Uint32 DstSize : {1, 5, 16, 37, 100})
+                {
+                    TestImage Dst{Type, DstSize, DstSize / 2 + 1, 4};
+                    Resample(Src, Dst, static_cast<RESAMPLE_FILTER>(Filter), AddressMode, AddressMode);
+                    for (Uint32 y = 0; y < Dst.Height; ++y)
+                    {
+                        for (Uint32 i = 0; i < Dst.Width * 4; ++i)
+                            ASSERT_NEAR(Dst.Get(i, y), Color[i % 4], 1e-3f) << "Filter " << Filter << " Dst size " << DstSize;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(Common_FilteringTools, ResampleImageThreadPool)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (auto Type : {VT_UINT8, VT_FLOAT32})
+    {
+        for (Uint32 Filter = 0; Filter < RESAMPLE_FILTER_COUNT; ++Filter)
+        {
+            TestImage Src{Type, 173, 131, 3};
+            Src.Randomize(Filter);
+
+            TestImage Dst{Type, 67, 89, 3};
+            TestImage DstMT{Type, 67, 89, 3};
+            Resample(Src, Dst, static_cast<RESAMPLE_FILTER>(Filter), TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_WRAP);
+            Resample(Src, DstMT, static_cast<RESAMPLE_FILTER>(Filter), TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_WRAP, pThreadPool);
+            // Compare the bytes as 8-bit image data may contain NaN bit patterns when viewed as floats
+            EXPECT_EQ(memcmp(Dst.Data.data(), DstMT.Data.data(), Dst.Data.size() * sizeof(float)), 0) << "Filter " << Filter;
+        }
+    }
+}
+
+TEST(Common_FilteringTools, DISABLED_ResampleImagePerformance)
+{
+    TestImage Src{VT_UINT8, 4096, 4096, 4};
+    Src.Randomize(0);
+    TestImage Dst{VT_UINT8, 1024, 1024, 4};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 1u)});
+
+    constexpr const char* FilterNames[] = {"box", "bilinear", "Lanczos3", "Kaiser"};
+    static_assert(_countof(FilterNames) == RESAMPLE_FILTER_COUNT, "Please update the filter names");
+    for (Uint32 Filter = 0; Filter < RESAMPLE_FILTER_COUNT; ++Filter)
+    {
+        for (auto* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            Timer T;
+            Resample(Src, Dst, static_cast<RESAMPLE_FILTER>(Filter), TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, pPool);
+            LOG_INFO_MESSAGE("Resampled 4096x4096 RGBA8 image to 1024x1024 with ", FilterNames[Filter], " filter",
+                             (pPool != nullptr ? " (thread pool)" : ""), " in ", T.GetElapsedTime() * 1000, " ms");
+        }
+    }
+}
+
 } // namespace
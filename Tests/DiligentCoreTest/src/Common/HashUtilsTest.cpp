@@ -186,6 +186,70 @@ TEST(Common_HashUtils, ComputeHashRaw)
     }
 }
 
+TEST(Common_HashUtils, StdHashSignedZero)
+{
+    // 0 and -0 compare equal, so the descriptions must have the same hash
+    {
+        SamplerDesc Desc1;
+        SamplerDesc Desc2;
+        Desc1.MipLODBias     = 0.f;
+        Desc2.MipLODBias     = -0.f;
+        Desc1.BorderColor[2] = 0.f;
+        Desc2.BorderColor[2] = -0.f;
+        ASSERT_EQ(Desc1, Desc2);
+        EXPECT_EQ(std::hash<SamplerDesc>{}(Desc1), std::hash<SamplerDesc>{}(Desc2));
+    }
+
+    {
+        RasterizerStateDesc Desc1;
+        RasterizerStateDesc Desc2;
+        Desc1.DepthBiasClamp       = 0.f;
+        Desc2.DepthBiasClamp       = -0.f;
+        Desc1.SlopeScaledDepthBias = 0.f;
+        Desc2.SlopeScaledDepthBias = -0.f;
+        ASSERT_EQ(Desc1, Desc2);
+        EXPECT_EQ(std::hash<RasterizerStateDesc>{}(Desc1), std::hash<RasterizerStateDesc>{}(Desc2));
+    }
+}
+
+TEST(Common_HashUtils, StdHashStringContents)
+{
+    // Strings are hashed by their contents rather than by their addresses
+    char Name1[] = "Sampler";
+    char Name2[] = "Sampler";
+
+    ImmutableSamplerDesc Desc1{SHADER_TYPE_PIXEL, Name1, SamplerDesc{}};
+    ImmutableSamplerDesc Desc2{SHADER_TYPE_PIXEL, Name2, SamplerDesc{}};
+    EXPECT_EQ(std::hash<ImmutableSamplerDesc>{}(Desc1), std::hash<ImmutableSamplerDesc>{}(Desc2));
+
+    // Null and empty strings compare equal, so they must have the same hash
+    Desc1.SamplerOrTextureName = nullptr;
+    Desc2.SamplerOrTextureName = "";
+    EXPECT_EQ(std::hash<ImmutableSamplerDesc>{}(Desc1), std::hash<ImmutableSamplerDesc>{}(Desc2));
+
+    // Descriptions that do not fit into the hasher buffer
+    std::vector<std::string>          Names;
+    std::vector<PipelineResourceDesc> Resources;
+    for (Uint32 i = 0; i < 64; ++i)
+        Names.emplace_back("Resource" + std::to_string(i));
+    for (const auto& Name : Names)
+        Resources.emplace_back(SHADER_TYPE_PIXEL, Name.c_str(), 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV);
+
+    PipelineResourceSignatureDesc SignDesc;
+    SignDesc.Resources    = Resources.data();
+    SignDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+    const size_t RefHash = std::hash<PipelineResourceSignatureDesc>{}(SignDesc);
+    EXPECT_EQ(std::hash<PipelineResourceSignatureDesc>{}(SignDesc), RefHash);
+
+    std::string LastName  = Names.back();
+    Resources.back().Name = LastName.c_str();
+    EXPECT_EQ(std::hash<PipelineResourceSignatureDesc>{}(SignDesc), RefHash);
+
+    Resources.back().ArraySize = 2;
+    EXPECT_NE(std::hash<PipelineResourceSignatureDesc>{}(SignDesc), RefHash);
+}
+
 
 template <typename Type>
 class StdHasherTestHelper
@@ -0,0 +1,274 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MappedFileStream.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+#include "TempDirectory.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "BasicFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "Timer.hpp"
+
+#if PLATFORM_LINUX
+#    include <cstdio>
+#    include <fcntl.h>
+#    include <sys/resource.h>
+#    include <sys/stat.h>
+#endif
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void WriteFile(const std::string& Path, const void* pData, size_t Size)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File);
+    if (Size > 0)
+        EXPECT_TRUE(File->Write(pData, Size));
+}
+
+std::vector<Uint8> MakeTestData(size_t Size, Uint32 Seed)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>((i * 31 + Seed * 7 + (i >> 8)) & 0xFF);
+    return Data;
+}
+
+TEST(Common_MappedFileStream, Read)
+{
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "TestFile.bin";
+
+    const auto Data = MakeTestData(10000, 0);
+    WriteFile(FilePath, Data.data(), Data.size());
+
+    auto pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_NE(pStream, nullptr);
+    EXPECT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), Data.size());
+    EXPECT_EQ(pStream->GetPos(), size_t{0});
+
+    std::vector<Uint8> Buffer(100);
+    EXPECT_TRUE(pStream->Read(Buffer.data(), Buffer.size()));
+    EXPECT_EQ(memcmp(Buffer.data(), Data.data(), Buffer.size()), 0);
+    EXPECT_EQ(pStream->GetPos(), size_t{100});
+
+    EXPECT_TRUE(pStream->SetPos(1000, static_cast<int>(FilePosOrigin::Start)));
+    EXPECT_TRUE(pStream->Read(Buffer.data(), Buffer.size()));
+    EXPECT_EQ(memcmp(Buffer.data(), &Data[1000], Buffer.size()), 0);
+
+    EXPECT_TRUE(pStream->SetPos(500, static_cast<int>(FilePosOrigin::Curr)));
+    EXPECT_EQ(pStream->GetPos(), size_t{1600});
+
+    EXPECT_TRUE(pStream->SetPos(static_cast<size_t>(-50), static_cast<int>(FilePosOrigin::End)));
+    EXPECT_FALSE(pStream->Read(Buffer.data(), Buffer.size()));
+    EXPECT_EQ(memcmp(Buffer.data(), &Data[Data.size() - 50], 50), 0);
+    EXPECT_EQ(pStream->GetPos(), Data.size());
+
+    EXPECT_TRUE(pStream->SetPos(9000, static_cast<int>(FilePosOrigin::Start)));
+    auto pBlob = DataBlobImpl::Create();
+    pStream->ReadBlob(pBlob);
+    ASSERT_EQ(pBlob->GetSize(), size_t{1000});
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), &Data[9000], 1000), 0);
+}
+
+TEST(Common_MappedFileStream, GetDataBlob)
+{
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "TestFile.bin";
+
+    const auto Data = MakeTestData(5000, 1);
+    WriteFile(FilePath, Data.data(), Data.size());
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    {
+        auto pStream = MappedFileStream::Create(FilePath.c_str());
+        ASSERT_NE(pStream, nullptr);
+        pStream->Advise(MappedFileAccessHint::Sequential);
+        pBlob = pStream->GetDataBlob();
+        if (MappedFile::IsMemoryMapped)
+            EXPECT_EQ(pBlob->GetConstDataPtr(), pStream->GetData());
+    }
+    // The blob must keep the file contents alive after the stream reference is released
+    ASSERT_NE(pBlob, nullptr);
+    ASSERT_EQ(pBlob->GetSize(), Data.size());
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+}
+
+TEST(Common_MappedFileStream, EmptyFile)
+{
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "Empty.bin";
+    WriteFile(FilePath, nullptr, 0);
+
+    auto pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_NE(pStream, nullptr);
+    EXPECT_EQ(pStream->GetSize(), size_t{0});
+
+    Uint8 Byte = 0;
+    EXPECT_FALSE(pStream->Read(&Byte, 1));
+
+    auto pBlob = pStream->GetDataBlob();
+    ASSERT_NE(pBlob, nullptr);
+    EXPECT_EQ(pBlob->GetSize(), size_t{0});
+}
+
+TEST(Common_MappedFileStream, MissingFile)
+{
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "Missing.bin";
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+    EXPECT_EQ(MappedFileStream::Create(FilePath.c_str()), nullptr);
+}
+
+TEST(Common_MappedFileStream, ModificationTime)
+{
+    TempDirectory TmpDir;
+    const auto    FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "TestFile.bin";
+
+    const auto Data = MakeTestData(100, 0);
+    WriteFile(FilePath, Data.data(), Data.size());
+
+#if PLATFORM_LINUX
+    const timespec Times[2] = {{0, UTIME_OMIT}, {1000000000, 123}};
+    ASSERT_EQ(utimensat(AT_FDCWD, FilePath.c_str(), Times, 0), 0);
+
+    auto pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_NE(pStream, nullptr);
+    EXPECT_EQ(pStream->GetModificationTime(), Uint64{1000000000} * 1000000000 + 123);
+#else
+    auto pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_NE(pStream, nullptr);
+    // The modification time is not known on this platform
+    EXPECT_EQ(pStream->GetModificationTime(), Uint64{0});
+#endif
+}
+
+TEST(Common_MappedFileStream, DISABLED_Performance)
+{
+    // Emulate a large shader tree: many small source files that are all kept in memory once loaded
+    constexpr Uint32 NumFiles = 10000;
+    constexpr size_t FileSize = 4096;
+
+    TempDirectory            TmpDir;
+    std::vector<std::string> FilePaths(NumFiles);
+    for (Uint32 i = 0; i < NumFiles; ++i)
+    {
+        FilePaths[i]    = TmpDir.Get() + FileSystem::SlashSymbol + "Shader" + std::to_string(i) + ".hlsl";
+        const auto Data = MakeTestData(FileSize, i);
+        WriteFile(FilePaths[i], Data.data(), Data.size());
+    }
+
+    // Returns the peak resident set size and the current amount of private (anonymous) resident memory, in KB.
+    // Pages of mapped files count towards the RSS too, but unlike private copies they are shared with the page
+    // cache and can be reclaimed by the OS at any time.
+    auto GetMemoryUsage = []() {
+        std::pair<long, long> PeakRSSAnonRSS{0, 0};
+#if PLATFORM_LINUX
+        rusage Usage{};
+        getrusage(RUSAGE_SELF, &Usage);
+        PeakRSSAnonRSS.first = Usage.ru_maxrss;
+
+        if (FILE* pStatus = fopen("/proc/self/status", "r"))
+        {
+            char Line[256];
+            while (fgets(Line, sizeof(Line), pStatus) != nullptr)
+            {
+                if (sscanf(Line, "RssAnon: %ld", &PeakRSSAnonRSS.second) == 1)
+                    break;
+            }
+            fclose(pStatus);
+        }
+#endif
+        return PeakRSSAnonRSS;
+    };
+
+    auto Checksum = [](const IDataBlob* pBlob) {
+        const auto* pData = static_cast<const Uint8*>(pBlob->GetConstDataPtr());
+        Uint32      Sum   = 0;
+        for (size_t i = 0; i < pBlob->GetSize(); i += 64)
+            Sum += pData[i];
+        return Sum;
+    };
+
+    // Peak RSS never decreases, so measure the mapped streams first
+    Uint32 MappedChecksum = 0;
+    {
+        std::vector<RefCntAutoPtr<IDataBlob>> Blobs(NumFiles);
+
+        const auto Mem0 = GetMemoryUsage();
+        Timer      T;
+        for (Uint32 i = 0; i < NumFiles; ++i)
+        {
+            auto pStream = MappedFileStream::Create(FilePaths[i].c_str());
+            ASSERT_NE(pStream, nullptr);
+            pStream->Advise(MappedFileAccessHint::Sequential);
+            Blobs[i] = pStream->GetDataBlob();
+            MappedChecksum += Checksum(Blobs[i]);
+        }
+        const auto Time = T.GetElapsedTime();
+        const auto Mem1 = GetMemoryUsage();
+        LOG_INFO_MESSAGE("Loaded ", NumFiles, " files with MappedFileStream in ", Time * 1000, " ms. Peak RSS increase: ",
+                         Mem1.first - Mem0.first, " KB, private memory increase: ", Mem1.second - Mem0.second, " KB");
+    }
+
+    Uint32 BasicChecksum = 0;
+    {
+        std::vector<RefCntAutoPtr<IDataBlob>> Blobs(NumFiles);
+
+        const auto Mem0 = GetMemoryUsage();
+        Timer      T;
+        for (Uint32 i = 0; i < NumFiles; ++i)
+        {
+            auto pStream = BasicFileStream::Create(FilePaths[i].c_str(), EFileAccessMode::Read);
+            ASSERT_TRUE(pStream->IsValid());
+            Blobs[i] = DataBlobImpl::Create();
+            pStream->ReadBlob(Blobs[i]);
+            BasicChecksum += Checksum(Blobs[i]);
+        }
+        const auto Time = T.GetElapsedTime();
+        const auto Mem1 = GetMemoryUsage();
+        LOG_INFO_MESSAGE("Loaded ", NumFiles, " files with BasicFileStream in ", Time * 1000, " ms. Peak RSS increase: ",
+                         Mem1.first - Mem0.first, " KB, private memory increase: ", Mem1.second - Mem0.second, " KB");
+    }
+
+    EXPECT_EQ(MappedChecksum, BasicChecksum);
+}
+
+} // namespace
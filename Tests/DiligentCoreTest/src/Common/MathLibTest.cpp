@@ -30,6 +30,9 @@
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "BatchMath.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -3362,4 +3365,415 @@ TEST(Common_AdvancedMath, TriangulatePolygon3D)
     }
 }
 
+
+// Reference O(N^2) ear-clipping triangulator that clips the first ear in the list of remaining vertices.
+template <typename T>
+std::vector<Uint32> TriangulatePolygon2DReference(const std::vector<Vector2<T>>& Polygon)
+{
+    const int VertCount = static_cast<int>(Polygon.size());
+
+    auto GetWinding = [](const Vector2<T>& V0, const Vector2<T>& V1, const Vector2<T>& V2) {
+        return (V1.x - V0.x) * (V2.y - V1.y) - (V2.x - V1.x) * (V1.y - V0.y);
+    };
+
+    int LeftmostVertIdx = 0;
+    for (int i = 1; i < VertCount; ++i)
+    {
+        if (Polygon[i].x < Polygon[LeftmostVertIdx].x)
+            LeftmostVertIdx = i;
+    }
+    const T PolygonWinding = GetWinding(Polygon[(LeftmostVertIdx + VertCount - 1) % VertCount], Polygon[LeftmostVertIdx], Polygon[(LeftmostVertIdx + 1) % VertCount]) > 0 ? T{1} : T{-1};
+
+    std::vector<int> Remaining(VertCount);
+    for (int i = 0; i < VertCount; ++i)
+        Remaining[i] = i;
+
+    auto IsEar = [&](int i) {
+        const int N    = static_cast<int>(Remaining.size());
+        const int Idx0 = Remaining[(i + N - 1) % N];
+        const int Idx1 = Remaining[i];
+        const int Idx2 = Remaining[(i + 1) % N];
+        if (GetWinding(Polygon[Idx0], Polygon[Idx1], Polygon[Idx2]) * PolygonWinding < 0)
+            return false;
+        for (int j = 0; j < N; ++j)
+        {
+            const int Idx = Remaining[j];
+            if (Idx == Idx0 || Idx == Idx1 || Idx == Idx2)
+                continue;
+            const bool IsReflex = GetWinding(Polygon[Remaining[(j + N - 1) % N]], Polygon[Idx], Polygon[Remaining[(j + 1) % N]]) * PolygonWinding < 0;
+            if (IsReflex && IsPointInsideTriangle(Polygon[Idx0], Polygon[Idx1], Polygon[Idx2], Polygon[Idx], false))
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<Uint32> Tris;
+    while (Remaining.size() > 3)
+    {
+        const int N   = static_cast<int>(Remaining.size());
+        int       Ear = 0;
+        while (Ear < N && !IsEar(Ear))
+            ++Ear;
+        if (Ear == N)
+            Ear = 0;
+        Tris.push_back(Remaining[(Ear + N - 1) % N]);
+        Tris.push_back(Remaining[Ear]);
+        Tris.push_back(Remaining[(Ear + 1) % N]);
+        Remaining.erase(Remaining.begin() + Ear);
+    }
+    Tris.insert(Tris.end(), Remaining.begin(), Remaining.end());
+    return Tris;
+}
+
+// Generates a random star-shaped polygon
+template <typename T>
+std::vector<Vector2<T>> MakeRandomStarPolygon(size_t NumVerts, unsigned int Seed, T Scale)
+{
+    FastRandDouble Rnd{Seed, 0.25, 1.0};
+
+    std::vector<Vector2<T>> Polygon(NumVerts);
+    for (size_t i = 0; i < NumVerts; ++i)
+    {
+        const double Angle  = 2.0 * PI * static_cast<double>(i) / static_cast<double>(NumVerts);
+        const double Radius = Rnd() * static_cast<double>(Scale);
+        Polygon[i]          = Vector2<T>{static_cast<T>(std::cos(Angle) * Radius), static_cast<T>(std::sin(Angle) * Radius)};
+    }
+    return Polygon;
+}
+
+// Generates a comb-shaped polygon similar to text outlines and building footprints:
+// many long thin teeth with all vertices on an integer grid.
+std::vector<double2> MakeCombPolygon(size_t NumTeeth)
+{
+    std::vector<double2> Polygon;
+    Polygon.reserve(NumTeeth * 4 + 2);
+    for (size_t i = 0; i < NumTeeth; ++i)
+    {
+        const double x = static_cast<double>(i) * 4;
+        Polygon.emplace_back(x + 0, 0);
+        Polygon.emplace_back(x + 2, 0);
+        Polygon.emplace_back(x + 2, 100);
+        Polygon.emplace_back(x + 4, 100);
+    }
+    Polygon.emplace_back(static_cast<double>(NumTeeth) * 4, -10);
+    Polygon.emplace_back(0, -10);
+    return Polygon;
+}
+
+template <typename T>
+double GetPolygonArea(const std::vector<Vector2<T>>& Polygon)
+{
+    double Area = 0;
+    for (size_t i = 0; i < Polygon.size(); ++i)
+    {
+        const auto& V0 = Polygon[i];
+        const auto& V1 = Polygon[(i + 1) % Polygon.size()];
+        Area += static_cast<double>(V0.x) * static_cast<double>(V1.y) - static_cast<double>(V1.x) * static_cast<double>(V0.y);
+    }
+    return Area * 0.5;
+}
+
+template <typename T>
+double GetTrianglesArea(const std::vector<Vector2<T>>& Verts, const std::vector<Uint32>& Tris)
+{
+    double Area = 0;
+    for (size_t i = 0; i + 2 < Tris.size(); i += 3)
+    {
+        const auto& V0 = Verts[Tris[i + 0]];
+        const auto& V1 = Verts[Tris[i + 1]];
+        const auto& V2 = Verts[Tris[i + 2]];
+        Area += (static_cast<double>(V1.x - V0.x) * static_cast<double>(V2.y - V0.y) - static_cast<double>(V2.x - V0.x) * static_cast<double>(V1.y - V0.y)) * 0.5;
+    }
+    return Area;
+}
+
+TEST(Common_AdvancedMath, TriangulatePolygon2DMatchesReference)
+{
+    Polygon2DTriangulator<Uint32> Triangulator;
+    for (size_t NumVerts : {4, 5, 7, 16, 33, 100, 257})
+    {
+        for (unsigned int Seed = 0; Seed < 8; ++Seed)
+        {
+            const auto Polygon = MakeRandomStarPolygon<float>(NumVerts, Seed, 100.f);
+            const auto Tris    = Triangulator.Triangulate(Polygon);
+            // Ear vertices may be found inside triangles that are not ears
+            EXPECT_EQ(Triangulator.GetResult() & ~TRIANGULATE_POLYGON_RESULT_INVALID_EAR, TRIANGULATE_POLYGON_RESULT_OK);
+            EXPECT_EQ(Tris, TriangulatePolygon2DReference(Polygon)) << "NumVerts: " << NumVerts << ", seed: " << Seed;
+        }
+    }
+
+    {
+        const auto Polygon = MakeCombPolygon(50);
+        const auto Tris    = Triangulator.Triangulate(Polygon);
+        EXPECT_EQ(Triangulator.GetResult(), TRIANGULATE_POLYGON_RESULT_OK);
+        EXPECT_EQ(Tris, TriangulatePolygon2DReference(Polygon));
+    }
+}
+
+TEST(Common_AdvancedMath, TriangulatePolygon2DHoles)
+{
+    Polygon2DTriangulator<Uint32> Triangulator;
+
+    //  ____________________
+    // |   __        __     |
+    // |  |__|      |  |    |
+    // |            |__|    |
+    // |      __            |
+    // |     |__|           |
+    // |____________________|
+    //
+    const std::vector<int2> Outer = {{0, 0}, {20, 0}, {20, 10}, {0, 10}};
+
+    const std::vector<std::vector<int2>> Holes = {
+        {{3, 7}, {5, 7}, {5, 8}, {3, 8}},
+        {{12, 5}, {12, 8}, {15, 8}, {15, 5}}, // Same winding as the outer polygon
+        {{6, 2}, {8, 2}, {8, 3}, {6, 3}},
+    };
+
+    std::vector<int2> AllVerts{Outer};
+    double            RefArea = GetPolygonArea(Outer);
+    for (const auto& Hole : Holes)
+    {
+        AllVerts.insert(AllVerts.end(), Hole.begin(), Hole.end());
+        RefArea -= std::abs(GetPolygonArea(Hole));
+    }
+
+    const auto Tris = Triangulator.Triangulate(Outer, Holes);
+    EXPECT_EQ(Triangulator.GetResult(), TRIANGULATE_POLYGON_RESULT_OK);
+    // Every hole adds two bridge vertices
+    EXPECT_EQ(Tris.size(), (AllVerts.size() + 2 * Holes.size() - 2) * 3);
+    for (const auto Idx : Tris)
+        EXPECT_LT(Idx, AllVerts.size());
+
+    // All triangles must have the winding order of the outer polygon and cover the polygon without the holes
+    for (size_t i = 0; i < Tris.size(); i += 3)
+    {
+        const auto& V0 = AllVerts[Tris[i + 0]];
+        const auto& V1 = AllVerts[Tris[i + 1]];
+        const auto& V2 = AllVerts[Tris[i + 2]];
+        EXPECT_GE((V1.x - V0.x) * (V2.y - V0.y) - (V2.x - V0.x) * (V1.y - V0.y), 0);
+    }
+    EXPECT_EQ(GetTrianglesArea(AllVerts, Tris), RefArea);
+
+    // A hole outside of the polygon can't be bridged and is reported
+    {
+        auto HolesWithOutsideHole = Holes;
+        HolesWithOutsideHole.push_back({{30, 3}, {32, 3}, {32, 4}, {30, 4}});
+
+        const auto OutsideTris = Triangulator.Triangulate(Outer, HolesWithOutsideHole);
+        EXPECT_EQ(Triangulator.GetResult(), TRIANGULATE_POLYGON_RESULT_HOLE_NOT_BRIDGED);
+        // The remaining holes are triangulated as before
+        EXPECT_EQ(OutsideTris, Tris);
+    }
+
+    // Holes inside a random star polygon
+    for (unsigned int Seed = 0; Seed < 8; ++Seed)
+    {
+        const auto Polygon = MakeRandomStarPolygon<double>(64, Seed, 100.0);
+
+        std::vector<std::vector<double2>> StarHoles;
+        for (int i = 0; i < 4; ++i)
+        {
+            const double  Angle = PI * 0.5 * i + 0.3;
+            const double2 Center{std::cos(Angle) * 12.0, std::sin(Angle) * 12.0};
+            StarHoles.emplace_back(MakeRandomStarPolygon<double>(8 + i, Seed * 4 + i, 5.0));
+            for (auto& V : StarHoles.back())
+                V += Center;
+        }
+
+        std::vector<double2> AllStarVerts{Polygon};
+        double               RefStarArea = GetPolygonArea(Polygon);
+        for (const auto& Hole : StarHoles)
+        {
+            AllStarVerts.insert(AllStarVerts.end(), Hole.begin(), Hole.end());
+            RefStarArea -= GetPolygonArea(Hole);
+        }
+
+        const auto StarTris = Triangulator.Triangulate(Polygon, StarHoles);
+        // Bridge vertices are duplicated, so only check that the triangulation did not get stuck
+        EXPECT_EQ(Triangulator.GetResult() & TRIANGULATE_POLYGON_RESULT_NO_EAR_FOUND, TRIANGULATE_POLYGON_RESULT_OK);
+        EXPECT_EQ(StarTris.size(), (AllStarVerts.size() + 2 * StarHoles.size() - 2) * 3);
+        EXPECT_NEAR(GetTrianglesArea(AllStarVerts, StarTris), RefStarArea, RefStarArea * 1e-9);
+    }
+}
+
+TEST(Common_AdvancedMath, DISABLED_TriangulatePolygon2DPerformance)
+{
+    Polygon2DTriangulator<Uint32> Triangulator;
+
+    auto Measure = [&](const char* Name, const auto& Polygon) {
+        Timer T;
+        // Reuse the triangulator to avoid reallocating scratch buffers
+        for (int i = 0; i < 2; ++i)
+            Triangulator.Triangulate(Polygon);
+        const double Time = T.GetElapsedTime() / 2;
+
+        EXPECT_EQ(Triangulator.GetResult() & ~TRIANGULATE_POLYGON_RESULT_INVALID_EAR, TRIANGULATE_POLYGON_RESULT_OK);
+        EXPECT_NEAR(GetTrianglesArea(Polygon, Triangulator.Triangulate(Polygon)), GetPolygonArea(Polygon), std::abs(GetPolygonArea(Polygon)) * 1e-6);
+        LOG_INFO_MESSAGE("Triangulated ", Name, " polygon with ", Polygon.size(), " vertices in ", Time * 1000, " ms");
+    };
+
+    Measure("random star", MakeRandomStarPolygon<double>(50000, 0, 1000.0));
+    Measure("comb", MakeCombPolygon(5000));
+}
+
+// The batch functions must match the scalar operations up to floating-point contraction
+void CheckBatchMathResult(const float* Values, const float* RefValues, size_t NumValues, float Scale)
+{
+    for (size_t i = 0; i < NumValues; ++i)
+    {
+        EXPECT_NEAR(Values[i], RefValues[i], Scale * 1e-6f) << "index " << i;
+    }
+}
+
+float4x4 MakeRandomMatrix(FastRandReal<float>& Rnd)
+{
+    float4x4 m;
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+            m[r][c] = Rnd();
+    }
+    return m;
+}
+
+TEST(Common_BatchMath, TransformPoints)
+{
+    FastRandReal<float> Rnd{0, -10.f, 10.f};
+
+    auto Matrix = MakeRandomMatrix(Rnd);
+    // Keep w away from zero
+    Matrix._14 = 0;
+    Matrix._24 = 0;
+    Matrix._34 = 0;
+    Matrix._44 = 1;
+
+    for (size_t Count : {0, 1, 3, 4, 17, 1000})
+    {
+        std::vector<float3> Points(Count);
+        for (auto& Point : Points)
+            Point = float3{Rnd(), Rnd(), Rnd()};
+
+        std::vector<float3> RefPoints(Count), RefDirs(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            RefPoints[i] = Points[i] * Matrix;
+
+            const auto Dir = float4{Points[i].x, Points[i].y, Points[i].z, 0} * Matrix;
+            RefDirs[i]     = float3{Dir.x, Dir.y, Dir.z};
+        }
+
+        std::vector<float3> Result(Count);
+        TransformPoints(Points.data(), Count, Matrix, Result.data());
+        CheckBatchMathResult(&Result.data()->x, &RefPoints.data()->x, Count * 3, 1000);
+
+        TransformDirections(Points.data(), Count, Matrix, Result.data());
+        CheckBatchMathResult(&Result.data()->x, &RefDirs.data()->x, Count * 3, 1000);
+
+        // In-place transform
+        Result = Points;
+        TransformPoints(Result.data(), Count, Matrix, Result.data());
+        CheckBatchMathResult(&Result.data()->x, &RefPoints.data()->x, Count * 3, 1000);
+    }
+}
+
+TEST(Common_BatchMath, TransformVectors)
+{
+    FastRandReal<float> Rnd{1, -10.f, 10.f};
+
+    const auto Matrix = MakeRandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 5, 1000})
+    {
+        std::vector<float4> Vectors(Count), RefVectors(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Vectors[i]    = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+            RefVectors[i] = Vectors[i] * Matrix;
+        }
+
+        TransformVectors(Vectors.data(), Count, Matrix, Vectors.data());
+        CheckBatchMathResult(&Vectors.data()->x, &RefVectors.data()->x, Count * 4, 1000);
+    }
+}
+
+TEST(Common_BatchMath, TransformBoundBoxes)
+{
+    FastRandReal<float> Rnd{2, -10.f, 10.f};
+
+    const auto Matrix = MakeRandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 2, 7, 1000})
+    {
+        std::vector<BoundBox> Boxes(Count), RefBoxes(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const float3 Center{Rnd(), Rnd(), Rnd()};
+            const float3 Extent{std::abs(Rnd()), std::abs(Rnd()), std::abs(Rnd())};
+
+            Boxes[i]    = BoundBox{Center - Extent, Center + Extent};
+            RefBoxes[i] = Boxes[i].Transform(Matrix);
+        }
+
+        std::vector<BoundBox> Result(Count);
+        TransformBoundBoxes(Boxes.data(), Count, Matrix, Result.data());
+        CheckBatchMathResult(&Result.data()->Min.x, &RefBoxes.data()->Min.x, Count * 6, 1000);
+    }
+}
+
+TEST(Common_BatchMath, MultiplyMatrices)
+{
+    FastRandReal<float> Rnd{3, -10.f, 10.f};
+
+    const auto Matrix = MakeRandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 3, 64})
+    {
+        std::vector<float4x4> Palette(Count), RefPalette(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Palette[i]    = MakeRandomMatrix(Rnd);
+            RefPalette[i] = Palette[i] * Matrix;
+        }
+
+        std::vector<float4x4> Result(Count);
+        MultiplyMatrices(Palette.data(), Count, Matrix, Result.data());
+        CheckBatchMathResult(&Result.data()->_11, &RefPalette.data()->_11, Count * 16, 1000);
+
+        MultiplyMatrices(Palette.data(), Count, Matrix, Palette.data());
+        CheckBatchMathResult(&Palette.data()->_11, &RefPalette.data()->_11, Count * 16, 1000);
+    }
+}
+
+TEST(Common_BatchMath, Bounds)
+{
+    FastRandReal<float> Rnd{4, -100.f, 100.f};
+
+    EXPECT_EQ(GetPointsBoundBox(nullptr, 0), BoundBox::Invalid());
+    EXPECT_EQ(CombineBoundBoxes(nullptr, 0), BoundBox::Invalid());
+
+    for (size_t Count : {1, 2, 3, 8, 23, 24, 25, 1001})
+    {
+        std::vector<float3> Points(Count);
+        for (auto& Point : Points)
+            Point = float3{Rnd(), Rnd(), Rnd()};
+
+        BoundBox RefBox = BoundBox::Invalid();
+        for (const auto& Point : Points)
+            RefBox = RefBox.Enclose(Point);
+        // Min and max are exact
+        EXPECT_EQ(GetPointsBoundBox(Points.data(), Count), RefBox);
+
+        std::vector<BoundBox> Boxes(Count);
+        for (auto& Box : Boxes)
+        {
+            const float3 p0{Rnd(), Rnd(), Rnd()};
+            const float3 p1{Rnd(), Rnd(), Rnd()};
+            Box = BoundBox{(std::min)(p0, p1), (std::max)(p0, p1)};
+        }
+
+        BoundBox RefCombinedBox = BoundBox::Invalid();
+        for (const auto& Box : Boxes)
+            RefCombinedBox = RefCombinedBox.Combine(Box);
+        EXPECT_EQ(CombineBoundBoxes(Boxes.data(), Count), RefCombinedBox);
+    }
+}
+
 } // namespace
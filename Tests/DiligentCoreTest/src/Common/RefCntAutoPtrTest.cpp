@@ -35,6 +35,7 @@
 #include "RefCntAutoPtr.hpp"
 #include "RefCountedObjectImpl.hpp"
 #include "ThreadSignal.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -894,6 +895,10 @@ void RefCntAutoPtrThreadingTest::RunConcurrencyTest()
         StartWorkerThreadsAndWait(0);
 
         StartWorkerThreadsAndWait(1);
+
+        // With biased reference counting, objects created by this thread and released
+        // by the worker threads are destroyed when the merges are processed.
+        ProcessBiasedReferenceCountMerges();
     }
 }
 
@@ -904,4 +909,296 @@ TEST(Common_RefCntAutoPtr, Threading)
     ThreadingTest.RunConcurrencyTest();
 }
 
+
+class BiasedRefCountingScope
+{
+public:
+    BiasedRefCountingScope(bool Enable = true)
+    {
+        SetBiasedReferenceCountingEnabled(Enable);
+    }
+    ~BiasedRefCountingScope()
+    {
+        SetBiasedReferenceCountingEnabled(false);
+        ProcessBiasedReferenceCountMerges();
+    }
+};
+
+class TrackedObject : public Object
+{
+public:
+    TrackedObject(Diligent::IReferenceCounters* pRefCounters, std::atomic_int& NumDestroyed) :
+        Object{pRefCounters},
+        m_NumDestroyed{NumDestroyed}
+    {}
+
+    ~TrackedObject()
+    {
+        m_NumDestroyed++;
+    }
+
+private:
+    std::atomic_int& m_NumDestroyed;
+};
+
+TEST(Common_RefCntAutoPtr, BiasedRefCounting)
+{
+    BiasedRefCountingScope BiasedScope;
+
+    std::atomic_int NumDestroyed{0};
+
+    // Owner thread only
+    {
+        RefCntAutoPtr<TrackedObject> SP0{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+        EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 1);
+        {
+            auto SP1 = SP0;
+            auto SP2 = SP1;
+            EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 3);
+        }
+        EXPECT_EQ(SP0->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+        RefCntWeakPtr<TrackedObject> WP{SP0};
+        EXPECT_TRUE(WP.Lock());
+        SP0.Release();
+        EXPECT_EQ(NumDestroyed, 1);
+        EXPECT_FALSE(WP.Lock());
+        EXPECT_FALSE(WP.IsValid());
+    }
+
+    // The last reference is released by another thread
+    {
+        NumDestroyed = 0;
+
+        RefCntAutoPtr<TrackedObject> SP{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+        RefCntWeakPtr<TrackedObject> WP{SP};
+
+        std::thread Thread{
+            [&SP]() {
+                auto SP2 = SP;
+                SP.Release();
+                EXPECT_EQ(SP2->GetReferenceCounters()->GetNumStrongRefs(), 1);
+                SP2.Release();
+            }};
+        Thread.join();
+
+        // The biased counter has not been merged yet: the object must still be alive
+        EXPECT_EQ(NumDestroyed, 0);
+        {
+            auto SP3 = WP.Lock();
+            EXPECT_TRUE(SP3);
+        }
+        ProcessBiasedReferenceCountMerges();
+        EXPECT_EQ(NumDestroyed, 1);
+        EXPECT_FALSE(WP.Lock());
+    }
+
+    // The owner thread releases the last reference after another thread has requested the merge
+    {
+        NumDestroyed = 0;
+
+        RefCntAutoPtr<TrackedObject> SP{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+        RefCntAutoPtr<TrackedObject> SP2{SP};
+
+        std::thread Thread{[&SP2]() {
+            SP2.Release();
+        }};
+        Thread.join();
+
+        EXPECT_EQ(NumDestroyed, 0);
+        SP.Release();
+        // Releasing a reference does not process the merges
+        EXPECT_EQ(NumDestroyed, 0);
+        ProcessBiasedReferenceCountMerges();
+        EXPECT_EQ(NumDestroyed, 1);
+    }
+
+    // The owner thread exits before the objects are released
+    {
+        NumDestroyed = 0;
+
+        constexpr int NumObjects = 16;
+
+        std::vector<RefCntAutoPtr<TrackedObject>> Objects(NumObjects);
+        std::thread                               Thread{
+            [&]() {
+                for (auto& SP : Objects)
+                {
+                    SP = MakeNewRCObj<TrackedObject>{}(NumDestroyed);
+                    RefCntAutoPtr<TrackedObject> SP2{SP};
+                }
+            }};
+        Thread.join();
+
+        EXPECT_EQ(NumDestroyed, 0);
+        for (int i = 0; i < NumObjects; ++i)
+        {
+            Objects[i].Release();
+            EXPECT_EQ(NumDestroyed, i + 1);
+        }
+    }
+}
+
+TEST(Common_RefCntAutoPtr, BiasedThreading)
+{
+    BiasedRefCountingScope BiasedScope;
+
+    RefCntAutoPtrThreadingTest ThreadingTest;
+    ThreadingTest.StartConcurrencyTest();
+    ThreadingTest.RunConcurrencyTest();
+}
+
+TEST(Common_RefCntAutoPtr, BiasedStress)
+{
+    BiasedRefCountingScope BiasedScope;
+
+    constexpr int NumObjects    = 64;
+    constexpr int NumRounds     = 200;
+    const int     NumThreads    = static_cast<int>(std::max(std::thread::hardware_concurrency(), 4u));
+    const int     NumIterations = 256;
+
+    std::atomic_int NumDestroyed{0};
+    std::atomic_int NumCreated{0};
+
+    std::vector<RefCntAutoPtr<TrackedObject>> SharedObjects(NumObjects);
+    std::vector<RefCntWeakPtr<TrackedObject>> WeakObjects(NumObjects);
+
+    std::atomic_int CurrRound{-1};
+    std::atomic_int NumThreadsDone{0};
+    std::mutex      ObjectsMtx;
+
+    auto WorkerFunc = [&](int ThreadId) {
+        for (int Round = 0; Round < NumRounds; ++Round)
+        {
+            while (CurrRound.load() < Round)
+                std::this_thread::yield();
+
+            // Each thread owns some of the objects
+            for (int i = ThreadId; i < NumObjects; i += NumThreads)
+            {
+                RefCntAutoPtr<TrackedObject> pObj{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+                NumCreated++;
+
+                std::lock_guard<std::mutex> Lock{ObjectsMtx};
+                WeakObjects[i]   = pObj;
+                SharedObjects[i] = std::move(pObj);
+            }
+
+            std::vector<RefCntAutoPtr<TrackedObject>> LocalRefs;
+            for (int i = 0; i < NumIterations; ++i)
+            {
+                const int Idx = (ThreadId * 7 + i * 13) % NumObjects;
+                if (i % 3 == 0)
+                {
+                    RefCntWeakPtr<TrackedObject> pWeakObj;
+                    {
+                        std::lock_guard<std::mutex> Lock{ObjectsMtx};
+                        pWeakObj = WeakObjects[Idx];
+                    }
+                    auto pObj = pWeakObj.Lock();
+                    if (pObj)
+                        LocalRefs.emplace_back(std::move(pObj));
+                }
+                else
+                {
+                    std::lock_guard<std::mutex> Lock{ObjectsMtx};
+                    if (SharedObjects[Idx])
+                        LocalRefs.emplace_back(SharedObjects[Idx]);
+                    if (i % 5 == 0)
+                        SharedObjects[Idx].Release();
+                }
+                if (LocalRefs.size() > 8)
+                    LocalRefs.erase(LocalRefs.begin(), LocalRefs.begin() + 4);
+            }
+            LocalRefs.clear();
+            ProcessBiasedReferenceCountMerges();
+
+            NumThreadsDone++;
+        }
+    };
+
+    std::vector<std::thread> Threads;
+    for (int t = 0; t < NumThreads; ++t)
+        Threads.emplace_back(WorkerFunc, t);
+
+    for (int Round = 0; Round < NumRounds; ++Round)
+    {
+        NumThreadsDone = 0;
+        CurrRound.store(Round);
+        while (NumThreadsDone < NumThreads)
+            std::this_thread::yield();
+
+        // Objects are released by a thread that does not own them
+        std::lock_guard<std::mutex> Lock{ObjectsMtx};
+        for (auto& pObj : SharedObjects)
+            pObj.Release();
+    }
+
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    // All owner threads have exited, so all pending merges have been processed
+    for (auto& WP : WeakObjects)
+        WP.Release();
+    EXPECT_EQ(NumDestroyed, NumCreated);
+}
+
+TEST(Common_RefCntAutoPtr, DISABLED_ContentionBenchmark)
+{
+    const int NumThreads = static_cast<int>(std::max(std::thread::hardware_concurrency(), 4u));
+#ifdef DILIGENT_DEBUG
+    constexpr int NumIterations = 100000;
+#else
+    constexpr int    NumIterations        = 1000000;
+#endif
+
+    auto RunBenchmark = [&](bool Biased, bool SharedObject) {
+        BiasedRefCountingScope BiasedScope{Biased};
+
+        std::atomic_int NumDestroyed{0};
+
+        RefCntAutoPtr<TrackedObject> pShared{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+
+        Threading::Signal StartSignal;
+        std::atomic_int   NumThreadsReady{0};
+
+        std::vector<std::thread> Threads;
+        for (int t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&]() {
+                    // Thread-local objects are owned by the thread that uses them
+                    RefCntAutoPtr<TrackedObject> pObj = SharedObject ? pShared : RefCntAutoPtr<TrackedObject>{MakeNewRCObj<TrackedObject>{}(NumDestroyed)};
+                    NumThreadsReady++;
+                    StartSignal.Wait();
+                    for (int i = 0; i < NumIterations; ++i)
+                    {
+                        RefCntAutoPtr<TrackedObject> pCopy{pObj};
+                        pCopy->m_Value.store(i, std::memory_order_relaxed);
+                    }
+                });
+        }
+        while (NumThreadsReady < NumThreads)
+            std::this_thread::yield();
+
+        Timer T;
+        StartSignal.Trigger(true);
+        for (auto& Thread : Threads)
+            Thread.join();
+        const auto ElapsedTime = T.GetElapsedTime();
+
+        LOG_INFO_MESSAGE(Biased ? "Biased" : "Atomic", " reference counting, ", (SharedObject ? "shared object" : "thread-local objects"), ": ",
+                         NumThreads, " threads x ", NumIterations, " copies: ", ElapsedTime * 1000, " ms");
+
+        pShared.Release();
+        ProcessBiasedReferenceCountMerges();
+        EXPECT_EQ(NumDestroyed, SharedObject ? 1 : NumThreads + 1);
+    };
+
+    RunBenchmark(false, false);
+    RunBenchmark(true, false);
+    RunBenchmark(false, true);
+    RunBenchmark(true, true);
+}
+
 } // namespace
@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ColorConversion.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+Uint8 LinearToGamma8Ref(float x)
+{
+    const double Linear = std::min(std::max(static_cast<double>(x), 0.0), 1.0);
+    const double Gamma  = Linear <= 0.0031308 ? Linear * 12.92 : 1.055 * std::pow(Linear, 1.0 / 2.4) - 0.055;
+    return static_cast<Uint8>(std::floor(Gamma * 255.0 + 0.5));
+}
+
+TEST(ColorConversionTest, LinearToGamma8)
+{
+    // Values around every rounding threshold
+    for (Uint32 i = 0; i < 255; ++i)
+    {
+        const double Gamma     = (static_cast<double>(i) + 0.5) / 255.0;
+        const double Threshold = Gamma <= 0.04045 ? Gamma / 12.92 : std::pow((Gamma + 0.055) / 1.055, 2.4);
+
+        float x = static_cast<float>(Threshold);
+        for (int j = 0; j < 4; ++j)
+            x = std::nextafter(x, 0.f);
+        for (int j = 0; j < 8; ++j, x = std::nextafter(x, 1.f))
+            EXPECT_EQ(LinearToGamma8(x), LinearToGamma8Ref(x)) << x;
+    }
+
+    // Exact values of all 8-bit codes
+    for (Uint32 i = 0; i < 256; ++i)
+        EXPECT_EQ(LinearToGamma8(GammaToLinear(static_cast<Uint8>(i))), i);
+
+    for (Uint32 i = 0; i <= 100000; ++i)
+    {
+        const float x = static_cast<float>(i) / 100000.f;
+        EXPECT_EQ(LinearToGamma8(x), LinearToGamma8Ref(x)) << x;
+    }
+
+    EXPECT_EQ(LinearToGamma8(-1.f), 0);
+    EXPECT_EQ(LinearToGamma8(0.f), 0);
+    EXPECT_EQ(LinearToGamma8(1e-10f), 0);
+    EXPECT_EQ(LinearToGamma8(1.f), 255);
+    EXPECT_EQ(LinearToGamma8(2.f), 255);
+    EXPECT_EQ(LinearToGamma8(std::nanf("")), 0);
+}
+
+} // namespace
@@ -445,6 +445,34 @@ TEST(GraphicsAccessories_DynamicAtlasManager, Allocate)
 #endif
 }
 
+TEST(GraphicsAccessories_DynamicAtlasManager, MaxFreeRegion)
+{
+    DynamicAtlasManager Mgr{16, 8};
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 16U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 8U);
+
+    auto R0 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 8U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 8U);
+
+    auto R1 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 8U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 4U);
+
+    auto R2 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 0U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 0U);
+
+    Mgr.Free(std::move(R1));
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 8U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 4U);
+
+    Mgr.Free(std::move(R0));
+    Mgr.Free(std::move(R2));
+    EXPECT_EQ(Mgr.GetMaxFreeRegionWidth(), 16U);
+    EXPECT_EQ(Mgr.GetMaxFreeRegionHeight(), 8U);
+}
+
 TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
 {
     DynamicAtlasManager Mgr{256, 256};
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureBase.hpp"
+
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(TextureBaseTest, ValidateTextureInitData)
+{
+    TextureDesc Desc;
+    Desc.Name      = "Validate init data test";
+    Desc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    Desc.Width     = 64;
+    Desc.Height    = 32;
+    Desc.ArraySize = 2;
+    Desc.MipLevels = 2;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.Usage     = USAGE_IMMUTABLE;
+
+    std::vector<Uint8>             Data(64 * 32 * 4);
+    std::vector<TextureSubResData> SubResources(4);
+    for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            SubResources[Slice * Desc.MipLevels + Mip].pData  = Data.data();
+            SubResources[Slice * Desc.MipLevels + Mip].Stride = (Desc.Width >> Mip) * 4;
+        }
+    }
+    TextureData InitData{SubResources.data(), static_cast<Uint32>(SubResources.size())};
+    EXPECT_NO_THROW(ValidateTextureInitData(Desc, &InitData));
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"immutable textures must be initialized"};
+        EXPECT_THROW(ValidateTextureInitData(Desc, nullptr), std::runtime_error);
+    }
+
+    {
+        TextureData                    BadInitData{SubResources.data(), 3};
+        TestingEnvironment::ErrorScope ExpectedErrors{"incorrect number of subresources"};
+        EXPECT_THROW(ValidateTextureInitData(Desc, &BadInitData), std::runtime_error);
+    }
+
+    {
+        SubResources[3].pData = nullptr;
+        TestingEnvironment::ErrorScope ExpectedErrors{"must not be null, but not both"};
+        EXPECT_THROW(ValidateTextureInitData(Desc, &InitData), std::runtime_error);
+        SubResources[3].pData = Data.data();
+    }
+
+    {
+        SubResources[1].Stride = 16;
+        TestingEnvironment::ErrorScope ExpectedErrors{"is below the row size"};
+        EXPECT_THROW(ValidateTextureInitData(Desc, &InitData), std::runtime_error);
+        SubResources[1].Stride = 32 * 4;
+    }
+
+    Desc.Usage = USAGE_DEFAULT;
+    EXPECT_NO_THROW(ValidateTextureInitData(Desc, nullptr));
+}
+
+TEST(TextureBaseTest, ValidateTextureInitData3D)
+{
+    TextureDesc Desc;
+    Desc.Name      = "Validate 3D init data test";
+    Desc.Type      = RESOURCE_DIM_TEX_3D;
+    Desc.Width     = 16;
+    Desc.Height    = 16;
+    Desc.Depth     = 4;
+    Desc.MipLevels = 1;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.Usage     = USAGE_IMMUTABLE;
+
+    std::vector<Uint8> Data(16 * 16 * 4 * 4);
+    TextureSubResData  SubResData{Data.data(), 16 * 4, 16 * 16 * 4};
+    TextureData        InitData{&SubResData, 1};
+    EXPECT_NO_THROW(ValidateTextureInitData(Desc, &InitData));
+
+    SubResData.DepthStride = 16 * 4;
+    TestingEnvironment::ErrorScope ExpectedErrors{"is below the depth slice size"};
+    EXPECT_THROW(ValidateTextureInitData(Desc, &InitData), std::runtime_error);
+}
+
+} // namespace
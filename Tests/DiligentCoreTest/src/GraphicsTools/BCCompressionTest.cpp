@@ -0,0 +1,594 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Generates a smooth gradient with some noise and a few hard edges
+std::vector<Uint8> GenerateTestImage(Uint32 Width, Uint32 Height)
+{
+    std::vector<Uint8> Data(size_t{Width} * Height * 4);
+
+    Uint32 Seed = 19;
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+
+            const float u      = static_cast<float>(x) / static_cast<float>(Width);
+            const float v      = static_cast<float>(y) / static_cast<float>(Height);
+            const int   Noise  = static_cast<int>((Seed >> 24) & 7) - 4;
+            const bool  Stripe = ((x / 16) + (y / 16)) % 5 == 0;
+
+            const float Color[4] = {
+                128.f + 127.f * std::sin(u * 6.f),
+                128.f + 127.f * std::cos(v * 5.f),
+                Stripe ? 32.f : 255.f * u * v,
+                255.f * (1.f - u),
+            };
+
+            auto* pDst = &Data[(size_t{y} * Width + x) * 4];
+            for (Uint32 c = 0; c < 4; ++c)
+                pDst[c] = static_cast<Uint8>(std::min(std::max(static_cast<int>(Color[c]) + Noise, 0), 255));
+        }
+    }
+    return Data;
+}
+
+// Reference decoder written directly from the format specification. It shares no code
+// with BCCompression.cpp, so that the encoder quality is not measured by the library's own decoder.
+Uint32 ReadBits(const Uint8* pBlock, Uint32 FirstBit, Uint32 NumBits)
+{
+    Uint32 Value = 0;
+    for (Uint32 b = 0; b < NumBits; ++b)
+        Value |= ((pBlock[(FirstBit + b) / 8] >> ((FirstBit + b) % 8)) & 1u) << b;
+    return Value;
+}
+
+void RefDecodeBC1(const Uint8* pBlock, bool ForceFourColors, Uint8 (&Pixels)[16][4])
+{
+    const Uint32 Color0 = ReadBits(pBlock, 0, 16);
+    const Uint32 Color1 = ReadBits(pBlock, 16, 16);
+
+    int Colors[4][4] = {};
+    for (Uint32 i = 0; i < 2; ++i)
+    {
+        const Uint32 Color = i == 0 ? Color0 : Color1;
+        const Uint32 R     = (Color >> 11) & 31;
+        const Uint32 G     = (Color >> 5) & 63;
+        const Uint32 B     = Color & 31;
+
+        Colors[i][0] = static_cast<int>((R << 3) | (R >> 2));
+        Colors[i][1] = static_cast<int>((G << 2) | (G >> 4));
+        Colors[i][2] = static_cast<int>((B << 3) | (B >> 2));
+        Colors[i][3] = 255;
+    }
+
+    if (ForceFourColors || Color0 > Color1)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            Colors[2][c] = (2 * Colors[0][c] + Colors[1][c] + 1) / 3;
+            Colors[3][c] = (Colors[0][c] + 2 * Colors[1][c] + 1) / 3;
+        }
+        Colors[2][3] = Colors[3][3] = 255;
+    }
+    else
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            Colors[2][c] = (Colors[0][c] + Colors[1][c] + 1) / 2;
+        Colors[2][3] = 255;
+        // Color 3 is transparent black
+    }
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 Idx = ReadBits(pBlock, 32 + i * 2, 2);
+        for (Uint32 c = 0; c < 4; ++c)
+            Pixels[i][c] = static_cast<Uint8>(Colors[Idx][c]);
+    }
+}
+
+void RefDecodeBC4(const Uint8* pBlock, Uint32 Channel, Uint8 (&Pixels)[16][4])
+{
+    const int Value0 = pBlock[0];
+    const int Value1 = pBlock[1];
+
+    int Values[8] = {Value0, Value1};
+    if (Value0 > Value1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            Values[i + 1] = ((7 - i) * Value0 + i * Value1 + 3) / 7;
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            Values[i + 1] = ((5 - i) * Value0 + i * Value1 + 2) / 5;
+        Values[6] = 0;
+        Values[7] = 255;
+    }
+
+    for (Uint32 i = 0; i < 16; ++i)
+        Pixels[i][Channel] = static_cast<Uint8>(Values[ReadBits(pBlock, 16 + i * 3, 3)]);
+}
+
+// Only decodes mode 6, which is the only mode produced by the encoder
+bool RefDecodeBC7(const Uint8* pBlock, Uint8 (&Pixels)[16][4])
+{
+    // Mode 6: six zero bits followed by a one
+    if (ReadBits(pBlock, 0, 7) != (1u << 6))
+        return false;
+
+    // 7-bit R, G, B and A endpoint pairs followed by one p-bit per endpoint
+    int Endpoints[2][4] = {};
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        for (Uint32 e = 0; e < 2; ++e)
+            Endpoints[e][c] = static_cast<int>(ReadBits(pBlock, 7 + (c * 2 + e) * 7, 7) << 1);
+    }
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        const int PBit = static_cast<int>(ReadBits(pBlock, 63 + e, 1));
+        for (Uint32 c = 0; c < 4; ++c)
+            Endpoints[e][c] |= PBit;
+    }
+
+    static constexpr int Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    // The anchor index of the first pixel has an implicit zero most significant bit
+    Uint32 Bit = 65;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 NumBits = i == 0 ? 3 : 4;
+        const int    Weight  = Weights[ReadBits(pBlock, Bit, NumBits)];
+        Bit += NumBits;
+        for (Uint32 c = 0; c < 4; ++c)
+            Pixels[i][c] = static_cast<Uint8>(((64 - Weight) * Endpoints[0][c] + Weight * Endpoints[1][c] + 32) >> 6);
+    }
+    return true;
+}
+
+bool RefDecodeBlock(TEXTURE_FORMAT Format, const Uint8* pBlock, Uint8 (&Pixels)[16][4])
+{
+    for (auto& Pixel : Pixels)
+    {
+        Pixel[0] = Pixel[1] = Pixel[2] = 0;
+        Pixel[3]                       = 255;
+    }
+
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            RefDecodeBC1(pBlock, false, Pixels);
+            return true;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            RefDecodeBC1(pBlock + 8, true, Pixels);
+            RefDecodeBC4(pBlock, 3, Pixels);
+            return true;
+
+        case TEX_FORMAT_BC4_UNORM:
+            RefDecodeBC4(pBlock, 0, Pixels);
+            return true;
+
+        case TEX_FORMAT_BC5_UNORM:
+            RefDecodeBC4(pBlock, 0, Pixels);
+            RefDecodeBC4(pBlock + 8, 1, Pixels);
+            return true;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return RefDecodeBC7(pBlock, Pixels);
+
+        default:
+            return false;
+    }
+}
+
+double ComputePSNR(const std::vector<Uint8>& Ref, const std::vector<Uint8>& Data, Uint32 NumChannels)
+{
+    double SqError = 0;
+    size_t Count   = 0;
+    for (size_t i = 0; i < Ref.size(); i += 4)
+    {
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            const double d = static_cast<double>(Ref[i + c]) - static_cast<double>(Data[i + c]);
+            SqError += d * d;
+            ++Count;
+        }
+    }
+    const double MSE = SqError / static_cast<double>(Count);
+    return MSE > 0 ? 10.0 * std::log10(255.0 * 255.0 / MSE) : 100.0;
+}
+
+struct CompressedImage
+{
+    std::vector<Uint8> Data;
+    size_t             Stride = 0;
+};
+
+CompressedImage Compress(TEXTURE_FORMAT Format, const std::vector<Uint8>& Src, Uint32 Width, Uint32 Height, BC_COMPRESSION_QUALITY Quality, IThreadPool* pThreadPool = nullptr)
+{
+    const auto& FmtAttribs = GetTextureFormatAttribs(Format);
+
+    CompressedImage Image;
+    Image.Stride = size_t{(Width + 3) / 4} * FmtAttribs.ComponentSize;
+    Image.Data.resize(Image.Stride * ((Height + 3) / 4));
+
+    CompressBCAttribs Attribs;
+    Attribs.DstFormat   = Format;
+    Attribs.Width       = Width;
+    Attribs.Height      = Height;
+    Attribs.pSrcData    = Src.data();
+    Attribs.SrcStride   = size_t{Width} * 4;
+    Attribs.pDstData    = Image.Data.data();
+    Attribs.DstStride   = Image.Stride;
+    Attribs.Quality     = Quality;
+    Attribs.pThreadPool = pThreadPool;
+    CompressBC(Attribs);
+
+    return Image;
+}
+
+std::vector<Uint8> Decompress(TEXTURE_FORMAT Format, const CompressedImage& Image, Uint32 Width, Uint32 Height)
+{
+    std::vector<Uint8> Data(size_t{Width} * Height * 4);
+
+    DecompressBCAttribs Attribs;
+    Attribs.SrcFormat = Format;
+    Attribs.Width     = Width;
+    Attribs.Height    = Height;
+    Attribs.pSrcData  = Image.Data.data();
+    Attribs.SrcStride = Image.Stride;
+    Attribs.pDstData  = Data.data();
+    Attribs.DstStride = size_t{Width} * 4;
+    EXPECT_TRUE(DecompressBC(Attribs));
+
+    return Data;
+}
+
+std::vector<Uint8> RefDecompress(TEXTURE_FORMAT Format, const CompressedImage& Image, Uint32 Width, Uint32 Height)
+{
+    const Uint32 BlockSize = GetTextureFormatAttribs(Format).ComponentSize;
+
+    std::vector<Uint8> Data(size_t{Width} * Height * 4);
+    for (Uint32 y = 0; y < Height; y += 4)
+    {
+        for (Uint32 x = 0; x < Width; x += 4)
+        {
+            Uint8 Pixels[16][4];
+            EXPECT_TRUE(RefDecodeBlock(Format, &Image.Data[(y / 4) * Image.Stride + (x / 4) * BlockSize], Pixels));
+            for (Uint32 py = 0; py < 4 && y + py < Height; ++py)
+            {
+                for (Uint32 px = 0; px < 4 && x + px < Width; ++px)
+                    memcpy(&Data[(size_t{y + py} * Width + x + px) * 4], Pixels[py * 4 + px], 4);
+            }
+        }
+    }
+    return Data;
+}
+
+void TestQuality(TEXTURE_FORMAT Format, Uint32 NumChannels, const double (&MinPSNR)[3])
+{
+    constexpr Uint32 Width  = 254;
+    constexpr Uint32 Height = 130;
+
+    auto Src = GenerateTestImage(Width, Height);
+    if (Format == TEX_FORMAT_BC1_UNORM)
+    {
+        // Punch-through alpha decodes to transparent black
+        for (size_t i = 0; i < Src.size(); i += 4)
+        {
+            if (Src[i + 3] < 64)
+                Src[i + 0] = Src[i + 1] = Src[i + 2] = Src[i + 3] = 0;
+            else
+                Src[i + 3] = 255;
+        }
+    }
+
+    double PrevPSNR = 0;
+    for (Uint32 q = 0; q < 3; ++q)
+    {
+        const auto Quality = static_cast<BC_COMPRESSION_QUALITY>(q);
+
+        Timer      T;
+        const auto Image = Compress(Format, Src, Width, Height, Quality);
+        const auto Time  = T.GetElapsedTime();
+
+        const auto Decompressed = RefDecompress(Format, Image, Width, Height);
+        const auto PSNR         = ComputePSNR(Src, Decompressed, NumChannels);
+
+        // The library decoder must agree with the reference decoder up to the rounding of the interpolated colors
+        const auto LibDecompressed = Decompress(Format, Image, Width, Height);
+        for (size_t i = 0; i < Decompressed.size(); ++i)
+        {
+            ASSERT_LE(std::abs(int{Decompressed[i]} - int{LibDecompressed[i]}), 1)
+                << GetTextureFormatAttribs(Format).Name << " quality " << q << ", byte " << i;
+        }
+        LOG_INFO_MESSAGE(GetTextureFormatAttribs(Format).Name, " quality ", q, ": PSNR ", PSNR, " dB, ",
+                         static_cast<double>(Width * Height) / std::max(Time, 1e-6) * 1e-6, " MPix/s");
+
+        EXPECT_GE(PSNR, MinPSNR[q]) << GetTextureFormatAttribs(Format).Name << " quality " << q;
+        EXPECT_GE(PSNR, PrevPSNR - 0.05) << GetTextureFormatAttribs(Format).Name << " quality " << q;
+        PrevPSNR = PSNR;
+    }
+}
+
+TEST(BCCompressionTest, BC1)
+{
+    TestQuality(TEX_FORMAT_BC1_UNORM, 4, {38, 38, 38});
+}
+
+TEST(BCCompressionTest, BC3)
+{
+    TestQuality(TEX_FORMAT_BC3_UNORM, 4, {37, 37, 37});
+}
+
+TEST(BCCompressionTest, BC4)
+{
+    TestQuality(TEX_FORMAT_BC4_UNORM, 1, {48, 48, 49});
+}
+
+TEST(BCCompressionTest, BC5)
+{
+    TestQuality(TEX_FORMAT_BC5_UNORM, 2, {47, 47, 48});
+}
+
+TEST(BCCompressionTest, BC7)
+{
+    TestQuality(TEX_FORMAT_BC7_UNORM, 4, {39, 39, 39});
+}
+
+TEST(BCCompressionTest, IsSupported)
+{
+    EXPECT_TRUE(IsBCCompressionSupported(TEX_FORMAT_BC1_UNORM_SRGB));
+    EXPECT_TRUE(IsBCCompressionSupported(TEX_FORMAT_BC7_UNORM));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_BC2_UNORM));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_BC6H_UF16));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_RGBA8_UNORM));
+}
+
+// Blocks with contents computed by hand from the format specification. Pixel i of
+// every block uses palette entry i % NumColors.
+TEST(BCCompressionTest, GoldenBlocks)
+{
+    struct GoldenBlock
+    {
+        TEXTURE_FORMAT Format;
+        Uint8          Data[16];
+        Uint32         NumColors;
+        Uint8          Palette[16][4];
+    };
+
+    // clang-format off
+    static constexpr GoldenBlock Blocks[] =
+    {
+        // Four-color BC1 block: red and blue endpoints
+        {TEX_FORMAT_BC1_UNORM, {0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4}, 4,
+            {{255, 0, 0, 255}, {0, 0, 255, 255}, {170, 0, 85, 255}, {85, 0, 170, 255}}},
+
+        // Three-color BC1 block with transparent black
+        {TEX_FORMAT_BC1_UNORM, {0x00, 0x00, 0x40, 0x08, 0xE4, 0xE4, 0xE4, 0xE4}, 4,
+            {{0, 0, 0, 255}, {8, 8, 0, 255}, {4, 4, 0, 255}, {0, 0, 0, 0}}},
+
+        // Eight-value BC4 block
+        {TEX_FORMAT_BC4_UNORM, {0xC8, 0x3C, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA}, 8,
+            {{200, 0, 0, 255}, {60, 0, 0, 255}, {180, 0, 0, 255}, {160, 0, 0, 255}, {140, 0, 0, 255}, {120, 0, 0, 255}, {100, 0, 0, 255}, {80, 0, 0, 255}}},
+
+        // Six-value BC4 block with explicit 0 and 255
+        {TEX_FORMAT_BC4_UNORM, {0x3C, 0xC8, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA}, 8,
+            {{60, 0, 0, 255}, {200, 0, 0, 255}, {88, 0, 0, 255}, {116, 0, 0, 255}, {144, 0, 0, 255}, {172, 0, 0, 255}, {0, 0, 0, 255}, {255, 0, 0, 255}}},
+
+        // BC7 mode 6 block: endpoints (0, 20, 254, 254) and (255, 201, 1, 255), index i for pixel i
+        {TEX_FORMAT_BC7_UNORM, {0x40, 0xC0, 0x5F, 0x41, 0xFE, 0x03, 0xFE, 0x7F, 0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE}, 16,
+            {{  0,  20, 254, 254}, { 16,  31, 238, 254}, { 36,  45, 218, 254}, { 52,  57, 203, 254},
+             { 68,  68, 187, 254}, { 84,  79, 171, 254}, {104,  94, 151, 254}, {120, 105, 135, 254},
+             {135, 116, 120, 255}, {151, 127, 104, 255}, {171, 142,  84, 255}, {187, 153,  68, 255},
+             {203, 164,  52, 255}, {219, 176,  37, 255}, {239, 190,  17, 255}, {255, 201,   1, 255}}},
+    };
+    // clang-format on
+
+    for (const auto& Block : Blocks)
+    {
+        const auto& FmtAttribs = GetTextureFormatAttribs(Block.Format);
+
+        CompressedImage Image;
+        Image.Stride = FmtAttribs.ComponentSize;
+        Image.Data.assign(Block.Data, Block.Data + FmtAttribs.ComponentSize);
+
+        const auto LibPixels = Decompress(Block.Format, Image, 4, 4);
+
+        Uint8 RefPixels[16][4];
+        EXPECT_TRUE(RefDecodeBlock(Block.Format, Block.Data, RefPixels));
+
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const auto& Expected = Block.Palette[i % Block.NumColors];
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                EXPECT_EQ(LibPixels[i * 4 + c], Expected[c]) << FmtAttribs.Name << ", pixel " << i << ", channel " << c;
+                EXPECT_EQ(RefPixels[i][c], Expected[c]) << FmtAttribs.Name << ", pixel " << i << ", channel " << c;
+            }
+        }
+    }
+}
+
+TEST(BCCompressionTest, UnsupportedFormats)
+{
+    constexpr Uint32 Width  = 8;
+    constexpr Uint32 Height = 8;
+
+    const auto Src = GenerateTestImage(Width, Height);
+
+    std::vector<Uint8> Dst(size_t{Width / 4} * (Height / 4) * 16, 0xCD);
+
+    CompressBCAttribs Attribs;
+    Attribs.Width     = Width;
+    Attribs.Height    = Height;
+    Attribs.pSrcData  = Src.data();
+    Attribs.SrcStride = size_t{Width} * 4;
+    Attribs.pDstData  = Dst.data();
+    Attribs.DstStride = size_t{Width / 4} * 16;
+
+    const auto CheckDstUntouched = [&Dst]() {
+        for (auto Byte : Dst)
+            ASSERT_EQ(Byte, 0xCD);
+    };
+
+    // Unsupported destination formats
+    for (auto Format : {TEX_FORMAT_BC4_SNORM, TEX_FORMAT_BC5_SNORM, TEX_FORMAT_BC2_UNORM, TEX_FORMAT_BC6H_UF16, TEX_FORMAT_RGBA8_UNORM})
+    {
+        Attribs.DstFormat = Format;
+        TestingEnvironment::ErrorScope ExpectedErrors{"is not supported by the BC encoder"};
+        EXPECT_FALSE(CompressBC(Attribs)) << GetTextureFormatAttribs(Format).Name;
+        CheckDstUntouched();
+    }
+
+    // Unsupported source formats
+    Attribs.DstFormat = TEX_FORMAT_BC7_UNORM;
+    for (auto Format : {TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_RGBA8_SNORM, TEX_FORMAT_R8_SNORM, TEX_FORMAT_RGBA16_UNORM})
+    {
+        Attribs.SrcFormat = Format;
+        TestingEnvironment::ErrorScope ExpectedErrors{"is not supported by the BC encoder"};
+        EXPECT_FALSE(CompressBC(Attribs)) << GetTextureFormatAttribs(Format).Name;
+        CheckDstUntouched();
+    }
+
+    Attribs.SrcFormat = TEX_FORMAT_RGBA8_UNORM;
+    EXPECT_TRUE(CompressBC(Attribs));
+
+    // Unsupported compressed format
+    std::vector<Uint8> Decompressed(size_t{Width} * Height * 4, 0xCD);
+
+    DecompressBCAttribs DecompressAttribs;
+    DecompressAttribs.SrcFormat = TEX_FORMAT_BC4_SNORM;
+    DecompressAttribs.Width     = Width;
+    DecompressAttribs.Height    = Height;
+    DecompressAttribs.pSrcData  = Dst.data();
+    DecompressAttribs.SrcStride = size_t{Width / 4} * 8;
+    DecompressAttribs.pDstData  = Decompressed.data();
+    DecompressAttribs.DstStride = size_t{Width} * 4;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"is not supported by the BC decoder"};
+        EXPECT_FALSE(DecompressBC(DecompressAttribs));
+    }
+    for (auto Byte : Decompressed)
+        ASSERT_EQ(Byte, 0xCD);
+}
+
+TEST(BCCompressionTest, ThreadPool)
+{
+    constexpr Uint32 Width  = 257;
+    constexpr Uint32 Height = 93;
+
+    const auto Src = GenerateTestImage(Width, Height);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (auto Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC4_UNORM, TEX_FORMAT_BC5_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        const auto Ref = Compress(Format, Src, Width, Height, BC_COMPRESSION_QUALITY_NORMAL);
+        const auto MT  = Compress(Format, Src, Width, Height, BC_COMPRESSION_QUALITY_NORMAL, pThreadPool);
+        EXPECT_EQ(Ref.Data, MT.Data) << GetTextureFormatAttribs(Format).Name;
+    }
+}
+
+TEST(BCCompressionTest, ComputeMipLevel)
+{
+    constexpr Uint32 Width  = 64;
+    constexpr Uint32 Height = 36;
+
+    std::vector<Uint8> Fine = GenerateTestImage(Width, Height);
+
+    Uint32 FineWidth  = Width;
+    Uint32 FineHeight = Height;
+    while (FineWidth > 1 || FineHeight > 1)
+    {
+        const Uint32 CoarseWidth  = std::max(FineWidth / 2, 1u);
+        const Uint32 CoarseHeight = std::max(FineHeight / 2, 1u);
+
+        std::vector<Uint8> Coarse(size_t{CoarseWidth} * CoarseHeight * 4);
+
+        CompressedImage Compressed;
+        Compressed.Stride = size_t{(CoarseWidth + 3) / 4} * 16;
+        Compressed.Data.resize(Compressed.Stride * ((CoarseHeight + 3) / 4));
+
+        ComputeMipLevelAttribs Attribs{TEX_FORMAT_RGBA8_UNORM, FineWidth, FineHeight, Fine.data(), size_t{FineWidth} * 4, Coarse.data(), size_t{CoarseWidth} * 4};
+        Attribs.CompressedFormat          = TEX_FORMAT_BC7_UNORM;
+        Attribs.pCompressedCoarseMipData  = Compressed.Data.data();
+        Attribs.CompressedCoarseMipStride = Compressed.Stride;
+        EXPECT_TRUE(ComputeMipLevel(Attribs));
+
+        // The compressed level must be identical to the result of compressing the coarse level
+        const auto Ref = Compress(TEX_FORMAT_BC7_UNORM, Coarse, CoarseWidth, CoarseHeight, Attribs.CompressionQuality);
+        EXPECT_EQ(Compressed.Data, Ref.Data) << CoarseWidth << "x" << CoarseHeight;
+
+        Fine       = std::move(Coarse);
+        FineWidth  = CoarseWidth;
+        FineHeight = CoarseHeight;
+    }
+
+    // Compression failure must be reported to the caller
+    {
+        const std::vector<Uint8> Fine2x2(2 * 2 * 4, 0x80);
+
+        Uint8 Coarse[4]      = {};
+        Uint8 Compressed[16] = {};
+
+        ComputeMipLevelAttribs Attribs{TEX_FORMAT_RGBA8_UNORM, 2, 2, Fine2x2.data(), 2 * 4, Coarse, 4};
+        Attribs.CompressedFormat          = TEX_FORMAT_BC2_UNORM;
+        Attribs.pCompressedCoarseMipData  = Compressed;
+        Attribs.CompressedCoarseMipStride = sizeof(Compressed);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"is not supported by the BC encoder"};
+        EXPECT_FALSE(ComputeMipLevel(Attribs));
+    }
+}
+
+} // namespace
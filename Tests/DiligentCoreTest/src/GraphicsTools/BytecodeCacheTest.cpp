@@ -24,9 +24,17 @@
  *  of the possibility of such damages.
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "BytecodeCache.h"
 #include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
+#include "MappedFileStream.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "TestingEnvironment.hpp"
 #include "gtest/gtest.h"
 
 using namespace Diligent;
@@ -72,6 +80,99 @@ TEST(BytecodeCacheTest, Basic)
     }
 }
 
+TEST(BytecodeCacheTest, LoadReferencedData)
+{
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = "SomeCode";
+
+    const std::string Data{"TestString"};
+
+    RefCntAutoPtr<IDataBlob> pStoredData;
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        pCache->AddBytecode(ShaderCI, DataBlobImpl::Create(Data.length(), Data.c_str()));
+        pCache->Store(&pStoredData);
+        ASSERT_NE(pStoredData, nullptr);
+    }
+
+    Testing::TempDirectory TmpDir;
+    const std::string      FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "BytecodeCache.bin";
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        ASSERT_TRUE(File->Write(pStoredData->GetConstDataPtr(), pStoredData->GetSize()));
+    }
+
+    for (bool ReferenceMappedData : {false, true})
+    {
+        BytecodeCacheCreateInfo CacheCI;
+        CacheCI.DeviceType          = RENDER_DEVICE_TYPE_VULKAN;
+        CacheCI.ReferenceMappedData = ReferenceMappedData;
+
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache(CacheCI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        auto CheckBytecode = [&](IDataBlob* pDataBlob, bool ExpectReferenced) {
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            pCache->GetBytecode(ShaderCI, &pBytecode);
+            ASSERT_NE(pBytecode, nullptr);
+            ASSERT_EQ(pBytecode->GetSize(), Data.length());
+            EXPECT_EQ(memcmp(pBytecode->GetConstDataPtr(), Data.c_str(), Data.length()), 0);
+
+            const auto* pStart = static_cast<const Uint8*>(pDataBlob->GetConstDataPtr());
+            const auto* pData  = static_cast<const Uint8*>(pBytecode->GetConstDataPtr());
+            EXPECT_EQ(pData >= pStart && pData < pStart + pDataBlob->GetSize(), ExpectReferenced);
+        };
+
+        {
+            // A proxy blob that does not own the data must always be copied:
+            // the caller may release the memory right after the call.
+            std::vector<Uint8> CallerData{pStoredData->GetConstDataPtr<Uint8>(), pStoredData->GetConstDataPtr<Uint8>() + pStoredData->GetSize()};
+
+            RefCntAutoPtr<IDataBlob> pDataBlob = ProxyDataBlob::Create(static_cast<const void*>(CallerData.data()), CallerData.size());
+            EXPECT_TRUE(pCache->Load(pDataBlob));
+            CheckBytecode(pDataBlob, false);
+
+            std::fill(CallerData.begin(), CallerData.end(), Uint8{0xCD});
+            pDataBlob.Release();
+            CallerData.clear();
+            CallerData.shrink_to_fit();
+
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            pCache->GetBytecode(ShaderCI, &pBytecode);
+            ASSERT_NE(pBytecode, nullptr);
+            EXPECT_EQ(memcmp(pBytecode->GetConstDataPtr(), Data.c_str(), Data.length()), 0);
+        }
+
+        {
+            // The data of a mapped file is only referenced when explicitly enabled
+            auto pStream = MappedFileStream::Create(FilePath.c_str());
+            ASSERT_NE(pStream, nullptr);
+
+            auto pDataBlob = pStream->GetDataBlob();
+            pCache->Clear();
+            EXPECT_TRUE(pCache->Load(pDataBlob));
+            CheckBytecode(pDataBlob, ReferenceMappedData && MappedFile::IsMemoryMapped);
+        }
+    }
+
+    {
+        // Truncated data
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        RefCntAutoPtr<IDataBlob>                pDataBlob = ProxyDataBlob::Create(pStoredData->GetConstDataPtr(), pStoredData->GetSize() - 1);
+        Testing::TestingEnvironment::ErrorScope ExpectedErrors{"Bytecode cache data is truncated"};
+        EXPECT_FALSE(pCache->Load(pDataBlob));
+    }
+}
+
 TEST(BytecodeCacheTest, RemoveBytecode)
 {
     RefCntAutoPtr<IBytecodeCache> pCache;
@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUProfiler.hpp"
+
+#include <thread>
+#include <chrono>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(GPUProfilerTest, CPUOnly)
+{
+    GPUProfiler::CreateInfo CI;
+    CI.MaxResolvedFrames = 2;
+
+    GPUProfiler Profiler{nullptr, CI};
+    EXPECT_FALSE(Profiler.IsGPUTimingEnabled());
+
+    constexpr Uint32 NumFrames = 3;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        {
+            GPUProfiler::ScopedZone Frame{Profiler, nullptr, "Frame"};
+            {
+                GPUProfiler::ScopedZone Shadows{Profiler, nullptr, "Shadows"};
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+            {
+                GPUProfiler::ScopedZone Opaque{Profiler, nullptr, "Opaque \"pass\""};
+                {
+                    GPUProfiler::ScopedZone Terrain{Profiler, nullptr, "Terrain"};
+                }
+            }
+        }
+        Profiler.EndFrame(nullptr);
+    }
+
+    // CPU-only frames are resolved immediately
+    EXPECT_EQ(Profiler.GetPendingFrameCount(), size_t{0});
+    EXPECT_EQ(Profiler.GetQueryPoolSize(), 0u);
+
+    const auto& Frames = Profiler.GetResolvedFrames();
+    ASSERT_EQ(Frames.size(), size_t{2});
+    EXPECT_EQ(Frames[0].FrameNumber, Uint64{1});
+    EXPECT_EQ(Frames[1].FrameNumber, Uint64{2});
+    EXPECT_LE(Frames[0].CPUEnd, Frames[1].CPUStart);
+
+    const auto& Zones = Frames[1].Zones;
+    ASSERT_EQ(Zones.size(), size_t{4});
+
+    EXPECT_EQ(Zones[0].Name, "Frame");
+    EXPECT_EQ(Zones[0].Depth, 0u);
+    EXPECT_EQ(Zones[0].Parent, ~0u);
+
+    EXPECT_EQ(Zones[1].Name, "Shadows");
+    EXPECT_EQ(Zones[1].Depth, 1u);
+    EXPECT_EQ(Zones[1].Parent, 0u);
+    EXPECT_GE(Zones[1].CPUEnd - Zones[1].CPUStart, 0.001);
+
+    EXPECT_EQ(Zones[2].Name, "Opaque \"pass\"");
+    EXPECT_EQ(Zones[2].Depth, 1u);
+    EXPECT_EQ(Zones[2].Parent, 0u);
+
+    EXPECT_EQ(Zones[3].Name, "Terrain");
+    EXPECT_EQ(Zones[3].Depth, 2u);
+    EXPECT_EQ(Zones[3].Parent, 2u);
+
+    for (const auto& Zone : Zones)
+    {
+        EXPECT_FALSE(Zone.HasGPUData);
+        EXPECT_LE(Zone.CPUStart, Zone.CPUEnd);
+        EXPECT_LE(Frames[1].CPUStart, Zone.CPUStart);
+        EXPECT_LE(Zone.CPUEnd, Frames[1].CPUEnd);
+        if (Zone.Parent != ~0u)
+        {
+            EXPECT_LE(Zones[Zone.Parent].CPUStart, Zone.CPUStart);
+            EXPECT_LE(Zone.CPUEnd, Zones[Zone.Parent].CPUEnd);
+        }
+    }
+
+    const auto Trace = Profiler.GetChromeTrace();
+    EXPECT_EQ(Trace.front(), '{');
+    EXPECT_NE(Trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Frame 2\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Opaque \\\"pass\\\"\""), std::string::npos);
+    EXPECT_EQ(Trace.find("\"cat\":\"GPU\""), std::string::npos);
+
+    Profiler.ClearResolvedFrames();
+    EXPECT_TRUE(Profiler.GetResolvedFrames().empty());
+}
+
+TEST(GPUProfilerTest, UnbalancedZones)
+{
+    GPUProfiler Profiler{nullptr};
+
+    Profiler.BeginZone(nullptr, "Open");
+    Profiler.BeginZone(nullptr, "Nested");
+    Profiler.EndZone(nullptr);
+    {
+        // The remaining zone is closed by EndFrame
+        TestingEnvironment::ErrorScope ExpectedErrors{"open zones at the end of the frame"};
+        Profiler.EndFrame(nullptr);
+    }
+
+    const auto& Frames = Profiler.GetResolvedFrames();
+    ASSERT_EQ(Frames.size(), size_t{1});
+    ASSERT_EQ(Frames[0].Zones.size(), size_t{2});
+    EXPECT_LE(Frames[0].Zones[0].CPUEnd, Frames[0].CPUEnd);
+}
+
+} // namespace
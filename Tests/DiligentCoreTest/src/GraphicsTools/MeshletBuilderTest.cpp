@@ -0,0 +1,420 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MeshletBuilder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Timer.hpp"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+};
+
+// Regular grid in the XY plane with NumCells x NumCells cells
+TestMesh CreateGrid(Uint32 NumCells)
+{
+    TestMesh Mesh;
+    for (Uint32 y = 0; y <= NumCells; ++y)
+    {
+        for (Uint32 x = 0; x <= NumCells; ++x)
+            Mesh.Positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.f);
+    }
+    for (Uint32 y = 0; y < NumCells; ++y)
+    {
+        for (Uint32 x = 0; x < NumCells; ++x)
+        {
+            const Uint32 v0 = y * (NumCells + 1) + x;
+            const Uint32 v1 = v0 + 1;
+            const Uint32 v2 = v0 + NumCells + 1;
+            const Uint32 v3 = v2 + 1;
+            Mesh.Indices.insert(Mesh.Indices.end(), {v0, v1, v2, v2, v1, v3});
+        }
+    }
+    return Mesh;
+}
+
+// Unit sphere with outward-facing counter-clockwise triangles
+TestMesh CreateSphere(Uint32 NumRings, Uint32 NumSegments)
+{
+    TestMesh Mesh;
+    for (Uint32 r = 0; r <= NumRings; ++r)
+    {
+        const float Theta = PI_F * static_cast<float>(r) / static_cast<float>(NumRings);
+        for (Uint32 s = 0; s <= NumSegments; ++s)
+        {
+            const float Phi = 2.f * PI_F * static_cast<float>(s) / static_cast<float>(NumSegments);
+            Mesh.Positions.emplace_back(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+        }
+    }
+    for (Uint32 r = 0; r < NumRings; ++r)
+    {
+        for (Uint32 s = 0; s < NumSegments; ++s)
+        {
+            const Uint32 v0 = r * (NumSegments + 1) + s;
+            const Uint32 v1 = v0 + 1;
+            const Uint32 v2 = v0 + NumSegments + 1;
+            const Uint32 v3 = v2 + 1;
+            // Triangles at the poles are degenerate and are skipped by the builder
+            Mesh.Indices.insert(Mesh.Indices.end(), {v0, v2, v1, v1, v2, v3});
+        }
+    }
+    return Mesh;
+}
+
+bool IsDegenerate(const Uint32* pTri)
+{
+    return pTri[0] == pTri[1] || pTri[1] == pTri[2] || pTri[2] == pTri[0];
+}
+
+void VerifyMeshlets(const TestMesh& Mesh, const BuildMeshletsAttribs& Attribs, const MeshletData& Data)
+{
+    ASSERT_EQ(Data.Bounds.size(), Data.Meshlets.size());
+
+    const Uint32 NumTriangles = static_cast<Uint32>(Mesh.Indices.size() / 3);
+
+    // Every non-degenerate triangle must be emitted exactly once
+    std::vector<Uint32>                                  TriangleCount(NumTriangles);
+    std::map<std::array<Uint32, 3>, std::vector<Uint32>> TriangleMap;
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        const Uint32* pTri = &Mesh.Indices[t * 3];
+        if (!IsDegenerate(pTri))
+            TriangleMap[{pTri[0], pTri[1], pTri[2]}].push_back(t);
+    }
+
+    for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+    {
+        const Meshlet& M = Data.Meshlets[m];
+        EXPECT_GT(M.PrimitiveCount, 0u);
+        EXPECT_LE(M.VertexCount, Attribs.MaxVertices);
+        EXPECT_LE(M.PrimitiveCount, Attribs.MaxPrimitives);
+        ASSERT_LE(M.VertexOffset + M.VertexCount, Data.Vertices.size());
+        ASSERT_LE(M.PrimitiveOffset + M.PrimitiveCount, Data.Primitives.size());
+
+        const MeshletBounds& Bounds = Data.Bounds[m];
+        const float3         Center{Bounds.Sphere.x, Bounds.Sphere.y, Bounds.Sphere.z};
+        for (Uint32 v = 0; v < M.VertexCount; ++v)
+        {
+            const Uint32 Vertex = Data.Vertices[M.VertexOffset + v];
+            ASSERT_LT(Vertex, Mesh.Positions.size());
+            EXPECT_LE(length(Mesh.Positions[Vertex] - Center), Bounds.Sphere.w * 1.0001f + 1e-6f);
+        }
+
+        for (Uint32 p = 0; p < M.PrimitiveCount; ++p)
+        {
+            const Uint32 Primitive = Data.Primitives[M.PrimitiveOffset + p];
+            EXPECT_EQ(Primitive >> 24, 0u);
+
+            std::array<Uint32, 3> Tri;
+            for (Uint32 i = 0; i < 3; ++i)
+            {
+                const Uint32 LocalIndex = (Primitive >> (i * 8)) & 0xFF;
+                ASSERT_LT(LocalIndex, M.VertexCount);
+                Tri[i] = Data.Vertices[M.VertexOffset + LocalIndex];
+            }
+
+            auto it = TriangleMap.find(Tri);
+            ASSERT_NE(it, TriangleMap.end()) << "Triangle is not found in the source mesh";
+            ASSERT_FALSE(it->second.empty()) << "Triangle is emitted more than once";
+            ++TriangleCount[it->second.back()];
+            it->second.pop_back();
+        }
+    }
+
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        EXPECT_EQ(TriangleCount[t], IsDegenerate(&Mesh.Indices[t * 3]) ? 0u : 1u) << "Triangle " << t;
+    }
+}
+
+BuildMeshletsAttribs GetAttribs(const TestMesh& Mesh)
+{
+    BuildMeshletsAttribs Attribs;
+    Attribs.pIndices    = Mesh.Indices.data();
+    Attribs.IndexType   = VT_UINT32;
+    Attribs.NumIndices  = static_cast<Uint32>(Mesh.Indices.size());
+    Attribs.pPositions  = Mesh.Positions.data();
+    Attribs.NumVertices = static_cast<Uint32>(Mesh.Positions.size());
+    return Attribs;
+}
+
+TEST(MeshletBuilderTest, Grid)
+{
+    const TestMesh Mesh = CreateGrid(64);
+
+    for (Uint32 MaxVertices : {3u, 16u, 64u, 128u, 256u})
+    {
+        for (Uint32 MaxPrimitives : {1u, 32u, 124u, 512u})
+        {
+            BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+            Attribs.MaxVertices          = MaxVertices;
+            Attribs.MaxPrimitives        = MaxPrimitives;
+
+            MeshletData Data;
+            BuildMeshlets(Attribs, Data);
+            VerifyMeshlets(Mesh, Attribs, Data);
+            ASSERT_EQ(Data.Submeshes.size(), 1u);
+            EXPECT_EQ(Data.Submeshes[0].FirstMeshlet, 0u);
+            EXPECT_EQ(Data.Submeshes[0].NumMeshlets, Data.Meshlets.size());
+        }
+    }
+
+    // A flat grid with 64 vertices per meshlet should produce well-filled meshlets
+    BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+
+    MeshletData Data;
+    BuildMeshlets(Attribs, Data);
+    const float AvgPrimitives = static_cast<float>(Data.Primitives.size()) / static_cast<float>(Data.Meshlets.size());
+    EXPECT_GT(AvgPrimitives, 80.f);
+}
+
+TEST(MeshletBuilderTest, Uint16Indices)
+{
+    const TestMesh Mesh = CreateGrid(32);
+
+    std::vector<Uint16> Indices16{Mesh.Indices.begin(), Mesh.Indices.end()};
+
+    BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+
+    MeshletData RefData;
+    BuildMeshlets(Attribs, RefData);
+
+    Attribs.pIndices  = Indices16.data();
+    Attribs.IndexType = VT_UINT16;
+
+    MeshletData Data;
+    BuildMeshlets(Attribs, Data);
+    VerifyMeshlets(Mesh, Attribs, Data);
+
+    EXPECT_EQ(Data.Vertices, RefData.Vertices);
+    EXPECT_EQ(Data.Primitives, RefData.Primitives);
+}
+
+TEST(MeshletBuilderTest, PositionStride)
+{
+    const TestMesh Mesh = CreateSphere(32, 64);
+
+    std::vector<float4> Positions;
+    for (const float3& Pos : Mesh.Positions)
+        Positions.emplace_back(Pos, 1.f);
+
+    BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+
+    MeshletData RefData;
+    BuildMeshlets(Attribs, RefData);
+
+    Attribs.pPositions     = Positions.data();
+    Attribs.PositionStride = sizeof(float4);
+
+    MeshletData Data;
+    BuildMeshlets(Attribs, Data);
+    VerifyMeshlets(Mesh, Attribs, Data);
+
+    EXPECT_EQ(Data.Primitives, RefData.Primitives);
+    ASSERT_EQ(Data.Bounds.size(), RefData.Bounds.size());
+    for (size_t i = 0; i < Data.Bounds.size(); ++i)
+    {
+        EXPECT_EQ(Data.Bounds[i].Sphere, RefData.Bounds[i].Sphere);
+        EXPECT_EQ(Data.Bounds[i].ConeAxis, RefData.Bounds[i].ConeAxis);
+    }
+}
+
+TEST(MeshletBuilderTest, NormalCone)
+{
+    const TestMesh Mesh = CreateSphere(64, 128);
+
+    BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+
+    MeshletData Data;
+    BuildMeshlets(Attribs, Data);
+    VerifyMeshlets(Mesh, Attribs, Data);
+
+    std::mt19937                          Gen{0};
+    std::uniform_real_distribution<float> Dist{-4.f, 4.f};
+
+    size_t NumCulled = 0;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const float3 Camera{Dist(Gen), Dist(Gen), Dist(Gen)};
+        if (length(Camera) < 1.5f)
+            continue;
+
+        for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+        {
+            const Meshlet&       M      = Data.Meshlets[m];
+            const MeshletBounds& Bounds = Data.Bounds[m];
+            const float3         Apex{Bounds.ConeApex.x, Bounds.ConeApex.y, Bounds.ConeApex.z};
+            const float3         Axis{Bounds.ConeAxis.x, Bounds.ConeAxis.y, Bounds.ConeAxis.z};
+            if (dot(normalize(Apex - Camera), Axis) < Bounds.ConeAxis.w)
+                continue;
+
+            // All triangles of a culled meshlet must be back-facing
+            ++NumCulled;
+            for (Uint32 p = 0; p < M.PrimitiveCount; ++p)
+            {
+                const Uint32 Primitive = Data.Primitives[M.PrimitiveOffset + p];
+
+                float3 Tri[3];
+                for (Uint32 v = 0; v < 3; ++v)
+                    Tri[v] = Mesh.Positions[Data.Vertices[M.VertexOffset + ((Primitive >> (v * 8)) & 0xFF)]];
+
+                const float3 Normal = cross(Tri[1] - Tri[0], Tri[2] - Tri[0]);
+                EXPECT_GE(dot(Normal, Tri[0] - Camera), -1e-6f);
+            }
+        }
+    }
+
+    // Roughly half of the meshlets face away from the camera
+    EXPECT_GT(NumCulled, size_t{0});
+}
+
+TEST(MeshletBuilderTest, Submeshes)
+{
+    const TestMesh Grid   = CreateGrid(48);
+    const TestMesh Sphere = CreateSphere(24, 48);
+
+    // Concatenate several copies of the two meshes
+    TestMesh                    Mesh;
+    std::vector<MeshletSubmesh> Submeshes;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const TestMesh& Src        = (i % 2) == 0 ? Grid : Sphere;
+        const Uint32    BaseVertex = static_cast<Uint32>(Mesh.Positions.size());
+        Submeshes.push_back({static_cast<Uint32>(Mesh.Indices.size()), static_cast<Uint32>(Src.Indices.size())});
+        Mesh.Positions.insert(Mesh.Positions.end(), Src.Positions.begin(), Src.Positions.end());
+        for (Uint32 Index : Src.Indices)
+            Mesh.Indices.push_back(Index + BaseVertex);
+    }
+    // Empty submesh
+    Submeshes.push_back({static_cast<Uint32>(Mesh.Indices.size()), 0});
+
+    BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+    Attribs.pSubmeshes           = Submeshes.data();
+    Attribs.NumSubmeshes         = static_cast<Uint32>(Submeshes.size());
+
+    MeshletData RefData;
+    BuildMeshlets(Attribs, RefData);
+    VerifyMeshlets(Mesh, Attribs, RefData);
+
+    ASSERT_EQ(RefData.Submeshes.size(), Submeshes.size());
+    Uint32 FirstMeshlet = 0;
+    for (size_t i = 0; i < Submeshes.size(); ++i)
+    {
+        const MeshletRange& Range = RefData.Submeshes[i];
+        EXPECT_EQ(Range.FirstMeshlet, FirstMeshlet);
+        FirstMeshlet += Range.NumMeshlets;
+
+        // Meshlets must only reference the triangles of their submesh
+        for (Uint32 m = Range.FirstMeshlet; m < Range.FirstMeshlet + Range.NumMeshlets; ++m)
+        {
+            const Meshlet& M = RefData.Meshlets[m];
+            for (Uint32 v = 0; v < M.VertexCount; ++v)
+            {
+                const Uint32 Vertex = RefData.Vertices[M.VertexOffset + v];
+                const auto   MinMax = std::minmax_element(Mesh.Indices.begin() + Submeshes[i].FirstIndex,
+                                                        Mesh.Indices.begin() + Submeshes[i].FirstIndex + Submeshes[i].NumIndices);
+                EXPECT_GE(Vertex, *MinMax.first);
+                EXPECT_LE(Vertex, *MinMax.second);
+            }
+        }
+    }
+    EXPECT_EQ(FirstMeshlet, RefData.Meshlets.size());
+    EXPECT_EQ(RefData.Submeshes.back().NumMeshlets, 0u);
+
+    // The result must not depend on the thread pool
+    auto pThreadPool    = CreateThreadPool(ThreadPoolCreateInfo{4});
+    Attribs.pThreadPool = pThreadPool;
+
+    MeshletData Data;
+    BuildMeshlets(Attribs, Data);
+    EXPECT_EQ(Data.Vertices, RefData.Vertices);
+    EXPECT_EQ(Data.Primitives, RefData.Primitives);
+    ASSERT_EQ(Data.Meshlets.size(), RefData.Meshlets.size());
+    for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+    {
+        EXPECT_EQ(Data.Meshlets[m].VertexOffset, RefData.Meshlets[m].VertexOffset);
+        EXPECT_EQ(Data.Meshlets[m].PrimitiveOffset, RefData.Meshlets[m].PrimitiveOffset);
+    }
+}
+
+TEST(MeshletBuilderTest, DISABLED_Performance)
+{
+    // 2M triangles split into 16 submeshes
+    constexpr Uint32 NumSubmeshes = 16;
+    const TestMesh   Sphere       = CreateSphere(256, 256);
+
+    TestMesh                    Mesh;
+    std::vector<MeshletSubmesh> Submeshes;
+    for (Uint32 i = 0; i < NumSubmeshes; ++i)
+    {
+        const Uint32 BaseVertex = static_cast<Uint32>(Mesh.Positions.size());
+        Submeshes.push_back({static_cast<Uint32>(Mesh.Indices.size()), static_cast<Uint32>(Sphere.Indices.size())});
+        Mesh.Positions.insert(Mesh.Positions.end(), Sphere.Positions.begin(), Sphere.Positions.end());
+        for (Uint32 Index : Sphere.Indices)
+            Mesh.Indices.push_back(Index + BaseVertex);
+    }
+    const size_t NumTriangles = Mesh.Indices.size() / 3;
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        BuildMeshletsAttribs Attribs = GetAttribs(Mesh);
+        Attribs.pSubmeshes           = Submeshes.data();
+        Attribs.NumSubmeshes         = NumSubmeshes;
+        Attribs.pThreadPool          = pPool;
+
+        MeshletData Data;
+        Timer       T;
+        BuildMeshlets(Attribs, Data);
+        const double Time = T.GetElapsedTime();
+
+        const double VertexFill    = static_cast<double>(Data.Vertices.size()) / (Data.Meshlets.size() * Attribs.MaxVertices);
+        const double PrimitiveFill = static_cast<double>(Data.Primitives.size()) / (Data.Meshlets.size() * Attribs.MaxPrimitives);
+        LOG_INFO_MESSAGE("Built ", Data.Meshlets.size(), " meshlets from ", NumTriangles, " triangles in ", Time * 1000, " ms (",
+                         NumTriangles / Time * 1e-6, " M triangles/s, ", (pPool != nullptr ? "4 threads" : "single thread"),
+                         "). Vertex fill rate: ", VertexFill * 100, "%, primitive fill rate: ", PrimitiveFill * 100, '%');
+
+        EXPECT_GT(PrimitiveFill, 0.6);
+    }
+}
+
+} // namespace
@@ -0,0 +1,347 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PixelFormatConversion.hpp"
+#include "GraphicsAccessories.hpp"
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 TestWidth  = 139;
+constexpr Uint32 TestHeight = 37;
+
+std::vector<Uint8> GenerateRGBA8(Uint32 Width, Uint32 Height)
+{
+    std::vector<Uint8> Data(size_t{Width} * Height * 4);
+
+    FastRandInt Rnd{0, 0, 255};
+    for (auto& Val : Data)
+        Val = static_cast<Uint8>(Rnd());
+    // Make sure that all values are present
+    for (size_t i = 0; i < std::min(Data.size(), size_t{256 * 4}); ++i)
+        Data[i] = static_cast<Uint8>(i / 4);
+
+    return Data;
+}
+
+std::vector<Uint8> Convert(TEXTURE_FORMAT              SrcFormat,
+                           TEXTURE_FORMAT              DstFormat,
+                           const std::vector<Uint8>&   Src,
+                           Uint32                      Width,
+                           Uint32                      Height,
+                           const ConvertPixelsAttribs& Options = {})
+{
+    const Uint32 SrcPixelSize = GetTextureFormatAttribs(SrcFormat).GetElementSize();
+    const Uint32 DstPixelSize = GetTextureFormatAttribs(DstFormat).GetElementSize();
+    VERIFY_EXPR(Src.size() == size_t{Width} * Height * SrcPixelSize);
+
+    std::vector<Uint8> Dst(size_t{Width} * Height * DstPixelSize);
+
+    ConvertPixelsAttribs Attribs = Options;
+    Attribs.SrcFormat            = SrcFormat;
+    Attribs.DstFormat            = DstFormat;
+    Attribs.Width                = Width;
+    Attribs.Height               = Height;
+    Attribs.pSrcData             = Src.data();
+    Attribs.SrcStride            = size_t{Width} * SrcPixelSize;
+    Attribs.pDstData             = Dst.data();
+    Attribs.DstStride            = size_t{Width} * DstPixelSize;
+    ConvertPixels(Attribs);
+
+    return Dst;
+}
+
+void TestRoundTrip(TEXTURE_FORMAT Format8, TEXTURE_FORMAT IntermediateFormat, Uint32 MaxColorError, Uint32 MaxAlphaError)
+{
+    const auto Src  = GenerateRGBA8(TestWidth, TestHeight);
+    const auto Tmp  = Convert(Format8, IntermediateFormat, Src, TestWidth, TestHeight);
+    const auto Dst  = Convert(IntermediateFormat, Format8, Tmp, TestWidth, TestHeight);
+    const auto Name = GetTextureFormatAttribs(IntermediateFormat).Name;
+
+    ASSERT_EQ(Src.size(), Dst.size());
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        const Uint32 MaxError = (i % 4) == 3 ? MaxAlphaError : MaxColorError;
+        if (static_cast<Uint32>(std::abs(Int32{Src[i]} - Int32{Dst[i]})) > MaxError)
+        {
+            ADD_FAILURE() << Name << ": value " << i << " is " << Uint32{Dst[i]} << " while " << Uint32{Src[i]} << " is expected";
+            break;
+        }
+    }
+}
+
+TEST(PixelFormatConversionTest, RoundTrip)
+{
+    for (auto Format8 : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_BGRA8_UNORM_SRGB})
+    {
+        const bool IsSRGB = GetTextureFormatAttribs(Format8).ComponentType == COMPONENT_TYPE_UNORM_SRGB;
+
+        // 8-bit linear and sRGB values can't be converted to each other without loss
+        TestRoundTrip(Format8, IsSRGB ? TEX_FORMAT_RGBA8_UNORM_SRGB : TEX_FORMAT_RGBA8_UNORM, 0, 0);
+        TestRoundTrip(Format8, IsSRGB ? TEX_FORMAT_BGRA8_UNORM_SRGB : TEX_FORMAT_BGRA8_UNORM, 0, 0);
+        TestRoundTrip(Format8, TEX_FORMAT_RGBA32_FLOAT, 0, 0);
+        TestRoundTrip(Format8, TEX_FORMAT_RGBA16_FLOAT, 0, 0);
+        // 10-bit linear values are coarser than 8-bit sRGB values near black
+        TestRoundTrip(Format8, TEX_FORMAT_RGB10A2_UNORM, IsSRGB ? 2 : 0, 43);
+        // 10-bit blue channel has 5 bits of mantissa
+        TestRoundTrip(Format8, TEX_FORMAT_R11G11B10_FLOAT, 2, 255);
+    }
+}
+
+TEST(PixelFormatConversionTest, SRGB)
+{
+    const auto Src = GenerateRGBA8(TestWidth, TestHeight);
+
+    const auto Linear = Convert(TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_RGBA32_FLOAT, Src, TestWidth, TestHeight);
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        float Val;
+        std::memcpy(&Val, &Linear[i * 4], sizeof(Val));
+        const float Ref = (i % 4) == 3 ? Src[i] / 255.f : GammaToLinear(Src[i] / 255.f);
+        EXPECT_NEAR(Val, Ref, 1e-6f);
+    }
+
+    // Linear 8-bit to sRGB is lossy, but must be monotonic and close to the reference
+    const auto SRGB = Convert(TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, Src, TestWidth, TestHeight);
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        const float Ref = (i % 4) == 3 ? Src[i] : LinearToGamma(Src[i] / 255.f) * 255.f;
+        EXPECT_NEAR(SRGB[i], Ref, 0.5f + 1e-3f);
+    }
+}
+
+TEST(PixelFormatConversionTest, Half)
+{
+    // All finite 16-bit values must survive the round trip through 32-bit floats
+    std::vector<Uint8> Src(65536 * 2);
+    Uint32             NumValues = 0;
+    for (Uint32 h = 0; h < 65536; ++h)
+    {
+        if (((h >> 10) & 0x1F) == 0x1F)
+            continue; // Skip infinities and NaNs
+        const Uint16 Val = static_cast<Uint16>(h);
+        std::memcpy(&Src[NumValues * 2], &Val, sizeof(Val));
+        ++NumValues;
+    }
+    Src.resize(NumValues * 2);
+
+    const auto Float = Convert(TEX_FORMAT_RGBA16_FLOAT, TEX_FORMAT_RGBA32_FLOAT, Src, NumValues / 4, 1);
+    const auto Dst   = Convert(TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_RGBA16_FLOAT, Float, NumValues / 4, 1);
+    EXPECT_EQ(Src, Dst);
+
+    auto ToHalf = [](float Val) {
+        std::vector<Uint8> Src(16);
+        for (Uint32 c = 0; c < 4; ++c)
+            std::memcpy(&Src[c * 4], &Val, sizeof(Val));
+        const auto Dst = Convert(TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_RGBA16_FLOAT, Src, 1, 1);
+        Uint16     h;
+        std::memcpy(&h, Dst.data(), sizeof(h));
+        return h;
+    };
+    EXPECT_EQ(ToHalf(1.f), 0x3C00);
+    EXPECT_EQ(ToHalf(-2.f), 0xC000);
+    EXPECT_EQ(ToHalf(65504.f), 0x7BFF);
+    EXPECT_EQ(ToHalf(65520.f), 0x7C00);
+    EXPECT_EQ(ToHalf(1e10f), 0x7C00);
+    EXPECT_EQ(ToHalf(5.96046448e-8f), 0x0001);
+    EXPECT_EQ(ToHalf(2.98023224e-8f), 0x0000); // Ties round to even
+    EXPECT_EQ(ToHalf(1.f + 1.f / 2048.f), 0x3C00);
+    EXPECT_EQ(ToHalf(1.f + 3.f / 2048.f), 0x3C02);
+}
+
+TEST(PixelFormatConversionTest, R11G11B10)
+{
+    std::vector<Uint8> Src(4 * 16);
+    const float        Values[][4] = {
+        {0.f, 1.f, 0.5f, 1.f},
+        {65024.f, 64512.f, 1e10f, 1.f},
+        {-1.f, std::nanf(""), 6.10351562e-5f, 1.f},
+        {1.f / 64.f / 16384.f, 1.f / 32.f / 16384.f, 1.f / 32.f / 16384.f, 1.f},
+    };
+    std::memcpy(Src.data(), Values, sizeof(Values));
+
+    const auto Packed = Convert(TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_R11G11B10_FLOAT, Src, 4, 1);
+    const auto Dst    = Convert(TEX_FORMAT_R11G11B10_FLOAT, TEX_FORMAT_RGBA32_FLOAT, Packed, 4, 1);
+
+    float Res[4][4];
+    std::memcpy(Res, Dst.data(), sizeof(Res));
+    EXPECT_EQ(Res[0][0], 0.f);
+    EXPECT_EQ(Res[0][1], 1.f);
+    EXPECT_EQ(Res[0][2], 0.5f);
+    EXPECT_EQ(Res[1][0], 65024.f); // Max finite 11-bit value
+    EXPECT_EQ(Res[1][1], 64512.f); // Max finite 10-bit value
+    EXPECT_EQ(Res[1][2], 64512.f); // Clamped
+    EXPECT_EQ(Res[2][0], 0.f);     // Negative values are clamped to zero
+    EXPECT_EQ(Res[2][1], 0.f);     // NaN is converted to zero
+    EXPECT_EQ(Res[2][2], 6.10351562e-5f);
+    EXPECT_EQ(Res[3][0], 1.f / 64.f / 16384.f); // Smallest 11-bit subnormal
+    EXPECT_EQ(Res[3][1], 1.f / 32.f / 16384.f);
+    EXPECT_EQ(Res[3][2], 1.f / 32.f / 16384.f); // Smallest 10-bit subnormal
+    for (Uint32 i = 0; i < 4; ++i)
+        EXPECT_EQ(Res[i][3], 1.f);
+}
+
+TEST(PixelFormatConversionTest, Swizzle)
+{
+    const auto Src = GenerateRGBA8(TestWidth, TestHeight);
+
+    const auto BGRA = Convert(TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_BGRA8_UNORM, Src, TestWidth, TestHeight);
+    for (size_t i = 0; i < Src.size(); i += 4)
+    {
+        EXPECT_EQ(BGRA[i + 0], Src[i + 2]);
+        EXPECT_EQ(BGRA[i + 1], Src[i + 1]);
+        EXPECT_EQ(BGRA[i + 2], Src[i + 0]);
+        EXPECT_EQ(BGRA[i + 3], Src[i + 3]);
+    }
+
+    ConvertPixelsAttribs Options;
+    Options.Swizzle = {TEXTURE_COMPONENT_SWIZZLE_A, TEXTURE_COMPONENT_SWIZZLE_ONE, TEXTURE_COMPONENT_SWIZZLE_ZERO, TEXTURE_COMPONENT_SWIZZLE_R};
+
+    // The byte path and the floating-point path must produce the same result
+    const auto Swizzled8 = Convert(TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_RGBA8_UNORM, BGRA, TestWidth, TestHeight, Options);
+    const auto SwizzledF = Convert(TEX_FORMAT_RGBA32_FLOAT, TEX_FORMAT_RGBA8_UNORM,
+                                   Convert(TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_RGBA32_FLOAT, BGRA, TestWidth, TestHeight),
+                                   TestWidth, TestHeight, Options);
+    EXPECT_EQ(Swizzled8, SwizzledF);
+    for (size_t i = 0; i < Src.size(); i += 4)
+    {
+        EXPECT_EQ(Swizzled8[i + 0], Src[i + 3]);
+        EXPECT_EQ(Swizzled8[i + 1], 255);
+        EXPECT_EQ(Swizzled8[i + 2], 0);
+        EXPECT_EQ(Swizzled8[i + 3], Src[i + 0]);
+    }
+}
+
+TEST(PixelFormatConversionTest, PremultiplyAlpha)
+{
+    const auto Src = GenerateRGBA8(TestWidth, TestHeight);
+
+    ConvertPixelsAttribs Options;
+    Options.PremultiplyAlpha = true;
+
+    const auto Dst = Convert(TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM, Src, TestWidth, TestHeight, Options);
+    for (size_t i = 0; i < Src.size(); i += 4)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            EXPECT_NEAR(Dst[i + c], Src[i + c] * Src[i + 3] / 255.f, 0.5f + 1e-3f);
+        EXPECT_EQ(Dst[i + 3], Src[i + 3]);
+    }
+
+    // sRGB values are premultiplied in linear space
+    const auto DstSRGB = Convert(TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_RGBA32_FLOAT, Src, TestWidth, TestHeight, Options);
+    for (size_t i = 0; i < Src.size(); i += 4)
+    {
+        float Val[4];
+        std::memcpy(Val, &DstSRGB[i * 4], sizeof(Val));
+        for (Uint32 c = 0; c < 3; ++c)
+            EXPECT_NEAR(Val[c], GammaToLinear(Src[i + c] / 255.f) * Src[i + 3] / 255.f, 1e-6f);
+    }
+}
+
+TEST(PixelFormatConversionTest, StridesAndFlip)
+{
+    const auto Src = GenerateRGBA8(TestWidth, TestHeight);
+
+    constexpr size_t DstStride = TestWidth * 16 + 48;
+
+    std::vector<Uint8> Dst(DstStride * TestHeight, 0xCD);
+
+    ConvertPixelsAttribs Attribs;
+    Attribs.SrcFormat      = TEX_FORMAT_RGBA8_UNORM;
+    Attribs.DstFormat      = TEX_FORMAT_RGBA32_FLOAT;
+    Attribs.Width          = TestWidth - 3;
+    Attribs.Height         = TestHeight;
+    Attribs.pSrcData       = Src.data();
+    Attribs.SrcStride      = TestWidth * 4;
+    Attribs.pDstData       = Dst.data();
+    Attribs.DstStride      = DstStride;
+    Attribs.FlipVertically = true;
+    ConvertPixels(Attribs);
+
+    for (Uint32 y = 0; y < TestHeight; ++y)
+    {
+        const auto* pSrcRow = &Src[size_t{TestHeight - 1 - y} * TestWidth * 4];
+        const auto* pDstRow = &Dst[y * DstStride];
+        for (Uint32 x = 0; x < TestWidth - 3; ++x)
+        {
+            float Val[4];
+            std::memcpy(Val, pDstRow + x * 16, sizeof(Val));
+            for (Uint32 c = 0; c < 4; ++c)
+                EXPECT_FLOAT_EQ(Val[c], pSrcRow[x * 4 + c] / 255.f);
+        }
+        // Padding must not be touched
+        for (size_t i = (TestWidth - 3) * 16; i < DstStride; ++i)
+            EXPECT_EQ(pDstRow[i], 0xCD);
+    }
+}
+
+TEST(PixelFormatConversionTest, ThreadPool)
+{
+    constexpr Uint32 Width  = 1024;
+    constexpr Uint32 Height = 512;
+
+    const auto Src = GenerateRGBA8(Width, Height);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    ConvertPixelsAttribs Options;
+    Options.PremultiplyAlpha = true;
+
+    for (auto DstFormat : {TEX_FORMAT_BGRA8_UNORM, TEX_FORMAT_RGBA16_FLOAT, TEX_FORMAT_R11G11B10_FLOAT})
+    {
+        Options.pThreadPool = nullptr;
+
+        Timer      T;
+        const auto Ref  = Convert(TEX_FORMAT_RGBA8_UNORM_SRGB, DstFormat, Src, Width, Height, Options);
+        const auto Time = T.GetElapsedTime();
+
+        Options.pThreadPool = pThreadPool;
+        T.Restart();
+        const auto MT     = Convert(TEX_FORMAT_RGBA8_UNORM_SRGB, DstFormat, Src, Width, Height, Options);
+        const auto MTTime = T.GetElapsedTime();
+
+        EXPECT_EQ(Ref, MT);
+        LOG_INFO_MESSAGE(GetTextureFormatAttribs(DstFormat).Name, ": ",
+                         Width * Height / std::max(Time, 1e-6) * 1e-6, " MPix/s (single thread), ",
+                         Width * Height / std::max(MTTime, 1e-6) * 1e-6, " MPix/s (thread pool)");
+    }
+}
+
+} // namespace
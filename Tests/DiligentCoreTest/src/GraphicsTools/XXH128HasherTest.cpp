@@ -25,9 +25,12 @@
  */
 
 #include "XXH128Hasher.hpp"
+#include "Timer.hpp"
 #include "gtest/gtest.h"
 #include <memory>
+#include <sstream>
 #include <unordered_set>
+#include <vector>
 
 using namespace Diligent;
 
@@ -76,4 +79,143 @@ TEST(XXH128HasherTest, Struct)
     EXPECT_EQ(Hasher1.Digest(), Hasher2.Digest());
 }
 
+struct TestPSOData
+{
+    LayoutElement              Elements[3];
+    ShaderResourceVariableDesc Variables[2];
+    ImmutableSamplerDesc       ImtblSamplers[1];
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    explicit TestPSOData(Uint32 Seed = 0)
+    {
+        Elements[0] = LayoutElement{0, 0, 3, VT_FLOAT32};
+        Elements[1] = LayoutElement{1, 0, 2, VT_FLOAT16};
+        Elements[2] = LayoutElement{2, 1, 4, VT_UINT8, True, INPUT_ELEMENT_FREQUENCY_PER_INSTANCE};
+
+        Variables[0] = ShaderResourceVariableDesc{SHADER_TYPE_PIXEL, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE};
+        Variables[1] = ShaderResourceVariableDesc{SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants", SHADER_RESOURCE_VARIABLE_TYPE_STATIC};
+
+        ImtblSamplers[0] = ImmutableSamplerDesc{SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{}};
+
+        auto& PSODesc = PSOCreateInfo.PSODesc;
+
+        PSODesc.Name                                    = "Test PSO";
+        PSODesc.ResourceLayout.DefaultVariableType      = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+        PSODesc.ResourceLayout.Variables                = Variables;
+        PSODesc.ResourceLayout.NumVariables             = _countof(Variables);
+        PSODesc.ResourceLayout.ImmutableSamplers        = ImtblSamplers;
+        PSODesc.ResourceLayout.NumImmutableSamplers     = _countof(ImtblSamplers);
+        PSOCreateInfo.GraphicsPipeline.NumRenderTargets = 2;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM_SRGB;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[1]    = TEX_FORMAT_R11G11B10_FLOAT;
+        PSOCreateInfo.GraphicsPipeline.DSVFormat        = TEX_FORMAT_D32_FLOAT;
+        PSOCreateInfo.GraphicsPipeline.InputLayout      = InputLayoutDesc{Elements, _countof(Elements)};
+        PSOCreateInfo.GraphicsPipeline.SampleMask       = 0xFFFF0000u | Seed;
+
+        PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode                = CULL_MODE_NONE;
+        PSOCreateInfo.GraphicsPipeline.BlendDesc.RenderTargets[0].BlendEnable = True;
+    }
+};
+
+// Hashes are used as persistent keys (e.g. by the render state cache),
+// so they must not change between runs and versions.
+TEST(XXH128HasherTest, Stability)
+{
+    auto ToString = [](const XXH128Hash& Hash) {
+        std::stringstream ss;
+        ss << std::hex << Hash.HighPart << "_" << Hash.LowPart;
+        return ss.str();
+    };
+
+    {
+        XXH128State Hasher;
+        Hasher.Update("Diligent Engine", 12345u, 1.5f, std::string{"XXH3"});
+        EXPECT_EQ(ToString(Hasher.Digest()), "8ad382776cfe3295_99198433b7267acb");
+    }
+
+    {
+        TestPSOData Data;
+
+        XXH128State Hasher;
+        Hasher.Update(Data.PSOCreateInfo);
+        EXPECT_EQ(ToString(Hasher.Digest()), "da6a5147cd62643_8bdda0a0a4d7aec3");
+    }
+
+    {
+        const Uint32 ByteCode[] = {0x07230203, 0x00010000, 0x0008000a, 0x00000010};
+
+        ShaderMacro Macros[] = {{"MACRO1", "1"}, {"MACRO2", "Value"}};
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.ByteCode        = ByteCode;
+        ShaderCI.ByteCodeSize    = sizeof(ByteCode);
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Test shader";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI.Macros          = {Macros, _countof(Macros)};
+
+        XXH128State Hasher;
+        Hasher.Update(ShaderCI);
+        EXPECT_EQ(ToString(Hasher.Digest()), "d8ae664ccbc4759c_3d42d185d357afab");
+    }
+}
+
+TEST(XXH128HasherTest, LargeData)
+{
+    std::vector<Uint8> Data(100000);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>((i * 7919u) >> 3u);
+
+    XXH128State RefHasher;
+    RefHasher.UpdateRaw(Data.data(), Data.size());
+    const auto RefHash = RefHasher.Digest();
+
+    // Small updates, large updates and updates that cross the internal buffer boundary
+    // must produce the same hash as a single update
+    for (size_t ChunkSize : {1, 7, 100, 4000, 16383, 16384, 16385, 50000})
+    {
+        XXH128State Hasher;
+        for (size_t Offset = 0; Offset < Data.size(); Offset += ChunkSize)
+            Hasher.UpdateRaw(&Data[Offset], std::min(ChunkSize, Data.size() - Offset));
+        EXPECT_EQ(Hasher.Digest(), RefHash) << ChunkSize;
+
+        // Digest must not affect the state
+        EXPECT_EQ(Hasher.Digest(), RefHash) << ChunkSize;
+
+        Hasher.Reset();
+        Hasher.UpdateRaw(Data.data(), 100);
+        XXH128State Hasher2;
+        Hasher2.UpdateRaw(Data.data(), 100);
+        EXPECT_EQ(Hasher.Digest(), Hasher2.Digest()) << ChunkSize;
+    }
+}
+
+TEST(XXH128HasherTest, DISABLED_Performance)
+{
+    constexpr Uint32 NumPSOs = 100000;
+
+    std::vector<TestPSOData> PSOs;
+    PSOs.reserve(256);
+    for (Uint32 i = 0; i < 256; ++i)
+        PSOs.emplace_back(i);
+
+    std::unordered_set<XXH128Hash> Hashes;
+
+    XXH128State Hasher;
+    Timer       T;
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        Hasher.Reset();
+        Hasher.Update(PSOs[i % PSOs.size()].PSOCreateInfo);
+        const auto Hash = Hasher.Digest();
+        if (i < PSOs.size())
+            EXPECT_TRUE(Hashes.insert(Hash).second);
+    }
+    const auto Time = T.GetElapsedTime();
+
+    LOG_INFO_MESSAGE("Hashed ", NumPSOs, " graphics pipeline create infos in ", Time * 1000, " ms (",
+                     Time / NumPSOs * 1e9, " ns per create info)");
+}
+
 } // namespace
@@ -0,0 +1,341 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GLSLangUtils.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr char CommonInc[] = R"(
+float4 GetColor()
+{
+#if USE_RED
+    return float4(1.0, 0.0, 0.0, 1.0);
+#else
+    return float4(0.0, 1.0, 0.0, 1.0);
+#endif
+}
+)";
+
+constexpr char ShaderPSH[] = R"(
+#include "Common.fxh"
+
+float4 main() : SV_Target
+{
+    return GetColor() * SCALE;
+}
+)";
+
+class GLSLangUtilsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+TEST_F(GLSLangUtilsTest, CompileSession)
+{
+    auto pShaderSourceFactory = CreateMemoryShaderSourceFactory({{"Common.fxh", CommonInc}, {"Shader.psh", ShaderPSH}});
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.FilePath                   = "Shader.psh";
+    ShaderCI.Desc                       = {"Compile session test", SHADER_TYPE_PIXEL};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    auto CompilePermutation = [&](GLSLangUtils::CompileSession& Session, bool UseRed, int Scale) {
+        const std::string ScaleStr = std::to_string(Scale);
+        const ShaderMacro Macros[] = {{"USE_RED", UseRed ? "1" : "0"}, {"SCALE", ScaleStr.c_str()}};
+        ShaderCreateInfo  CI       = ShaderCI;
+        CI.Macros                  = {Macros, _countof(Macros)};
+        return Session.HLSLtoSPIRV(CI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    };
+
+    GLSLangUtils::CompileSession Session;
+
+    const auto SPIRV0 = CompilePermutation(Session, true, 1);
+    EXPECT_FALSE(SPIRV0.empty());
+    const auto SPIRV1 = CompilePermutation(Session, false, 1);
+    EXPECT_FALSE(SPIRV1.empty());
+    EXPECT_NE(SPIRV0, SPIRV1);
+
+    {
+        const auto Stats = Session.GetStats();
+        EXPECT_EQ(Stats.NumCompilations, 2u);
+        EXPECT_EQ(Stats.NumFailedCompilations, 0u);
+        // Shader.psh and Common.fxh are each read once
+        EXPECT_EQ(Stats.NumIncludeCacheMisses, 2u);
+        EXPECT_EQ(Stats.NumIncludeCacheHits, 2u);
+        EXPECT_EQ(Stats.NumPreprocessCacheMisses, 2u);
+        EXPECT_EQ(Stats.NumPreprocessCacheHits, 0u);
+        EXPECT_GT(Stats.Timings.Parse, 0.0);
+    }
+
+    // Same permutation must hit the preprocess cache and produce the same bytecode
+    const auto SPIRV2 = CompilePermutation(Session, true, 1);
+    EXPECT_EQ(SPIRV0, SPIRV2);
+    EXPECT_EQ(Session.GetStats().NumPreprocessCacheHits, 1u);
+
+    // Compile many permutations concurrently
+    Session.ResetStats();
+
+    constexpr int            NumThreads               = 4;
+    constexpr int            NumPermutationsPerThread = 8;
+    std::vector<std::thread> Threads(NumThreads);
+    std::vector<bool>        Succeeded(NumThreads, false);
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread(
+            [&](int ThreadId) {
+                bool AllCompiled = true;
+                for (int i = 0; i < NumPermutationsPerThread; ++i)
+                {
+                    AllCompiled = AllCompiled && !CompilePermutation(Session, (i & 1) != 0, i / 2).empty();
+                }
+                Succeeded[ThreadId] = AllCompiled;
+            },
+            t);
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (int t = 0; t < NumThreads; ++t)
+        EXPECT_TRUE(Succeeded[t]) << "Thread " << t;
+
+    const auto Stats = Session.GetStats();
+    EXPECT_EQ(Stats.NumCompilations, Uint32{NumThreads * NumPermutationsPerThread});
+    EXPECT_EQ(Stats.NumFailedCompilations, 0u);
+    // All source files are already cached
+    EXPECT_EQ(Stats.NumIncludeCacheMisses, 0u);
+    EXPECT_EQ(Stats.NumPreprocessCacheHits + Stats.NumPreprocessCacheMisses, Stats.NumCompilations);
+    // Two of the permutations were compiled before. Threads may race to preprocess
+    // the remaining six, but each one is preprocessed at least once.
+    EXPECT_GE(Stats.NumPreprocessCacheMisses, 6u);
+    EXPECT_LE(Stats.NumPreprocessCacheMisses, Uint32{6 * NumThreads});
+}
+
+TEST_F(GLSLangUtilsTest, CompileSessionGLSL)
+{
+    constexpr char Source[] = R"(
+#version 450
+layout(location = 0) out vec4 Color;
+void main()
+{
+    Color = vec4(COLOR_R, 0.5, 0.25, 1.0);
+}
+)";
+
+    const ShaderMacro Macros[] = {{"COLOR_R", "0.75"}};
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+    Attribs.ShaderSource  = Source;
+    Attribs.SourceCodeLen = static_cast<int>(sizeof(Source) - 1);
+    Attribs.Macros        = {Macros, _countof(Macros)};
+
+    GLSLangUtils::CompileSession Session;
+
+    const auto SPIRV0 = Session.GLSLtoSPIRV(Attribs);
+    EXPECT_FALSE(SPIRV0.empty());
+    const auto SPIRV1 = Session.GLSLtoSPIRV(Attribs);
+    EXPECT_EQ(SPIRV0, SPIRV1);
+
+    const auto Stats = Session.GetStats();
+    EXPECT_EQ(Stats.NumCompilations, 2u);
+    EXPECT_EQ(Stats.NumPreprocessCacheMisses, 1u);
+    EXPECT_EQ(Stats.NumPreprocessCacheHits, 1u);
+}
+
+// Session compilation must produce exactly the same bytecode as the non-session functions
+TEST_F(GLSLangUtilsTest, CompileSessionMatchesNonSession)
+{
+    auto pShaderSourceFactory = CreateMemoryShaderSourceFactory({{"Common.fxh", CommonInc}, {"Shader.psh", ShaderPSH}});
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    GLSLangUtils::CompileSession Session;
+
+    // HLSL with an include file, macros and extra definitions that go to the preamble
+    for (const char* ExtraDefinitions : {static_cast<const char*>(nullptr), "#define SCALE_OVERRIDE 2\n"})
+    {
+        for (int UseRed = 0; UseRed < 2; ++UseRed)
+        {
+            const ShaderMacro Macros[] = {{"USE_RED", UseRed ? "1" : "0"}, {"SCALE", "3"}};
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.FilePath                   = "Shader.psh";
+            ShaderCI.Desc                       = {"Compile session test", SHADER_TYPE_PIXEL};
+            ShaderCI.EntryPoint                 = "main";
+            ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+            ShaderCI.Macros                     = {Macros, _countof(Macros)};
+
+            for (auto Version : {GLSLangUtils::SpirvVersion::Vk100, GLSLangUtils::SpirvVersion::Vk120})
+            {
+                const auto RefSPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, Version, ExtraDefinitions, nullptr);
+                ASSERT_FALSE(RefSPIRV.empty());
+                // The second session compilation uses the cached preprocessed source
+                for (int i = 0; i < 2; ++i)
+                    EXPECT_EQ(Session.HLSLtoSPIRV(ShaderCI, Version, ExtraDefinitions, nullptr), RefSPIRV);
+            }
+        }
+    }
+
+    // GLSL sources of the same length that only differ in the text must not share the preprocessed source
+    constexpr char SourceA[] = R"(
+#version 450
+layout(location = 0) out vec4 Color;
+void main()
+{
+    Color = vec4(COLOR_R, 0.5, 0.25, 1.0);
+}
+)";
+    constexpr char SourceB[] = R"(
+#version 450
+layout(location = 0) out vec4 Color;
+void main()
+{
+    Color = vec4(COLOR_R, 0.5, 0.75, 1.0);
+}
+)";
+    static_assert(sizeof(SourceA) == sizeof(SourceB), "Sources must have the same length");
+
+    std::vector<unsigned int> RefSPIRVs[2];
+    for (const char* Source : {SourceA, SourceB})
+    {
+        const ShaderMacro Macros[] = {{"COLOR_R", "0.125"}};
+
+        GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+        Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+        Attribs.ShaderSource  = Source;
+        Attribs.SourceCodeLen = static_cast<int>(sizeof(SourceA) - 1);
+        Attribs.Macros        = {Macros, _countof(Macros)};
+
+        const auto RefSPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+        ASSERT_FALSE(RefSPIRV.empty());
+        EXPECT_EQ(Session.GLSLtoSPIRV(Attribs), RefSPIRV);
+        RefSPIRVs[Source == SourceA ? 0 : 1] = RefSPIRV;
+    }
+    EXPECT_NE(RefSPIRVs[0], RefSPIRVs[1]);
+}
+
+// Compilations that run concurrently through one session must produce the same bytecode
+// as the non-session functions, whether they preprocess the source or hit the cache.
+TEST_F(GLSLangUtilsTest, CompileSessionConcurrentMatchesNonSession)
+{
+    auto pShaderSourceFactory = CreateMemoryShaderSourceFactory({{"Common.fxh", CommonInc}, {"Shader.psh", ShaderPSH}});
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    constexpr int NumPermutations = 8;
+    constexpr int NumVersions     = 2;
+
+    const GLSLangUtils::SpirvVersion Versions[NumVersions] = {GLSLangUtils::SpirvVersion::Vk100, GLSLangUtils::SpirvVersion::Vk120};
+
+    auto Compile = [&](GLSLangUtils::CompileSession* pSession, int Permutation, GLSLangUtils::SpirvVersion Version) {
+        const std::string ScaleStr = std::to_string(Permutation / 2 + 1);
+        const ShaderMacro Macros[] = {{"USE_RED", (Permutation & 1) != 0 ? "1" : "0"}, {"SCALE", ScaleStr.c_str()}};
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.FilePath                   = "Shader.psh";
+        ShaderCI.Desc                       = {"Compile session test", SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+        ShaderCI.Macros                     = {Macros, _countof(Macros)};
+        return pSession != nullptr ?
+            pSession->HLSLtoSPIRV(ShaderCI, Version, nullptr, nullptr) :
+            GLSLangUtils::HLSLtoSPIRV(ShaderCI, Version, nullptr, nullptr);
+    };
+
+    std::vector<unsigned int> RefSPIRVs[NumPermutations][NumVersions];
+    for (int p = 0; p < NumPermutations; ++p)
+    {
+        for (int v = 0; v < NumVersions; ++v)
+        {
+            RefSPIRVs[p][v] = Compile(nullptr, p, Versions[v]);
+            ASSERT_FALSE(RefSPIRVs[p][v].empty());
+        }
+    }
+
+    GLSLangUtils::CompileSession Session;
+
+    // Every thread compiles all permutations for both SPIR-V versions in its own order,
+    // so the same permutation is preprocessed by one thread and taken from the cache by others.
+    constexpr int            NumThreads = 4;
+    constexpr int            NumRounds  = 2;
+    std::vector<std::thread> Threads(NumThreads);
+    std::vector<int>         NumMismatches(NumThreads, 0);
+    for (int t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread(
+            [&](int ThreadId) {
+                for (int r = 0; r < NumRounds; ++r)
+                {
+                    for (int i = 0; i < NumPermutations * NumVersions; ++i)
+                    {
+                        const int Idx = (i + ThreadId * 3) % (NumPermutations * NumVersions);
+                        const int p   = Idx / NumVersions;
+                        const int v   = Idx % NumVersions;
+                        if (Compile(&Session, p, Versions[v]) != RefSPIRVs[p][v])
+                            ++NumMismatches[ThreadId];
+                    }
+                }
+            },
+            t);
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (int t = 0; t < NumThreads; ++t)
+        EXPECT_EQ(NumMismatches[t], 0) << "Thread " << t;
+
+    const auto Stats = Session.GetStats();
+    EXPECT_EQ(Stats.NumCompilations, Uint32{NumThreads * NumRounds * NumPermutations * NumVersions});
+    EXPECT_EQ(Stats.NumFailedCompilations, 0u);
+    EXPECT_EQ(Stats.NumPreprocessCacheHits + Stats.NumPreprocessCacheMisses, Stats.NumCompilations);
+    // Both SPIR-V versions share the preprocessed source of a permutation
+    EXPECT_GE(Stats.NumPreprocessCacheMisses, Uint32{NumPermutations});
+    EXPECT_GT(Stats.NumPreprocessCacheHits, 0u);
+}
+
+} // namespace
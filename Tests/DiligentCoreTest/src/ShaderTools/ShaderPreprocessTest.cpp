@@ -25,6 +25,8 @@
  */
 
 #include <deque>
+#include <thread>
+#include <vector>
 
 #include "ShaderToolsCommon.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
@@ -194,6 +196,56 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+TEST(ShaderPreprocessTest, PrefetchIncludes)
+{
+    DefaultShaderSourceStreamFactoryCreateInfo FactoryCI;
+    FactoryCI.SearchDirectories = "shaders/ShaderPreprocessor";
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory(FactoryCI, &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    FactoryCI.PrefetchIncludes = True;
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pPrefetchFactory;
+    CreateDefaultShaderSourceStreamFactory(FactoryCI, &pPrefetchFactory);
+    ASSERT_NE(pPrefetchFactory, nullptr);
+
+    constexpr const char* FilePaths[] = {
+        "InlineIncludeShaderTest.hlsl",
+        "IncludeBasicTest.hlsl",
+        "IncludeWhiteSpaceTest.hlsl",
+        "IncludeCommentsMultiLineTest.hlsl",
+    };
+    constexpr size_t NumFiles = _countof(FilePaths);
+
+    auto Unroll = [](IShaderSourceInputStreamFactory* pFactory, const char* FilePath) {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.Name                  = "TestShader";
+        ShaderCI.FilePath                   = FilePath;
+        ShaderCI.pShaderSourceStreamFactory = pFactory;
+        return UnrollShaderIncludes(ShaderCI);
+    };
+
+    std::vector<std::string> RefStrings;
+    for (const char* FilePath : FilePaths)
+        RefStrings.emplace_back(Unroll(pShaderSourceFactory, FilePath));
+
+    // Compilations that run concurrently and share the factory must not affect each other
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < 4; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < 64; ++i)
+            {
+                const size_t FileIdx = (t + i) % NumFiles;
+                EXPECT_EQ(Unroll(pPrefetchFactory, FilePaths[FileIdx]), RefStrings[FileIdx]) << FilePaths[FileIdx];
+            }
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
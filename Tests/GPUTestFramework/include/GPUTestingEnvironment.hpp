@@ -64,6 +64,17 @@ public:
         DeviceFeaturesVk FeaturesVk{DEVICE_FEATURE_STATE_OPTIONAL};
 
         DebugMessageCallbackType MessageCallback = TestingEnvironment::MessageCallback;
+
+        CreateInfo()
+        {
+            // Descriptor buffers can't be used with sparse resources, so they are only
+            // enabled by the --Features.DescriptorBuffer=On command line argument
+            FeaturesVk.DescriptorBuffer = DEVICE_FEATURE_STATE_DISABLED;
+
+            // Graphics pipeline libraries change how every graphics pipeline is created, so they
+            // are only enabled by the --Features.GraphicsPipelineLibrary=On command line argument
+            FeaturesVk.GraphicsPipelineLibrary = DEVICE_FEATURE_STATE_DISABLED;
+        }
     };
     GPUTestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc);
 
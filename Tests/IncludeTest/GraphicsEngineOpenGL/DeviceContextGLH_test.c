@@ -33,4 +33,10 @@ void TestDeviceContextGL_CInterface(IDeviceContextGL* pCtxGL)
     (void)res;
     IDeviceContextGL_PurgeCurrentGLContextCaches(pCtxGL);
     IDeviceContextGL_SetSwapChain(pCtxGL, (struct ISwapChainGL*)NULL);
+
+    VAOCacheStatsGL Stats;
+    IDeviceContextGL_GetVAOCacheStats(pCtxGL, &Stats);
+
+    ResourceBindingStatsGL BindingStats;
+    IDeviceContextGL_GetResourceBindingStats(pCtxGL, &BindingStats);
 }
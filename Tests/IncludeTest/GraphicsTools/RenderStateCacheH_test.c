@@ -49,4 +49,6 @@ void TestRenderStateCacheCInterface()
     IRenderStateCache_Reload(pCache, NULL, NULL);
     Uint32 Ver = IRenderStateCache_GetContentVersion(pCache);
     (void)Ver;
+    RenderStateCacheReloadStats Stats;
+    IRenderStateCache_GetLastReloadStats(pCache, &Stats);
 }